@@ -67,9 +67,119 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
   #endif
   #include <limits>
   #if !defined(SOFT_DOUBLE_DISABLE_IOSTREAM)
+  #include <locale>
   #include <sstream>
+  #include <string>
   #endif
   #include <type_traits>
+  #if defined(__has_include)
+  #if (__has_include(<version>) != 0)
+  #include <version>
+  #endif
+  #endif
+  #if (defined(__cpp_lib_bitops) && (__cpp_lib_bitops >= 201907L))
+  #include <bit>
+  #endif
+
+  // Select the backend used to count leading zeros when normalizing.
+  // This is 2 for std::countl_zero (C++20), 1 for the GCC/clang builtin
+  // __builtin_clzll or 0 for the portable nibble table (which is also
+  // kept for small 8/16-bit targets). The user may predefine
+  // SOFT_DOUBLE_CLZ_BACKEND in order to override the choice.
+
+  #if !defined(SOFT_DOUBLE_CLZ_BACKEND)
+  #if (defined(__cpp_lib_bitops) && (__cpp_lib_bitops >= 201907L))
+  #define SOFT_DOUBLE_CLZ_BACKEND 2 // NOLINT(cppcoreguidelines-macro-usage)
+  #elif ((defined(__GNUC__) || defined(__clang__)) && !defined(__AVR__))
+  #define SOFT_DOUBLE_CLZ_BACKEND 1 // NOLINT(cppcoreguidelines-macro-usage)
+  #else
+  #define SOFT_DOUBLE_CLZ_BACKEND 0 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #endif
+
+  // Select the backend used for the full 64x64->128-bit product
+  // that lies at the heart of multiplication. A native 128-bit
+  // unsigned integer is preferred. The MSVC x64 intrinsic _umul128
+  // is used at run-time if available. Otherwise (or if the user
+  // defines SOFT_DOUBLE_DISABLE_NATIVE_UINT128) the portable
+  // 32x32->64-bit schoolbook product is used.
+
+  #if (!defined(SOFT_DOUBLE_DISABLE_NATIVE_UINT128) && defined(__SIZEOF_INT128__))
+  #define SOFT_DOUBLE_HAS_NATIVE_UINT128 1 // NOLINT(cppcoreguidelines-macro-usage)
+  #else
+  #define SOFT_DOUBLE_HAS_NATIVE_UINT128 0 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  #if (   (SOFT_DOUBLE_HAS_NATIVE_UINT128 == 0)                                \
+       && !defined(SOFT_DOUBLE_DISABLE_NATIVE_UINT128)                         \
+       && (defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__))        \
+       && (defined(__cpp_lib_is_constant_evaluated) && (__cpp_lib_is_constant_evaluated >= 201811L)))
+  #include <intrin.h>
+  #define SOFT_DOUBLE_HAS_UMUL128 1 // NOLINT(cppcoreguidelines-macro-usage)
+  #else
+  #define SOFT_DOUBLE_HAS_UMUL128 0 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  // The alternate division kernel refines the reciprocal to 64 bits
+  // with full 128-bit products. It is available whenever a fast 128-bit
+  // product is, and it is used in f64_div if the user defines
+  // SOFT_DOUBLE_ENABLE_WIDE_DIVISION. The default remains the 32-bit
+  // kernel, which is as fast or faster on hosts with a quick hardware
+  // divider (since both kernels begin with one hardware division).
+
+  #if (   defined(SOFT_DOUBLE_ENABLE_WIDE_DIVISION)                            \
+       && ((SOFT_DOUBLE_HAS_NATIVE_UINT128 == 1) || (SOFT_DOUBLE_HAS_UMUL128 == 1)))
+  #define SOFT_DOUBLE_HAS_WIDE_DIVISION 1 // NOLINT(cppcoreguidelines-macro-usage)
+  #else
+  #define SOFT_DOUBLE_HAS_WIDE_DIVISION 0 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  // The alternate exponential function multiplies an entry of a table
+  // of 2^(j/N) by a short polynomial and needs no division. It is used
+  // if the user defines SOFT_DOUBLE_ENABLE_TABLE_EXP. The table has
+  // N = 2^SOFT_DOUBLE_EXP_TABLE_BITS entries of 8 bytes each, and is
+  // generated at compile time. Table bits in the range [3, 10] are
+  // supported. Larger tables need fewer polynomial terms. The default
+  // of 5 bits (32 entries, 256 bytes) suits flash-constrained targets.
+  // The same table backs the fixed-point cores of pow and exp2, which
+  // are used in every configuration.
+
+  #if defined(SOFT_DOUBLE_ENABLE_TABLE_EXP)
+  #define SOFT_DOUBLE_HAS_TABLE_EXP 1 // NOLINT(cppcoreguidelines-macro-usage)
+  #else
+  #define SOFT_DOUBLE_HAS_TABLE_EXP 0 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  #if !defined(SOFT_DOUBLE_EXP_TABLE_BITS)
+  #define SOFT_DOUBLE_EXP_TABLE_BITS 5 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  #if ((SOFT_DOUBLE_EXP_TABLE_BITS < 3) || (SOFT_DOUBLE_EXP_TABLE_BITS > 10))
+  #error Configuration error regarding SOFT_DOUBLE_EXP_TABLE_BITS
+  #endif
+
+  // The alternate logarithm function multiplies the argument by a tabulated
+  // reciprocal, indexed on the top bits of its mantissa, and needs no
+  // division. It is used if the user defines SOFT_DOUBLE_ENABLE_TABLE_LOG.
+  // The table has N = 2^SOFT_DOUBLE_LOG_TABLE_BITS entries of 24 bytes each
+  // (the reciprocal and its logarithm), and is generated at compile time.
+  // Table bits in the range [3, 10] are supported, with the default being 5.
+  // The fixed-point cores of pow, log2 and log10 use this table in every
+  // configuration.
+
+  #if defined(SOFT_DOUBLE_ENABLE_TABLE_LOG)
+  #define SOFT_DOUBLE_HAS_TABLE_LOG 1 // NOLINT(cppcoreguidelines-macro-usage)
+  #else
+  #define SOFT_DOUBLE_HAS_TABLE_LOG 0 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  #if !defined(SOFT_DOUBLE_LOG_TABLE_BITS)
+  #define SOFT_DOUBLE_LOG_TABLE_BITS 5 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  #if ((SOFT_DOUBLE_LOG_TABLE_BITS < 3) || (SOFT_DOUBLE_LOG_TABLE_BITS > 10))
+  #error Configuration error regarding SOFT_DOUBLE_LOG_TABLE_BITS
+  #endif
 
   #if (defined(__clang__) && (__clang_major__ <= 9))
   #define SOFT_DOUBLE_NUM_LIMITS_CLASS_TYPE struct // NOLINT(cppcoreguidelines-macro-usage)
@@ -104,6 +214,46 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
   // Forward declaration the math::softfloat::soft_double class.
   class soft_double;
 
+  // Forward declaration of the class template having a fixed rounding policy.
+  template<typename RoundingPolicy>
+  class basic_soft_double;
+
+  // Forward declaration of the interval class.
+  class soft_interval;
+
+  // The formats of the character conversion with to_chars. These and
+  // the result type mirror those of <charconv> and are defined here,
+  // since <charconv> is not available on all targets.
+  enum class chars_format : std::uint8_t
+  {
+    scientific = UINT8_C(1),
+    fixed      = UINT8_C(2),
+    hex        = UINT8_C(4),
+    general    = UINT8_C(3)
+  };
+
+  // The error codes of the character conversion. The value-initialized
+  // code chars_errc { } indicates success.
+  enum class chars_errc : std::uint8_t
+  {
+    ok,
+    invalid_argument,
+    value_too_large,
+    result_out_of_range
+  };
+
+  struct to_chars_result
+  {
+    char*      ptr; // NOLINT(misc-non-private-member-variables-in-classes)
+    chars_errc ec;  // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  struct from_chars_result
+  {
+    const char* ptr; // NOLINT(misc-non-private-member-variables-in-classes)
+    chars_errc  ec;  // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
   #if(__cplusplus >= 201703L)
   } // namespace math::softfloat
   #else
@@ -156,6 +306,220 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     std::uint64_t v1; // NOLINT(misc-non-private-member-variables-in-classes)
   };
 
+  #if (SOFT_DOUBLE_HAS_NATIVE_UINT128 == 1)
+  __extension__ typedef unsigned __int128 uint128_native; // NOLINT(modernize-use-using)
+  #endif
+
+  constexpr auto softfloat_mul64To128_portable(std::uint64_t a, std::uint64_t b) -> uint128_compound
+  {
+    // Returns the 128-bit product of a and b, computed from
+    // four 32x32->64-bit partial products.
+
+    const auto a32 = static_cast<std::uint32_t>(a >> static_cast<unsigned>(UINT8_C(32)));
+    const auto a0  = static_cast<std::uint32_t>(a);
+    const auto b32 = static_cast<std::uint32_t>(b >> static_cast<unsigned>(UINT8_C(32)));
+    const auto b0  = static_cast<std::uint32_t>(b);
+
+    const auto mid1 = static_cast<std::uint64_t>(                                  (static_cast<std::uint64_t>(a32)) * b0);
+          auto mid  = static_cast<std::uint64_t>(mid1 + static_cast<std::uint64_t>((static_cast<std::uint64_t>(b32)) * a0));
+
+    auto z =
+      uint128_compound
+      {
+        static_cast<std::uint64_t>(static_cast<std::uint64_t>(a0)  * b0),
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(static_cast<std::uint64_t>(a32) * b32)
+          + static_cast<std::uint32_t>(mid >> static_cast<unsigned>(UINT8_C(32)))
+        )
+      };
+
+    if(mid < mid1)
+    {
+      z.v1 =
+        static_cast<std::uint64_t>
+        (
+             z.v1
+          +  static_cast<std::uint64_t>(UINT64_C(0x100000000))
+        );
+    }
+
+    mid = static_cast<std::uint64_t>(mid << static_cast<unsigned>(UINT8_C(32)));
+
+    z.v0 = static_cast<std::uint64_t>(z.v0 + mid);
+
+    z.v1 =
+      static_cast<std::uint64_t>
+      (
+          z.v1
+        + static_cast<std::uint_fast8_t>
+          (
+            (z.v0 < mid)
+              ? static_cast<std::uint_fast8_t>(UINT8_C(1))
+              : static_cast<std::uint_fast8_t>(UINT8_C(0))
+          )
+      );
+
+    return z;
+  }
+
+  constexpr auto softfloat_mul64To128(std::uint64_t a, std::uint64_t b) -> uint128_compound
+  {
+    // Returns the 128-bit product of a and b using the backend
+    // selected at compile-time (see SOFT_DOUBLE_HAS_NATIVE_UINT128
+    // and SOFT_DOUBLE_HAS_UMUL128).
+
+    #if (SOFT_DOUBLE_HAS_NATIVE_UINT128 == 1)
+    const auto p = static_cast<uint128_native>(static_cast<uint128_native>(a) * b);
+
+    return
+      uint128_compound
+      {
+        static_cast<std::uint64_t>(p),
+        static_cast<std::uint64_t>(p >> static_cast<unsigned>(UINT8_C(64)))
+      };
+    #elif (SOFT_DOUBLE_HAS_UMUL128 == 1)
+    if(std::is_constant_evaluated())
+    {
+      return softfloat_mul64To128_portable(a, b);
+    }
+
+    auto hi = std::uint64_t { };
+
+    const auto lo = static_cast<std::uint64_t>(_umul128(a, b, &hi));
+
+    return uint128_compound { lo, hi };
+    #else
+    return softfloat_mul64To128_portable(a, b);
+    #endif
+  }
+
+  constexpr auto softfloat_add128(const uint128_compound& a, const uint128_compound& b) -> uint128_compound
+  {
+    // Returns the 128-bit sum a + b (modulo 2^128).
+    return
+      uint128_compound
+      {
+        static_cast<std::uint64_t>(a.v0 + b.v0),
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(a.v1 + b.v1)
+          + static_cast<std::uint64_t>
+            (
+              (static_cast<std::uint64_t>(a.v0 + b.v0) < a.v0) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0))
+            )
+        )
+      };
+  }
+
+  constexpr auto softfloat_sub128(const uint128_compound& a, const uint128_compound& b) -> uint128_compound
+  {
+    // Returns the 128-bit difference a - b (modulo 2^128).
+    return
+      uint128_compound
+      {
+        static_cast<std::uint64_t>(a.v0 - b.v0),
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(a.v1 - b.v1)
+          - static_cast<std::uint64_t>
+            (
+              (a.v0 < b.v0) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0))
+            )
+        )
+      };
+  }
+
+  constexpr auto softfloat_shortShiftLeft128(const uint128_compound& a, std::uint_fast8_t dist) -> uint128_compound
+  {
+    // Shifts the 128 bits of a left by the number of bits given in dist,
+    // which must be in the range 0 to 63.
+    return
+      (dist == static_cast<std::uint_fast8_t>(UINT8_C(0)))
+        ? a
+        : uint128_compound
+          {
+            static_cast<std::uint64_t>(a.v0 << static_cast<unsigned>(dist)),
+            static_cast<std::uint64_t>
+            (
+                static_cast<std::uint64_t>(a.v1 << static_cast<unsigned>(dist))
+              | static_cast<std::uint64_t>(a.v0 >> static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - dist))
+            )
+          };
+  }
+
+  constexpr auto softfloat_shortShiftRightJam128(const uint128_compound& a, std::uint_fast8_t dist) -> uint128_compound
+  {
+    // Shifts the 128 bits of a right by the number of bits given in dist,
+    // which must be in the range 1 to 63. If any nonzero bits are shifted
+    // off, they are jammed into the least-significant bit of the result.
+    return
+      uint128_compound
+      {
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(a.v1 << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - dist))
+          | static_cast<std::uint64_t>(a.v0 >> static_cast<unsigned>(dist))
+          | static_cast<std::uint64_t>
+            (
+              (static_cast<std::uint64_t>(a.v0 << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - dist)) != static_cast<std::uint64_t>(UINT8_C(0)))
+                ? static_cast<unsigned>(UINT8_C(1))
+                : static_cast<unsigned>(UINT8_C(0))
+            )
+        ),
+        static_cast<std::uint64_t>(a.v1 >> static_cast<unsigned>(dist))
+      };
+  }
+
+  constexpr auto softfloat_shiftRightJam128(const uint128_compound& a, std::uint_fast16_t dist) -> uint128_compound
+  {
+    // Shifts the 128 bits of a right by the number of bits given in dist,
+    // which must not be zero. If any nonzero bits are shifted off, they are
+    // jammed into the least-significant bit of the result. The value of dist
+    // can be arbitrarily large.
+    return
+      (dist < static_cast<std::uint_fast16_t>(UINT8_C(64)))
+        ? softfloat_shortShiftRightJam128(a, static_cast<std::uint_fast8_t>(dist))
+        : uint128_compound
+          {
+            static_cast<std::uint64_t>
+            (
+              (dist < static_cast<std::uint_fast16_t>(UINT8_C(127)))
+                ? static_cast<std::uint64_t>
+                  (
+                      static_cast<std::uint64_t>(a.v1 >> static_cast<unsigned>(dist & static_cast<std::uint_fast16_t>(UINT8_C(63))))
+                    | static_cast<std::uint64_t>
+                      (
+                        (
+                          static_cast<std::uint64_t>
+                          (
+                              static_cast<std::uint64_t>
+                              (
+                                  a.v1
+                                & static_cast<std::uint64_t>
+                                  (
+                                      static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(dist & static_cast<std::uint_fast16_t>(UINT8_C(63))))
+                                    - static_cast<std::uint64_t>(UINT8_C(1))
+                                  )
+                              )
+                            | a.v0
+                          ) != static_cast<std::uint64_t>(UINT8_C(0))
+                        )
+                          ? static_cast<unsigned>(UINT8_C(1))
+                          : static_cast<unsigned>(UINT8_C(0))
+                      )
+                  )
+                : static_cast<std::uint64_t>
+                  (
+                    (static_cast<std::uint64_t>(a.v1 | a.v0) != static_cast<std::uint64_t>(UINT8_C(0)))
+                      ? static_cast<unsigned>(UINT8_C(1))
+                      : static_cast<unsigned>(UINT8_C(0))
+                  )
+            ),
+            static_cast<std::uint64_t>(UINT8_C(0))
+          };
+  }
+
   template<typename UnsignedIntegralType>
   constexpr auto negate(UnsignedIntegralType u) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
                                                                            && std::is_unsigned<UnsignedIntegralType>::value, UnsignedIntegralType>::type
@@ -183,6 +547,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
   constexpr auto expF64UI (std::uint64_t a) -> std::int16_t  { return static_cast<std::int16_t>(static_cast<std::int16_t>(a >> static_cast<unsigned>(UINT8_C(52))) & static_cast<std::int16_t>(INT16_C(0x7FF))); } // NOLINT(hicpp-signed-bitwise)
   constexpr auto fracF64UI(std::uint64_t a) -> std::uint64_t { return static_cast<std::uint64_t>(a & static_cast<std::uint64_t>(UINT64_C(0x000FFFFFFFFFFFFF))); }
 
+  constexpr auto isNaNF64UI(std::uint64_t a) -> bool { return ((expF64UI(a) == static_cast<std::int16_t>(INT16_C(0x7FF))) && (fracF64UI(a) != static_cast<std::uint64_t>(UINT8_C(0)))); }
+  constexpr auto isZeroF64UI(std::uint64_t a) -> bool { return (static_cast<std::uint64_t>(a & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF))) == static_cast<std::uint64_t>(UINT8_C(0))); }
+
   template<typename IntegralTypeExp,
            typename IntegralTypeSig>
   constexpr auto packToF64UI(bool sign, IntegralTypeExp expA, IntegralTypeSig sig) -> std::uint64_t
@@ -294,6 +661,24 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
   constexpr auto softfloat_countLeadingZeros32(std::uint32_t a) -> std::uint_fast8_t
   {
+    // Returns the number of leading 0 bits before the most-significant 1 bit
+    // of a. If a is zero, 32 is returned.
+
+    #if (SOFT_DOUBLE_CLZ_BACKEND == 2)
+    return static_cast<std::uint_fast8_t>(std::countl_zero(a));
+    #elif (SOFT_DOUBLE_CLZ_BACKEND == 1)
+    return
+      static_cast<std::uint_fast8_t>
+      (
+        (a == static_cast<std::uint32_t>(UINT8_C(0)))
+          ? static_cast<std::uint_fast8_t>(UINT8_C(32))
+          : static_cast<std::uint_fast8_t>
+            (
+                static_cast<unsigned>(__builtin_clzll(static_cast<unsigned long long>(a))) // NOLINT(google-runtime-int)
+              - static_cast<unsigned>(std::numeric_limits<unsigned long long>::digits - 32) // NOLINT(google-runtime-int)
+            )
+      );
+    #else
     return
       static_cast<std::uint_fast8_t>
       (
@@ -305,10 +690,29 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
             )
           :     softfloat_countLeadingZeros16(static_cast<std::uint16_t>(a >> static_cast<unsigned>(UINT8_C(16))))
       );
+    #endif
   }
 
   constexpr auto softfloat_countLeadingZeros64(std::uint64_t a) -> std::uint_fast8_t
   {
+    // Returns the number of leading 0 bits before the most-significant 1 bit
+    // of a. If a is zero, 64 is returned.
+
+    #if (SOFT_DOUBLE_CLZ_BACKEND == 2)
+    return static_cast<std::uint_fast8_t>(std::countl_zero(a));
+    #elif (SOFT_DOUBLE_CLZ_BACKEND == 1)
+    return
+      static_cast<std::uint_fast8_t>
+      (
+        (a == static_cast<std::uint64_t>(UINT8_C(0)))
+          ? static_cast<std::uint_fast8_t>(UINT8_C(64))
+          : static_cast<std::uint_fast8_t>
+            (
+                static_cast<unsigned>(__builtin_clzll(static_cast<unsigned long long>(a))) // NOLINT(google-runtime-int)
+              - static_cast<unsigned>(std::numeric_limits<unsigned long long>::digits - 64) // NOLINT(google-runtime-int)
+            )
+      );
+    #else
     return
       static_cast<std::uint_fast8_t>
       (
@@ -320,6 +724,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
             )
           :     softfloat_countLeadingZeros32(static_cast<std::uint32_t>(a >> static_cast<unsigned>(UINT8_C(32))))
       );
+    #endif
   }
 
   constexpr auto softfloat_approxRecip32_1(std::uint32_t a) -> std::uint32_t
@@ -335,6 +740,116 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
       );
   }
 
+  constexpr auto softfloat_approxRecipSqrt32_1(std::uint32_t oddExpA, std::uint32_t a) -> std::uint32_t
+  {
+    // Returns an approximation to the reciprocal of the square root of the number
+    // represented by a, where a is interpreted as an unsigned fixed-point
+    // number either with one integer bit and 31 fraction bits or with two integer
+    // bits and 30 fraction bits.
+    using softfloat_approx_recip_sqrt_array_type = std::array<std::uint16_t, static_cast<std::size_t>(UINT8_C(16))>;
+
+    constexpr auto softfloat_approxRecipSqrt_1k0s =
+      softfloat_approx_recip_sqrt_array_type
+      {
+        static_cast<std::uint16_t>(UINT16_C(0xB4C9)), static_cast<std::uint16_t>(UINT16_C(0xFFAB)), static_cast<std::uint16_t>(UINT16_C(0xAA7D)), static_cast<std::uint16_t>(UINT16_C(0xF11C)),
+        static_cast<std::uint16_t>(UINT16_C(0xA1C5)), static_cast<std::uint16_t>(UINT16_C(0xE4C7)), static_cast<std::uint16_t>(UINT16_C(0x9A43)), static_cast<std::uint16_t>(UINT16_C(0xDA29)),
+        static_cast<std::uint16_t>(UINT16_C(0x93B5)), static_cast<std::uint16_t>(UINT16_C(0xD0E5)), static_cast<std::uint16_t>(UINT16_C(0x8DED)), static_cast<std::uint16_t>(UINT16_C(0xC8B7)),
+        static_cast<std::uint16_t>(UINT16_C(0x88C6)), static_cast<std::uint16_t>(UINT16_C(0xC16D)), static_cast<std::uint16_t>(UINT16_C(0x8424)), static_cast<std::uint16_t>(UINT16_C(0xBAE1))
+      };
+
+    constexpr auto softfloat_approxRecipSqrt_1k1s =
+      softfloat_approx_recip_sqrt_array_type
+      {
+        static_cast<std::uint16_t>(UINT16_C(0xA5A5)), static_cast<std::uint16_t>(UINT16_C(0xEA42)), static_cast<std::uint16_t>(UINT16_C(0x8C21)), static_cast<std::uint16_t>(UINT16_C(0xC62D)),
+        static_cast<std::uint16_t>(UINT16_C(0x788F)), static_cast<std::uint16_t>(UINT16_C(0xAA7F)), static_cast<std::uint16_t>(UINT16_C(0x6928)), static_cast<std::uint16_t>(UINT16_C(0x94B6)),
+        static_cast<std::uint16_t>(UINT16_C(0x5CC7)), static_cast<std::uint16_t>(UINT16_C(0x8335)), static_cast<std::uint16_t>(UINT16_C(0x52A6)), static_cast<std::uint16_t>(UINT16_C(0x74E2)),
+        static_cast<std::uint16_t>(UINT16_C(0x4A3E)), static_cast<std::uint16_t>(UINT16_C(0x68FE)), static_cast<std::uint16_t>(UINT16_C(0x432B)), static_cast<std::uint16_t>(UINT16_C(0x5EFD))
+      };
+
+    const auto index  =
+      static_cast<std::int16_t>
+      (
+          static_cast<std::uint32_t>
+          (
+            static_cast<std::uint32_t>(a >> static_cast<unsigned>(UINT8_C(27))) & static_cast<std::uint32_t>(UINT8_C(0xE))
+          )
+        + oddExpA
+      );
+
+    const auto eps = static_cast<std::uint16_t>(a >> static_cast<unsigned>(UINT8_C(12)));
+
+    const auto r0 =
+      static_cast<std::uint16_t>
+      (
+          softfloat_approxRecipSqrt_1k0s[static_cast<std::size_t>(index)] // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        - static_cast<std::uint16_t>
+          (
+            static_cast<std::uint32_t>
+            (
+                softfloat_approxRecipSqrt_1k1s[static_cast<std::size_t>(index)] // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+              * static_cast<std::uint32_t>(eps)
+            ) >> static_cast<unsigned>(UINT8_C(20))
+          )
+      );
+
+    auto ESqrR0 = static_cast<std::uint32_t>(static_cast<std::uint32_t>(r0) * r0);
+
+    if(oddExpA == static_cast<std::uint32_t>(UINT8_C(0)))
+    {
+      ESqrR0 <<= static_cast<unsigned>(UINT8_C(1));
+    }
+
+    const auto sigma0 =
+      static_cast<std::uint32_t>
+      (
+        ~static_cast<std::uint32_t>
+         (
+           static_cast<std::uint64_t>(ESqrR0 * static_cast<std::uint64_t>(a)) >> static_cast<unsigned>(UINT8_C(23))
+         )
+      );
+
+    auto r =
+      static_cast<std::uint32_t>
+      (
+          static_cast<std::uint32_t>(static_cast<std::uint32_t>(r0) << static_cast<unsigned>(UINT8_C(16)))
+        + static_cast<std::uint32_t>(static_cast<std::uint64_t>(r0 * static_cast<std::uint64_t>(sigma0)) >> static_cast<unsigned>(UINT8_C(25)))
+      );
+
+    r +=
+      static_cast<std::uint32_t>
+      (
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint32_t>
+            (
+                static_cast<std::uint32_t>
+                (
+                  static_cast<std::uint64_t>(r >> static_cast<unsigned>(UINT8_C(1))) + static_cast<std::uint32_t>(r >> static_cast<unsigned>(UINT8_C(3)))
+                )
+              - static_cast<std::uint32_t>
+                (
+                  static_cast<std::uint32_t>(r0) << static_cast<unsigned>(UINT8_C(14))
+                )
+            )
+          *
+            static_cast<std::uint64_t>
+            (
+              static_cast<std::uint32_t>
+              (
+                static_cast<std::uint64_t>(static_cast<std::uint64_t>(sigma0) * sigma0) >> static_cast<unsigned>(UINT8_C(32))
+              )
+            )
+        ) >> static_cast<unsigned>(UINT8_C(48))
+      );
+
+    if(static_cast<std::uint32_t>(r & static_cast<std::uint32_t>(UINT32_C(0x80000000))) == static_cast<std::uint32_t>(UINT8_C(0)))
+    {
+      r = static_cast<std::uint32_t>(UINT32_C(0x80000000));
+    }
+
+    return r;
+  }
+
   constexpr auto softfloat_shiftRightJam64Extra(std::uint64_t a,
                                                 std::uint64_t extra,
                                                 std::uint32_t dist) -> uint128_compound
@@ -386,862 +901,5980 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
       };
   }
 
-  #if (defined(SOFT_DOUBLE_CONSTEXPR_BUILTIN_FLOATS) && (SOFT_DOUBLE_CONSTEXPR_BUILTIN_FLOATS == 0))
-
-  template<typename BuiltInFloatType,
-           typename ExactUnsignedIntegralType = typename uint_type_helper<std::numeric_limits<BuiltInFloatType>::digits>::exact_unsigned_type>
-  union uz_type
+  #if ((SOFT_DOUBLE_HAS_NATIVE_UINT128 == 1) || (SOFT_DOUBLE_HAS_UMUL128 == 1))
+  constexpr auto softfloat_divSigF64_wide(std::uint64_t sigA, std::uint64_t sigB) -> std::uint64_t
   {
-    static_assert((   std::is_same<BuiltInFloatType, float>::value
-                   || std::is_same<BuiltInFloatType, double>::value),
-                  "Error: This template is intended for either built-in float or double, but not for any other type(s)");
+    // Returns floor((sigA * 2^63) / sigB) with the least significant bit
+    // jammed if the division is inexact. Here, sigB has its most significant
+    // bit set and sigA lies in [sigB / 2, sigB).
+
+    // The 32-bit reciprocal r0 = 2^127 / sigB * (1 - eps) is biased low,
+    // with 0 <= eps < 2^-29. The exact error term eps is recovered from
+    // one full product and the reciprocal is refined to 64 bits using
+    // 1 / (1 - eps) = 1 + eps + eps^2 + O(2^-87). This is a single
+    // third-order Newton-Raphson (Goldschmidt) step, applied directly
+    // to the quotient estimate p0 = sigA * r0 so that the products
+    // sigA * r0 and sigB * r0 can be evaluated in parallel.
+
+    const auto r0 =
+      static_cast<std::uint64_t>
+      (
+        static_cast<std::uint64_t>
+        (
+          static_cast<std::uint32_t>
+          (
+              softfloat_approxRecip32_1(static_cast<std::uint32_t>(sigB >> static_cast<unsigned>(UINT8_C(32))))
+            - static_cast<unsigned>(UINT8_C(2))
+          )
+        )
+        << static_cast<unsigned>(UINT8_C(32))
+      );
 
-    using float_type    = BuiltInFloatType;
-    using unsigned_type = ExactUnsignedIntegralType;
+    const auto p0 = softfloat_mul64To128(sigA, r0);
 
-    const float_type    my_f; // NOLINT(misc-non-private-member-variables-in-classes)
-    const unsigned_type my_u; // NOLINT(misc-non-private-member-variables-in-classes)
+    // Express the error term eps as a 64-bit fixed-point value scaled by 2^92.
 
-    explicit constexpr uz_type(float_type    f) noexcept : my_f(f) { }
-    explicit constexpr uz_type(unsigned_type u) noexcept : my_u(u) { }
+    const auto e0 =
+      softfloat_sub128
+      (
+        uint128_compound
+        {
+          static_cast<std::uint64_t>(UINT8_C(0)),
+          static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(UINT8_C(63)))
+        },
+        softfloat_mul64To128(sigB, r0)
+      );
 
-    SOFT_DOUBLE_NODISCARD constexpr auto get_f() const noexcept -> float_type    { return my_f; }
-    SOFT_DOUBLE_NODISCARD constexpr auto get_u() const noexcept -> unsigned_type { return my_u; }
-  };
+    const auto eps =
+      static_cast<std::uint64_t>
+      (
+          static_cast<std::uint64_t>(e0.v1 << static_cast<unsigned>(UINT8_C(29)))
+        | static_cast<std::uint64_t>(e0.v0 >> static_cast<unsigned>(UINT8_C(35)))
+      );
 
-  #elif (defined(SOFT_DOUBLE_CONSTEXPR_BUILTIN_FLOATS) && (SOFT_DOUBLE_CONSTEXPR_BUILTIN_FLOATS == 1))
-  template<typename BuiltInFloatType,
-           typename ExactUnsignedIntegralType = typename uint_type_helper<std::numeric_limits<BuiltInFloatType>::digits>::exact_unsigned_type>
-  struct uz_type
-  {
-    static_assert((   std::is_same<BuiltInFloatType, float>::value
-                   || std::is_same<BuiltInFloatType, double>::value),
-                  "Error: This template is intended for either built-in float or double, but not for any other type(s)");
+    const auto eps_plus_eps2 =
+      static_cast<std::uint64_t>
+      (
+          eps
+        + static_cast<std::uint64_t>(softfloat_mul64To128(eps, eps).v1 >> static_cast<unsigned>(UINT8_C(28)))
+      );
 
-    using float_type    = BuiltInFloatType;
-    using unsigned_type = ExactUnsignedIntegralType;
+    // Form q = floor(p0 * (1 + eps + eps^2) / 2^64), keeping the fraction
+    // bits of p0 so that the estimate is short by one only when the exact
+    // quotient lies just above an integer. Every truncation rounds down,
+    // so q is never too large and a single remainder check finishes it.
 
-    const float_type my_f; // NOLINT(misc-non-private-member-variables-in-classes,cppcoreguidelines-avoid-const-or-ref-data-members)
+    const auto p1 = softfloat_mul64To128(p0.v1, eps_plus_eps2);
 
-    explicit constexpr uz_type(float_type    f) noexcept : my_f(f) { }
+    const auto p1_shifted_v0 =
+      static_cast<std::uint64_t>
+      (
+          static_cast<std::uint64_t>(p1.v1 << static_cast<unsigned>(UINT8_C(36)))
+        | static_cast<std::uint64_t>(p1.v0 >> static_cast<unsigned>(UINT8_C(28)))
+      );
 
-    explicit constexpr uz_type(unsigned_type u) noexcept : my_f(std::bit_cast<float_type>(u)) { }
+    const auto frac = static_cast<std::uint64_t>(p1_shifted_v0 + p0.v0);
 
-    SOFT_DOUBLE_NODISCARD constexpr auto get_u() const noexcept -> unsigned_type { return std::bit_cast<unsigned_type>(my_f); }
-    SOFT_DOUBLE_NODISCARD constexpr auto get_f() const noexcept -> float_type    { return my_f; }
-  };
-  #else
-  #error Configuration error regarding SOFT_DOUBLE_CONSTEXPR_BUILTIN_FLOATS
+    auto q =
+      static_cast<std::uint64_t>
+      (
+          p0.v1
+        + static_cast<std::uint64_t>(p1.v1 >> static_cast<unsigned>(UINT8_C(28)))
+        + static_cast<std::uint64_t>
+          (
+            (frac < p0.v0) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0))
+          )
+      );
+
+    auto rem =
+      softfloat_sub128
+      (
+        uint128_compound
+        {
+          static_cast<std::uint64_t>(sigA << static_cast<unsigned>(UINT8_C(63))),
+          static_cast<std::uint64_t>(sigA >> static_cast<unsigned>(UINT8_C(1)))
+        },
+        softfloat_mul64To128(q, sigB)
+      );
+
+    if((rem.v1 != static_cast<std::uint64_t>(UINT8_C(0))) || (rem.v0 >= sigB))
+    {
+      ++q;
+
+      rem = softfloat_sub128(rem, uint128_compound { sigB, static_cast<std::uint64_t>(UINT8_C(0)) });
+    }
+
+    return
+      static_cast<std::uint64_t>
+      (
+          q
+        | static_cast<std::uint64_t>
+          (
+            (rem.v0 != static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0))
+          )
+      );
+  }
   #endif
 
-  struct nothing { };
+  template<const unsigned TableBits>
+  struct exp2_table_q126
+  {
+    static constexpr auto size() -> std::size_t { return static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(1)) << TableBits); }
 
-  } // namespace detail
+    std::uint64_t lo[size()] { }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays,misc-non-private-member-variables-in-classes)
+    std::uint64_t hi[size()] { }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays,misc-non-private-member-variables-in-classes)
+  };
 
-  constexpr auto operator+(const soft_double& a, const soft_double& b) -> soft_double;
-  constexpr auto operator-(const soft_double& a, const soft_double& b) -> soft_double;
-  constexpr auto operator*(const soft_double& a, const soft_double& b) -> soft_double;
-  constexpr auto operator/(const soft_double& a, const soft_double& b) -> soft_double;
+  struct exp2_table_u256
+  {
+    std::uint64_t w0 { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint64_t w1 { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint64_t w2 { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint64_t w3 { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
 
-  template<typename UnsignedIntegralType> constexpr auto operator+(const soft_double& u, UnsignedIntegralType n) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, soft_double>::type;
-  template<typename UnsignedIntegralType> constexpr auto operator-(const soft_double& u, UnsignedIntegralType n) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, soft_double>::type;
-  template<typename UnsignedIntegralType> constexpr auto operator*(const soft_double& u, UnsignedIntegralType n) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, soft_double>::type;
-  template<typename UnsignedIntegralType> constexpr auto operator/(const soft_double& u, UnsignedIntegralType n) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, soft_double>::type;
+  constexpr auto exp2_table_add_carry(std::uint64_t& sum, std::uint64_t addend) -> std::uint64_t
+  {
+    sum = static_cast<std::uint64_t>(sum + addend);
 
-  template<typename UnsignedIntegralType> constexpr auto operator+(UnsignedIntegralType n, const soft_double& u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, soft_double>::type;
-  template<typename UnsignedIntegralType> constexpr auto operator-(UnsignedIntegralType n, const soft_double& u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, soft_double>::type;
-  template<typename UnsignedIntegralType> constexpr auto operator*(UnsignedIntegralType n, const soft_double& u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, soft_double>::type;
-  template<typename UnsignedIntegralType> constexpr auto operator/(UnsignedIntegralType n, const soft_double& u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, soft_double>::type;
+    return static_cast<std::uint64_t>((sum < addend) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)));
+  }
 
-  template<typename SignedIntegralType> constexpr auto operator+(const soft_double& u, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, soft_double>::type;
-  template<typename SignedIntegralType> constexpr auto operator-(const soft_double& u, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, soft_double>::type;
-  template<typename SignedIntegralType> constexpr auto operator*(const soft_double& u, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, soft_double>::type;
-  template<typename SignedIntegralType> constexpr auto operator/(const soft_double& u, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, soft_double>::type;
+  constexpr auto exp2_table_mul128To256(const uint128_compound& a, const uint128_compound& b) -> exp2_table_u256
+  {
+    const auto p00 = softfloat_mul64To128(a.v0, b.v0);
+    const auto p01 = softfloat_mul64To128(a.v0, b.v1);
+    const auto p10 = softfloat_mul64To128(a.v1, b.v0);
+    const auto p11 = softfloat_mul64To128(a.v1, b.v1);
 
-  template<typename SignedIntegralType> constexpr auto operator+(SignedIntegralType n, const soft_double& u) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, soft_double>::type;
-  template<typename SignedIntegralType> constexpr auto operator-(SignedIntegralType n, const soft_double& u) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, soft_double>::type;
-  template<typename SignedIntegralType> constexpr auto operator*(SignedIntegralType n, const soft_double& u) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, soft_double>::type;
-  template<typename SignedIntegralType> constexpr auto operator/(SignedIntegralType n, const soft_double& u) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, soft_double>::type;
+    exp2_table_u256 w { };
 
-  constexpr auto operator+(const soft_double& u, float f) -> soft_double;
-  constexpr auto operator-(const soft_double& u, float f) -> soft_double;
-  constexpr auto operator*(const soft_double& u, float f) -> soft_double;
-  constexpr auto operator/(const soft_double& u, float f) -> soft_double;
+    w.w0 = p00.v0;
 
-  constexpr auto operator+(float f, const soft_double& u) -> soft_double;
-  constexpr auto operator-(float f, const soft_double& u) -> soft_double;
-  constexpr auto operator*(float f, const soft_double& u) -> soft_double;
-  constexpr auto operator/(float f, const soft_double& u) -> soft_double;
+    w.w1 = p00.v1;
 
-  constexpr auto operator+(const soft_double& u, double f) -> soft_double;
-  constexpr auto operator-(const soft_double& u, double f) -> soft_double;
-  constexpr auto operator*(const soft_double& u, double f) -> soft_double;
-  constexpr auto operator/(const soft_double& u, double f) -> soft_double;
+    auto carry = exp2_table_add_carry(w.w1, p01.v0);
 
-  constexpr auto operator+(double f, const soft_double& u) -> soft_double;
-  constexpr auto operator-(double f, const soft_double& u) -> soft_double;
-  constexpr auto operator*(double f, const soft_double& u) -> soft_double;
-  constexpr auto operator/(double f, const soft_double& u) -> soft_double;
+    carry = static_cast<std::uint64_t>(carry + exp2_table_add_carry(w.w1, p10.v0));
 
-  constexpr auto operator+(const soft_double& u, long double f) -> soft_double;
-  constexpr auto operator-(const soft_double& u, long double f) -> soft_double;
-  constexpr auto operator*(const soft_double& u, long double f) -> soft_double;
-  constexpr auto operator/(const soft_double& u, long double f) -> soft_double;
+    w.w2 = p11.v0;
 
-  constexpr auto operator+(long double f, const soft_double& u) -> soft_double;
-  constexpr auto operator-(long double f, const soft_double& u) -> soft_double;
-  constexpr auto operator*(long double f, const soft_double& u) -> soft_double;
-  constexpr auto operator/(long double f, const soft_double& u) -> soft_double;
+    auto carry_hi = exp2_table_add_carry(w.w2, p01.v1);
 
-  constexpr auto operator< (const soft_double& a, const soft_double& b) -> bool;
-  constexpr auto operator<=(const soft_double& a, const soft_double& b) -> bool;
-  constexpr auto operator==(const soft_double& a, const soft_double& b) -> bool;
-  constexpr auto operator!=(const soft_double& a, const soft_double& b) -> bool;
-  constexpr auto operator>=(const soft_double& a, const soft_double& b) -> bool;
-  constexpr auto operator> (const soft_double& a, const soft_double& b) -> bool;
+    carry_hi = static_cast<std::uint64_t>(carry_hi + exp2_table_add_carry(w.w2, p10.v1));
+    carry_hi = static_cast<std::uint64_t>(carry_hi + exp2_table_add_carry(w.w2, carry));
 
-  template<typename UnsignedIntegralType> constexpr auto operator< (const soft_double& a, UnsignedIntegralType u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
-  template<typename UnsignedIntegralType> constexpr auto operator<=(const soft_double& a, UnsignedIntegralType u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
-  template<typename UnsignedIntegralType> constexpr auto operator==(const soft_double& a, UnsignedIntegralType u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
-  template<typename UnsignedIntegralType> constexpr auto operator!=(const soft_double& a, UnsignedIntegralType u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
-  template<typename UnsignedIntegralType> constexpr auto operator>=(const soft_double& a, UnsignedIntegralType u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
-  template<typename UnsignedIntegralType> constexpr auto operator> (const soft_double& a, UnsignedIntegralType u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
+    w.w3 = static_cast<std::uint64_t>(p11.v1 + carry_hi);
 
-  template<typename UnsignedIntegralType> constexpr auto operator< (UnsignedIntegralType u, const soft_double& a) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
-  template<typename UnsignedIntegralType> constexpr auto operator<=(UnsignedIntegralType u, const soft_double& a) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
-  template<typename UnsignedIntegralType> constexpr auto operator==(UnsignedIntegralType u, const soft_double& a) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
-  template<typename UnsignedIntegralType> constexpr auto operator!=(UnsignedIntegralType u, const soft_double& a) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
-  template<typename UnsignedIntegralType> constexpr auto operator>=(UnsignedIntegralType u, const soft_double& a) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
-  template<typename UnsignedIntegralType> constexpr auto operator> (UnsignedIntegralType u, const soft_double& a) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
+    return w;
+  }
 
-  template<typename SignedIntegralType> constexpr auto operator< (const soft_double& a, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
-  template<typename SignedIntegralType> constexpr auto operator<=(const soft_double& a, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
-  template<typename SignedIntegralType> constexpr auto operator==(const soft_double& a, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
-  template<typename SignedIntegralType> constexpr auto operator!=(const soft_double& a, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
-  template<typename SignedIntegralType> constexpr auto operator>=(const soft_double& a, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
-  template<typename SignedIntegralType> constexpr auto operator> (const soft_double& a, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
+  constexpr auto exp2_table_mul_q126(const uint128_compound& a, const uint128_compound& b) -> uint128_compound
+  {
+    // Multiply two fixed-point numbers having 126 fractional bits
+    // and truncate the product to the same format.
+    const auto w = exp2_table_mul128To256(a, b);
 
-  template<typename SignedIntegralType> constexpr auto operator< (SignedIntegralType n, const soft_double& a) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
-  template<typename SignedIntegralType> constexpr auto operator<=(SignedIntegralType n, const soft_double& a) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
-  template<typename SignedIntegralType> constexpr auto operator==(SignedIntegralType n, const soft_double& a) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
-  template<typename SignedIntegralType> constexpr auto operator!=(SignedIntegralType n, const soft_double& a) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
-  template<typename SignedIntegralType> constexpr auto operator>=(SignedIntegralType n, const soft_double& a) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
-  template<typename SignedIntegralType> constexpr auto operator> (SignedIntegralType n, const soft_double& a) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
+    return
+      uint128_compound
+      {
+        static_cast<std::uint64_t>(static_cast<std::uint64_t>(w.w1 >> static_cast<unsigned>(UINT8_C(62))) | static_cast<std::uint64_t>(w.w2 << static_cast<unsigned>(UINT8_C(2)))),
+        static_cast<std::uint64_t>(static_cast<std::uint64_t>(w.w2 >> static_cast<unsigned>(UINT8_C(62))) | static_cast<std::uint64_t>(w.w3 << static_cast<unsigned>(UINT8_C(2))))
+      };
+  }
 
-  constexpr auto operator< (const soft_double& a, float f) -> bool;
-  constexpr auto operator<=(const soft_double& a, float f) -> bool;
-  constexpr auto operator==(const soft_double& a, float f) -> bool;
-  constexpr auto operator!=(const soft_double& a, float f) -> bool;
-  constexpr auto operator>=(const soft_double& a, float f) -> bool;
-  constexpr auto operator> (const soft_double& a, float f) -> bool;
+  constexpr auto exp2_table_root(unsigned level) -> uint128_compound
+  {
+    // The root 2^(1/2^level) for level in [1, 10], in fixed-point
+    // with 126 fractional bits (rounded to nearest).
+    using root_array_type = std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(20))>;
 
-  constexpr auto operator< (float f, const soft_double& a) -> bool;
-  constexpr auto operator<=(float f, const soft_double& a) -> bool;
-  constexpr auto operator==(float f, const soft_double& a) -> bool;
-  constexpr auto operator!=(float f, const soft_double& a) -> bool;
-  constexpr auto operator>=(float f, const soft_double& a) -> bool;
-  constexpr auto operator> (float f, const soft_double& a) -> bool;
+    constexpr auto roots =
+      root_array_type
+      {
+        static_cast<std::uint64_t>(UINT64_C(0x2CBEC4D9BAA55F50)), static_cast<std::uint64_t>(UINT64_C(0x5A827999FCEF3242)),
+        static_cast<std::uint64_t>(UINT64_C(0xA356918C17217B7B)), static_cast<std::uint64_t>(UINT64_C(0x4C1BF828C6DC54B7)),
+        static_cast<std::uint64_t>(UINT64_C(0x7DF23143AC529E48)), static_cast<std::uint64_t>(UINT64_C(0x45CAE0F1F545EB73)),
+        static_cast<std::uint64_t>(UINT64_C(0x62E4ADC610AA60D9)), static_cast<std::uint64_t>(UINT64_C(0x42D561B3E6243D8A)),
+        static_cast<std::uint64_t>(UINT64_C(0x9F1523ADA3290600)), static_cast<std::uint64_t>(UINT64_C(0x4166C34C5615D0EB)),
+        static_cast<std::uint64_t>(UINT64_C(0xBDF2B293DE8A6F7A)), static_cast<std::uint64_t>(UINT64_C(0x40B268F9DE0183B9)),
+        static_cast<std::uint64_t>(UINT64_C(0x1299AB8CDB737E90)), static_cast<std::uint64_t>(UINT64_C(0x4058F6A7ECCCD5B6)),
+        static_cast<std::uint64_t>(UINT64_C(0x4A6AC4FB04772551)), static_cast<std::uint64_t>(UINT64_C(0x402C6BE96AF2FB58)),
+        static_cast<std::uint64_t>(UINT64_C(0x7FC674A533CBD9E7)), static_cast<std::uint64_t>(UINT64_C(0x4016321B687027A8)),
+        static_cast<std::uint64_t>(UINT64_C(0x1B486FF22688E804)), static_cast<std::uint64_t>(UINT64_C(0x400B18178BA33B14))
+      };
 
-  constexpr auto operator< (const soft_double& a, double f) -> bool;
-  constexpr auto operator<=(const soft_double& a, double f) -> bool;
-  constexpr auto operator==(const soft_double& a, double f) -> bool;
-  constexpr auto operator!=(const soft_double& a, double f) -> bool;
-  constexpr auto operator>=(const soft_double& a, double f) -> bool;
-  constexpr auto operator> (const soft_double& a, double f) -> bool;
+    return
+      uint128_compound
+      {
+        roots[static_cast<std::size_t>(static_cast<std::size_t>(static_cast<std::size_t>(level - 1U) * 2U) + 0U)],
+        roots[static_cast<std::size_t>(static_cast<std::size_t>(static_cast<std::size_t>(level - 1U) * 2U) + 1U)]
+      };
+  }
 
-  constexpr auto operator< (double f, const soft_double& a) -> bool;
-  constexpr auto operator<=(double f, const soft_double& a) -> bool;
-  constexpr auto operator==(double f, const soft_double& a) -> bool;
-  constexpr auto operator!=(double f, const soft_double& a) -> bool;
-  constexpr auto operator>=(double f, const soft_double& a) -> bool;
-  constexpr auto operator> (double f, const soft_double& a) -> bool;
+  template<const unsigned TableBits>
+  constexpr auto make_exp2_table_q126() -> exp2_table_q126<TableBits>
+  {
+    // Generate the table of 2^(j/N), with N = 2^TableBits, at compile time
+    // in fixed-point with 126 fractional bits. Entry j is the product of an
+    // earlier entry (j with its lowest set bit cleared) and the root of 2 for
+    // that bit.
 
-  constexpr auto operator< (const soft_double& a, long double f) -> bool;
-  constexpr auto operator<=(const soft_double& a, long double f) -> bool;
-  constexpr auto operator==(const soft_double& a, long double f) -> bool;
-  constexpr auto operator!=(const soft_double& a, long double f) -> bool;
-  constexpr auto operator>=(const soft_double& a, long double f) -> bool;
-  constexpr auto operator> (const soft_double& a, long double f) -> bool;
+    exp2_table_q126<TableBits> table { };
 
-  constexpr auto operator< (long double f, const soft_double& a) -> bool;
-  constexpr auto operator<=(long double f, const soft_double& a) -> bool;
-  constexpr auto operator==(long double f, const soft_double& a) -> bool;
-  constexpr auto operator!=(long double f, const soft_double& a) -> bool;
-  constexpr auto operator>=(long double f, const soft_double& a) -> bool;
-  constexpr auto operator> (long double f, const soft_double& a) -> bool;
+    table.hi[0U] = static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(UINT8_C(62)));
 
-  #if !defined(SOFT_DOUBLE_DISABLE_IOSTREAM)
-  template<typename char_type, typename traits_type> auto operator<<(std::basic_ostream<char_type, traits_type>& os, const soft_double& f) -> std::basic_ostream<char_type, traits_type>&;
-  template<typename char_type, typename traits_type> auto operator>>(std::basic_istream<char_type, traits_type>& is,       soft_double& f) -> std::basic_istream<char_type, traits_type>&;
-  #endif // !WIDE_DECIMAL_DISABLE_IOSTREAM
+    for(auto j = static_cast<std::size_t>(UINT8_C(1)); j < exp2_table_q126<TableBits>::size(); ++j)
+    {
+      auto bit = static_cast<unsigned>(UINT8_C(0));
 
-  constexpr auto (isnan)   (soft_double x) -> bool;
-  constexpr auto (isinf)   (soft_double x) -> bool;
-  constexpr auto (isfinite)(soft_double x) -> bool;
-  constexpr auto  abs      (soft_double x) -> soft_double;
-  constexpr auto  fabs     (soft_double x) -> soft_double;
-  constexpr auto  fmod     (soft_double v1, soft_double v2) -> soft_double;
-  constexpr auto  frexp    (soft_double x, int* expptr) -> soft_double;
-  constexpr auto  ldexp    (soft_double x, int expval) -> soft_double;
-  constexpr auto  floor    (soft_double x) -> soft_double;
-  constexpr auto  ceil     (soft_double x) -> soft_double;
-  constexpr auto  sqrt     (soft_double x) -> soft_double;
-  constexpr auto  exp      (soft_double x) -> soft_double;
-  constexpr auto  log      (soft_double x) -> soft_double;
-  constexpr auto  pow      (soft_double x, soft_double a) -> soft_double;
-  constexpr auto  sin      (soft_double x) -> soft_double;
-  constexpr auto  cos      (soft_double x) -> soft_double;
-  constexpr auto  tan      (soft_double x) -> soft_double;
-  constexpr auto  asin     (soft_double x) -> soft_double;
-  constexpr auto  acos     (soft_double x) -> soft_double;
-  constexpr auto  atan     (soft_double x) -> soft_double;
-  constexpr auto  sinh     (soft_double x) -> soft_double;
-  constexpr auto  cosh     (soft_double x) -> soft_double;
-  constexpr auto  tanh     (soft_double x) -> soft_double;
+      while(static_cast<std::size_t>(j & static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(1)) << bit)) == static_cast<std::size_t>(UINT8_C(0)))
+      {
+        ++bit;
+      }
 
-  template<typename UnsignedIntegralType,
-           typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
-                                    && std::is_unsigned<UnsignedIntegralType>::value)>::type const* = nullptr>
-  constexpr auto pow(soft_double x, UnsignedIntegralType u) -> soft_double;
+      const auto j_prev = static_cast<std::size_t>(j & static_cast<std::size_t>(j - static_cast<std::size_t>(UINT8_C(1))));
 
-  template<typename SignedIntegralType,
-           typename std::enable_if<(   std::is_integral<SignedIntegralType>::value
-                                    && std::is_signed  <SignedIntegralType>::value)>::type const* = nullptr>
-  constexpr auto pow(soft_double x, SignedIntegralType n) -> soft_double;
+      const auto value = exp2_table_mul_q126(uint128_compound { table.lo[j_prev], table.hi[j_prev] }, exp2_table_root(TableBits - bit)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
 
-  class soft_double final
+      table.lo[j] = value.v0; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+      table.hi[j] = value.v1; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+
+    return table;
+  }
+
+  template<const unsigned TableBits>
+  struct exp2_table
   {
-  public:
-    static_assert(sizeof(float) == static_cast<std::size_t>(UINT8_C(4)),
-                  "Error: This template is designed for built-in float having 4 bytes");
+    static constexpr auto size() -> std::size_t { return static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(1)) << TableBits); }
 
-    using representation_type = std::uint64_t;
+    std::uint64_t data[size()] { }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays,misc-non-private-member-variables-in-classes)
+  };
 
-    constexpr soft_double() noexcept = default;
+  template<const unsigned TableBits>
+  constexpr auto make_exp2_table() -> exp2_table<TableBits>
+  {
+    // Store the entries of 2^(j/N) with 63 fractional bits.
 
-    template<typename UnsignedIntegralType,
-             typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
-                                      && std::is_unsigned<UnsignedIntegralType>::value
-                                      && (sizeof(UnsignedIntegralType) <= sizeof(std::uint32_t)))>::type const* = nullptr>
-    constexpr soft_double(UnsignedIntegralType u) noexcept : my_value(my_ui32_to_f64(static_cast<std::uint32_t>(u))) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    const auto values = make_exp2_table_q126<TableBits>();
 
-    template<typename UnsignedIntegralType,
-             typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
-                                      && std::is_unsigned<UnsignedIntegralType>::value
-                                      && (!(sizeof(UnsignedIntegralType) <= sizeof(std::uint32_t))))>::type const* = nullptr>
-    constexpr soft_double(UnsignedIntegralType u) noexcept : my_value(my_ui64_to_f64(static_cast<std::uint64_t>(u))) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    exp2_table<TableBits> table { };
 
-    template<typename SignedIntegralType,
+    for(auto j = static_cast<std::size_t>(UINT8_C(0)); j < exp2_table<TableBits>::size(); ++j)
+    {
+      // Round to nearest, with 63 fractional bits.
+      const auto round_up = (static_cast<std::uint64_t>(values.lo[j] >> static_cast<unsigned>(UINT8_C(62))) & static_cast<std::uint64_t>(UINT8_C(1))); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+      table.data[j] = // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>
+            (
+                static_cast<std::uint64_t>(values.hi[j] << static_cast<unsigned>(UINT8_C(1))) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+              | static_cast<std::uint64_t>(values.lo[j] >> static_cast<unsigned>(UINT8_C(63))) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            )
+          + round_up
+        );
+    }
+
+    return table;
+  }
+
+  template<const unsigned TableBits>
+  struct exp2_table_holder
+  {
+    // The table has static storage, so that it is not rebuilt on the stack.
+    static constexpr exp2_table<TableBits> values = make_exp2_table<TableBits>();
+  };
+
+  #if (__cplusplus < 201703L)
+  template<const unsigned TableBits>
+  constexpr exp2_table<TableBits> exp2_table_holder<TableBits>::values;
+  #endif
+
+  constexpr auto exp_table_poly_degree(unsigned table_bits) -> unsigned
+  {
+    // The degree of the Taylor polynomial of exp(r), with 0 <= r < ln2 / N,
+    // for which the truncation error stays below 2^-62.
+    return
+      static_cast<unsigned>
+      (
+          (table_bits <= static_cast<unsigned>(UINT8_C(3))) ? static_cast<unsigned>(UINT8_C(10))
+        : (table_bits <= static_cast<unsigned>(UINT8_C(4))) ? static_cast<unsigned>(UINT8_C( 9))
+        : (table_bits <= static_cast<unsigned>(UINT8_C(5))) ? static_cast<unsigned>(UINT8_C( 8))
+        : (table_bits <= static_cast<unsigned>(UINT8_C(6))) ? static_cast<unsigned>(UINT8_C( 7))
+        : (table_bits <= static_cast<unsigned>(UINT8_C(8))) ? static_cast<unsigned>(UINT8_C( 6))
+        :                                                     static_cast<unsigned>(UINT8_C( 5))
+      );
+  }
+
+  template<const unsigned TableBits>
+  struct log_table
+  {
+    static constexpr auto size() -> std::size_t { return static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(1)) << TableBits); }
+
+    std::uint64_t recip [size()] { }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays,misc-non-private-member-variables-in-classes)
+    std::uint64_t log_lo[size()] { }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays,misc-non-private-member-variables-in-classes)
+    std::uint64_t log_hi[size()] { }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays,misc-non-private-member-variables-in-classes)
+  };
+
+  template<const unsigned TableBits>
+  constexpr auto log_table_pow2(const exp2_table_q126<TableBits>& pow2, std::size_t k) -> uint128_compound
+  {
+    // The power 2^(k/N) for k in [0, N], with 126 fractional bits.
+    return
+      (k == exp2_table_q126<TableBits>::size())
+        ? uint128_compound { static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(UINT8_C(63))) }
+        : uint128_compound { pow2.lo[k], pow2.hi[k] }; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+  }
+
+  template<const unsigned TableBits>
+  constexpr auto make_log_table() -> log_table<TableBits>
+  {
+    // Generate the table of reciprocals c_j and -log(c_j) at compile time.
+    // Entry j covers the mantissas in [1 + j/N, 1 + (j + 1)/N). Its reciprocal
+    // is c = 2^(-k/N), for the k such that 2^(k/N) lies closest to the middle
+    // of that interval, rounded to c' with 63 fractional bits. Entry 0 uses
+    // k = 0 (so c' = 1 and the logarithm of 1 is exact). Since c' differs
+    // from c by at most 2^-64, -log(c') = (k/N) * ln2 + ((c - c') * 2^(k/N))
+    // to within 2^-127. The logarithm is stored with 116 fractional bits.
+
+    // ln2 with 128 fractional bits.
+    constexpr auto ln2_hi = static_cast<std::uint64_t>(UINT64_C(0xB17217F7D1CF79AB));
+    constexpr auto ln2_lo = static_cast<std::uint64_t>(UINT64_C(0xC9E3B39803F2F6AF));
+
+    constexpr auto n = log_table<TableBits>::size();
+
+    const auto pow2 = make_exp2_table_q126<TableBits>();
+
+    log_table<TableBits> table { };
+
+    auto k = static_cast<std::size_t>(UINT8_C(0));
+
+    for(auto j = static_cast<std::size_t>(UINT8_C(0)); j < n; ++j)
+    {
+      if(j != static_cast<std::size_t>(UINT8_C(0)))
+      {
+        // The middle of the interval 1 + ((j + 1/2) / N), with 126 fractional
+        // bits, of which only the upper limb is nonzero.
+        const auto mid =
+          static_cast<std::uint64_t>
+          (
+              static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(UINT8_C(62)))
+            + static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(j * 2U) + 1U) << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(61)) - TableBits))
+          );
+
+        while(   (k < n)
+              && (   (log_table_pow2(pow2, k + 1U).v1 <= mid)
+                  || (   (log_table_pow2(pow2, k).v1 < mid)
+                      && (static_cast<std::uint64_t>(log_table_pow2(pow2, k + 1U).v1 - mid) < static_cast<std::uint64_t>(mid - log_table_pow2(pow2, k).v1)))))
+        {
+          ++k;
+        }
+      }
+
+      if(k == static_cast<std::size_t>(UINT8_C(0)))
+      {
+        table.recip[j] = static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(UINT8_C(63))); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+      }
+      else
+      {
+        // The limbs of 2^((N - k)/N) hold c = 2^(-k/N) with 127 fractional bits.
+        // The rounded reciprocal is the upper limb (plus one when rounding up),
+        // and the magnitude of the difference c - c' is given by the lower limb.
+        const auto c = log_table_pow2(pow2, n - k);
+
+        const auto round_up = static_cast<std::uint64_t>(c.v0 >> static_cast<unsigned>(UINT8_C(63)));
+
+        table.recip[j] = static_cast<std::uint64_t>(c.v1 + round_up); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+        const auto diff =
+          static_cast<std::uint64_t>
+          (
+            (round_up != static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(0)) - c.v0) : c.v0
+          );
+
+        // The correction |c - c'| * 2^(k/N), with 128 fractional bits.
+        const auto pk = log_table_pow2(pow2, k);
+
+        const auto prod =
+          softfloat_add128
+          (
+            softfloat_mul64To128(diff, pk.v1),
+            uint128_compound { softfloat_mul64To128(diff, pk.v0).v1, static_cast<std::uint64_t>(UINT8_C(0)) }
+          );
+
+        const auto corr =
+          uint128_compound
+          {
+            static_cast<std::uint64_t>(static_cast<std::uint64_t>(prod.v0 >> static_cast<unsigned>(UINT8_C(61))) | static_cast<std::uint64_t>(prod.v1 << static_cast<unsigned>(UINT8_C(3)))),
+            static_cast<std::uint64_t>(prod.v1 >> static_cast<unsigned>(UINT8_C(61)))
+          };
+
+        // The product (k/N) * ln2, with 128 fractional bits.
+        const auto k_ln2_lo = softfloat_mul64To128(static_cast<std::uint64_t>(k), ln2_lo);
+
+        const auto k_ln2_hi =
+          softfloat_add128
+          (
+            softfloat_mul64To128(static_cast<std::uint64_t>(k), ln2_hi),
+            uint128_compound { k_ln2_lo.v1, static_cast<std::uint64_t>(UINT8_C(0)) }
+          );
+
+        const auto k_ln2 =
+          uint128_compound
+          {
+            static_cast<std::uint64_t>(static_cast<std::uint64_t>(k_ln2_lo.v0 >> TableBits) | static_cast<std::uint64_t>(k_ln2_hi.v0 << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - TableBits))),
+            static_cast<std::uint64_t>(static_cast<std::uint64_t>(k_ln2_hi.v0 >> TableBits) | static_cast<std::uint64_t>(k_ln2_hi.v1 << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - TableBits)))
+          };
+
+        // When rounding up, c' exceeds c and the correction is subtracted.
+        const auto value =
+          softfloat_add128
+          (
+            ((round_up != static_cast<std::uint64_t>(UINT8_C(0))) ? softfloat_sub128(k_ln2, corr) : softfloat_add128(k_ln2, corr)),
+            uint128_compound { static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(UINT8_C(11))), static_cast<std::uint64_t>(UINT8_C(0)) }
+          );
+
+        // Round to nearest, with 116 fractional bits.
+        table.log_lo[j] = static_cast<std::uint64_t>(static_cast<std::uint64_t>(value.v0 >> static_cast<unsigned>(UINT8_C(12))) | static_cast<std::uint64_t>(value.v1 << static_cast<unsigned>(UINT8_C(52)))); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        table.log_hi[j] = static_cast<std::uint64_t>(value.v1 >> static_cast<unsigned>(UINT8_C(12))); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+      }
+    }
+
+    return table;
+  }
+
+  template<const unsigned TableBits>
+  struct log_table_holder
+  {
+    // The table has static storage, so that it is not rebuilt on the stack.
+    static constexpr log_table<TableBits> values = make_log_table<TableBits>();
+  };
+
+  #if (__cplusplus < 201703L)
+  template<const unsigned TableBits>
+  constexpr log_table<TableBits> log_table_holder<TableBits>::values;
+  #endif
+
+  constexpr auto log_table_poly_degree(unsigned table_bits) -> unsigned
+  {
+    // The degree of the polynomial Q(r) in log(1 + r) = r - (r^2 * Q(r)),
+    // with |r| < 1 / N, for which the relative truncation error stays
+    // below 2^-64.
+    return
+      static_cast<unsigned>
+      (
+          (table_bits <= static_cast<unsigned>(UINT8_C(3))) ? static_cast<unsigned>(UINT8_C(19))
+        : (table_bits <= static_cast<unsigned>(UINT8_C(4))) ? static_cast<unsigned>(UINT8_C(14))
+        : (table_bits <= static_cast<unsigned>(UINT8_C(5))) ? static_cast<unsigned>(UINT8_C(11))
+        : (table_bits <= static_cast<unsigned>(UINT8_C(6))) ? static_cast<unsigned>(UINT8_C( 9))
+        : (table_bits <= static_cast<unsigned>(UINT8_C(7))) ? static_cast<unsigned>(UINT8_C( 7))
+        : (table_bits <= static_cast<unsigned>(UINT8_C(8))) ? static_cast<unsigned>(UINT8_C( 6))
+        :                                                     static_cast<unsigned>(UINT8_C( 5))
+      );
+  }
+
+  struct trig_reduced_argument
+  {
+    // The reduced argument r = x - (n * pi/2), with |r| <= pi/4, is
+    // held as |r| = (sig / 2^63) * 2^exp together with its sign.
+    // The quadrant is n mod 4.
+    std::uint64_t sig      { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::int16_t  exp      { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint32_t quadrant { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    bool          sign     { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  constexpr auto trig_two_over_pi_word(std::size_t index) -> std::uint64_t
+  {
+    // The binary digits of 2/pi, 64 at a time. These are preceded
+    // by one word of zeros, which stands for the integral part.
+    using word_array_type = std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(20))>;
+
+    constexpr auto words =
+      word_array_type
+      {
+        static_cast<std::uint64_t>(UINT64_C(0x0000000000000000)),
+        static_cast<std::uint64_t>(UINT64_C(0xA2F9836E4E441529)), static_cast<std::uint64_t>(UINT64_C(0xFC2757D1F534DDC0)),
+        static_cast<std::uint64_t>(UINT64_C(0xDB6295993C439041)), static_cast<std::uint64_t>(UINT64_C(0xFE5163ABDEBBC561)),
+        static_cast<std::uint64_t>(UINT64_C(0xB7246E3A424DD2E0)), static_cast<std::uint64_t>(UINT64_C(0x06492EEA09D1921C)),
+        static_cast<std::uint64_t>(UINT64_C(0xFE1DEB1CB129A73E)), static_cast<std::uint64_t>(UINT64_C(0xE88235F52EBB4484)),
+        static_cast<std::uint64_t>(UINT64_C(0xE99C7026B45F7E41)), static_cast<std::uint64_t>(UINT64_C(0x3991D639835339F4)),
+        static_cast<std::uint64_t>(UINT64_C(0x9C845F8BBDF9283B)), static_cast<std::uint64_t>(UINT64_C(0x1FF897FFDE05980F)),
+        static_cast<std::uint64_t>(UINT64_C(0xEF2F118B5A0A6D1F)), static_cast<std::uint64_t>(UINT64_C(0x6D367ECF27CB09B7)),
+        static_cast<std::uint64_t>(UINT64_C(0x4F463F669E5FEA2D)), static_cast<std::uint64_t>(UINT64_C(0x7527BAC7EBE5F17B)),
+        static_cast<std::uint64_t>(UINT64_C(0x3D0739F78A5292EA)), static_cast<std::uint64_t>(UINT64_C(0x6BFB5FB11F8D5D08)),
+        static_cast<std::uint64_t>(UINT64_C(0x56033046FC7B6BAB))
+      };
+
+    return words[index];
+  }
+
+  constexpr auto trig_window_word(std::size_t index, unsigned shift) -> std::uint64_t
+  {
+    // The 64 bits of 2/pi (with the leading zero word) which begin
+    // at bit shift of the word with the given index.
+    return
+      static_cast<std::uint64_t>
+      (
+        (shift == static_cast<unsigned>(UINT8_C(0)))
+          ? trig_two_over_pi_word(index)
+          : static_cast<std::uint64_t>
+            (
+                static_cast<std::uint64_t>(trig_two_over_pi_word(index) << shift)
+              | static_cast<std::uint64_t>(trig_two_over_pi_word(index + 1U) >> static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - shift))
+            )
+      );
+  }
+
+  constexpr auto trig_normalize_q190(std::uint64_t w2, std::uint64_t w1, std::uint64_t w0, trig_reduced_argument& result) -> void
+  {
+    // Normalize the nonzero magnitude (w2, w1, w0), which has 190 fractional
+    // bits, to 64 significant bits (jamming the rest into the lowest bit).
+    auto exp_shift = static_cast<std::int16_t>(INT8_C(0));
+
+    for(auto   i = static_cast<unsigned>(UINT8_C(0));
+              (i < static_cast<unsigned>(UINT8_C(2))) && (w2 == static_cast<std::uint64_t>(UINT8_C(0)));
+             ++i)
+    {
+      w2 = w1;
+      w1 = w0;
+      w0 = static_cast<std::uint64_t>(UINT8_C(0));
+
+      exp_shift = static_cast<std::int16_t>(exp_shift - static_cast<std::int16_t>(INT8_C(64)));
+    }
+
+    const auto lz = static_cast<unsigned>(softfloat_countLeadingZeros64(w2) % static_cast<unsigned>(UINT8_C(64)));
+
+    const auto sticky = static_cast<std::uint64_t>((static_cast<std::uint64_t>((lz == 0U) ? w1 : static_cast<std::uint64_t>(w1 << lz)) | w0) != static_cast<std::uint64_t>(UINT8_C(0)));
+
+    result.sig =
+      static_cast<std::uint64_t>
+      (
+          static_cast<std::uint64_t>((lz == 0U) ? w2 : static_cast<std::uint64_t>(static_cast<std::uint64_t>(w2 << lz) | static_cast<std::uint64_t>(w1 >> static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - lz))))
+        | sticky
+      );
+
+    // The leading bit of w2 (at bit 63) stands for 2^1 before shifting.
+    result.exp = static_cast<std::int16_t>(static_cast<std::int16_t>(static_cast<std::int16_t>(INT8_C(1)) + exp_shift) - static_cast<std::int16_t>(lz));
+  }
+
+  constexpr auto trig_reduce_cody_waite(std::uint64_t sig, std::int16_t exp2) -> trig_reduced_argument
+  {
+    // Reduce x = sig * 2^exp2, with |x| < 2^30, by n * pi/2 where n is
+    // the nearest integer to x * 2/pi. The constant pi/2 is split into three
+    // 64-bit parts (190 fractional bits), so that every partial product n * p
+    // is exact and r = x - (n * p2) - (n * p1) - (n * p0) is obtained without
+    // cancellation error. This is carried out modulo 2^192 in fixed-point.
+
+    constexpr auto two_over_pi = static_cast<std::uint64_t>(UINT64_C(0xA2F9836E4E44152A));
+
+    constexpr auto pio2_p2 = static_cast<std::uint64_t>(UINT64_C(0x6487ED5110B4611A));
+    constexpr auto pio2_p1 = static_cast<std::uint64_t>(UINT64_C(0x62633145C06E0E68));
+    constexpr auto pio2_p0 = static_cast<std::uint64_t>(UINT64_C(0x948127044533E63A));
+
+    // The estimate n = round(x * 2/pi) may be off by one at a midpoint
+    // (making |r| exceed pi/4 very slightly), which does no harm.
+    const auto x_2_over_pi = softfloat_mul64To128(sig, two_over_pi);
+
+    const auto shift = static_cast<unsigned>(static_cast<int>(INT8_C(64)) - static_cast<int>(exp2));
+
+    const auto n_times_two =
+      static_cast<std::uint64_t>
+      (
+        (shift < static_cast<unsigned>(UINT8_C(129))) ? static_cast<std::uint64_t>(x_2_over_pi.v1 >> static_cast<unsigned>(shift - 65U)) : static_cast<std::uint64_t>(UINT8_C(0))
+      );
+
+    const auto n = static_cast<std::uint64_t>(static_cast<std::uint64_t>(n_times_two + 1U) >> static_cast<unsigned>(UINT8_C(1)));
+
+    // Place x in the 192-bit fixed-point format (modulo 2^192).
+    const auto k = static_cast<unsigned>(static_cast<int>(INT16_C(190)) + static_cast<int>(exp2));
+
+    const auto x2 =
+      static_cast<std::uint64_t>
+      (
+        (k >= static_cast<unsigned>(UINT8_C(128))) ? static_cast<std::uint64_t>(sig << static_cast<unsigned>(k - 128U))
+                                                   : static_cast<std::uint64_t>(sig >> static_cast<unsigned>(128U - k))
+      );
+
+    const auto x1 =
+      static_cast<std::uint64_t>
+      (
+        (k >= static_cast<unsigned>(UINT8_C(128))) ? static_cast<std::uint64_t>(UINT8_C(0))
+                                                   : static_cast<std::uint64_t>(sig << static_cast<unsigned>(k - 64U))
+      );
+
+    // Form n * pi/2 (modulo 2^192) from the three exact partial products.
+    const auto np0 = softfloat_mul64To128(n, pio2_p0);
+    const auto np1 = softfloat_mul64To128(n, pio2_p1);
+
+    const auto m1 = static_cast<std::uint64_t>(np0.v1 + np1.v0);
+    const auto m2 =
+      static_cast<std::uint64_t>
+      (
+          static_cast<std::uint64_t>(np1.v1 + static_cast<std::uint64_t>(n * pio2_p2))
+        + static_cast<std::uint64_t>((m1 < np0.v1) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))
+      );
+
+    // Subtract with borrow: r = x - (n * pi/2).
+    const auto r0 = static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(0)) - np0.v0);
+
+    const auto borrow0 = static_cast<std::uint64_t>((np0.v0 != static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)));
+
+    const auto r1 = static_cast<std::uint64_t>(static_cast<std::uint64_t>(x1 - m1) - borrow0);
+
+    const auto borrow1 = static_cast<std::uint64_t>(((x1 < m1) || ((x1 == m1) && (borrow0 != static_cast<std::uint64_t>(UINT8_C(0))))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)));
+
+    const auto r2 = static_cast<std::uint64_t>(static_cast<std::uint64_t>(x2 - m2) - borrow1);
+
+    trig_reduced_argument result { };
+
+    result.quadrant = static_cast<std::uint32_t>(n & static_cast<std::uint64_t>(UINT8_C(3)));
+    result.sign     = (static_cast<std::uint64_t>(r2 >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint64_t>(UINT8_C(0)));
+
+    if(result.sign)
+    {
+      // Negate the 192-bit two's complement value.
+      const auto n0 = static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(0)) - r0);
+      const auto c0 = static_cast<std::uint64_t>((r0 == static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)));
+      const auto n1 = static_cast<std::uint64_t>(static_cast<std::uint64_t>(~r1) + c0);
+      const auto c1 = static_cast<std::uint64_t>(((c0 != static_cast<std::uint64_t>(UINT8_C(0))) && (n1 == static_cast<std::uint64_t>(UINT8_C(0)))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)));
+      const auto n2 = static_cast<std::uint64_t>(static_cast<std::uint64_t>(~r2) + c1);
+
+      trig_normalize_q190(n2, n1, n0, result);
+    }
+    else
+    {
+      trig_normalize_q190(r2, r1, r0, result);
+    }
+
+    return result;
+  }
+
+  constexpr auto trig_reduce_payne_hanek(std::uint64_t sig, std::int16_t exp2) -> trig_reduced_argument
+  {
+    // Reduce x = sig * 2^exp2, with |x| >= 2^30, using the bits of 2/pi.
+    // Bits of 2/pi with weights above 2^(1 - exp2) contribute multiples
+    // of 4 to x * 2/pi and are skipped. The next 192 bits give x * 2/pi
+    // modulo 4, with 190 fractional bits. Its integral part is the quadrant
+    // and its fractional part f (taken in [-1/2, 1/2)) gives r = f * pi/2.
+
+    constexpr auto pio2 = static_cast<std::uint64_t>(UINT64_C(0xC90FDAA22168C235));
+
+    const auto position = static_cast<unsigned>(static_cast<int>(exp2) + static_cast<int>(INT8_C(62)));
+
+    const auto index = static_cast<std::size_t>(position / 64U);
+    const auto shift = static_cast<unsigned>(position % 64U);
+
+    const auto w2 = trig_window_word(index + 0U, shift);
+    const auto w1 = trig_window_word(index + 1U, shift);
+    const auto w0 = trig_window_word(index + 2U, shift);
+
+    // Form sig * w (modulo 2^192).
+    const auto p0 = softfloat_mul64To128(sig, w0);
+    const auto p1 = softfloat_mul64To128(sig, w1);
+
+    const auto f1 = static_cast<std::uint64_t>(p0.v1 + p1.v0);
+    const auto f2 =
+      static_cast<std::uint64_t>
+      (
+          static_cast<std::uint64_t>(p1.v1 + static_cast<std::uint64_t>(sig * w2))
+        + static_cast<std::uint64_t>((f1 < p0.v1) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))
+      );
+
+    trig_reduced_argument result { };
+
+    result.quadrant = static_cast<std::uint32_t>(f2 >> static_cast<unsigned>(UINT8_C(62)));
+
+    auto g2 = static_cast<std::uint64_t>(f2 & static_cast<std::uint64_t>(UINT64_C(0x3FFFFFFFFFFFFFFF)));
+    auto g1 = f1;
+    auto g0 = p0.v0;
+
+    // Round to the nearest quadrant (f >= 1/2 belongs to the next one).
+    result.sign = (static_cast<std::uint64_t>(g2 >> static_cast<unsigned>(UINT8_C(61))) != static_cast<std::uint64_t>(UINT8_C(0)));
+
+    if(result.sign)
+    {
+      result.quadrant = static_cast<std::uint32_t>(static_cast<std::uint32_t>(result.quadrant + 1U) & static_cast<std::uint32_t>(UINT8_C(3)));
+
+      // Form 1 - f, with 190 fractional bits.
+      const auto n0 = static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(0)) - g0);
+      const auto c0 = static_cast<std::uint64_t>((g0 == static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)));
+      const auto n1 = static_cast<std::uint64_t>(static_cast<std::uint64_t>(~g1) + c0);
+      const auto c1 = static_cast<std::uint64_t>(((c0 != static_cast<std::uint64_t>(UINT8_C(0))) && (n1 == static_cast<std::uint64_t>(UINT8_C(0)))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)));
+      const auto n2 = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(~g2) + c1) & static_cast<std::uint64_t>(UINT64_C(0x3FFFFFFFFFFFFFFF)));
+
+      g2 = n2;
+      g1 = n1;
+      g0 = n0;
+    }
+
+    trig_normalize_q190(g2, g1, g0, result);
+
+    // Multiply by pi/2 (which has 63 fractional bits).
+    const auto r = softfloat_mul64To128(result.sig, pio2);
+
+    if(static_cast<std::uint64_t>(r.v1 >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint64_t>(UINT8_C(0)))
+    {
+      result.sig = static_cast<std::uint64_t>(r.v1 | static_cast<std::uint64_t>((r.v0 != static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0))));
+
+      ++result.exp;
+    }
+    else
+    {
+      result.sig =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(r.v1 << static_cast<unsigned>(UINT8_C(1)))
+          | static_cast<std::uint64_t>(r.v0 >> static_cast<unsigned>(UINT8_C(63)))
+          | static_cast<std::uint64_t>((static_cast<std::uint64_t>(r.v0 << static_cast<unsigned>(UINT8_C(1))) != static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))
+        );
+    }
+
+    return result;
+  }
+
+  constexpr auto trig_reduce(std::int16_t expA, std::uint64_t sigA) -> trig_reduced_argument
+  {
+    // Reduce the normal, finite argument with the biased exponent expA
+    // and fraction sigA, using Cody-Waite for |x| < 2^30 and Payne-Hanek
+    // otherwise.
+    const auto sig  = static_cast<std::uint64_t>(sigA | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)));
+    const auto exp2 = static_cast<std::int16_t>(expA - static_cast<std::int16_t>(INT16_C(0x433)));
+
+    return
+      (expA < static_cast<std::int16_t>(INT16_C(0x41D)))
+        ? trig_reduce_cody_waite (sig, exp2)
+        : trig_reduce_payne_hanek(sig, exp2);
+  }
+
+  constexpr auto trig_div_q63(std::uint64_t n, std::uint64_t d) -> uint128_compound
+  {
+    // Returns an approximation to (n * 2^127) / d, where n and d both have
+    // their most significant bit set, with a relative error of a few 2^-63.
+    // The reciprocal of d is refined from a 32-bit estimate biased low
+    // (with error eps < 2^-29) using 1 / (1 - eps) = 1 + eps + eps^2.
+    const auto r0 =
+      static_cast<std::uint64_t>
+      (
+        static_cast<std::uint64_t>
+        (
+          static_cast<std::uint32_t>
+          (
+              softfloat_approxRecip32_1(static_cast<std::uint32_t>(d >> static_cast<unsigned>(UINT8_C(32))))
+            - static_cast<unsigned>(UINT8_C(2))
+          )
+        )
+        << static_cast<unsigned>(UINT8_C(32))
+      );
+
+    const auto e0 =
+      softfloat_sub128
+      (
+        uint128_compound
+        {
+          static_cast<std::uint64_t>(UINT8_C(0)),
+          static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(UINT8_C(63)))
+        },
+        softfloat_mul64To128(d, r0)
+      );
+
+    // The error term eps, with 64 fractional bits.
+    const auto eps =
+      static_cast<std::uint64_t>
+      (
+          static_cast<std::uint64_t>(e0.v1 << static_cast<unsigned>(UINT8_C(1)))
+        | static_cast<std::uint64_t>(e0.v0 >> static_cast<unsigned>(UINT8_C(63)))
+      );
+
+    const auto eps_plus_eps2 = static_cast<std::uint64_t>(eps + softfloat_mul64To128(eps, eps).v1);
+
+    const auto r1 = static_cast<std::uint64_t>(r0 + softfloat_mul64To128(r0, eps_plus_eps2).v1);
+
+    return softfloat_mul64To128(n, r1);
+  }
+
+  constexpr auto mul_q63(std::uint64_t u, std::uint64_t v) -> std::uint64_t
+  {
+    // Returns (u * v) / 2^63 (truncated), where the result must fit
+    // in 64 bits. This multiplies two values having 63 fractional bits.
+    const auto p = softfloat_mul64To128(u, v);
+
+    return
+      static_cast<std::uint64_t>
+      (
+          static_cast<std::uint64_t>(p.v1 << static_cast<unsigned>(UINT8_C(1)))
+        | static_cast<std::uint64_t>(p.v0 >> static_cast<unsigned>(UINT8_C(63)))
+      );
+  }
+
+  #if (defined(SOFT_DOUBLE_CONSTEXPR_BUILTIN_FLOATS) && (SOFT_DOUBLE_CONSTEXPR_BUILTIN_FLOATS == 0))
+
+  template<typename BuiltInFloatType,
+           typename ExactUnsignedIntegralType = typename uint_type_helper<std::numeric_limits<BuiltInFloatType>::digits>::exact_unsigned_type>
+  union uz_type
+  {
+    static_assert((   std::is_same<BuiltInFloatType, float>::value
+                   || std::is_same<BuiltInFloatType, double>::value),
+                  "Error: This template is intended for either built-in float or double, but not for any other type(s)");
+
+    using float_type    = BuiltInFloatType;
+    using unsigned_type = ExactUnsignedIntegralType;
+
+    const float_type    my_f; // NOLINT(misc-non-private-member-variables-in-classes)
+    const unsigned_type my_u; // NOLINT(misc-non-private-member-variables-in-classes)
+
+    explicit constexpr uz_type(float_type    f) noexcept : my_f(f) { }
+    explicit constexpr uz_type(unsigned_type u) noexcept : my_u(u) { }
+
+    SOFT_DOUBLE_NODISCARD constexpr auto get_f() const noexcept -> float_type    { return my_f; }
+    SOFT_DOUBLE_NODISCARD constexpr auto get_u() const noexcept -> unsigned_type { return my_u; }
+  };
+
+  #elif (defined(SOFT_DOUBLE_CONSTEXPR_BUILTIN_FLOATS) && (SOFT_DOUBLE_CONSTEXPR_BUILTIN_FLOATS == 1))
+  template<typename BuiltInFloatType,
+           typename ExactUnsignedIntegralType = typename uint_type_helper<std::numeric_limits<BuiltInFloatType>::digits>::exact_unsigned_type>
+  struct uz_type
+  {
+    static_assert((   std::is_same<BuiltInFloatType, float>::value
+                   || std::is_same<BuiltInFloatType, double>::value),
+                  "Error: This template is intended for either built-in float or double, but not for any other type(s)");
+
+    using float_type    = BuiltInFloatType;
+    using unsigned_type = ExactUnsignedIntegralType;
+
+    const float_type my_f; // NOLINT(misc-non-private-member-variables-in-classes,cppcoreguidelines-avoid-const-or-ref-data-members)
+
+    explicit constexpr uz_type(float_type    f) noexcept : my_f(f) { }
+
+    explicit constexpr uz_type(unsigned_type u) noexcept : my_f(std::bit_cast<float_type>(u)) { }
+
+    SOFT_DOUBLE_NODISCARD constexpr auto get_u() const noexcept -> unsigned_type { return std::bit_cast<unsigned_type>(my_f); }
+    SOFT_DOUBLE_NODISCARD constexpr auto get_f() const noexcept -> float_type    { return my_f; }
+  };
+  #else
+  #error Configuration error regarding SOFT_DOUBLE_CONSTEXPR_BUILTIN_FLOATS
+  #endif
+
+  struct nothing { };
+
+  // The rounding directions, named as in Berkeley SoftFloat.
+  enum class round_mode : std::uint8_t
+  {
+    near_even,
+    min_mag,
+    min,
+    max,
+    near_max_mag
+  };
+
+  struct unrounded_f64
+  {
+    // A result before its rounding, in the form that is expected by
+    // softfloat_roundPackToF64: the significand has its leading bit
+    // at bit 62 and ten rounding bits, with any lower ones jammed.
+    bool          sign { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::int16_t  exp  { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint64_t sig  { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  template<round_mode Mode>
+  constexpr auto round_increment(bool sign, std::uint16_t half) -> std::uint16_t
+  {
+    // Returns the increment that is added to a significand before
+    // its rounding bits (half being the weight of the highest one)
+    // are truncated: half to round to nearest, all ones to round away
+    // from zero in the direction of the mode, and zero otherwise.
+
+    return
+      static_cast<std::uint16_t>
+      (
+        ((Mode == round_mode::near_even) || (Mode == round_mode::near_max_mag))
+          ? half
+          : ((Mode == (sign ? round_mode::min : round_mode::max))
+              ? static_cast<std::uint16_t>(static_cast<std::uint16_t>(half << static_cast<unsigned>(UINT8_C(1))) - static_cast<std::uint16_t>(UINT8_C(1)))
+              : static_cast<std::uint16_t>(UINT8_C(0)))
+      );
+  }
+
+  // Character conversion of binary64 representations, see to_chars.
+
+  // The shortest decimal digits that convert back to the same value
+  // are found with the Ryu algorithm of U. Adams (PLDI 2018). The
+  // 128-bit multipliers for 5^i and 5^-i are reconstructed from every
+  // 26th multiplier, a small power of five and a 2-bit correction.
+  // This keeps the tables small enough for little targets.
+
+  struct chars_decimal
+  {
+    std::uint64_t digits { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::int32_t  exp10  { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  constexpr auto chars_pow5bits(std::int32_t e) -> std::int32_t
+  {
+    // The bit count of 5^e, valid for 0 <= e <= 3528.
+    return static_cast<std::int32_t>(static_cast<std::int32_t>(static_cast<std::uint32_t>(static_cast<std::uint32_t>(e) * static_cast<std::uint32_t>(UINT32_C(1217359))) >> static_cast<unsigned>(UINT8_C(19))) + static_cast<std::int32_t>(INT8_C(1)));
+  }
+
+  constexpr auto chars_log10_pow2(std::int32_t e) -> std::int32_t
+  {
+    // floor(log10(2^e)), valid for 0 <= e <= 1650.
+    return static_cast<std::int32_t>(static_cast<std::uint32_t>(static_cast<std::uint32_t>(e) * static_cast<std::uint32_t>(UINT32_C(78913))) >> static_cast<unsigned>(UINT8_C(18)));
+  }
+
+  constexpr auto chars_log10_pow5(std::int32_t e) -> std::int32_t
+  {
+    // floor(log10(5^e)), valid for 0 <= e <= 2620.
+    return static_cast<std::int32_t>(static_cast<std::uint32_t>(static_cast<std::uint32_t>(e) * static_cast<std::uint32_t>(UINT32_C(732923))) >> static_cast<unsigned>(UINT8_C(20)));
+  }
+
+  constexpr auto chars_add128(const uint128_compound& a, const uint128_compound& b) -> uint128_compound
+  {
+    const auto lo = static_cast<std::uint64_t>(a.v0 + b.v0);
+
+    return uint128_compound { lo, static_cast<std::uint64_t>(static_cast<std::uint64_t>(a.v1 + b.v1) + static_cast<std::uint64_t>((lo < a.v0) ? 1U : 0U)) };
+  }
+
+  constexpr auto chars_shr128(const uint128_compound& a, std::uint_fast8_t s) -> uint128_compound
+  {
+    // Here 0 < s < 64.
+    return
+      uint128_compound
+      {
+        static_cast<std::uint64_t>(static_cast<std::uint64_t>(a.v0 >> s) | static_cast<std::uint64_t>(a.v1 << static_cast<std::uint_fast8_t>(UINT8_C(64) - s))),
+        static_cast<std::uint64_t>(a.v1 >> s)
+      };
+  }
+
+  constexpr auto chars_shl128(const uint128_compound& a, std::uint_fast8_t s) -> uint128_compound
+  {
+    // Here 0 < s < 64.
+    return
+      uint128_compound
+      {
+        static_cast<std::uint64_t>(a.v0 << s),
+        static_cast<std::uint64_t>(static_cast<std::uint64_t>(a.v1 << s) | static_cast<std::uint64_t>(a.v0 >> static_cast<std::uint_fast8_t>(UINT8_C(64) - s)))
+      };
+  }
+
+  constexpr auto chars_pow5_small(std::uint32_t i) -> std::uint64_t
+  {
+    constexpr std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(26))> pow5 =
+    {{
+      UINT64_C(0x0000000000000001), UINT64_C(0x0000000000000005), UINT64_C(0x0000000000000019), UINT64_C(0x000000000000007D),
+      UINT64_C(0x0000000000000271), UINT64_C(0x0000000000000C35), UINT64_C(0x0000000000003D09), UINT64_C(0x000000000001312D),
+      UINT64_C(0x000000000005F5E1), UINT64_C(0x00000000001DCD65), UINT64_C(0x00000000009502F9), UINT64_C(0x0000000002E90EDD),
+      UINT64_C(0x000000000E8D4A51), UINT64_C(0x0000000048C27395), UINT64_C(0x000000016BCC41E9), UINT64_C(0x000000071AFD498D),
+      UINT64_C(0x0000002386F26FC1), UINT64_C(0x000000B1A2BC2EC5), UINT64_C(0x000003782DACE9D9), UINT64_C(0x00001158E460913D),
+      UINT64_C(0x000056BC75E2D631), UINT64_C(0x0001B1AE4D6E2EF5), UINT64_C(0x000878678326EAC9), UINT64_C(0x002A5A058FC295ED),
+      UINT64_C(0x00D3C21BCECCEDA1), UINT64_C(0x0422CA8B0A00A425)
+    }};
+
+    return pow5[static_cast<std::size_t>(i)];
+  }
+
+  constexpr auto chars_pow5_split(std::uint32_t i) -> uint128_compound
+  {
+    // floor(5^i * 2^(125 - pow5bits(i))) for 0 <= i <= 325.
+
+    // The multipliers of 5^(26 * n), low and high parts.
+    constexpr std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(26))> split2 =
+    {{
+      UINT64_C(0x0000000000000000), UINT64_C(0x1000000000000000),
+      UINT64_C(0x0000000000000000), UINT64_C(0x14ADF4B7320334B9),
+      UINT64_C(0x0E549208B31ADB10), UINT64_C(0x1ABA4714957D300D),
+      UINT64_C(0x6DC6AD264D8F0866), UINT64_C(0x1145B7E285BF98F5),
+      UINT64_C(0xEB1DBD923D8596CA), UINT64_C(0x1652EFDC6018A1FC),
+      UINT64_C(0xB4C1B80B22AE923C), UINT64_C(0x1CDA62055B2D9D83),
+      UINT64_C(0x5BB28B4E8F7E4C30), UINT64_C(0x12A5568B9F52F416),
+      UINT64_C(0xF08AED437682D4FB), UINT64_C(0x1819651531F9E78F),
+      UINT64_C(0xB4EE134AD99BF150), UINT64_C(0x1F25C186A6F04C28),
+      UINT64_C(0x16499ECB70C25F03), UINT64_C(0x1420EB449C8842E6),
+      UINT64_C(0x85A56EAD360865B0), UINT64_C(0x1A03FDE214CAF085),
+      UINT64_C(0x093DB1D57999890B), UINT64_C(0x10CFEB353A97DAD8),
+      UINT64_C(0xCF38BB735E3F36AC), UINT64_C(0x15BAAF44FA52673E)
+    }};
+
+    // The 2-bit corrections, sixteen per element.
+    constexpr std::array<std::uint32_t, static_cast<std::size_t>(UINT8_C(21))> offsets =
+    {{
+      UINT32_C(0x00000000), UINT32_C(0x00000000), UINT32_C(0x00000000), UINT32_C(0x00000000),
+      UINT32_C(0x40000000), UINT32_C(0x59695995), UINT32_C(0x55545555), UINT32_C(0x56555515),
+      UINT32_C(0x41150504), UINT32_C(0x40555410), UINT32_C(0x44555145), UINT32_C(0x44504540),
+      UINT32_C(0x45555550), UINT32_C(0x40004000), UINT32_C(0x96440440), UINT32_C(0x55565565),
+      UINT32_C(0x54454045), UINT32_C(0x40154151), UINT32_C(0x55559155), UINT32_C(0x51405555),
+      UINT32_C(0x00000105)
+    }};
+
+    const auto base   = static_cast<std::uint32_t>(i / static_cast<std::uint32_t>(UINT8_C(26)));
+    const auto base2  = static_cast<std::uint32_t>(base * static_cast<std::uint32_t>(UINT8_C(26)));
+    const auto offset = static_cast<std::uint32_t>(i - base2);
+
+    const auto mul =
+      uint128_compound
+      {
+        split2[static_cast<std::size_t>(static_cast<std::size_t>(base) * 2U)],
+        split2[static_cast<std::size_t>(static_cast<std::size_t>(base) * 2U + 1U)]
+      };
+
+    auto result = mul;
+
+    if(offset != static_cast<std::uint32_t>(UINT8_C(0)))
+    {
+      const auto m = chars_pow5_small(offset);
+
+      const auto delta = static_cast<std::uint_fast8_t>(chars_pow5bits(static_cast<std::int32_t>(i)) - chars_pow5bits(static_cast<std::int32_t>(base2)));
+
+      const auto corr =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint32_t>(offsets[static_cast<std::size_t>(i / static_cast<std::uint32_t>(UINT8_C(16)))] >> static_cast<unsigned>(static_cast<unsigned>(i % static_cast<std::uint32_t>(UINT8_C(16))) * 2U))
+          & static_cast<std::uint32_t>(UINT8_C(3))
+        );
+
+      result =
+        chars_add128
+        (
+          chars_add128(chars_shr128(softfloat_mul64To128(m, mul.v0), delta),
+                       chars_shl128(softfloat_mul64To128(m, mul.v1), static_cast<std::uint_fast8_t>(UINT8_C(64) - delta))),
+          uint128_compound { corr, static_cast<std::uint64_t>(UINT8_C(0)) }
+        );
+    }
+
+    return result;
+  }
+
+  constexpr auto chars_pow5_inv_split(std::uint32_t i) -> uint128_compound
+  {
+    // floor(2^(pow5bits(i) - 1 + 125) / 5^i) + 1 for 0 <= i <= 292.
+
+    // The multipliers of 5^-(26 * n), low and high parts.
+    constexpr std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(26))> inv_split2 =
+    {{
+      UINT64_C(0x0000000000000001), UINT64_C(0x2000000000000000),
+      UINT64_C(0x52A6C95FC0655034), UINT64_C(0x18C240C4AECB13BB),
+      UINT64_C(0x7CA8D50071DFC806), UINT64_C(0x1327FC58DA0F6FF5),
+      UINT64_C(0x6520247D3556476E), UINT64_C(0x1DA48CE468E7C702),
+      UINT64_C(0x6139CDD76802E6E9), UINT64_C(0x16EF5B40C2FC7779),
+      UINT64_C(0xF951A7FF43DE8C79), UINT64_C(0x11BEBDF578B2F391),
+      UINT64_C(0x7BE8BEE8D6E957E8), UINT64_C(0x1B758D848FAC54B0),
+      UINT64_C(0x8BD3F9E999A423EA), UINT64_C(0x153EDA614071A3B7),
+      UINT64_C(0x0848F973CB3EE3CE), UINT64_C(0x10701BD527B4978C),
+      UINT64_C(0x153285EBB9EFBFA2), UINT64_C(0x196FBB9BB44DB44D),
+      UINT64_C(0xADEEE7F86C07B696), UINT64_C(0x13AE3591F5B4D936),
+      UINT64_C(0x4D686A4EAF182222), UINT64_C(0x1E74404F3DAADA91),
+      UINT64_C(0x98C0A106E09EBD9F), UINT64_C(0x17900EA4FDA7C257)
+    }};
+
+    // The 2-bit corrections, sixteen per element.
+    constexpr std::array<std::uint32_t, static_cast<std::size_t>(UINT8_C(19))> offsets =
+    {{
+      UINT32_C(0x54544554), UINT32_C(0x04055545), UINT32_C(0x10041000), UINT32_C(0x00400414),
+      UINT32_C(0x40010000), UINT32_C(0x41155555), UINT32_C(0x00000454), UINT32_C(0x00010044),
+      UINT32_C(0x40000000), UINT32_C(0x44000041), UINT32_C(0x50454450), UINT32_C(0x55550054),
+      UINT32_C(0x51655554), UINT32_C(0x40004000), UINT32_C(0x01000001), UINT32_C(0x00010500),
+      UINT32_C(0x51515411), UINT32_C(0x05555554), UINT32_C(0x00000100)
+    }};
+
+    const auto base   = static_cast<std::uint32_t>(static_cast<std::uint32_t>(i + static_cast<std::uint32_t>(UINT8_C(25))) / static_cast<std::uint32_t>(UINT8_C(26)));
+    const auto base2  = static_cast<std::uint32_t>(base * static_cast<std::uint32_t>(UINT8_C(26)));
+    const auto offset = static_cast<std::uint32_t>(base2 - i);
+
+    const auto mul =
+      uint128_compound
+      {
+        inv_split2[static_cast<std::size_t>(static_cast<std::size_t>(base) * 2U)],
+        inv_split2[static_cast<std::size_t>(static_cast<std::size_t>(base) * 2U + 1U)]
+      };
+
+    auto result = mul;
+
+    if(offset != static_cast<std::uint32_t>(UINT8_C(0)))
+    {
+      const auto m = chars_pow5_small(offset);
+
+      const auto delta = static_cast<std::uint_fast8_t>(chars_pow5bits(static_cast<std::int32_t>(base2)) - chars_pow5bits(static_cast<std::int32_t>(i)));
+
+      const auto corr =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint32_t>
+            (
+                static_cast<std::uint32_t>(offsets[static_cast<std::size_t>(i / static_cast<std::uint32_t>(UINT8_C(16)))] >> static_cast<unsigned>(static_cast<unsigned>(i % static_cast<std::uint32_t>(UINT8_C(16))) * 2U))
+              & static_cast<std::uint32_t>(UINT8_C(3))
+            )
+          + static_cast<std::uint32_t>(UINT8_C(1))
+        );
+
+      // The multiplier is rounded up, so its truncated
+      // value is used here and the one is added back.
+      result =
+        chars_add128
+        (
+          chars_add128(chars_shr128(softfloat_mul64To128(m, static_cast<std::uint64_t>(mul.v0 - static_cast<std::uint64_t>(UINT8_C(1)))), delta),
+                       chars_shl128(softfloat_mul64To128(m, mul.v1), static_cast<std::uint_fast8_t>(UINT8_C(64) - delta))),
+          uint128_compound { corr, static_cast<std::uint64_t>(UINT8_C(0)) }
+        );
+    }
+
+    return result;
+  }
+
+  constexpr auto chars_mul_shift64(std::uint64_t m, const uint128_compound& mul, std::int32_t j) -> std::uint64_t
+  {
+    // Returns floor(m * mul / 2^j), where 64 <= j < 192.
+
+    const auto b0 = softfloat_mul64To128(m, mul.v0);
+    const auto b2 = softfloat_mul64To128(m, mul.v1);
+
+    const auto sum = chars_add128(uint128_compound { b0.v1, static_cast<std::uint64_t>(UINT8_C(0)) }, b2);
+
+    const auto s = static_cast<std::uint_fast8_t>(j - static_cast<std::int32_t>(INT8_C(64)));
+
+    return
+      (s == static_cast<std::uint_fast8_t>(UINT8_C(0)))
+        ? sum.v0
+        : ((s < static_cast<std::uint_fast8_t>(UINT8_C(64)))
+            ? chars_shr128(sum, s).v0
+            : static_cast<std::uint64_t>(sum.v1 >> static_cast<std::uint_fast8_t>(s - static_cast<std::uint_fast8_t>(UINT8_C(64)))));
+  }
+
+  constexpr auto chars_multiple_of_pow5(std::uint64_t value, std::int32_t p) -> bool
+  {
+    auto count = static_cast<std::int32_t>(INT8_C(0));
+
+    while((value != static_cast<std::uint64_t>(UINT8_C(0))) && ((value % static_cast<std::uint64_t>(UINT8_C(5))) == static_cast<std::uint64_t>(UINT8_C(0))))
+    {
+      value /= static_cast<std::uint64_t>(UINT8_C(5));
+
+      ++count;
+    }
+
+    return (count >= p);
+  }
+
+  constexpr auto chars_digits10(std::uint64_t value) -> std::int32_t
+  {
+    auto count = static_cast<std::int32_t>(INT8_C(1));
+
+    while(value >= static_cast<std::uint64_t>(UINT8_C(10)))
+    {
+      value /= static_cast<std::uint64_t>(UINT8_C(10));
+
+      ++count;
+    }
+
+    return count;
+  }
+
+  constexpr auto chars_shortest(std::uint64_t ieee_frac, std::int16_t ieee_exp) -> chars_decimal
+  {
+    // The value is nonzero and finite. The returned digits have
+    // no more than 17 decimal digits.
+
+    const auto is_subnormal = (ieee_exp == static_cast<std::int16_t>(INT8_C(0)));
+
+    const auto e2 =
+      static_cast<std::int32_t>
+      (
+        is_subnormal ? static_cast<std::int32_t>(INT16_C(-1076))
+                     : static_cast<std::int32_t>(static_cast<std::int32_t>(ieee_exp) - static_cast<std::int32_t>(INT16_C(1077)))
+      );
+
+    const auto m2 =
+      static_cast<std::uint64_t>
+      (
+        is_subnormal ? ieee_frac
+                     : static_cast<std::uint64_t>(ieee_frac | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)))
+      );
+
+    const auto accept_bounds = ((m2 & static_cast<std::uint64_t>(UINT8_C(1))) == static_cast<std::uint64_t>(UINT8_C(0)));
+
+    // The bounds of the rounding interval are mv + 2 and mv - 1 - mm_shift.
+    // The lower one is closer if the value is a power of two.
+    const auto mv = static_cast<std::uint64_t>(m2 << static_cast<unsigned>(UINT8_C(2)));
+
+    const auto mm_shift =
+      static_cast<std::uint64_t>
+      (
+        ((ieee_frac != static_cast<std::uint64_t>(UINT8_C(0))) || (ieee_exp <= static_cast<std::int16_t>(INT8_C(1)))) ? 1U : 0U
+      );
+
+    auto vr = std::uint64_t { };
+    auto vp = std::uint64_t { };
+    auto vm = std::uint64_t { };
+
+    auto e10 = std::int32_t { };
+
+    auto vm_is_trailing_zeros = false;
+    auto vr_is_trailing_zeros = false;
+
+    if(e2 >= static_cast<std::int32_t>(INT8_C(0)))
+    {
+      const auto q =
+        static_cast<std::int32_t>
+        (
+            chars_log10_pow2(e2)
+          - static_cast<std::int32_t>((e2 > static_cast<std::int32_t>(INT8_C(3))) ? 1 : 0)
+        );
+
+      e10 = q;
+
+      const auto k = static_cast<std::int32_t>(static_cast<std::int32_t>(INT8_C(124)) + chars_pow5bits(q));
+      const auto i = static_cast<std::int32_t>(static_cast<std::int32_t>(q + k) - e2);
+
+      const auto mul = chars_pow5_inv_split(static_cast<std::uint32_t>(q));
+
+      vr = chars_mul_shift64(mv, mul, i);
+      vp = chars_mul_shift64(static_cast<std::uint64_t>(mv + static_cast<std::uint64_t>(UINT8_C(2))), mul, i);
+      vm = chars_mul_shift64(static_cast<std::uint64_t>(static_cast<std::uint64_t>(mv - static_cast<std::uint64_t>(UINT8_C(1))) - mm_shift), mul, i);
+
+      if(q <= static_cast<std::int32_t>(INT8_C(21)))
+      {
+        // Only one of mp, mv and mm can be a multiple of 5, if any.
+        if((mv % static_cast<std::uint64_t>(UINT8_C(5))) == static_cast<std::uint64_t>(UINT8_C(0)))
+        {
+          vr_is_trailing_zeros = chars_multiple_of_pow5(mv, q);
+        }
+        else if(accept_bounds)
+        {
+          vm_is_trailing_zeros = chars_multiple_of_pow5(static_cast<std::uint64_t>(static_cast<std::uint64_t>(mv - static_cast<std::uint64_t>(UINT8_C(1))) - mm_shift), q);
+        }
+        else
+        {
+          vp -= static_cast<std::uint64_t>(chars_multiple_of_pow5(static_cast<std::uint64_t>(mv + static_cast<std::uint64_t>(UINT8_C(2))), q) ? 1U : 0U);
+        }
+      }
+    }
+    else
+    {
+      const auto q =
+        static_cast<std::int32_t>
+        (
+            chars_log10_pow5(-e2)
+          - static_cast<std::int32_t>((-e2 > static_cast<std::int32_t>(INT8_C(1))) ? 1 : 0)
+        );
+
+      e10 = static_cast<std::int32_t>(q + e2);
+
+      const auto i = static_cast<std::int32_t>(-e2 - q);
+      const auto k = static_cast<std::int32_t>(chars_pow5bits(i) - static_cast<std::int32_t>(INT8_C(125)));
+      const auto j = static_cast<std::int32_t>(q - k);
+
+      const auto mul = chars_pow5_split(static_cast<std::uint32_t>(i));
+
+      vr = chars_mul_shift64(mv, mul, j);
+      vp = chars_mul_shift64(static_cast<std::uint64_t>(mv + static_cast<std::uint64_t>(UINT8_C(2))), mul, j);
+      vm = chars_mul_shift64(static_cast<std::uint64_t>(static_cast<std::uint64_t>(mv - static_cast<std::uint64_t>(UINT8_C(1))) - mm_shift), mul, j);
+
+      if(q <= static_cast<std::int32_t>(INT8_C(1)))
+      {
+        // Here mv has at least q trailing zero bits.
+        vr_is_trailing_zeros = true;
+
+        if(accept_bounds)
+        {
+          vm_is_trailing_zeros = (mm_shift == static_cast<std::uint64_t>(UINT8_C(1)));
+        }
+        else
+        {
+          --vp;
+        }
+      }
+      else if(q < static_cast<std::int32_t>(INT8_C(63)))
+      {
+        vr_is_trailing_zeros =
+          (static_cast<std::uint64_t>(mv & static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(q)) - static_cast<std::uint64_t>(UINT8_C(1))))
+            == static_cast<std::uint64_t>(UINT8_C(0)));
+      }
+    }
+
+    // Remove the digits that are common to the whole interval.
+    auto removed = static_cast<std::int32_t>(INT8_C(0));
+
+    auto last_removed_digit = static_cast<std::uint8_t>(UINT8_C(0));
+
+    auto output = std::uint64_t { };
+
+    const auto ten = static_cast<std::uint64_t>(UINT8_C(10));
+
+    if(vm_is_trailing_zeros || vr_is_trailing_zeros)
+    {
+      // The rare case, in which the bounds or the value itself
+      // may be exactly decimal.
+      while((vp / ten) > (vm / ten))
+      {
+        vm_is_trailing_zeros = (vm_is_trailing_zeros && ((vm % ten) == static_cast<std::uint64_t>(UINT8_C(0))));
+        vr_is_trailing_zeros = (vr_is_trailing_zeros && (last_removed_digit == static_cast<std::uint8_t>(UINT8_C(0))));
+
+        last_removed_digit = static_cast<std::uint8_t>(vr % ten);
+
+        vr /= ten;
+        vp /= ten;
+        vm /= ten;
+
+        ++removed;
+      }
+
+      if(vm_is_trailing_zeros)
+      {
+        while((vm % ten) == static_cast<std::uint64_t>(UINT8_C(0)))
+        {
+          vr_is_trailing_zeros = (vr_is_trailing_zeros && (last_removed_digit == static_cast<std::uint8_t>(UINT8_C(0))));
+
+          last_removed_digit = static_cast<std::uint8_t>(vr % ten);
+
+          vr /= ten;
+          vp /= ten;
+          vm /= ten;
+
+          ++removed;
+        }
+      }
+
+      if(   vr_is_trailing_zeros
+         && (last_removed_digit == static_cast<std::uint8_t>(UINT8_C(5)))
+         && ((vr % static_cast<std::uint64_t>(UINT8_C(2))) == static_cast<std::uint64_t>(UINT8_C(0))))
+      {
+        // Round to even if the exact value is ...50...0.
+        last_removed_digit = static_cast<std::uint8_t>(UINT8_C(4));
+      }
+
+      const auto round_up =
+        (   ((vr == vm) && ((!accept_bounds) || (!vm_is_trailing_zeros)))
+         || (last_removed_digit >= static_cast<std::uint8_t>(UINT8_C(5))));
+
+      output = static_cast<std::uint64_t>(vr + static_cast<std::uint64_t>(round_up ? 1U : 0U));
+    }
+    else
+    {
+      // The common case.
+      auto round_up = false;
+
+      const auto hundred = static_cast<std::uint64_t>(UINT8_C(100));
+
+      if((vp / hundred) > (vm / hundred))
+      {
+        round_up = ((vr % hundred) >= static_cast<std::uint64_t>(UINT8_C(50)));
+
+        vr /= hundred;
+        vp /= hundred;
+        vm /= hundred;
+
+        removed = static_cast<std::int32_t>(removed + static_cast<std::int32_t>(INT8_C(2)));
+      }
+
+      while((vp / ten) > (vm / ten))
+      {
+        round_up = ((vr % ten) >= static_cast<std::uint64_t>(UINT8_C(5)));
+
+        vr /= ten;
+        vp /= ten;
+        vm /= ten;
+
+        ++removed;
+      }
+
+      output = static_cast<std::uint64_t>(vr + static_cast<std::uint64_t>(((vr == vm) || round_up) ? 1U : 0U));
+    }
+
+    return chars_decimal { output, static_cast<std::int32_t>(e10 + removed) };
+  }
+
+  class chars_shortest_digits
+  {
+  public:
+    // The decimal digits of the shortest representation, followed by
+    // zeros. These are split up front by divisions by the constant 10.
+    explicit constexpr chars_shortest_digits(std::uint64_t digits, std::int32_t count) noexcept
+      : my_count(count)
+    {
+      for(auto i = static_cast<std::int32_t>(count - 1); i >= static_cast<std::int32_t>(INT8_C(0)); --i)
+      {
+        my_digits[static_cast<std::size_t>(i)] = static_cast<char>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(digits % static_cast<std::uint64_t>(UINT8_C(10))) + static_cast<std::uint64_t>(UINT8_C(0x30))));
+
+        digits /= static_cast<std::uint64_t>(UINT8_C(10));
+      }
+    }
+
+    constexpr auto next() noexcept -> char
+    {
+      return ((my_index < my_count) ? my_digits[static_cast<std::size_t>(my_index++)] : '0');
+    }
+
+  private:
+    char         my_digits[static_cast<std::size_t>(UINT8_C(20))] { }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    std::int32_t my_count { };
+    std::int32_t my_index { };
+  };
+
+  class chars_exact_digits
+  {
+  public:
+    // The exact decimal digits of sig * 2^e2, beginning with the
+    // first nonzero one. These are produced in chunks of nine from
+    // a big integer of 32-bit limbs. The integer part is converted
+    // to base 10^9 up front, the fraction is multiplied by 10^9 for
+    // each chunk. Beyond the last nonzero digit come zeros.
+
+    explicit constexpr chars_exact_digits(std::uint64_t sig, std::int32_t e2) noexcept
+    {
+      if(sig != static_cast<std::uint64_t>(UINT8_C(0)))
+      {
+        if(e2 >= static_cast<std::int32_t>(INT8_C(0)))
+        {
+          // The value is an integer, having up to 1024 bits.
+          const auto limb_shift = static_cast<std::size_t>(static_cast<std::uint32_t>(e2) / static_cast<std::uint32_t>(UINT8_C(32)));
+          const auto bit_shift  = static_cast<unsigned>(static_cast<std::uint32_t>(e2) % static_cast<std::uint32_t>(UINT8_C(32)));
+
+          const auto lo = static_cast<std::uint64_t>(sig << bit_shift);
+          const auto hi = static_cast<std::uint32_t>((bit_shift == 0U) ? 0U : static_cast<std::uint32_t>(sig >> static_cast<unsigned>(64U - bit_shift)));
+
+          my_limbs[limb_shift]                                 = static_cast<std::uint32_t>(lo);
+          my_limbs[static_cast<std::size_t>(limb_shift + 1U)] = static_cast<std::uint32_t>(lo >> static_cast<unsigned>(UINT8_C(32)));
+          my_limbs[static_cast<std::size_t>(limb_shift + 2U)] = hi;
+
+          auto count = static_cast<std::size_t>(limb_shift + 3U);
+
+          while(count != static_cast<std::size_t>(UINT8_C(0)))
+          {
+            if(my_limbs[static_cast<std::size_t>(count - 1U)] == static_cast<std::uint32_t>(UINT8_C(0)))
+            {
+              --count;
+            }
+            else
+            {
+              // Divide by 10^9 and keep the remainder as the next chunk.
+              auto rem = static_cast<std::uint64_t>(UINT8_C(0));
+
+              for(auto i = count; i != static_cast<std::size_t>(UINT8_C(0)); --i)
+              {
+                const auto cur = static_cast<std::uint64_t>(static_cast<std::uint64_t>(rem << static_cast<unsigned>(UINT8_C(32))) | my_limbs[static_cast<std::size_t>(i - 1U)]);
+
+                my_limbs[static_cast<std::size_t>(i - 1U)] = static_cast<std::uint32_t>(cur / chunk_base());
+
+                rem = static_cast<std::uint64_t>(cur % chunk_base());
+              }
+
+              my_chunks[my_int_chunks] = static_cast<std::uint32_t>(rem);
+
+              ++my_int_chunks;
+            }
+          }
+        }
+        else
+        {
+          my_frac_bits = static_cast<std::uint32_t>(-e2);
+
+          const auto int_part =
+            static_cast<std::uint64_t>
+            (
+              (my_frac_bits < static_cast<std::uint32_t>(UINT8_C(64))) ? static_cast<std::uint64_t>(sig >> static_cast<unsigned>(my_frac_bits))
+                                                                        : static_cast<std::uint64_t>(UINT8_C(0))
+            );
+
+          const auto frac_part =
+            static_cast<std::uint64_t>
+            (
+              (my_frac_bits < static_cast<std::uint32_t>(UINT8_C(64)))
+                ? static_cast<std::uint64_t>(sig & static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(my_frac_bits)) - static_cast<std::uint64_t>(UINT8_C(1))))
+                : sig
+            );
+
+          // The integer part has less than 2^53.
+          my_chunks[static_cast<std::size_t>(UINT8_C(0))] = static_cast<std::uint32_t>(int_part % chunk_base());
+          my_chunks[static_cast<std::size_t>(UINT8_C(1))] = static_cast<std::uint32_t>(int_part / chunk_base());
+
+          my_int_chunks =
+            static_cast<std::size_t>
+            (
+              (my_chunks[static_cast<std::size_t>(UINT8_C(1))] != static_cast<std::uint32_t>(UINT8_C(0)))
+                ? static_cast<std::size_t>(UINT8_C(2))
+                : ((my_chunks[static_cast<std::size_t>(UINT8_C(0))] != static_cast<std::uint32_t>(UINT8_C(0))) ? static_cast<std::size_t>(UINT8_C(1)) : static_cast<std::size_t>(UINT8_C(0)))
+            );
+
+          // The fraction is scaled by 2^frac_bits and needs
+          // 30 more bits for the multiplication with 10^9.
+          my_frac_limbs = static_cast<std::size_t>(static_cast<std::uint32_t>(my_frac_bits + static_cast<std::uint32_t>(UINT8_C(61))) / static_cast<std::uint32_t>(UINT8_C(32)));
+
+          my_limbs[static_cast<std::size_t>(UINT8_C(0))] = static_cast<std::uint32_t>(frac_part);
+          my_limbs[static_cast<std::size_t>(UINT8_C(1))] = static_cast<std::uint32_t>(frac_part >> static_cast<unsigned>(UINT8_C(32)));
+        }
+
+        if(my_int_chunks != static_cast<std::size_t>(UINT8_C(0)))
+        {
+          --my_int_chunks;
+
+          set_chunk(my_chunks[my_int_chunks]);
+
+          my_exp10 = static_cast<std::int32_t>(static_cast<std::int32_t>(static_cast<std::int32_t>(my_int_chunks) * static_cast<std::int32_t>(INT8_C(9))) + static_cast<std::int32_t>(INT8_C(8)));
+        }
+        else
+        {
+          // Skip the leading zero chunks of a pure fraction.
+          my_exp10 = static_cast<std::int32_t>(INT8_C(-1));
+
+          auto chunk = frac_chunk();
+
+          while(chunk == static_cast<std::uint32_t>(UINT8_C(0)))
+          {
+            my_exp10 = static_cast<std::int32_t>(my_exp10 - static_cast<std::int32_t>(INT8_C(9)));
+
+            chunk = frac_chunk();
+          }
+
+          set_chunk(chunk);
+        }
+
+        while(my_digits[my_pos] == static_cast<std::uint8_t>(UINT8_C(0)))
+        {
+          ++my_pos;
+
+          --my_exp10;
+        }
+      }
+    }
+
+    // The decimal exponent of the first digit. This is zero for zero.
+    SOFT_DOUBLE_NODISCARD constexpr auto exp10() const noexcept -> std::int32_t { return my_exp10; }
+
+    constexpr auto next() noexcept -> std::uint8_t
+    {
+      if(my_pos == chunk_digits())
+      {
+        if(my_int_chunks != static_cast<std::size_t>(UINT8_C(0)))
+        {
+          --my_int_chunks;
+
+          set_chunk(my_chunks[my_int_chunks]);
+        }
+        else
+        {
+          set_chunk(frac_chunk());
+        }
+      }
+
+      return my_digits[my_pos++];
+    }
+
+    // Returns true if any of the digits after the current one is nonzero.
+    SOFT_DOUBLE_NODISCARD constexpr auto sticky() const noexcept -> bool
+    {
+      auto result = false;
+
+      for(auto i = my_pos; ((!result) && (i < chunk_digits())); ++i)
+      {
+        result = (my_digits[i] != static_cast<std::uint8_t>(UINT8_C(0)));
+      }
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); ((!result) && (i < my_int_chunks)); ++i)
+      {
+        result = (my_chunks[i] != static_cast<std::uint32_t>(UINT8_C(0)));
+      }
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); ((!result) && (i < my_frac_limbs)); ++i)
+      {
+        result = (my_limbs[i] != static_cast<std::uint32_t>(UINT8_C(0)));
+      }
+
+      return result;
+    }
+
+  private:
+    // These are plain arrays, since the elements of std::array
+    // can not be modified in a constant expression in C++14.
+    std::uint32_t   my_limbs [static_cast<std::size_t>(UINT8_C(36))] { }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    std::uint32_t   my_chunks[static_cast<std::size_t>(UINT8_C(36))] { }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    std::size_t     my_int_chunks { };
+    std::size_t     my_frac_limbs { };
+    std::uint32_t   my_frac_bits  { };
+    std::uint8_t    my_digits[static_cast<std::size_t>(UINT8_C(9))] { }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    std::size_t     my_pos        { static_cast<std::size_t>(UINT8_C(9)) };
+    std::int32_t    my_exp10      { };
+
+    static constexpr auto chunk_base  () noexcept -> std::uint32_t { return static_cast<std::uint32_t>(UINT32_C(1000000000)); }
+    static constexpr auto chunk_digits() noexcept -> std::size_t   { return static_cast<std::size_t>(UINT8_C(9)); }
+
+    constexpr auto set_chunk(std::uint32_t chunk) noexcept -> void
+    {
+      // Split the chunk into its nine digits by divisions by the constant 10.
+      for(auto i = chunk_digits(); i != static_cast<std::size_t>(UINT8_C(0)); --i)
+      {
+        my_digits[static_cast<std::size_t>(i - 1U)] = static_cast<std::uint8_t>(chunk % static_cast<std::uint32_t>(UINT8_C(10)));
+
+        chunk /= static_cast<std::uint32_t>(UINT8_C(10));
+      }
+
+      my_pos = static_cast<std::size_t>(UINT8_C(0));
+    }
+
+    constexpr auto frac_chunk() noexcept -> std::uint32_t
+    {
+      // Multiply the fraction by 10^9 and take the integer part.
+      auto carry = static_cast<std::uint64_t>(UINT8_C(0));
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < my_frac_limbs; ++i)
+      {
+        const auto t = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(my_limbs[i]) * chunk_base()) + carry);
+
+        my_limbs[i] = static_cast<std::uint32_t>(t);
+
+        carry = static_cast<std::uint64_t>(t >> static_cast<unsigned>(UINT8_C(32)));
+      }
+
+      const auto idx = static_cast<std::size_t>(my_frac_bits / static_cast<std::uint32_t>(UINT8_C(32)));
+      const auto sft = static_cast<unsigned>(my_frac_bits % static_cast<std::uint32_t>(UINT8_C(32)));
+
+      const auto two_limbs =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(my_limbs[idx])
+          | static_cast<std::uint64_t>
+            (
+              (static_cast<std::size_t>(idx + 1U) < my_frac_limbs)
+                ? static_cast<std::uint64_t>(static_cast<std::uint64_t>(my_limbs[static_cast<std::size_t>(idx + 1U)]) << static_cast<unsigned>(UINT8_C(32)))
+                : static_cast<std::uint64_t>(UINT8_C(0))
+            )
+        );
+
+      const auto chunk = static_cast<std::uint32_t>(two_limbs >> sft);
+
+      my_limbs[idx] = static_cast<std::uint32_t>(my_limbs[idx] & static_cast<std::uint32_t>(static_cast<std::uint32_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << sft) - static_cast<std::uint64_t>(UINT8_C(1)))));
+
+      for(auto i = static_cast<std::size_t>(idx + 1U); i < my_frac_limbs; ++i)
+      {
+        my_limbs[i] = static_cast<std::uint32_t>(UINT8_C(0));
+      }
+
+      return chunk;
+    }
+  };
+
+  class chars_rounded_digits
+  {
+  public:
+    // The exact digits rounded to nearest (ties to even) after the
+    // first count digits, followed by zeros. The rounding is planned
+    // in a first pass on a copy of the digits, so that no buffer is
+    // needed. A carry out of all nines gives a leading one, whereby
+    // the decimal exponent of the first digit increases by one.
+
+    explicit constexpr chars_rounded_digits(const chars_exact_digits& exact, std::int32_t count) noexcept
+      : my_exact(exact),
+        my_count(count)
+    {
+      auto digits = exact;
+
+      auto odd = false;
+
+      for(auto i = static_cast<std::int32_t>(INT8_C(0)); i < count; ++i)
+      {
+        const auto digit = digits.next();
+
+        if(digit != static_cast<std::uint8_t>(UINT8_C(9))) { my_last_non_nine = i; }
+        if(digit != static_cast<std::uint8_t>(UINT8_C(0))) { my_last_nonzero  = i; }
+
+        odd = ((static_cast<std::uint8_t>(digit & static_cast<std::uint8_t>(UINT8_C(1)))) != static_cast<std::uint8_t>(UINT8_C(0)));
+      }
+
+      // If count is negative, the first digit lies further to
+      // the right than the one after the last kept position.
+      const auto next_digit = ((count >= static_cast<std::int32_t>(INT8_C(0))) ? digits.next() : static_cast<std::uint8_t>(UINT8_C(0)));
+
+      my_round_up =
+        (   (next_digit > static_cast<std::uint8_t>(UINT8_C(5)))
+         || ((next_digit == static_cast<std::uint8_t>(UINT8_C(5))) && (odd || digits.sticky())));
+
+      my_carry = (my_round_up && (my_last_non_nine < static_cast<std::int32_t>(INT8_C(0))));
+
+      if(my_round_up)
+      {
+        my_last_nonzero = (my_carry ? static_cast<std::int32_t>(INT8_C(0)) : my_last_non_nine);
+      }
+    }
+
+    // Returns 1 if the rounding carries into a new leading digit.
+    SOFT_DOUBLE_NODISCARD constexpr auto carry() const noexcept -> std::int32_t { return (my_carry ? static_cast<std::int32_t>(INT8_C(1)) : static_cast<std::int32_t>(INT8_C(0))); }
+
+    // The index of the last nonzero rounded digit, or -1 for zero.
+    SOFT_DOUBLE_NODISCARD constexpr auto last_nonzero() const noexcept -> std::int32_t { return my_last_nonzero; }
+
+    constexpr auto next() noexcept -> char
+    {
+      auto digit = static_cast<std::uint8_t>(UINT8_C(0));
+
+      if(my_carry)
+      {
+        digit = static_cast<std::uint8_t>((my_index == static_cast<std::int32_t>(INT8_C(0))) ? 1U : 0U);
+      }
+      else if(my_index < my_count)
+      {
+        digit = my_exact.next();
+
+        if(my_round_up && (my_index >= my_last_non_nine))
+        {
+          digit = static_cast<std::uint8_t>((my_index == my_last_non_nine) ? static_cast<std::uint8_t>(digit + static_cast<std::uint8_t>(UINT8_C(1))) : static_cast<std::uint8_t>(UINT8_C(0)));
+        }
+      }
+
+      ++my_index;
+
+      return static_cast<char>(static_cast<std::uint8_t>(digit + static_cast<std::uint8_t>(UINT8_C(0x30))));
+    }
+
+  private:
+    chars_exact_digits my_exact;
+    std::int32_t       my_count;
+    std::int32_t       my_index         { };
+    std::int32_t       my_last_non_nine { static_cast<std::int32_t>(INT8_C(-1)) };
+    std::int32_t       my_last_nonzero  { static_cast<std::int32_t>(INT8_C(-1)) };
+    bool               my_round_up      { };
+    bool               my_carry         { };
+  };
+
+  struct chars_style
+  {
+    // The printf flags that are not expressible with chars_format,
+    // as used by the output stream operator.
+    bool upper      { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    bool plus       { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    bool point      { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    bool hex_prefix { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  constexpr auto chars_exponent_length(std::int32_t e) -> std::int32_t
+  {
+    // The length of e+dd or e-ddd.
+    return
+      static_cast<std::int32_t>
+      (
+        ((e >= static_cast<std::int32_t>(INT8_C(100))) || (e <= static_cast<std::int32_t>(INT8_C(-100))))
+          ? static_cast<std::int32_t>(INT8_C(5))
+          : static_cast<std::int32_t>(INT8_C(4))
+      );
+  }
+
+  constexpr auto chars_fixed_length(std::int32_t x, std::int32_t frac_digits, bool point) -> std::int32_t
+  {
+    return
+      static_cast<std::int32_t>
+      (
+          ((x >= static_cast<std::int32_t>(INT8_C(0))) ? static_cast<std::int32_t>(x + static_cast<std::int32_t>(INT8_C(1))) : static_cast<std::int32_t>(INT8_C(1)))
+        + static_cast<std::int32_t>(((frac_digits > static_cast<std::int32_t>(INT8_C(0))) || point) ? 1 : 0)
+        + frac_digits
+      );
+  }
+
+  constexpr auto chars_scientific_length(std::int32_t x, std::int32_t frac_digits, bool point) -> std::int32_t
+  {
+    return
+      static_cast<std::int32_t>
+      (
+          static_cast<std::int32_t>(INT8_C(1))
+        + static_cast<std::int32_t>(((frac_digits > static_cast<std::int32_t>(INT8_C(0))) || point) ? 1 : 0)
+        + frac_digits
+        + chars_exponent_length(x)
+      );
+  }
+
+  template<typename DigitSourceType>
+  constexpr auto chars_put_fixed(char* p, DigitSourceType& digits, std::int32_t x, std::int32_t frac_digits, bool point) -> char*
+  {
+    // The digit positions above the first digit (position x) are zeros.
+
+    if(x < static_cast<std::int32_t>(INT8_C(0)))
+    {
+      *p++ = '0';
+    }
+    else
+    {
+      for(auto pos = x; pos >= static_cast<std::int32_t>(INT8_C(0)); --pos)
+      {
+        *p++ = digits.next();
+      }
+    }
+
+    if((frac_digits > static_cast<std::int32_t>(INT8_C(0))) || point)
+    {
+      *p++ = '.';
+    }
+
+    for(auto pos = static_cast<std::int32_t>(INT8_C(-1)); pos >= -frac_digits; --pos)
+    {
+      *p++ = ((pos > x) ? '0' : digits.next());
+    }
+
+    return p;
+  }
+
+  template<typename DigitSourceType>
+  constexpr auto chars_put_scientific(char* p, DigitSourceType& digits, std::int32_t x, std::int32_t frac_digits, const chars_style& style) -> char*
+  {
+    *p++ = digits.next();
+
+    if((frac_digits > static_cast<std::int32_t>(INT8_C(0))) || style.point)
+    {
+      *p++ = '.';
+    }
+
+    for(auto i = static_cast<std::int32_t>(INT8_C(0)); i < frac_digits; ++i)
+    {
+      *p++ = digits.next();
+    }
+
+    *p++ = (style.upper ? 'E' : 'e');
+    *p++ = ((x < static_cast<std::int32_t>(INT8_C(0))) ? '-' : '+');
+
+    auto ax = static_cast<std::uint32_t>((x < static_cast<std::int32_t>(INT8_C(0))) ? -x : x);
+
+    if(ax >= static_cast<std::uint32_t>(UINT8_C(100)))
+    {
+      *p++ = static_cast<char>(static_cast<std::uint32_t>(static_cast<std::uint32_t>(ax / static_cast<std::uint32_t>(UINT8_C(100))) + static_cast<std::uint32_t>(UINT8_C(0x30))));
+
+      ax %= static_cast<std::uint32_t>(UINT8_C(100));
+    }
+
+    *p++ = static_cast<char>(static_cast<std::uint32_t>(static_cast<std::uint32_t>(ax / static_cast<std::uint32_t>(UINT8_C(10))) + static_cast<std::uint32_t>(UINT8_C(0x30))));
+    *p++ = static_cast<char>(static_cast<std::uint32_t>(static_cast<std::uint32_t>(ax % static_cast<std::uint32_t>(UINT8_C(10))) + static_cast<std::uint32_t>(UINT8_C(0x30))));
+
+    return p;
+  }
+
+  constexpr auto chars_convert_hex(char* first, char* last, std::uint64_t u, std::int32_t precision, const chars_style& style) -> to_chars_result
+  {
+    // As printf %a, but without the prefix 0x unless requested. A negative
+    // precision gives the shortest form. Subnormals are printed as 0.xxxp-1022.
+
+    const auto ieee_exp  = expF64UI(u);
+    const auto ieee_frac = fracF64UI(u);
+
+    auto lead = static_cast<std::uint8_t>((ieee_exp != static_cast<std::int16_t>(INT8_C(0))) ? 1U : 0U);
+
+    const auto e =
+      static_cast<std::int32_t>
+      (
+        (ieee_exp != static_cast<std::int16_t>(INT8_C(0)))
+          ? static_cast<std::int32_t>(static_cast<std::int32_t>(ieee_exp) - static_cast<std::int32_t>(INT16_C(1023)))
+          : ((ieee_frac != static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<std::int32_t>(INT16_C(-1022)) : static_cast<std::int32_t>(INT8_C(0)))
+      );
+
+    auto hex_digits = ieee_frac;
+    auto count      = static_cast<std::int32_t>(INT8_C(13));
+    auto zeros      = static_cast<std::int32_t>(INT8_C(0));
+
+    if(precision < static_cast<std::int32_t>(INT8_C(0)))
+    {
+      while((count > static_cast<std::int32_t>(INT8_C(0))) && (static_cast<std::uint64_t>(hex_digits & static_cast<std::uint64_t>(UINT8_C(0xF))) == static_cast<std::uint64_t>(UINT8_C(0))))
+      {
+        hex_digits >>= static_cast<unsigned>(UINT8_C(4));
+
+        --count;
+      }
+    }
+    else if(precision < count)
+    {
+      // Round to nearest, ties to even.
+      const auto shift = static_cast<unsigned>(static_cast<unsigned>(count - precision) * 4U);
+
+      const auto half = static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(shift - 1U));
+      const auto rem  = static_cast<std::uint64_t>(ieee_frac & static_cast<std::uint64_t>(static_cast<std::uint64_t>(half << static_cast<unsigned>(UINT8_C(1))) - static_cast<std::uint64_t>(UINT8_C(1))));
+
+      hex_digits = static_cast<std::uint64_t>(ieee_frac >> shift);
+
+      // Without hexadecimal places, the leading digit decides a tie.
+      const auto odd =
+        (static_cast<std::uint64_t>
+        (
+            ((precision == static_cast<std::int32_t>(INT8_C(0))) ? static_cast<std::uint64_t>(lead) : hex_digits)
+          & static_cast<std::uint64_t>(UINT8_C(1))
+        ) != static_cast<std::uint64_t>(UINT8_C(0)));
+
+      if((rem > half) || ((rem == half) && odd))
+      {
+        ++hex_digits;
+
+        if((hex_digits >> static_cast<unsigned>(static_cast<unsigned>(precision) * 4U)) != static_cast<std::uint64_t>(UINT8_C(0)))
+        {
+          hex_digits = static_cast<std::uint64_t>(UINT8_C(0));
+
+          ++lead;
+        }
+      }
+
+      count = precision;
+    }
+    else
+    {
+      zeros = static_cast<std::int32_t>(precision - count);
+    }
+
+    const auto ae = static_cast<std::int32_t>((e < static_cast<std::int32_t>(INT8_C(0))) ? -e : e);
+
+    const auto exp_digits =
+      static_cast<std::int32_t>
+      (
+        (ae >= static_cast<std::int32_t>(INT16_C(1000))) ? 4 : ((ae >= static_cast<std::int32_t>(INT8_C(100))) ? 3 : ((ae >= static_cast<std::int32_t>(INT8_C(10))) ? 2 : 1))
+      );
+
+    const auto has_point = (((count + zeros) > static_cast<std::int32_t>(INT8_C(0))) || style.point);
+
+    const auto len =
+      static_cast<std::int32_t>
+      (
+          static_cast<std::int32_t>(style.hex_prefix ? 3 : 1)
+        + static_cast<std::int32_t>(has_point ? 1 : 0)
+        + count
+        + zeros
+        + static_cast<std::int32_t>(INT8_C(2))
+        + exp_digits
+      );
+
+    auto result = to_chars_result { last, chars_errc::value_too_large };
+
+    if(static_cast<std::ptrdiff_t>(len) <= static_cast<std::ptrdiff_t>(last - first))
+    {
+      auto p = first;
+
+      if(style.hex_prefix)
+      {
+        *p++ = '0';
+        *p++ = (style.upper ? 'X' : 'x');
+      }
+
+      *p++ = static_cast<char>(static_cast<std::uint8_t>(lead + static_cast<std::uint8_t>(UINT8_C(0x30))));
+
+      if(has_point)
+      {
+        *p++ = '.';
+      }
+
+      for(auto i = static_cast<std::int32_t>(count - 1); i >= static_cast<std::int32_t>(INT8_C(0)); --i)
+      {
+        const auto nibble = static_cast<std::uint8_t>(static_cast<std::uint64_t>(hex_digits >> static_cast<unsigned>(static_cast<unsigned>(i) * 4U)) & static_cast<std::uint64_t>(UINT8_C(0xF)));
+
+        *p++ =
+          static_cast<char>
+          (
+            (nibble < static_cast<std::uint8_t>(UINT8_C(10)))
+              ? static_cast<std::uint8_t>(nibble + static_cast<std::uint8_t>(UINT8_C(0x30)))
+              : static_cast<std::uint8_t>(static_cast<std::uint8_t>(nibble - static_cast<std::uint8_t>(UINT8_C(10))) + static_cast<std::uint8_t>(style.upper ? UINT8_C(0x41) : UINT8_C(0x61)))
+          );
+      }
+
+      for(auto i = static_cast<std::int32_t>(INT8_C(0)); i < zeros; ++i)
+      {
+        *p++ = '0';
+      }
+
+      *p++ = (style.upper ? 'P' : 'p');
+      *p++ = ((e < static_cast<std::int32_t>(INT8_C(0))) ? '-' : '+');
+
+      auto div = static_cast<std::int32_t>(INT8_C(1));
+
+      for(auto i = static_cast<std::int32_t>(INT8_C(1)); i < exp_digits; ++i)
+      {
+        div = static_cast<std::int32_t>(div * static_cast<std::int32_t>(INT8_C(10)));
+      }
+
+      for( ; div != static_cast<std::int32_t>(INT8_C(0)); div = static_cast<std::int32_t>(div / static_cast<std::int32_t>(INT8_C(10))))
+      {
+        *p++ = static_cast<char>(static_cast<std::int32_t>(static_cast<std::int32_t>(static_cast<std::int32_t>(ae / div) % static_cast<std::int32_t>(INT8_C(10))) + static_cast<std::int32_t>(INT8_C(0x30))));
+      }
+
+      result = to_chars_result { p, chars_errc { } };
+    }
+
+    return result;
+  }
+
+  constexpr auto chars_convert_shortest(char* first, char* last, std::uint64_t u, chars_format fmt, bool is_plain) -> to_chars_result
+  {
+    // The shortest representation that rounds back to the value. The
+    // general format is fixed for exponents in [-4, 6) and otherwise
+    // scientific. Without a format, the shorter of both is taken and
+    // fixed wins a tie. Values from 2^53 upward are printed in full
+    // as integers in fixed format, just as printf %.0f does.
+
+    const auto ieee_exp  = expF64UI(u);
+    const auto ieee_frac = fracF64UI(u);
+
+    const auto is_zero = ((u & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF))) == static_cast<std::uint64_t>(UINT8_C(0)));
+
+    const auto dec = (is_zero ? chars_decimal { } : chars_shortest(ieee_frac, ieee_exp));
+
+    const auto count = chars_digits10(dec.digits);
+
+    const auto x = static_cast<std::int32_t>(static_cast<std::int32_t>(dec.exp10 + count) - static_cast<std::int32_t>(INT8_C(1)));
+
+    const auto fixed_frac =
+      static_cast<std::int32_t>
+      (
+        (x < static_cast<std::int32_t>(count - 1)) ? static_cast<std::int32_t>(static_cast<std::int32_t>(count - 1) - x) : static_cast<std::int32_t>(INT8_C(0))
+      );
+
+    const auto sci_frac = static_cast<std::int32_t>(count - 1);
+
+    const auto fixed_len = chars_fixed_length     (x, fixed_frac, false);
+    const auto sci_len   = chars_scientific_length(x, sci_frac,   false);
+
+    const auto use_fixed =
+      (is_plain ? (fixed_len <= sci_len)
+                : ((fmt == chars_format::fixed) || (   (fmt == chars_format::general)
+                                                     && (x >= static_cast<std::int32_t>(INT8_C(-4)))
+                                                     && (x <  static_cast<std::int32_t>(INT8_C(6))))));
+
+    auto result = to_chars_result { last, chars_errc::value_too_large };
+
+    if(use_fixed && (ieee_exp > static_cast<std::int16_t>(INT16_C(1075))))
+    {
+      const auto exact =
+        chars_exact_digits
+        {
+          static_cast<std::uint64_t>(ieee_frac | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000))),
+          static_cast<std::int32_t>(static_cast<std::int32_t>(ieee_exp) - static_cast<std::int32_t>(INT16_C(1075)))
+        };
+
+      const auto x_exact = exact.exp10();
+
+      if(static_cast<std::ptrdiff_t>(x_exact) < static_cast<std::ptrdiff_t>(last - first))
+      {
+        auto digits = chars_rounded_digits { exact, static_cast<std::int32_t>(x_exact + static_cast<std::int32_t>(INT8_C(1))) };
+
+        result = to_chars_result { chars_put_fixed(first, digits, x_exact, static_cast<std::int32_t>(INT8_C(0)), false), chars_errc { } };
+      }
+    }
+    else if(static_cast<std::ptrdiff_t>(use_fixed ? fixed_len : sci_len) <= static_cast<std::ptrdiff_t>(last - first))
+    {
+      auto digits = chars_shortest_digits { dec.digits, count };
+
+      char* p { };
+
+      if(!use_fixed)
+      {
+        p = chars_put_scientific(first, digits, x, sci_frac, chars_style { });
+      }
+      else
+      {
+        p = chars_put_fixed(first, digits, x, fixed_frac, false);
+      }
+
+      result = to_chars_result { p, chars_errc { } };
+    }
+
+    return result;
+  }
+
+  constexpr auto chars_convert_precision(char* first, char* last, std::uint64_t u, chars_format fmt, std::int32_t precision, const chars_style& style) -> to_chars_result
+  {
+    // As printf %.*e, %.*f and %.*g, with exact digits and rounding to
+    // nearest, ties to even. Here the precision is not negative.
+
+    const auto ieee_exp  = expF64UI(u);
+    const auto ieee_frac = fracF64UI(u);
+
+    const auto exact =
+      chars_exact_digits
+      {
+        (ieee_exp != static_cast<std::int16_t>(INT8_C(0))) ? static_cast<std::uint64_t>(ieee_frac | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000))) : ieee_frac,
+        (ieee_exp != static_cast<std::int16_t>(INT8_C(0))) ? static_cast<std::int32_t>(static_cast<std::int32_t>(ieee_exp) - static_cast<std::int32_t>(INT16_C(1075))) : static_cast<std::int32_t>(INT16_C(-1074))
+      };
+
+    const auto x0 = exact.exp10();
+
+    // The count of significant digits for %g.
+    const auto p_general =
+      static_cast<std::int32_t>
+      (
+        (precision == static_cast<std::int32_t>(INT8_C(0))) ? static_cast<std::int32_t>(INT8_C(1)) : precision
+      );
+
+    const auto count =
+      static_cast<std::int32_t>
+      (
+        (fmt == chars_format::fixed)
+          ? static_cast<std::int32_t>(static_cast<std::int32_t>(x0 + precision) + static_cast<std::int32_t>(INT8_C(1)))
+          : ((fmt == chars_format::scientific) ? static_cast<std::int32_t>(precision + static_cast<std::int32_t>(INT8_C(1))) : p_general)
+      );
+
+    auto digits = chars_rounded_digits { exact, count };
+
+    const auto x = static_cast<std::int32_t>(x0 + digits.carry());
+
+    auto use_fixed = (fmt == chars_format::fixed);
+
+    auto frac_digits = precision;
+
+    if(fmt == chars_format::general)
+    {
+      use_fixed = ((x >= static_cast<std::int32_t>(INT8_C(-4))) && (x < p_general));
+
+      // Without the flag point, the trailing zeros are removed.
+      const auto last_digit =
+        static_cast<std::int32_t>
+        (
+          style.point ? static_cast<std::int32_t>(p_general - 1) : digits.last_nonzero()
+        );
+
+      const auto frac_general = static_cast<std::int32_t>(use_fixed ? static_cast<std::int32_t>(last_digit - x) : last_digit);
+
+      frac_digits = ((frac_general > static_cast<std::int32_t>(INT8_C(0))) ? frac_general : static_cast<std::int32_t>(INT8_C(0)));
+    }
+
+    const auto len =
+      (use_fixed ? chars_fixed_length     (x, frac_digits, style.point)
+                 : chars_scientific_length(x, frac_digits, style.point));
+
+    auto result = to_chars_result { last, chars_errc::value_too_large };
+
+    if(static_cast<std::ptrdiff_t>(len) <= static_cast<std::ptrdiff_t>(last - first))
+    {
+      char* p =
+        (use_fixed ? chars_put_fixed     (first, digits, x, frac_digits, style.point)
+                   : chars_put_scientific(first, digits, x, frac_digits, style));
+
+      result = to_chars_result { p, chars_errc { } };
+    }
+
+    return result;
+  }
+
+  constexpr auto chars_convert(char* first, char* last, std::uint64_t u, chars_format fmt, std::int32_t precision, bool is_plain, const chars_style& style) -> to_chars_result
+  {
+    // Write the sign, the special values and dispatch the rest.
+    // A negative precision requests the shortest representation.
+
+    auto result = to_chars_result { last, chars_errc::value_too_large };
+
+    const auto has_sign = (signF64UI(u) || style.plus);
+
+    if(   (fmt != chars_format::scientific)
+       && (fmt != chars_format::fixed)
+       && (fmt != chars_format::hex)
+       && (fmt != chars_format::general))
+    {
+      result = to_chars_result { last, chars_errc::invalid_argument };
+    }
+    else if(   (first < last)
+            && (   (precision < static_cast<std::int32_t>(INT8_C(0)))
+                || ((fmt == chars_format::general) && (!style.point))
+                || (static_cast<std::ptrdiff_t>(precision) < static_cast<std::ptrdiff_t>(last - first))))
+    {
+      // A precision beyond the buffer can only fit in %g without point.
+      auto p = first;
+
+      if(has_sign)
+      {
+        *p++ = (signF64UI(u) ? '-' : '+');
+      }
+
+      if(expF64UI(u) == static_cast<std::int16_t>(INT16_C(0x7FF)))
+      {
+        const auto is_nan = (fracF64UI(u) != static_cast<std::uint64_t>(UINT8_C(0)));
+
+        if(static_cast<std::ptrdiff_t>(last - p) >= static_cast<std::ptrdiff_t>(INT8_C(3)))
+        {
+          const char* text = (is_nan ? (style.upper ? "NAN" : "nan") : (style.upper ? "INF" : "inf"));
+
+          *p++ = text[static_cast<std::size_t>(UINT8_C(0))];
+          *p++ = text[static_cast<std::size_t>(UINT8_C(1))];
+          *p++ = text[static_cast<std::size_t>(UINT8_C(2))];
+
+          result = to_chars_result { p, chars_errc { } };
+        }
+      }
+      else if(fmt == chars_format::hex)
+      {
+        result = chars_convert_hex(p, last, u, precision, style);
+      }
+      else if(precision < static_cast<std::int32_t>(INT8_C(0)))
+      {
+        result = chars_convert_shortest(p, last, u, fmt, is_plain);
+      }
+      else
+      {
+        // Beyond 800 significant digits, all digits of a binary64
+        // value are zero and %g gives the same without the point.
+        result =
+          chars_convert_precision
+          (
+            p,
+            last,
+            u,
+            fmt,
+            (((fmt == chars_format::general) && (!style.point) && (precision > static_cast<std::int32_t>(INT16_C(800)))) ? static_cast<std::int32_t>(INT16_C(800)) : precision),
+            style
+          );
+      }
+    }
+
+    return result;
+  }
+
+  // Parsing of binary64 representations from characters, see from_chars.
+
+  // A decimal significand w of up to 19 digits and its exponent q are
+  // converted with the method of D. Lemire (Software: Practice and
+  // Experience 51, 2021), which goes back to M. Eisel. The 128-bit
+  // multipliers of 5^q are those of Ryu above, which are not exact.
+  // When the rounding of w * 10^q lies within their error, or when
+  // more digits are given, the decision is made by an exact comparison
+  // with the halfway point in big integer arithmetic.
+
+  struct chars_pow5_wide
+  {
+    uint128_compound m  { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::int32_t     e2 { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  constexpr auto chars_pow5_wide_of(std::int32_t q) -> chars_pow5_wide
+  {
+    // Returns m and e2 with 5^q = m * 2^e2 to within 64 units in the
+    // last place of m, where 2^127 <= m < 2^128 and -342 <= q <= 308.
+
+    auto result = chars_pow5_wide { };
+
+    if(q >= static_cast<std::int32_t>(INT8_C(0)))
+    {
+      result.m  = chars_shl128(chars_pow5_split(static_cast<std::uint32_t>(q)), static_cast<std::uint_fast8_t>(UINT8_C(3)));
+      result.e2 = static_cast<std::int32_t>(chars_pow5bits(q) - static_cast<std::int32_t>(INT16_C(128)));
+    }
+    else if(q >= static_cast<std::int32_t>(INT16_C(-292)))
+    {
+      result.m  = chars_shl128(chars_pow5_inv_split(static_cast<std::uint32_t>(-q)), static_cast<std::uint_fast8_t>(UINT8_C(3)));
+      result.e2 = static_cast<std::int32_t>(-static_cast<std::int32_t>(chars_pow5bits(-q) + static_cast<std::int32_t>(INT16_C(127))));
+    }
+    else
+    {
+      // Beyond the table, 5^q = 5^-292 * 5^(q + 292), where the
+      // product of the multipliers is truncated to 128 bits.
+      const auto a = chars_pow5_wide_of(static_cast<std::int32_t>(INT16_C(-292)));
+      const auto b = chars_pow5_wide_of(static_cast<std::int32_t>(q + static_cast<std::int32_t>(INT16_C(292))));
+
+      const auto p01 = softfloat_mul64To128(a.m.v0, b.m.v1);
+      const auto p10 = softfloat_mul64To128(a.m.v1, b.m.v0);
+
+      const auto lo = static_cast<std::uint64_t>(p01.v0 + p10.v0);
+
+      const auto top =
+        chars_add128
+        (
+          chars_add128(softfloat_mul64To128(a.m.v1, b.m.v1), uint128_compound { p01.v1, static_cast<std::uint64_t>(UINT8_C(0)) }),
+          uint128_compound { p10.v1, static_cast<std::uint64_t>(UINT8_C(0)) }
+        );
+
+      const auto top_carried = chars_add128(top, uint128_compound { static_cast<std::uint64_t>((lo < p01.v0) ? 1U : 0U), static_cast<std::uint64_t>(UINT8_C(0)) });
+
+      const auto is_normalized = ((top_carried.v1 >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint64_t>(UINT8_C(0)));
+
+      result.m =
+        (is_normalized ? top_carried
+                       : uint128_compound
+                         {
+                           static_cast<std::uint64_t>(static_cast<std::uint64_t>(top_carried.v0 << static_cast<unsigned>(UINT8_C(1))) | static_cast<std::uint64_t>(lo >> static_cast<unsigned>(UINT8_C(63)))),
+                           static_cast<std::uint64_t>(static_cast<std::uint64_t>(top_carried.v1 << static_cast<unsigned>(UINT8_C(1))) | static_cast<std::uint64_t>(top_carried.v0 >> static_cast<unsigned>(UINT8_C(63))))
+                         });
+
+      result.e2 = static_cast<std::int32_t>(static_cast<std::int32_t>(a.e2 + b.e2) + static_cast<std::int32_t>(is_normalized ? INT16_C(128) : INT16_C(127)));
+    }
+
+    return result;
+  }
+
+  struct chars_binary
+  {
+    std::uint64_t bits    { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    bool          decided { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  constexpr auto chars_decimal_to_binary(std::uint64_t w, std::int32_t q) -> chars_binary
+  {
+    // Returns the binary64 representation of w * 10^q rounded to nearest,
+    // for w != 0 and -342 <= q <= 308. If the rounding is not decided,
+    // the representation of the value rounded toward zero is returned.
+
+    constexpr auto error = static_cast<std::uint64_t>(UINT8_C(128));
+
+    const auto lz = softfloat_countLeadingZeros64(w);
+    const auto wn = static_cast<std::uint64_t>(w << lz);
+    const auto pw = chars_pow5_wide_of(q);
+
+    // The upper 128 bits r of the product wn * m, with 2^126 <= r < 2^128.
+    const auto r =
+      chars_add128
+      (
+        softfloat_mul64To128(wn, pw.m.v1),
+        uint128_compound { softfloat_mul64To128(wn, pw.m.v0).v1, static_cast<std::uint64_t>(UINT8_C(0)) }
+      );
+
+    const auto upper = static_cast<std::int32_t>(r.v1 >> static_cast<unsigned>(UINT8_C(63)));
+
+    // The value is r * 2^e0, and its leading bit has the biased exponent below.
+    const auto e0     = static_cast<std::int32_t>(static_cast<std::int32_t>(pw.e2 + q) - static_cast<std::int32_t>(static_cast<std::int32_t>(lz) - static_cast<std::int32_t>(INT8_C(64))));
+    const auto biased = static_cast<std::int32_t>(static_cast<std::int32_t>(e0 + upper) + static_cast<std::int32_t>(INT16_C(1149)));
+
+    auto result = chars_binary { static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000)), true };
+
+    if(biased < static_cast<std::int32_t>(INT16_C(2047)))
+    {
+      // The count of bits of r below the last place of the result.
+      const auto p =
+        static_cast<std::int32_t>
+        (
+          (biased >= static_cast<std::int32_t>(INT8_C(1))) ? static_cast<std::int32_t>(upper + static_cast<std::int32_t>(INT8_C(74)))
+                                                           : static_cast<std::int32_t>(static_cast<std::int32_t>(INT16_C(-1074)) - e0)
+        );
+
+      if(p > static_cast<std::int32_t>(INT16_C(128)))
+      {
+        result = chars_binary { static_cast<std::uint64_t>(UINT8_C(0)), true };
+      }
+      else
+      {
+        const auto s = static_cast<unsigned>(p - static_cast<std::int32_t>(INT8_C(64)));
+
+        const auto base =
+          static_cast<std::uint64_t>
+          (
+            (biased >= static_cast<std::int32_t>(INT8_C(1))) ? static_cast<std::uint64_t>(static_cast<std::uint64_t>(biased - static_cast<std::int32_t>(INT8_C(1))) << static_cast<unsigned>(UINT8_C(52)))
+                                                             : static_cast<std::uint64_t>(UINT8_C(0))
+          );
+
+        const auto mant = ((s == 64U) ? static_cast<std::uint64_t>(UINT8_C(0)) : static_cast<std::uint64_t>(r.v1 >> s));
+        const auto rest = ((s == 64U) ? r.v1 : static_cast<std::uint64_t>(r.v1 & static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << s) - static_cast<std::uint64_t>(UINT8_C(1)))));
+        const auto half = static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(s - 1U));
+
+        // Is the remainder below the last place within the error of one half?
+        const auto is_ambiguous =
+          (   ((rest == half) && (r.v0 <= error))
+           || ((static_cast<std::uint64_t>(rest + static_cast<std::uint64_t>(UINT8_C(1))) == half) && (static_cast<std::uint64_t>(~r.v0) < error)));
+
+        result =
+          chars_binary
+          {
+            static_cast<std::uint64_t>(static_cast<std::uint64_t>(base + mant) + static_cast<std::uint64_t>(((!is_ambiguous) && (rest >= half)) ? 1U : 0U)),
+            (!is_ambiguous)
+          };
+      }
+    }
+
+    return result;
+  }
+
+  class chars_bigint
+  {
+  public:
+    explicit constexpr chars_bigint(std::uint64_t value)
+    {
+      my_limbs[static_cast<std::size_t>(UINT8_C(0))] = static_cast<std::uint32_t>(value);
+      my_limbs[static_cast<std::size_t>(UINT8_C(1))] = static_cast<std::uint32_t>(value >> static_cast<unsigned>(UINT8_C(32)));
+
+      my_count = ((my_limbs[static_cast<std::size_t>(UINT8_C(1))] != static_cast<std::uint32_t>(UINT8_C(0))) ? static_cast<std::size_t>(UINT8_C(2)) : static_cast<std::size_t>(UINT8_C(1)));
+    }
+
+    constexpr auto mul_add(std::uint32_t m, std::uint32_t a) -> void
+    {
+      // Replace the value by value * m + a.
+      auto carry = static_cast<std::uint64_t>(a);
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < my_count; ++i)
+      {
+        const auto t = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(my_limbs[i]) * m) + carry);
+
+        my_limbs[i] = static_cast<std::uint32_t>(t);
+
+        carry = static_cast<std::uint64_t>(t >> static_cast<unsigned>(UINT8_C(32)));
+      }
+
+      if(carry != static_cast<std::uint64_t>(UINT8_C(0)))
+      {
+        my_limbs[my_count++] = static_cast<std::uint32_t>(carry);
+      }
+    }
+
+    constexpr auto mul_pow5(std::int32_t n) -> void
+    {
+      // Multiply by 5^n in steps of 5^13, the largest power below 2^32.
+      for( ; n >= static_cast<std::int32_t>(INT8_C(13)); n -= static_cast<std::int32_t>(INT8_C(13)))
+      {
+        mul_add(static_cast<std::uint32_t>(UINT32_C(1220703125)), static_cast<std::uint32_t>(UINT8_C(0)));
+      }
+
+      if(n > static_cast<std::int32_t>(INT8_C(0)))
+      {
+        mul_add(static_cast<std::uint32_t>(chars_pow5_small(static_cast<std::uint32_t>(n))), static_cast<std::uint32_t>(UINT8_C(0)));
+      }
+    }
+
+    constexpr auto shl(std::int32_t n) -> void
+    {
+      // Multiply by 2^n.
+      const auto limb_shift = static_cast<std::size_t>(static_cast<std::uint32_t>(n) / static_cast<std::uint32_t>(UINT8_C(32)));
+      const auto bit_shift  = static_cast<unsigned>   (static_cast<std::uint32_t>(n) % static_cast<std::uint32_t>(UINT8_C(32)));
+
+      my_limbs[my_count] = static_cast<std::uint32_t>(UINT8_C(0));
+
+      for(auto i = static_cast<std::size_t>(my_count + 1U); i != static_cast<std::size_t>(UINT8_C(0)); --i)
+      {
+        const auto hi = static_cast<std::uint32_t>(my_limbs[static_cast<std::size_t>(i - 1U)] << bit_shift);
+        const auto lo =
+          static_cast<std::uint32_t>
+          (
+            ((bit_shift == 0U) || (i == static_cast<std::size_t>(UINT8_C(1))))
+              ? static_cast<std::uint32_t>(UINT8_C(0))
+              : static_cast<std::uint32_t>(my_limbs[static_cast<std::size_t>(i - 2U)] >> static_cast<unsigned>(32U - bit_shift))
+          );
+
+        my_limbs[static_cast<std::size_t>(static_cast<std::size_t>(i - 1U) + limb_shift)] = static_cast<std::uint32_t>(hi | lo);
+      }
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < limb_shift; ++i)
+      {
+        my_limbs[i] = static_cast<std::uint32_t>(UINT8_C(0));
+      }
+
+      my_count = static_cast<std::size_t>(static_cast<std::size_t>(my_count + 1U) + limb_shift);
+
+      while((my_count > static_cast<std::size_t>(UINT8_C(1))) && (my_limbs[static_cast<std::size_t>(my_count - 1U)] == static_cast<std::uint32_t>(UINT8_C(0))))
+      {
+        --my_count;
+      }
+    }
+
+    SOFT_DOUBLE_NODISCARD constexpr auto compare(const chars_bigint& other) const -> std::int_fast8_t
+    {
+      auto result = static_cast<std::int_fast8_t>((my_count > other.my_count) ? INT8_C(1) : ((my_count < other.my_count) ? INT8_C(-1) : INT8_C(0)));
+
+      for(auto i = my_count; ((result == static_cast<std::int_fast8_t>(INT8_C(0))) && (i != static_cast<std::size_t>(UINT8_C(0)))); --i)
+      {
+        const auto a = my_limbs      [static_cast<std::size_t>(i - 1U)];
+        const auto b = other.my_limbs[static_cast<std::size_t>(i - 1U)];
+
+        result = static_cast<std::int_fast8_t>((a > b) ? INT8_C(1) : ((a < b) ? INT8_C(-1) : INT8_C(0)));
+      }
+
+      return result;
+    }
+
+  private:
+    // The comparisons below need at most 2700 bits. This is a plain
+    // array, since the elements of std::array can not be modified in
+    // a constant expression in C++14.
+    std::uint32_t my_limbs[static_cast<std::size_t>(UINT8_C(96))] { }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    std::size_t   my_count { };
+  };
+
+  constexpr auto chars_is_digit(char c) -> bool
+  {
+    return ((c >= '0') && (c <= '9'));
+  }
+
+  constexpr auto chars_decide(const char* first, const char* last, std::int32_t exp10, std::uint64_t candidate) -> std::uint64_t
+  {
+    // Compare the decimal value of the digits in [first, last), possibly
+    // with a point, times 10^exp10 with the halfway point between the
+    // candidate and its successor. The halfway points have at most 767
+    // significant digits, so that any digits beyond 780 only count as
+    // being nonzero.
+
+    constexpr auto max_digits = static_cast<std::int32_t>(INT16_C(780));
+
+    auto x = chars_bigint { static_cast<std::uint64_t>(UINT8_C(0)) };
+
+    auto used   = static_cast<std::int32_t>(INT8_C(0));
+    auto chunk  = static_cast<std::uint32_t>(UINT8_C(0));
+    auto scale  = static_cast<std::uint32_t>(UINT8_C(1));
+    auto sticky = false;
+
+    for( ; first != last; ++first)
+    {
+      if(chars_is_digit(*first))
+      {
+        const auto d = static_cast<std::uint32_t>(static_cast<std::uint8_t>(*first - '0'));
+
+        if(used < max_digits)
+        {
+          if((used != static_cast<std::int32_t>(INT8_C(0))) || (d != static_cast<std::uint32_t>(UINT8_C(0))))
+          {
+            chunk = static_cast<std::uint32_t>(static_cast<std::uint32_t>(chunk * static_cast<std::uint32_t>(UINT8_C(10))) + d);
+            scale = static_cast<std::uint32_t>(scale * static_cast<std::uint32_t>(UINT8_C(10)));
+
+            ++used;
+
+            if(scale == static_cast<std::uint32_t>(UINT32_C(1000000000)))
+            {
+              x.mul_add(scale, chunk);
+
+              chunk = static_cast<std::uint32_t>(UINT8_C(0));
+              scale = static_cast<std::uint32_t>(UINT8_C(1));
+            }
+          }
+        }
+        else
+        {
+          // The exponent refers to the last digit given.
+          ++exp10;
+
+          sticky = (sticky || (d != static_cast<std::uint32_t>(UINT8_C(0))));
+        }
+      }
+    }
+
+    x.mul_add(scale, chunk);
+
+    // The halfway point is y * 2^e2.
+    const auto exp_field = static_cast<std::int32_t>(candidate >> static_cast<unsigned>(UINT8_C(52)));
+    const auto frac      = static_cast<std::uint64_t>(candidate & static_cast<std::uint64_t>(UINT64_C(0x000FFFFFFFFFFFFF)));
+
+    const auto m_b =
+      static_cast<std::uint64_t>
+      (
+        (exp_field == static_cast<std::int32_t>(INT8_C(0))) ? frac
+                                                            : static_cast<std::uint64_t>(frac | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)))
+      );
+
+    const auto e2 =
+      static_cast<std::int32_t>
+      (
+        ((exp_field == static_cast<std::int32_t>(INT8_C(0))) ? static_cast<std::int32_t>(INT16_C(-1074))
+                                                             : static_cast<std::int32_t>(exp_field - static_cast<std::int32_t>(INT16_C(1075))))
+        - static_cast<std::int32_t>(INT8_C(1))
+      );
+
+    auto y = chars_bigint { static_cast<std::uint64_t>(static_cast<std::uint64_t>(m_b << static_cast<unsigned>(UINT8_C(1))) + static_cast<std::uint64_t>(UINT8_C(1))) };
+
+    // Compare x * 5^exp10 * 2^exp10 with y * 2^e2.
+    if(exp10 >= static_cast<std::int32_t>(INT8_C(0)))
+    {
+      x.mul_pow5(exp10);
+    }
+    else
+    {
+      y.mul_pow5(static_cast<std::int32_t>(-exp10));
+    }
+
+    if(exp10 > e2)
+    {
+      x.shl(static_cast<std::int32_t>(exp10 - e2));
+    }
+    else
+    {
+      y.shl(static_cast<std::int32_t>(e2 - exp10));
+    }
+
+    const auto cmp = x.compare(y);
+
+    const auto round_up =
+      (   (cmp > static_cast<std::int_fast8_t>(INT8_C(0)))
+       || ((cmp == static_cast<std::int_fast8_t>(INT8_C(0))) && (sticky || ((m_b & static_cast<std::uint64_t>(UINT8_C(1))) != static_cast<std::uint64_t>(UINT8_C(0))))));
+
+    return static_cast<std::uint64_t>(candidate + static_cast<std::uint64_t>(round_up ? 1U : 0U));
+  }
+
+  constexpr auto chars_hex_to_binary(std::uint64_t w, std::int32_t e2, bool sticky) -> std::uint64_t
+  {
+    // Returns the binary64 representation of (w + sticky / 2) * 2^e2
+    // rounded to nearest, for w != 0. All of this is exact.
+
+    const auto lz = softfloat_countLeadingZeros64(w);
+    const auto r  = static_cast<std::uint64_t>(w << lz);
+    const auto e0 = static_cast<std::int32_t>(e2 - static_cast<std::int32_t>(lz));
+
+    const auto biased = static_cast<std::int32_t>(e0 + static_cast<std::int32_t>(INT16_C(1086)));
+
+    auto result = static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000));
+
+    if(biased < static_cast<std::int32_t>(INT16_C(2047)))
+    {
+      const auto p =
+        static_cast<std::int32_t>
+        (
+          (biased >= static_cast<std::int32_t>(INT8_C(1))) ? static_cast<std::int32_t>(INT8_C(11))
+                                                           : static_cast<std::int32_t>(static_cast<std::int32_t>(INT16_C(-1074)) - e0)
+        );
+
+      if(p > static_cast<std::int32_t>(INT8_C(64)))
+      {
+        result = static_cast<std::uint64_t>(UINT8_C(0));
+      }
+      else
+      {
+        const auto s = static_cast<unsigned>(p);
+
+        const auto base =
+          static_cast<std::uint64_t>
+          (
+            (biased >= static_cast<std::int32_t>(INT8_C(1))) ? static_cast<std::uint64_t>(static_cast<std::uint64_t>(biased - static_cast<std::int32_t>(INT8_C(1))) << static_cast<unsigned>(UINT8_C(52)))
+                                                             : static_cast<std::uint64_t>(UINT8_C(0))
+          );
+
+        const auto mant = ((s == 64U) ? static_cast<std::uint64_t>(UINT8_C(0)) : static_cast<std::uint64_t>(r >> s));
+        const auto rest = ((s == 64U) ? r : static_cast<std::uint64_t>(r & static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << s) - static_cast<std::uint64_t>(UINT8_C(1)))));
+        const auto half = static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(s - 1U));
+
+        const auto round_up =
+          (   (rest > half)
+           || ((rest == half) && (sticky || ((mant & static_cast<std::uint64_t>(UINT8_C(1))) != static_cast<std::uint64_t>(UINT8_C(0))))));
+
+        result = static_cast<std::uint64_t>(static_cast<std::uint64_t>(base + mant) + static_cast<std::uint64_t>(round_up ? 1U : 0U));
+      }
+    }
+
+    return result;
+  }
+
+  struct chars_parsed
+  {
+    const char*   ptr  { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    chars_errc    ec   { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint64_t bits { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  constexpr auto chars_lower(char c) -> char
+  {
+    return (((c >= 'A') && (c <= 'Z')) ? static_cast<char>(static_cast<char>(c - 'A') + 'a') : c);
+  }
+
+  constexpr auto chars_hex_value(char c) -> std::uint8_t
+  {
+    // The value of a hexadecimal digit, or 16 for other characters.
+    return
+      static_cast<std::uint8_t>
+      (
+        chars_is_digit(c) ? static_cast<std::uint8_t>(c - '0')
+                          : (((chars_lower(c) >= 'a') && (chars_lower(c) <= 'f')) ? static_cast<std::uint8_t>(static_cast<std::uint8_t>(chars_lower(c) - 'a') + UINT8_C(10))
+                                                                                  : static_cast<std::uint8_t>(UINT8_C(16)))
+      );
+  }
+
+  constexpr auto chars_match(const char* first, const char* last, const char* word) -> const char*
+  {
+    // Returns the end of the lowercase word at first ignoring case, or first.
+    auto p = first;
+
+    while((*word != '\0') && (p != last) && (chars_lower(*p) == *word))
+    {
+      ++p;
+      ++word;
+    }
+
+    return ((*word == '\0') ? p : first);
+  }
+
+  struct chars_exponent
+  {
+    const char*  ptr   { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::int32_t value { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  constexpr auto chars_scan_exponent(const char* first, const char* last) -> chars_exponent
+  {
+    // Scan the optional sign and the digits of an exponent following
+    // its marker at first. Without digits, nothing is taken. Huge
+    // exponents are limited, which does not change the results.
+
+    auto result = chars_exponent { first, static_cast<std::int32_t>(INT8_C(0)) };
+
+    auto p = static_cast<const char*>(first + 1);
+
+    const auto is_neg = ((p != last) && (*p == '-'));
+
+    if((p != last) && ((*p == '-') || (*p == '+')))
+    {
+      ++p;
+    }
+
+    if((p != last) && chars_is_digit(*p))
+    {
+      auto value = static_cast<std::int32_t>(INT8_C(0));
+
+      for( ; (p != last) && chars_is_digit(*p); ++p)
+      {
+        if(value < static_cast<std::int32_t>(INT32_C(100000)))
+        {
+          value = static_cast<std::int32_t>(static_cast<std::int32_t>(value * static_cast<std::int32_t>(INT8_C(10))) + static_cast<std::int32_t>(*p - '0'));
+        }
+      }
+
+      result = chars_exponent { p, (is_neg ? static_cast<std::int32_t>(-value) : value) };
+    }
+
+    return result;
+  }
+
+  constexpr auto chars_parse_hex(const char* first, const char* last) -> chars_parsed
+  {
+    // The hexadecimal significand is kept in 16 digits and a sticky bit.
+
+    auto p = first;
+
+    auto w       = static_cast<std::uint64_t>(UINT8_C(0));
+    auto count   = static_cast<std::int32_t>(INT8_C(0));
+    auto e2      = static_cast<std::int32_t>(INT8_C(0));
+    auto sticky  = false;
+    auto any     = false;
+    auto is_frac = false;
+
+    for( ; p != last; ++p)
+    {
+      const auto d = chars_hex_value(*p);
+
+      if((*p == '.') && (!is_frac))
+      {
+        is_frac = true;
+      }
+      else if(d == static_cast<std::uint8_t>(UINT8_C(16)))
+      {
+        break;
+      }
+      else
+      {
+        any = true;
+
+        if(count < static_cast<std::int32_t>(INT8_C(16)))
+        {
+          if((count != static_cast<std::int32_t>(INT8_C(0))) || (d != static_cast<std::uint8_t>(UINT8_C(0))))
+          {
+            w = static_cast<std::uint64_t>(static_cast<std::uint64_t>(w << static_cast<unsigned>(UINT8_C(4))) | d);
+
+            ++count;
+          }
+
+          if(is_frac)
+          {
+            e2 -= static_cast<std::int32_t>(INT8_C(4));
+          }
+        }
+        else
+        {
+          if(!is_frac)
+          {
+            e2 += static_cast<std::int32_t>(INT8_C(4));
+          }
+
+          sticky = (sticky || (d != static_cast<std::uint8_t>(UINT8_C(0))));
+        }
+      }
+    }
+
+    auto result = chars_parsed { first, chars_errc::invalid_argument, static_cast<std::uint64_t>(UINT8_C(0)) };
+
+    if(any)
+    {
+      if((p != last) && ((*p == 'p') || (*p == 'P')))
+      {
+        const auto ex = chars_scan_exponent(p, last);
+
+        p   = ex.ptr;
+        e2 += ex.value;
+      }
+
+      const auto bits = ((w == static_cast<std::uint64_t>(UINT8_C(0))) ? w : chars_hex_to_binary(w, e2, sticky));
+
+      result =
+        chars_parsed
+        {
+          p,
+          (((w != static_cast<std::uint64_t>(UINT8_C(0))) && ((bits == static_cast<std::uint64_t>(UINT8_C(0))) || (bits == static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000))))) ? chars_errc::result_out_of_range : chars_errc { }),
+          bits
+        };
+    }
+
+    return result;
+  }
+
+  constexpr auto chars_parse_decimal(const char* first, const char* last, chars_format fmt) -> chars_parsed
+  {
+    // The decimal significand is kept in 19 digits w, with the value
+    // being w * 10^q if no further nonzero digits are given.
+
+    auto p = first;
+
+    auto w           = static_cast<std::uint64_t>(UINT8_C(0));
+    auto count       = static_cast<std::int32_t>(INT8_C(0));
+    auto q           = static_cast<std::int32_t>(INT8_C(0));
+    auto frac_digits = static_cast<std::int32_t>(INT8_C(0));
+    auto truncated   = false;
+    auto any         = false;
+    auto is_frac     = false;
+
+    for( ; p != last; ++p)
+    {
+      if((*p == '.') && (!is_frac))
+      {
+        is_frac = true;
+      }
+      else if(!chars_is_digit(*p))
+      {
+        break;
+      }
+      else
+      {
+        any = true;
+
+        const auto d = static_cast<std::uint8_t>(*p - '0');
+
+        if(count < static_cast<std::int32_t>(INT8_C(19)))
+        {
+          if((count != static_cast<std::int32_t>(INT8_C(0))) || (d != static_cast<std::uint8_t>(UINT8_C(0))))
+          {
+            w = static_cast<std::uint64_t>(static_cast<std::uint64_t>(w * static_cast<std::uint64_t>(UINT8_C(10))) + d);
+
+            ++count;
+          }
+
+          if(is_frac)
+          {
+            --q;
+          }
+        }
+        else
+        {
+          if(!is_frac)
+          {
+            ++q;
+          }
+
+          truncated = (truncated || (d != static_cast<std::uint8_t>(UINT8_C(0))));
+        }
+
+        if(is_frac)
+        {
+          ++frac_digits;
+        }
+      }
+    }
+
+    const auto digits_last = p;
+
+    auto result = chars_parsed { first, chars_errc::invalid_argument, static_cast<std::uint64_t>(UINT8_C(0)) };
+
+    auto ex = chars_exponent { p, static_cast<std::int32_t>(INT8_C(0)) };
+
+    if((fmt != chars_format::fixed) && (p != last) && ((*p == 'e') || (*p == 'E')))
+    {
+      ex = chars_scan_exponent(p, last);
+    }
+
+    // The exponent is required in the scientific format.
+    if(any && ((fmt != chars_format::scientific) || (ex.ptr != p)))
+    {
+      p  = ex.ptr;
+      q += ex.value;
+
+      auto bits = static_cast<std::uint64_t>(UINT8_C(0));
+
+      if(w == static_cast<std::uint64_t>(UINT8_C(0)))
+      {
+        bits = static_cast<std::uint64_t>(UINT8_C(0));
+      }
+      else if(q > static_cast<std::int32_t>(INT16_C(308)))
+      {
+        bits = static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000));
+      }
+      else if(q < static_cast<std::int32_t>(INT16_C(-342)))
+      {
+        bits = static_cast<std::uint64_t>(UINT8_C(0));
+      }
+      else
+      {
+        // With further nonzero digits, the value lies between w * 10^q
+        // and (w + 1) * 10^q. If both round to the same, so does the value.
+        const auto lo = chars_decimal_to_binary(w, q);
+        const auto hi = (truncated ? chars_decimal_to_binary(static_cast<std::uint64_t>(w + static_cast<std::uint64_t>(UINT8_C(1))), q) : lo);
+
+        bits = lo.bits;
+
+        if((!lo.decided) || (!hi.decided) || (lo.bits != hi.bits))
+        {
+          bits =
+            chars_decide
+            (
+              first,
+              digits_last,
+              static_cast<std::int32_t>(ex.value - frac_digits),
+              ((!lo.decided) ? lo.bits : ((!hi.decided) ? hi.bits : lo.bits))
+            );
+        }
+      }
+
+      result =
+        chars_parsed
+        {
+          p,
+          (((w != static_cast<std::uint64_t>(UINT8_C(0))) && ((bits == static_cast<std::uint64_t>(UINT8_C(0))) || (bits == static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000))))) ? chars_errc::result_out_of_range : chars_errc { }),
+          bits
+        };
+    }
+
+    return result;
+  }
+
+  constexpr auto chars_parse(const char* first, const char* last, chars_format fmt) -> chars_parsed
+  {
+    // Parse the sign, the special values and dispatch the rest.
+    // As in from_chars, a plus sign is not accepted.
+
+    auto result = chars_parsed { first, chars_errc::invalid_argument, static_cast<std::uint64_t>(UINT8_C(0)) };
+
+    const auto is_neg = ((first != last) && (*first == '-'));
+
+    const auto p = static_cast<const char*>(is_neg ? (first + 1) : first);
+
+    const auto sign_bit = static_cast<std::uint64_t>(is_neg ? UINT64_C(0x8000000000000000) : UINT64_C(0));
+
+    const auto after_inf = chars_match(p, last, "inf");
+    const auto after_nan = chars_match(p, last, "nan");
+
+    if(   (fmt != chars_format::scientific)
+       && (fmt != chars_format::fixed)
+       && (fmt != chars_format::hex)
+       && (fmt != chars_format::general))
+    {
+      result = chars_parsed { first, chars_errc::invalid_argument, static_cast<std::uint64_t>(UINT8_C(0)) };
+    }
+    else if(after_inf != p)
+    {
+      result = chars_parsed { chars_match(after_inf, last, "inity"), chars_errc { }, static_cast<std::uint64_t>(sign_bit | static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000))) };
+    }
+    else if(after_nan != p)
+    {
+      auto q = after_nan;
+
+      // An optional sequence of letters, digits and underscores in parentheses.
+      if((q != last) && (*q == '('))
+      {
+        auto r = static_cast<const char*>(q + 1);
+
+        while((r != last) && (chars_is_digit(*r) || ((chars_lower(*r) >= 'a') && (chars_lower(*r) <= 'z')) || (*r == '_')))
+        {
+          ++r;
+        }
+
+        q = (((r != last) && (*r == ')')) ? static_cast<const char*>(r + 1) : q);
+      }
+
+      // There is only one NaN representation, see isnan.
+      result = chars_parsed { q, chars_errc { }, static_cast<std::uint64_t>(UINT64_C(0xFFF8000000000000)) };
+    }
+    else
+    {
+      result = ((fmt == chars_format::hex) ? chars_parse_hex(p, last) : chars_parse_decimal(p, last, fmt));
+
+      result.bits |= sign_bit;
+
+      if(result.ec == chars_errc::invalid_argument)
+      {
+        result.ptr = first;
+      }
+    }
+
+    return result;
+  }
+
+  } // namespace detail
+
+  constexpr auto operator+(const soft_double& a, const soft_double& b) -> soft_double;
+  constexpr auto operator-(const soft_double& a, const soft_double& b) -> soft_double;
+  constexpr auto operator*(const soft_double& a, const soft_double& b) -> soft_double;
+  constexpr auto operator/(const soft_double& a, const soft_double& b) -> soft_double;
+
+  template<typename UnsignedIntegralType> constexpr auto operator+(const soft_double& u, UnsignedIntegralType n) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, soft_double>::type;
+  template<typename UnsignedIntegralType> constexpr auto operator-(const soft_double& u, UnsignedIntegralType n) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, soft_double>::type;
+  template<typename UnsignedIntegralType> constexpr auto operator*(const soft_double& u, UnsignedIntegralType n) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, soft_double>::type;
+  template<typename UnsignedIntegralType> constexpr auto operator/(const soft_double& u, UnsignedIntegralType n) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, soft_double>::type;
+
+  template<typename UnsignedIntegralType> constexpr auto operator+(UnsignedIntegralType n, const soft_double& u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, soft_double>::type;
+  template<typename UnsignedIntegralType> constexpr auto operator-(UnsignedIntegralType n, const soft_double& u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, soft_double>::type;
+  template<typename UnsignedIntegralType> constexpr auto operator*(UnsignedIntegralType n, const soft_double& u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, soft_double>::type;
+  template<typename UnsignedIntegralType> constexpr auto operator/(UnsignedIntegralType n, const soft_double& u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, soft_double>::type;
+
+  template<typename SignedIntegralType> constexpr auto operator+(const soft_double& u, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, soft_double>::type;
+  template<typename SignedIntegralType> constexpr auto operator-(const soft_double& u, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, soft_double>::type;
+  template<typename SignedIntegralType> constexpr auto operator*(const soft_double& u, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, soft_double>::type;
+  template<typename SignedIntegralType> constexpr auto operator/(const soft_double& u, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, soft_double>::type;
+
+  template<typename SignedIntegralType> constexpr auto operator+(SignedIntegralType n, const soft_double& u) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, soft_double>::type;
+  template<typename SignedIntegralType> constexpr auto operator-(SignedIntegralType n, const soft_double& u) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, soft_double>::type;
+  template<typename SignedIntegralType> constexpr auto operator*(SignedIntegralType n, const soft_double& u) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, soft_double>::type;
+  template<typename SignedIntegralType> constexpr auto operator/(SignedIntegralType n, const soft_double& u) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, soft_double>::type;
+
+  constexpr auto operator+(const soft_double& u, float f) -> soft_double;
+  constexpr auto operator-(const soft_double& u, float f) -> soft_double;
+  constexpr auto operator*(const soft_double& u, float f) -> soft_double;
+  constexpr auto operator/(const soft_double& u, float f) -> soft_double;
+
+  constexpr auto operator+(float f, const soft_double& u) -> soft_double;
+  constexpr auto operator-(float f, const soft_double& u) -> soft_double;
+  constexpr auto operator*(float f, const soft_double& u) -> soft_double;
+  constexpr auto operator/(float f, const soft_double& u) -> soft_double;
+
+  constexpr auto operator+(const soft_double& u, double f) -> soft_double;
+  constexpr auto operator-(const soft_double& u, double f) -> soft_double;
+  constexpr auto operator*(const soft_double& u, double f) -> soft_double;
+  constexpr auto operator/(const soft_double& u, double f) -> soft_double;
+
+  constexpr auto operator+(double f, const soft_double& u) -> soft_double;
+  constexpr auto operator-(double f, const soft_double& u) -> soft_double;
+  constexpr auto operator*(double f, const soft_double& u) -> soft_double;
+  constexpr auto operator/(double f, const soft_double& u) -> soft_double;
+
+  constexpr auto operator+(const soft_double& u, long double f) -> soft_double;
+  constexpr auto operator-(const soft_double& u, long double f) -> soft_double;
+  constexpr auto operator*(const soft_double& u, long double f) -> soft_double;
+  constexpr auto operator/(const soft_double& u, long double f) -> soft_double;
+
+  constexpr auto operator+(long double f, const soft_double& u) -> soft_double;
+  constexpr auto operator-(long double f, const soft_double& u) -> soft_double;
+  constexpr auto operator*(long double f, const soft_double& u) -> soft_double;
+  constexpr auto operator/(long double f, const soft_double& u) -> soft_double;
+
+  constexpr auto operator< (const soft_double& a, const soft_double& b) -> bool;
+  constexpr auto operator<=(const soft_double& a, const soft_double& b) -> bool;
+  constexpr auto operator==(const soft_double& a, const soft_double& b) -> bool;
+  constexpr auto operator!=(const soft_double& a, const soft_double& b) -> bool;
+  constexpr auto operator>=(const soft_double& a, const soft_double& b) -> bool;
+  constexpr auto operator> (const soft_double& a, const soft_double& b) -> bool;
+
+  template<typename UnsignedIntegralType> constexpr auto operator< (const soft_double& a, UnsignedIntegralType u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
+  template<typename UnsignedIntegralType> constexpr auto operator<=(const soft_double& a, UnsignedIntegralType u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
+  template<typename UnsignedIntegralType> constexpr auto operator==(const soft_double& a, UnsignedIntegralType u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
+  template<typename UnsignedIntegralType> constexpr auto operator!=(const soft_double& a, UnsignedIntegralType u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
+  template<typename UnsignedIntegralType> constexpr auto operator>=(const soft_double& a, UnsignedIntegralType u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
+  template<typename UnsignedIntegralType> constexpr auto operator> (const soft_double& a, UnsignedIntegralType u) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
+
+  template<typename UnsignedIntegralType> constexpr auto operator< (UnsignedIntegralType u, const soft_double& a) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
+  template<typename UnsignedIntegralType> constexpr auto operator<=(UnsignedIntegralType u, const soft_double& a) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
+  template<typename UnsignedIntegralType> constexpr auto operator==(UnsignedIntegralType u, const soft_double& a) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
+  template<typename UnsignedIntegralType> constexpr auto operator!=(UnsignedIntegralType u, const soft_double& a) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
+  template<typename UnsignedIntegralType> constexpr auto operator>=(UnsignedIntegralType u, const soft_double& a) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
+  template<typename UnsignedIntegralType> constexpr auto operator> (UnsignedIntegralType u, const soft_double& a) -> typename std::enable_if<std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value, bool>::type;
+
+  template<typename SignedIntegralType> constexpr auto operator< (const soft_double& a, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
+  template<typename SignedIntegralType> constexpr auto operator<=(const soft_double& a, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
+  template<typename SignedIntegralType> constexpr auto operator==(const soft_double& a, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
+  template<typename SignedIntegralType> constexpr auto operator!=(const soft_double& a, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
+  template<typename SignedIntegralType> constexpr auto operator>=(const soft_double& a, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
+  template<typename SignedIntegralType> constexpr auto operator> (const soft_double& a, SignedIntegralType n) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
+
+  template<typename SignedIntegralType> constexpr auto operator< (SignedIntegralType n, const soft_double& a) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
+  template<typename SignedIntegralType> constexpr auto operator<=(SignedIntegralType n, const soft_double& a) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
+  template<typename SignedIntegralType> constexpr auto operator==(SignedIntegralType n, const soft_double& a) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
+  template<typename SignedIntegralType> constexpr auto operator!=(SignedIntegralType n, const soft_double& a) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
+  template<typename SignedIntegralType> constexpr auto operator>=(SignedIntegralType n, const soft_double& a) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
+  template<typename SignedIntegralType> constexpr auto operator> (SignedIntegralType n, const soft_double& a) -> typename std::enable_if<std::is_integral<SignedIntegralType>::value && std::is_signed<SignedIntegralType>::value, bool>::type;
+
+  constexpr auto operator< (const soft_double& a, float f) -> bool;
+  constexpr auto operator<=(const soft_double& a, float f) -> bool;
+  constexpr auto operator==(const soft_double& a, float f) -> bool;
+  constexpr auto operator!=(const soft_double& a, float f) -> bool;
+  constexpr auto operator>=(const soft_double& a, float f) -> bool;
+  constexpr auto operator> (const soft_double& a, float f) -> bool;
+
+  constexpr auto operator< (float f, const soft_double& a) -> bool;
+  constexpr auto operator<=(float f, const soft_double& a) -> bool;
+  constexpr auto operator==(float f, const soft_double& a) -> bool;
+  constexpr auto operator!=(float f, const soft_double& a) -> bool;
+  constexpr auto operator>=(float f, const soft_double& a) -> bool;
+  constexpr auto operator> (float f, const soft_double& a) -> bool;
+
+  constexpr auto operator< (const soft_double& a, double f) -> bool;
+  constexpr auto operator<=(const soft_double& a, double f) -> bool;
+  constexpr auto operator==(const soft_double& a, double f) -> bool;
+  constexpr auto operator!=(const soft_double& a, double f) -> bool;
+  constexpr auto operator>=(const soft_double& a, double f) -> bool;
+  constexpr auto operator> (const soft_double& a, double f) -> bool;
+
+  constexpr auto operator< (double f, const soft_double& a) -> bool;
+  constexpr auto operator<=(double f, const soft_double& a) -> bool;
+  constexpr auto operator==(double f, const soft_double& a) -> bool;
+  constexpr auto operator!=(double f, const soft_double& a) -> bool;
+  constexpr auto operator>=(double f, const soft_double& a) -> bool;
+  constexpr auto operator> (double f, const soft_double& a) -> bool;
+
+  constexpr auto operator< (const soft_double& a, long double f) -> bool;
+  constexpr auto operator<=(const soft_double& a, long double f) -> bool;
+  constexpr auto operator==(const soft_double& a, long double f) -> bool;
+  constexpr auto operator!=(const soft_double& a, long double f) -> bool;
+  constexpr auto operator>=(const soft_double& a, long double f) -> bool;
+  constexpr auto operator> (const soft_double& a, long double f) -> bool;
+
+  constexpr auto operator< (long double f, const soft_double& a) -> bool;
+  constexpr auto operator<=(long double f, const soft_double& a) -> bool;
+  constexpr auto operator==(long double f, const soft_double& a) -> bool;
+  constexpr auto operator!=(long double f, const soft_double& a) -> bool;
+  constexpr auto operator>=(long double f, const soft_double& a) -> bool;
+  constexpr auto operator> (long double f, const soft_double& a) -> bool;
+
+  constexpr auto to_chars(char* first, char* last, soft_double x) -> to_chars_result;
+  constexpr auto to_chars(char* first, char* last, soft_double x, chars_format fmt) -> to_chars_result;
+  constexpr auto to_chars(char* first, char* last, soft_double x, chars_format fmt, int precision) -> to_chars_result;
+
+  constexpr auto from_chars(const char* first, const char* last, soft_double& x) -> from_chars_result;
+  constexpr auto from_chars(const char* first, const char* last, soft_double& x, chars_format fmt) -> from_chars_result;
+
+  #if !defined(SOFT_DOUBLE_DISABLE_IOSTREAM)
+  template<typename char_type, typename traits_type> auto operator<<(std::basic_ostream<char_type, traits_type>& os, const soft_double& f) -> std::basic_ostream<char_type, traits_type>&;
+  template<typename char_type, typename traits_type> auto operator>>(std::basic_istream<char_type, traits_type>& is,       soft_double& f) -> std::basic_istream<char_type, traits_type>&;
+  #endif // !WIDE_DECIMAL_DISABLE_IOSTREAM
+
+  constexpr auto (isnan)   (soft_double x) -> bool;
+  constexpr auto (isinf)   (soft_double x) -> bool;
+  constexpr auto (isfinite)(soft_double x) -> bool;
+  constexpr auto  abs      (soft_double x) -> soft_double;
+  constexpr auto  fabs     (soft_double x) -> soft_double;
+  constexpr auto  fmod     (soft_double v1, soft_double v2) -> soft_double;
+  constexpr auto  remainder(soft_double v1, soft_double v2) -> soft_double;
+  constexpr auto  remquo   (soft_double v1, soft_double v2, int* quo) -> soft_double;
+  constexpr auto  frexp    (soft_double x, int* expptr) -> soft_double;
+  constexpr auto  ldexp    (soft_double x, int expval) -> soft_double;
+  constexpr auto  floor    (soft_double x) -> soft_double;
+  constexpr auto  ceil     (soft_double x) -> soft_double;
+  constexpr auto  trunc    (soft_double x) -> soft_double;
+  constexpr auto  round    (soft_double x) -> soft_double;
+  constexpr auto  lround   (soft_double x) -> long; // NOLINT(google-runtime-int)
+  constexpr auto  nearbyint(soft_double x) -> soft_double;
+  constexpr auto  modf     (soft_double x, soft_double* iptr) -> soft_double;
+  constexpr auto  sqrt     (soft_double x) -> soft_double;
+  constexpr auto  fma      (soft_double x, soft_double y, soft_double z) -> soft_double;
+  constexpr auto  cbrt     (soft_double x) -> soft_double;
+  constexpr auto  hypot    (soft_double x, soft_double y) -> soft_double;
+  constexpr auto  exp      (soft_double x) -> soft_double;
+  constexpr auto  exp2     (soft_double x) -> soft_double;
+  constexpr auto  log      (soft_double x) -> soft_double;
+  constexpr auto  log2     (soft_double x) -> soft_double;
+  constexpr auto  log10    (soft_double x) -> soft_double;
+  constexpr auto  expm1    (soft_double x) -> soft_double;
+  constexpr auto  log1p    (soft_double x) -> soft_double;
+  constexpr auto  pow      (soft_double x, soft_double a) -> soft_double;
+  constexpr auto  sin      (soft_double x) -> soft_double;
+  constexpr auto  cos      (soft_double x) -> soft_double;
+  constexpr auto  tan      (soft_double x) -> soft_double;
+  constexpr auto  sincos   (soft_double x, soft_double* s, soft_double* c) -> void;
+  constexpr auto  asin     (soft_double x) -> soft_double;
+  constexpr auto  acos     (soft_double x) -> soft_double;
+  constexpr auto  atan     (soft_double x) -> soft_double;
+  constexpr auto  atan2    (soft_double y, soft_double x) -> soft_double;
+  constexpr auto  sinh     (soft_double x) -> soft_double;
+  constexpr auto  cosh     (soft_double x) -> soft_double;
+  constexpr auto  tanh     (soft_double x) -> soft_double;
+
+  template<typename UnsignedIntegralType,
+           typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
+                                    && std::is_unsigned<UnsignedIntegralType>::value)>::type const* = nullptr>
+  constexpr auto pow(soft_double x, UnsignedIntegralType u) -> soft_double;
+
+  template<typename SignedIntegralType,
+           typename std::enable_if<(   std::is_integral<SignedIntegralType>::value
+                                    && std::is_signed  <SignedIntegralType>::value)>::type const* = nullptr>
+  constexpr auto pow(soft_double x, SignedIntegralType n) -> soft_double;
+
+  class soft_double final
+  {
+  public:
+    static_assert(sizeof(float) == static_cast<std::size_t>(UINT8_C(4)),
+                  "Error: This template is designed for built-in float having 4 bytes");
+
+    using representation_type = std::uint64_t;
+
+    constexpr soft_double() noexcept = default;
+
+    template<typename UnsignedIntegralType,
+             typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
+                                      && std::is_unsigned<UnsignedIntegralType>::value
+                                      && (sizeof(UnsignedIntegralType) <= sizeof(std::uint32_t)))>::type const* = nullptr>
+    constexpr soft_double(UnsignedIntegralType u) noexcept : my_value(my_ui32_to_f64(static_cast<std::uint32_t>(u))) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    template<typename UnsignedIntegralType,
+             typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
+                                      && std::is_unsigned<UnsignedIntegralType>::value
+                                      && (!(sizeof(UnsignedIntegralType) <= sizeof(std::uint32_t))))>::type const* = nullptr>
+    constexpr soft_double(UnsignedIntegralType u) noexcept : my_value(my_ui64_to_f64(static_cast<std::uint64_t>(u))) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    template<typename SignedIntegralType,
              typename std::enable_if<(   std::is_integral<SignedIntegralType>::value
                                       && std::is_signed  <SignedIntegralType>::value
                                       && (sizeof(SignedIntegralType) <= sizeof(int32_t)))>::type const* = nullptr>
     constexpr soft_double(SignedIntegralType n) noexcept : my_value(my__i32_to_f64(static_cast<std::int32_t>(n))) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
 
-    template<typename SignedIntegralType,
-             typename std::enable_if<(   std::is_integral<SignedIntegralType>::value
-                                      && std::is_signed  <SignedIntegralType>::value
-                                      && (!(sizeof(SignedIntegralType) <= sizeof(int32_t))))>::type const* = nullptr>
-    constexpr soft_double(SignedIntegralType n) noexcept : my_value(my__i64_to_f64(static_cast<std::int64_t>(n))) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    template<typename SignedIntegralType,
+             typename std::enable_if<(   std::is_integral<SignedIntegralType>::value
+                                      && std::is_signed  <SignedIntegralType>::value
+                                      && (!(sizeof(SignedIntegralType) <= sizeof(int32_t))))>::type const* = nullptr>
+    constexpr soft_double(SignedIntegralType n) noexcept : my_value(my__i64_to_f64(static_cast<std::int64_t>(n))) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    constexpr soft_double(float f) noexcept // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+      : my_value
+        (
+          ((detail::expF32UI(detail::uz_type<float>(f).get_u()) == static_cast<std::int16_t>(INT8_C(0))) && (detail::fracF32UI(detail::uz_type<float>(f).get_u()) == static_cast<std::uint32_t>(UINT8_C(0)))) // NOLINT(cppcoreguidelines-pro-type-union-access)
+            ? detail::packToF64UI
+              (
+                detail::signF32UI(detail::uz_type<float>(f).get_u()), // NOLINT(cppcoreguidelines-pro-type-union-access)
+                static_cast<int>(INT8_C(0)),
+                static_cast<int>(INT8_C(0))
+              )
+            : detail::packToF64UI
+              (
+                detail::signF32UI(detail::uz_type<float>(f).get_u()), // NOLINT(cppcoreguidelines-pro-type-union-access)
+                static_cast<std::int32_t>
+                (
+                    static_cast<std::int32_t>(detail::expF32UI(detail::uz_type<float>(f).get_u())) // NOLINT(cppcoreguidelines-pro-type-union-access)
+                  + static_cast<std::int32_t>(INT16_C(0x380))
+                ),
+                static_cast<std::uint64_t>
+                (
+                  static_cast<std::uint64_t>
+                  (
+                    detail::fracF32UI(detail::uz_type<float>(f).get_u()) // NOLINT(cppcoreguidelines-pro-type-union-access)
+                  ) << static_cast<unsigned>(UINT8_C(29))
+                )
+              )
+        ) { }
+
+    constexpr soft_double(double d) noexcept              // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+      : my_value(detail::uz_type<double>(d).get_u()) { }  // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+    constexpr soft_double(long double ld) noexcept                             // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+      : my_value(detail::uz_type<double>(static_cast<double>(ld)).get_u()) { } // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+    // The copy and move operations are defaulted, so that soft_double
+    // is trivially copyable (see the static assertions below the class).
+    constexpr soft_double(const soft_double&) noexcept = default;
+    constexpr soft_double(soft_double&&) noexcept = default;
+
+    explicit constexpr soft_double(std::uint64_t n, detail::nothing&&) noexcept // NOLINT(hicpp-named-parameter,readability-named-parameter)
+      : my_value(static_cast<std::uint64_t>(n)) { }
+
+    constexpr auto operator=(const soft_double&) noexcept -> soft_double& = default;
+    constexpr auto operator=(soft_double&&) noexcept -> soft_double& = default;
+
+    ~soft_double() = default;
+
+    SOFT_DOUBLE_NODISCARD constexpr auto  representation() const -> representation_type { return my_value; }
+    SOFT_DOUBLE_NODISCARD constexpr auto crepresentation() const -> representation_type { return my_value; }
+
+    static constexpr auto get_rep(const soft_double& a) -> representation_type { return a.crepresentation(); }
+
+    constexpr operator   signed char     () const { return static_cast<signed char>     (f64_to__i32(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    constexpr operator   signed short    () const { return static_cast<signed short>    (f64_to__i32(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions,google-runtime-int)
+    constexpr operator   signed int      () const { return static_cast<signed int>      (f64_to__i32(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    constexpr operator   signed long     () const { return static_cast<signed long>     (f64_to__i64(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions,google-runtime-int)
+    constexpr operator   signed long long() const { return static_cast<signed long long>(f64_to__i64(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions,google-runtime-int)
+
+    constexpr operator unsigned char     () const { return static_cast<unsigned char>     (f64_to_ui32(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    constexpr operator unsigned short    () const { return static_cast<unsigned short>    (f64_to_ui32(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions,google-runtime-int)
+    constexpr operator unsigned int      () const { return static_cast<unsigned int>      (f64_to_ui32(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    constexpr operator unsigned long     () const { return static_cast<unsigned long>     (f64_to_ui64(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions,google-runtime-int)
+    constexpr operator unsigned long long() const { return static_cast<unsigned long long>(f64_to_ui64(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions,google-runtime-int)
+
+  private:
+    template<typename FloatingPointType>
+    SOFT_DOUBLE_NODISCARD constexpr auto to_float() const -> typename std::enable_if<(   (sizeof(FloatingPointType) == 4)
+                                                                                      && std::numeric_limits<FloatingPointType>::is_iec559), FloatingPointType>::type
+    {
+      return f64_to_f32(my_value);
+    }
+
+    template<typename FloatingPointType>
+    SOFT_DOUBLE_NODISCARD constexpr auto to_float() const -> typename std::enable_if<(   (sizeof(FloatingPointType) == static_cast<std::size_t>(UINT8_C(8)))
+                                                                                      && std::numeric_limits<FloatingPointType>::is_iec559), FloatingPointType>::type
+    {
+      return static_cast<FloatingPointType>(*static_cast<const volatile FloatingPointType*>(static_cast<const volatile void*>(this))); // NOLINT(bugprone-casting-through-void)
+    }
+
+  public:
+    constexpr operator float      () const noexcept { return to_float<float>(); }                            // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    constexpr operator double     () const noexcept { return to_float<double>(); }                           // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    constexpr operator long double() const noexcept { return static_cast<long double>(to_float<double>()); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    constexpr auto operator+=(const soft_double& other) -> soft_double& { my_value = f64_add(my_value, other.my_value); return *this; }
+    constexpr auto operator-=(const soft_double& other) -> soft_double& { my_value = f64_sub(my_value, other.my_value); return *this; }
+    constexpr auto operator*=(const soft_double& other) -> soft_double& { my_value = f64_mul(my_value, other.my_value); return *this; }
+    constexpr auto operator/=(const soft_double& other) -> soft_double& { my_value = f64_div(my_value, other.my_value); return *this; }
+
+    // Operators pre-increment and pre-decrement.
+    constexpr auto operator++() -> soft_double& { return *this += my_value_one(); }
+    constexpr auto operator--() -> soft_double& { return *this -= my_value_one(); }
+
+    // Operators post-increment and post-decrement.
+    constexpr auto operator++(int) -> soft_double { const soft_double w(*this); static_cast<void>(++(*this)); return w; } // NOLINT(performance-no-automatic-move)
+    constexpr auto operator--(int) -> soft_double { const soft_double w(*this); static_cast<void>(--(*this)); return w; } // NOLINT(performance-no-automatic-move)
+
+    constexpr auto operator+() const -> const soft_double& { return *this; }
+    constexpr auto operator-() const ->       soft_double  { return soft_double { my_value ^ static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(UINT8_C(63))), detail::nothing{} }; }
+
+    static constexpr auto my_value_zero   () -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0)),                   detail::nothing{} }; }
+    static constexpr auto my_value_one    () -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0x3FF0000000000000)),  detail::nothing{} }; }
+    static constexpr auto my_value_two    () -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0x4000000000000000)),  detail::nothing{} }; }
+    static constexpr auto my_value_half   () -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0x3FE0000000000000)),  detail::nothing{} }; }
+    static constexpr auto my_value_pi     () -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(4614256656552045848)), detail::nothing{} }; }
+    static constexpr auto my_value_pi_half() -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0x3FF921FB54442D18)),  detail::nothing{} }; }
+    static constexpr auto my_value_ln2    () -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(4604418534313441775)), detail::nothing{} }; }
+
+    static constexpr auto my_value_min()           -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(4503599627370496)),    detail::nothing{} }; }
+    static constexpr auto my_value_max()           -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(9218868437227405311)), detail::nothing{} }; }
+    static constexpr auto my_value_lowest()        -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(18442240474082181119)),detail::nothing{} }; }
+    static constexpr auto my_value_epsilon()       -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(4372995238176751616)), detail::nothing{} }; }
+    static constexpr auto my_value_round_error()   -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0x3FE0000000000000)),  detail::nothing{} }; }
+    static constexpr auto my_value_denorm_min()    -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(1)),                   detail::nothing{} }; }
+    static constexpr auto my_value_infinity()      -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000)),  detail::nothing{} }; }
+    static constexpr auto my_value_quiet_NaN()     -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0xFFF8000000000000)),  detail::nothing{} }; }
+    static constexpr auto my_value_signaling_NaN() -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0x7FF8000000000000)),  detail::nothing{} }; }
+
+  private:
+    representation_type my_value { };
+
+    // The directed-rounding types call the rounding-mode kernels below.
+    template<typename RoundingPolicy>
+    friend class basic_soft_double;
+
+    // The interval class rounds unrounded results in both directions.
+    friend class soft_interval;
+
+    static constexpr auto my_le(const soft_double& a, const soft_double& b) -> bool
+    {
+      return (detail::signF64UI(a.my_value) != detail::signF64UI(b.my_value))
+               ? (detail::signF64UI(a.my_value) ||  (static_cast<std::uint64_t>(a.my_value | b.my_value) & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF))) == static_cast<std::uint64_t>(UINT8_C(0)))
+               : (a.my_value == b.my_value)     || ((  static_cast<unsigned>(detail::signF64UI(a.my_value) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))
+                                                     ^ static_cast<unsigned>((a.my_value < b.my_value)     ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))) != static_cast<unsigned>(UINT8_C(0)));
+    }
+
+    static constexpr auto my_lt(const soft_double& a, const soft_double& b) -> bool
+    {
+      return (detail::signF64UI(a.my_value) != detail::signF64UI(b.my_value))
+               ? (detail::signF64UI(a.my_value) &&  (static_cast<std::uint64_t>(a.my_value | b.my_value) & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF))) != static_cast<std::uint64_t>(UINT8_C(0)))
+               : (a.my_value != b.my_value)     && ((  static_cast<unsigned>(detail::signF64UI(a.my_value) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))
+                                                     ^ static_cast<unsigned>((a.my_value < b.my_value)     ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))) != static_cast<unsigned>(UINT8_C(0)));
+    }
+
+    static constexpr auto sign_ab(const std::uint64_t a, const std::uint64_t b) -> bool
+    {
+      const auto signA = detail::signF64UI(a);
+      const auto signB = detail::signF64UI(b);
+
+      return
+        static_cast<std::uint_fast8_t>
+        (
+            static_cast<std::uint_fast8_t>(signA ? static_cast<std::uint_fast8_t>(UINT8_C(1)) : static_cast<std::uint_fast8_t>(UINT8_C(0)))
+          ^ static_cast<std::uint_fast8_t>(signB ? static_cast<std::uint_fast8_t>(UINT8_C(1)) : static_cast<std::uint_fast8_t>(UINT8_C(0)))
+        ) != static_cast<std::uint_fast8_t>(UINT8_C(0));
+    }
+
+    template<detail::round_mode Mode = detail::round_mode::near_even>
+    static constexpr auto f64_add(const std::uint64_t a, const std::uint64_t b) -> std::uint64_t
+    {
+      const auto signA = detail::signF64UI(a);
+
+      return ((signA == detail::signF64UI(b)) ? softfloat_addMagsF64<Mode>(a, b, signA)
+                                              : softfloat_subMagsF64<Mode>(a, b, signA));
+    }
+
+    template<detail::round_mode Mode = detail::round_mode::near_even>
+    static constexpr auto f64_sub(const std::uint64_t a, const std::uint64_t b) -> std::uint64_t
+    {
+      const auto signA = detail::signF64UI(a);
+
+      return ((signA == detail::signF64UI(b)) ? softfloat_subMagsF64<Mode>(a, b, signA)
+                                              : softfloat_addMagsF64<Mode>(a, b, signA));
+    }
+
+    template<detail::round_mode Mode = detail::round_mode::near_even>
+    static constexpr auto f64_mul(const std::uint64_t a, const std::uint64_t b) -> std::uint64_t
+    {
+      auto result = std::uint64_t { };
+
+      if(detail::isZeroF64UI(a) || detail::isZeroF64UI(b))
+      {
+        result = detail::packToF64UI(sign_ab(a, b), static_cast<int>(INT8_C(0)), static_cast<int>(INT8_C(0)));
+      }
+      else
+      {
+        const auto z = f64_mul_unrounded(a, b);
+
+        result = softfloat_roundPackToF64<Mode>(z.sign, z.exp, z.sig);
+      }
+
+      return result;
+    }
+
+    static constexpr auto f64_mul_unrounded(const std::uint64_t a, const std::uint64_t b) -> detail::unrounded_f64
+    {
+      // The product of the nonzero, finite a and b, ready to be rounded
+      // in any direction with softfloat_roundPackToF64.
+
+      auto expA  = detail::expF64UI (a);
+      auto expB  = detail::expF64UI (b);
+
+      auto sigA  = detail::fracF64UI(a);
+      auto sigB  = detail::fracF64UI(b);
+
+      if(expA == static_cast<std::int16_t>(INT8_C(0))) { softfloat_normSubnormalF64Sig(expA, sigA); }
+      if(expB == static_cast<std::int16_t>(INT8_C(0))) { softfloat_normSubnormalF64Sig(expB, sigB); }
+
+      auto expZ =
+        static_cast<std::int16_t>
+        (
+            static_cast<std::int16_t>(expA + expB)
+          - static_cast<std::int16_t>(INT16_C(0x3FF))
+        );
+
+      sigA =
+        static_cast<std::uint64_t>
+        (
+          static_cast<std::uint64_t>
+          (
+            sigA | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000))
+          ) << static_cast<unsigned>(UINT8_C(10))
+        );
+
+      sigB =
+        static_cast<std::uint64_t>
+        (
+          static_cast<std::uint64_t>
+          (
+            sigB | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000))
+          ) << static_cast<unsigned>(UINT8_C(11))
+        );
+
+      // Compute the 128-bit product of sigA and sigB.
+      auto sig128Z = detail::softfloat_mul64To128(sigA, sigB);
+
+      if(sig128Z.v0 != static_cast<std::uint64_t>(UINT8_C(0)))
+      {
+        sig128Z.v1 =
+          static_cast<std::uint64_t>
+          (
+              sig128Z.v1
+            | static_cast<std::uint_fast8_t>(UINT8_C(1))
+          );
+      }
+
+      if(sig128Z.v1 < static_cast<std::uint64_t>(UINT64_C(0x4000000000000000)))
+      {
+        --expZ;
+
+        sig128Z.v1 <<= static_cast<unsigned>(UINT8_C(1));
+      }
+
+      return detail::unrounded_f64 { sign_ab(a, b), expZ, sig128Z.v1 };
+    }
+
+    static constexpr auto f64_add_exact(std::uint64_t a, std::uint64_t b, std::uint64_t& err) -> std::uint64_t
+    {
+      // Returns the rounded sum of a and b and sets err to the exact
+      // rounding error (a + b) - sum. The significands are added once
+      // in 128 bits, from which both the sum and its error are taken.
+      // Outside of the range of normal numbers, the error is obtained
+      // with the usual sequence of six additions instead.
+
+      if(   static_cast<std::uint64_t>(a & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF)))
+         <  static_cast<std::uint64_t>(b & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF))))
+      {
+        const auto tmp = a;
+
+        a = b;
+        b = tmp;
+      }
+
+      // Now |a| >= |b|.
+      const auto expA = detail::expF64UI(a);
+      const auto expB = detail::expF64UI(b);
+
+      const auto expDiff = static_cast<std::int16_t>(expA - expB);
+
+      auto result = std::uint64_t { };
+
+      if(expA >= static_cast<std::int16_t>(INT16_C(0x7FD)))
+      {
+        result = f64_add(a, b);
+
+        const auto bb = f64_sub(result, a);
+
+        err = f64_add(f64_sub(a, f64_sub(result, bb)), f64_sub(b, bb));
+      }
+      else if(expDiff > static_cast<std::int16_t>(INT8_C(54)))
+      {
+        // Here |b| is less than half of the spacing below |a|,
+        // so the sum rounds to a and b itself is the error.
+        result = a;
+        err    = b;
+      }
+      else if(expB < static_cast<std::int16_t>(INT8_C(54)))
+      {
+        result = f64_add(a, b);
+
+        const auto bb = f64_sub(result, a);
+
+        err = f64_add(f64_sub(a, f64_sub(result, bb)), f64_sub(b, bb));
+      }
+      else
+      {
+        const auto signA = detail::signF64UI(a);
+
+        const auto sigA = static_cast<std::uint64_t>(detail::fracF64UI(a) | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)));
+        const auto sigB = static_cast<std::uint64_t>(detail::fracF64UI(b) | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)));
+
+        // Align the significands in 128 bits, where the upper half holds
+        // sigA and b is shifted right by at most 54 bits without loss.
+        const auto sig128A = detail::uint128_compound { static_cast<std::uint64_t>(UINT8_C(0)), sigA };
+
+        const auto sig128B =
+          (expDiff == static_cast<std::int16_t>(INT8_C(0)))
+            ? detail::uint128_compound { static_cast<std::uint64_t>(UINT8_C(0)), sigB }
+            : detail::uint128_compound
+              {
+                static_cast<std::uint64_t>(sigB << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - static_cast<unsigned>(expDiff))),
+                static_cast<std::uint64_t>(sigB >> static_cast<unsigned>(expDiff))
+              };
+
+        const auto sig128Z =
+          (signA == detail::signF64UI(b))
+            ? detail::softfloat_add128(sig128A, sig128B)
+            : detail::softfloat_sub128(sig128A, sig128B);
+
+        if(   (sig128Z.v1 == static_cast<std::uint64_t>(UINT8_C(0)))
+           && (sig128Z.v0 == static_cast<std::uint64_t>(UINT8_C(0))))
+        {
+          result = static_cast<std::uint64_t>(UINT8_C(0));
+          err    = static_cast<std::uint64_t>(UINT8_C(0));
+        }
+        else
+        {
+          // The value of the sum is sig128Z * 2^(expA - 1139), and any bit
+          // at position n within sig128Z has a biased exponent n + expA - 116.
+          const auto lead = leading_bit_128(sig128Z);
+
+          if(lead <= static_cast<unsigned>(UINT8_C(52)))
+          {
+            // After cancellation the sum has at most 53 bits and is exact.
+            result =
+              detail::packToF64UI
+              (
+                signA,
+                static_cast<std::int32_t>(static_cast<std::int32_t>(lead) + static_cast<std::int32_t>(expA) - static_cast<std::int32_t>(INT8_C(117))),
+                static_cast<std::uint64_t>(sig128Z.v0 << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(52)) - lead))
+              );
+
+            err = static_cast<std::uint64_t>(UINT8_C(0));
+          }
+          else
+          {
+            const auto shift = static_cast<unsigned>(lead - static_cast<unsigned>(UINT8_C(52)));
+
+            auto sigZ =
+              static_cast<std::uint64_t>
+              (
+                (shift >= static_cast<unsigned>(UINT8_C(64)))
+                  ? static_cast<std::uint64_t>(sig128Z.v1 >> static_cast<unsigned>(shift - static_cast<unsigned>(UINT8_C(64))))
+                  : static_cast<std::uint64_t>
+                    (
+                        static_cast<std::uint64_t>(sig128Z.v1 << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - shift))
+                      | static_cast<std::uint64_t>(sig128Z.v0 >> shift)
+                    )
+              );
+
+            // The shifted-out remainder, and one unit in its last place.
+            const auto shift_is_wide = (shift >= static_cast<unsigned>(UINT8_C(64)));
+
+            const auto one_ulp =
+              shift_is_wide
+                ? detail::uint128_compound { static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(shift - static_cast<unsigned>(UINT8_C(64)))) }
+                : detail::uint128_compound { static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << shift), static_cast<std::uint64_t>(UINT8_C(0)) };
+
+            const auto low =
+              shift_is_wide
+                ? detail::uint128_compound { sig128Z.v0, static_cast<std::uint64_t>(sig128Z.v1 & static_cast<std::uint64_t>(one_ulp.v1 - static_cast<std::uint64_t>(UINT8_C(1)))) }
+                : detail::uint128_compound { static_cast<std::uint64_t>(sig128Z.v0 & static_cast<std::uint64_t>(one_ulp.v0 - static_cast<std::uint64_t>(UINT8_C(1)))), static_cast<std::uint64_t>(UINT8_C(0)) };
+
+            const auto half =
+              detail::uint128_compound
+              {
+                static_cast<std::uint64_t>(static_cast<std::uint64_t>(one_ulp.v0 >> static_cast<unsigned>(UINT8_C(1))) | static_cast<std::uint64_t>(one_ulp.v1 << static_cast<unsigned>(UINT8_C(63)))),
+                static_cast<std::uint64_t>(one_ulp.v1 >> static_cast<unsigned>(UINT8_C(1)))
+              };
+
+            const auto low_vs_half =
+              static_cast<int>
+              (
+                (low.v1 != half.v1) ? ((low.v1 > half.v1) ? 1 : -1)
+                                    : ((low.v0 > half.v0) ? 1 : ((low.v0 < half.v0) ? -1 : 0))
+              );
+
+            const auto round_up =
+              (
+                   (low_vs_half > 0)
+                || ((low_vs_half == 0) && ((sigZ & static_cast<std::uint64_t>(UINT8_C(1))) != static_cast<std::uint64_t>(UINT8_C(0))))
+              );
+
+            auto err128 = low;
+
+            if(round_up)
+            {
+              ++sigZ;
+
+              err128 = detail::softfloat_sub128(one_ulp, low);
+            }
+
+            result =
+              detail::packToF64UI
+              (
+                signA,
+                static_cast<std::int32_t>(static_cast<std::int32_t>(lead) + static_cast<std::int32_t>(expA) - static_cast<std::int32_t>(INT8_C(117))),
+                sigZ
+              );
+
+            if(   (err128.v1 == static_cast<std::uint64_t>(UINT8_C(0)))
+               && (err128.v0 == static_cast<std::uint64_t>(UINT8_C(0))))
+            {
+              err = static_cast<std::uint64_t>(UINT8_C(0));
+            }
+            else
+            {
+              // The error is exactly representable, so its significant
+              // bits all lie within the 53 bits below its leading bit.
+              const auto lead_err = leading_bit_128(err128);
+
+              const auto sig_err =
+                static_cast<std::uint64_t>
+                (
+                  (lead_err > static_cast<unsigned>(UINT8_C(52)))
+                    ? static_cast<std::uint64_t>
+                      (
+                          static_cast<std::uint64_t>(err128.v1 << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(116)) - lead_err))
+                        | static_cast<std::uint64_t>(err128.v0 >> static_cast<unsigned>(lead_err - static_cast<unsigned>(UINT8_C(52))))
+                      )
+                    : static_cast<std::uint64_t>(err128.v0 << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(52)) - lead_err))
+                );
+
+              err =
+                detail::packToF64UI
+                (
+                  (signA != round_up),
+                  static_cast<std::int32_t>(static_cast<std::int32_t>(lead_err) + static_cast<std::int32_t>(expA) - static_cast<std::int32_t>(INT8_C(117))),
+                  sig_err
+                );
+            }
+          }
+        }
+      }
+
+      return result;
+    }
+
+    static constexpr auto leading_bit_128(const detail::uint128_compound& x) -> unsigned
+    {
+      return
+        static_cast<unsigned>
+        (
+          (x.v1 != static_cast<std::uint64_t>(UINT8_C(0)))
+            ? static_cast<unsigned>(static_cast<unsigned>(UINT8_C(127)) - static_cast<unsigned>(detail::softfloat_countLeadingZeros64(x.v1)))
+            : static_cast<unsigned>(static_cast<unsigned>(UINT8_C(63))  - static_cast<unsigned>(detail::softfloat_countLeadingZeros64(x.v0)))
+        );
+    }
+
+    static constexpr auto f64_mul_exact(const std::uint64_t a, const std::uint64_t b, std::uint64_t& err) -> std::uint64_t
+    {
+      // Returns the rounded product of a and b and sets err to the
+      // exact rounding error (a * b) - product. Both are taken from one
+      // 106-bit product of the significands. When the product or its
+      // error would leave the range of normal numbers (or for zero,
+      // subnormal or non-finite operands), both are obtained with
+      // fused multiply-adds instead.
+
+      const auto expA = detail::expF64UI(a);
+      const auto expB = detail::expF64UI(b);
+
+      const auto expZ = static_cast<std::int32_t>(static_cast<std::int32_t>(expA + expB) - static_cast<std::int32_t>(INT16_C(0x3FF)));
+
+      const auto is_in_window =
+        (
+             (expA != static_cast<std::int16_t>(INT8_C(0))) && (expA != static_cast<std::int16_t>(INT16_C(0x7FF)))
+          && (expB != static_cast<std::int16_t>(INT8_C(0))) && (expB != static_cast<std::int16_t>(INT16_C(0x7FF)))
+          && (expZ >= static_cast<std::int32_t>(INT8_C(105)))
+          && (expZ <= static_cast<std::int32_t>(INT16_C(0x7FC)))
+        );
+
+      auto result = std::uint64_t { };
+
+      if(!is_in_window)
+      {
+        // Adding negative zero leaves every product, including
+        // the sign of a zero product, unchanged.
+        result = f64_mulAdd(a, b, static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)));
+
+        err = f64_mulAdd(a, b, static_cast<std::uint64_t>(result ^ static_cast<std::uint64_t>(UINT64_C(0x8000000000000000))));
+      }
+      else
+      {
+        const auto signZ = sign_ab(a, b);
+
+        const auto sigA = static_cast<std::uint64_t>(detail::fracF64UI(a) | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)));
+        const auto sigB = static_cast<std::uint64_t>(detail::fracF64UI(b) | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)));
+
+        // The product of the two 53-bit significands has 105 or 106 bits.
+        const auto sig128Z = detail::softfloat_mul64To128(sigA, sigB);
+
+        const auto shift =
+          static_cast<unsigned>
+          (
+            (sig128Z.v1 >= static_cast<std::uint64_t>(UINT64_C(0x0000020000000000))) ? static_cast<unsigned>(UINT8_C(53))
+                                                                                     : static_cast<unsigned>(UINT8_C(52))
+          );
+
+        auto sigZ =
+          static_cast<std::uint64_t>
+          (
+              static_cast<std::uint64_t>(sig128Z.v1 << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - shift))
+            | static_cast<std::uint64_t>(sig128Z.v0 >> shift)
+          );
+
+        const auto one_ulp = static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << shift);
+        const auto half    = static_cast<std::uint64_t>(one_ulp >> static_cast<unsigned>(UINT8_C(1)));
+        const auto low     = static_cast<std::uint64_t>(sig128Z.v0 & static_cast<std::uint64_t>(one_ulp - static_cast<std::uint64_t>(UINT8_C(1))));
+
+        const auto round_up =
+          (
+               (low > half)
+            || ((low == half) && ((sigZ & static_cast<std::uint64_t>(UINT8_C(1))) != static_cast<std::uint64_t>(UINT8_C(0))))
+          );
+
+        auto err_mag = low;
+
+        if(round_up)
+        {
+          ++sigZ;
+
+          err_mag = static_cast<std::uint64_t>(one_ulp - low);
+        }
+
+        // A carry out of the rounding is absorbed by the addition
+        // of the significand's hidden bit into the exponent field.
+        result =
+          detail::packToF64UI
+          (
+            signZ,
+            static_cast<std::int32_t>(expZ + static_cast<std::int32_t>(shift) - static_cast<std::int32_t>(INT8_C(53))),
+            sigZ
+          );
+
+        if(err_mag == static_cast<std::uint64_t>(UINT8_C(0)))
+        {
+          err = static_cast<std::uint64_t>(UINT8_C(0));
+        }
+        else
+        {
+          // The error has at most 53 significant bits and its lowest
+          // possible bit is 2^(expZ - 1127), so it is exact and normal.
+          const auto lead =
+            static_cast<unsigned>
+            (
+              static_cast<unsigned>(UINT8_C(63)) - static_cast<unsigned>(detail::softfloat_countLeadingZeros64(err_mag))
+            );
+
+          err =
+            detail::packToF64UI
+            (
+              (signZ != round_up),
+              static_cast<std::int32_t>(expZ - static_cast<std::int32_t>(INT8_C(105)) + static_cast<std::int32_t>(lead)),
+              static_cast<std::uint64_t>(err_mag << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(52)) - lead))
+            );
+        }
+      }
+
+      return result;
+    }
+
+    template<detail::round_mode Mode = detail::round_mode::near_even>
+    static constexpr auto f64_mulAdd(const std::uint64_t a, const std::uint64_t b, const std::uint64_t c) -> std::uint64_t
+    {
+      // Computes (a * b) + c with a single rounding. This follows
+      // softfloat_mulAddF64 of Berkeley SoftFloat 3e, without the
+      // special handling of infinity and NaN.
+
+      auto expA = detail::expF64UI (a);
+      auto sigA = detail::fracF64UI(a);
+      auto expB = detail::expF64UI (b);
+      auto sigB = detail::fracF64UI(b);
+
+      const auto signC = detail::signF64UI(c);
+
+      auto expC = detail::expF64UI (c);
+      auto sigC = detail::fracF64UI(c);
+
+      const auto signProd = sign_ab(a, b);
+
+      const auto c_is_zero = (   (expC == static_cast<std::int16_t> ( INT8_C(0)))
+                              && (sigC == static_cast<std::uint64_t>(UINT8_C(0))));
+
+      auto result = std::uint64_t { };
+
+      if(   (   (expA == static_cast<std::int16_t> ( INT8_C(0)))
+             && (sigA == static_cast<std::uint64_t>(UINT8_C(0))))
+         || (   (expB == static_cast<std::int16_t> ( INT8_C(0)))
+             && (sigB == static_cast<std::uint64_t>(UINT8_C(0)))))
+      {
+        // The product is zero. The result is c, except for zeros having
+        // opposite signs which add to +0 (or to -0 when rounding downward).
+
+        result = ((c_is_zero && (signProd != signC)) ? detail::packToF64UI((Mode == detail::round_mode::min), static_cast<int>(INT8_C(0)), static_cast<int>(INT8_C(0))) : c);
+      }
+      else
+      {
+        if(expA == static_cast<std::int16_t>(INT8_C(0))) { softfloat_normSubnormalF64Sig(expA, sigA); }
+        if(expB == static_cast<std::int16_t>(INT8_C(0))) { softfloat_normSubnormalF64Sig(expB, sigB); }
+
+        auto expZ =
+          static_cast<std::int16_t>
+          (
+              static_cast<std::int16_t>(expA + expB)
+            - static_cast<std::int16_t>(INT16_C(0x3FE))
+          );
+
+        sigA = static_cast<std::uint64_t>(static_cast<std::uint64_t>(sigA | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000))) << static_cast<unsigned>(UINT8_C(10)));
+        sigB = static_cast<std::uint64_t>(static_cast<std::uint64_t>(sigB | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000))) << static_cast<unsigned>(UINT8_C(10)));
+
+        // Compute the exact 128-bit product of sigA and sigB and normalize it
+        // such that its upper half lies in the range [2^61, 2^62).
+        auto sig128Z = detail::softfloat_mul64To128(sigA, sigB);
+
+        if(sig128Z.v1 < static_cast<std::uint64_t>(UINT64_C(0x2000000000000000)))
+        {
+          --expZ;
+
+          sig128Z = detail::softfloat_add128(sig128Z, sig128Z);
+        }
+
+        if(c_is_zero)
+        {
+          --expZ;
+
+          const auto sigZ =
+            static_cast<std::uint64_t>
+            (
+                static_cast<std::uint64_t>(sig128Z.v1 << static_cast<unsigned>(UINT8_C(1)))
+              | static_cast<std::uint64_t>
+                (
+                  (sig128Z.v0 != static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0))
+                )
+            );
+
+          result = softfloat_roundPackToF64<Mode>(signProd, expZ, sigZ);
+        }
+        else
+        {
+          if(expC == static_cast<std::int16_t>(INT8_C(0))) { softfloat_normSubnormalF64Sig(expC, sigC); }
+
+          sigC = static_cast<std::uint64_t>(static_cast<std::uint64_t>(sigC | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000))) << static_cast<unsigned>(UINT8_C(9)));
+
+          result = softfloat_addProdF64<Mode>(signProd, expZ, sig128Z, signC, expC, sigC);
+        }
+      }
+
+      return result;
+    }
+
+    template<detail::round_mode Mode = detail::round_mode::near_even>
+    static constexpr auto f64_div(const std::uint64_t a, const std::uint64_t b) -> std::uint64_t
+    {
+      auto result = std::uint64_t { };
+
+      if(detail::isZeroF64UI(a))
+      {
+        result = detail::packToF64UI(sign_ab(a, b), static_cast<int>(INT8_C(0)), static_cast<int>(INT8_C(0)));
+      }
+      else
+      {
+        const auto z = f64_div_unrounded(a, b);
+
+        result = softfloat_roundPackToF64<Mode>(z.sign, z.exp, z.sig);
+      }
+
+      return result;
+    }
+
+    static constexpr auto f64_div_unrounded(const std::uint64_t a, const std::uint64_t b) -> detail::unrounded_f64
+    {
+      // The quotient of the nonzero, finite a and b, ready to be rounded
+      // in any direction with softfloat_roundPackToF64.
+
+      auto expA  = detail::expF64UI(a);
+      auto sigA  = detail::fracF64UI(a);
+
+      auto expB = detail::expF64UI (b);
+      auto sigB = detail::fracF64UI(b);
+
+      if(expA == static_cast<std::int16_t>(INT8_C(0))) { softfloat_normSubnormalF64Sig(expA, sigA); }
+      if(expB == static_cast<std::int16_t>(INT8_C(0))) { softfloat_normSubnormalF64Sig(expB, sigB); }
+
+      auto expZ =
+        static_cast<std::int16_t>
+        (
+            static_cast<std::int16_t>(expA - expB)
+          + static_cast<std::int16_t>(INT16_C(0x3FE))
+        );
+
+      sigA =
+        static_cast<std::uint64_t>
+        (
+            sigA
+          | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000))
+        );
+
+      sigB =
+        static_cast<std::uint64_t>
+        (
+            sigB
+          | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000))
+        );
+
+      if(sigA < sigB)
+      {
+        --expZ;
+
+        sigA = static_cast<std::uint64_t>(sigA << static_cast<unsigned>(UINT8_C(11)));
+      }
+      else
+      {
+        sigA = static_cast<std::uint64_t>(sigA << static_cast<unsigned>(UINT8_C(10)));
+      }
+
+      sigB <<= static_cast<unsigned>(UINT8_C(11));
+
+      #if (SOFT_DOUBLE_HAS_WIDE_DIVISION == 1)
+      const auto sigZ = detail::softfloat_divSigF64_wide(sigA, sigB);
+      #else
+      const auto recip32 =
+        static_cast<std::uint32_t>
+        (
+            detail::softfloat_approxRecip32_1(static_cast<std::uint32_t>(sigB >> static_cast<unsigned>(UINT8_C(32))))
+          - static_cast<unsigned>(UINT8_C(2))
+        );
+
+      const auto sig32Z =
+        static_cast<std::uint32_t>
+        (
+          static_cast<std::uint64_t>
+          (
+              static_cast<std::uint32_t>(sigA >> static_cast<unsigned>(UINT8_C(32)))
+            * static_cast<std::uint64_t>(recip32)
+          ) >> static_cast<unsigned>(UINT8_C(32))
+        );
+
+      auto doubleTerm = static_cast<std::uint32_t>(sig32Z << static_cast<unsigned>(UINT8_C(1)));
+
+      auto rem =
+        static_cast<std::uint64_t>
+        (
+          static_cast<std::uint64_t>
+          (
+            static_cast<std::uint64_t>
+            (
+                sigA
+              - static_cast<std::uint64_t>
+                (
+                    static_cast<std::uint64_t>(doubleTerm)
+                  * static_cast<std::uint32_t>(sigB >> static_cast<unsigned>(UINT8_C(32)))
+                )
+            )
+            << static_cast<unsigned>(UINT8_C(28))
+          )
+        - static_cast<std::uint64_t>
+          (
+              static_cast<std::uint64_t>(doubleTerm)
+            * static_cast<std::uint32_t>(static_cast<std::uint32_t>(sigB) >> static_cast<unsigned>(UINT8_C(4)))
+          )
+        );
+
+      auto q =
+        static_cast<std::uint32_t>
+        (
+            static_cast<std::uint32_t>
+            (
+                 static_cast<std::uint64_t>
+                 (
+                     static_cast<std::uint32_t>(rem >> static_cast<unsigned>(UINT8_C(32)))
+                   * static_cast<std::uint64_t>(recip32)
+                 )
+              >> static_cast<unsigned>(UINT8_C(32))
+            )
+          + static_cast<std::uint_fast8_t>(UINT8_C(4))
+        );
+
+      auto sigZ =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(static_cast<std::uint64_t>(sig32Z) << static_cast<unsigned>(UINT8_C(32)))
+          + static_cast<std::uint64_t>(static_cast<std::uint64_t>(q)      << static_cast<unsigned>(UINT8_C( 4)))
+        );
+
+      if(static_cast<std::uint_fast16_t>(sigZ & static_cast<std::uint_fast16_t>(UINT16_C(0x1FF))) < static_cast<std::uint_fast16_t>(static_cast<std::uint_fast16_t>(UINT8_C(4)) << static_cast<unsigned>(UINT8_C(4))))
+      {
+        q    = static_cast<std::uint32_t>(q    & static_cast<std::uint32_t>(~static_cast<std::uint32_t>(UINT8_C(7))));
+        sigZ = static_cast<std::uint64_t>(sigZ & static_cast<std::uint64_t>(~static_cast<std::uint64_t>(UINT8_C(0x7F))));
+
+        doubleTerm = static_cast<std::uint32_t>(q << static_cast<unsigned>(UINT8_C(1)));
+
+        rem =
+          static_cast<std::uint64_t>
+          (
+              static_cast<std::uint64_t>
+              (
+                static_cast<std::uint64_t>
+                (
+                    rem
+                  - static_cast<std::uint64_t>
+                    (
+                        static_cast<std::uint64_t>(doubleTerm)
+                      * static_cast<std::uint32_t>(sigB >> static_cast<unsigned>(UINT8_C(32)))
+                    )
+                ) << static_cast<unsigned>(UINT8_C(28))
+              )
+            - static_cast<std::uint64_t>
+              (
+                  static_cast<std::uint64_t>(doubleTerm)
+                * static_cast<std::uint32_t>(static_cast<std::uint32_t>(sigB) >> static_cast<unsigned>(UINT8_C(4)))
+              )
+          );
+
+        if(static_cast<std::uint_fast8_t>(rem >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint_fast8_t>(UINT8_C(0)))
+        {
+          sigZ =
+            static_cast<std::uint64_t>
+            (
+                sigZ
+              - static_cast<std::uint_fast8_t>
+                (
+                  static_cast<std::uint_fast8_t>(UINT8_C(1)) << static_cast<unsigned>(UINT8_C(7))
+                )
+            );
+        }
+        else
+        {
+          if(rem != static_cast<std::uint64_t>(UINT8_C(0)))
+          {
+            sigZ = static_cast<std::uint64_t>(sigZ | static_cast<std::uint_fast8_t>(UINT8_C(1)));
+          }
+        }
+      }
+      #endif
+
+      return detail::unrounded_f64 { sign_ab(a, b), expZ, sigZ };
+    }
+
+    template<detail::round_mode Mode = detail::round_mode::near_even>
+    static constexpr auto f64_sqrt(const std::uint64_t a) -> std::uint64_t
+    {
+      auto result = std::uint64_t { };
+
+      if(detail::isZeroF64UI(a) || detail::signF64UI(a))
+      {
+        result = a;
+      }
+      else
+      {
+        const auto z = f64_sqrt_unrounded(a);
+
+        result = softfloat_roundPackToF64<Mode>(z.sign, z.exp, z.sig);
+      }
+
+      return result;
+    }
+
+    static constexpr auto f64_sqrt_unrounded(const std::uint64_t a) -> detail::unrounded_f64
+    {
+      // The square root of the positive, finite a, ready to be rounded
+      // in any direction with softfloat_roundPackToF64.
+
+      auto expA = detail::expF64UI (a);
+      auto sigA = detail::fracF64UI(a);
+
+      // sig32Z is guaranteed to be a lower bound on the square root
+      // of sig32A, which makes sig32Z also a lower bound on the
+      // square root of sigA.
+
+      if(expA == static_cast<std::int16_t>(INT8_C(0))) { softfloat_normSubnormalF64Sig(expA, sigA); }
+
+      const auto expZ =
+        static_cast<std::int16_t>
+        (
+            static_cast<std::int_fast16_t>
+            (
+              static_cast<std::int_fast16_t> // NOLINT(hicpp-signed-bitwise)
+              (
+                  expA
+                - static_cast<std::int16_t>(INT16_C(0x3FF))
+              ) >> static_cast<unsigned>(UINT8_C(1))
+            )
+          + static_cast<std::int_fast16_t>(INT16_C(0x3FE))
+        );
+
+      expA =
+        static_cast<std::int16_t>
+        (
+          static_cast<std::uint_fast8_t>(expA) & static_cast<std::uint_fast8_t>(UINT8_C(1))
+        );
+
+      sigA = static_cast<std::uint64_t>(sigA | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)));
+
+      const auto sig32A      = static_cast<std::uint32_t>(sigA >> static_cast<unsigned>(UINT8_C(21)));
+      const auto recipSqrt32 = detail::softfloat_approxRecipSqrt32_1(static_cast<std::uint32_t>(expA), sig32A);
+            auto sig32Z      = static_cast<std::uint32_t>
+                               (
+                                 static_cast<std::uint64_t>(static_cast<std::uint64_t>(sig32A) * recipSqrt32) >> static_cast<unsigned>(UINT8_C(32))
+                               );
+
+      if(expA != static_cast<std::int16_t>(INT8_C(0)))
+      {
+        sigA   <<= static_cast<unsigned>(UINT8_C(8));
+        sig32Z >>= static_cast<unsigned>(UINT8_C(1));
+      }
+      else
+      {
+        sigA <<= static_cast<unsigned>(UINT8_C(9));
+      }
+
+      auto rem =
+        static_cast<std::uint64_t>
+        (
+            sigA
+          - static_cast<std::uint64_t>(static_cast<std::uint64_t>(sig32Z) * sig32Z)
+        );
+
+      const auto q =
+        static_cast<std::uint32_t>
+        (
+          static_cast<std::uint64_t>
+          (
+              static_cast<std::uint32_t>(rem >> static_cast<unsigned>(UINT8_C(2)))
+            * static_cast<std::uint64_t>(recipSqrt32)
+          ) >> static_cast<unsigned>(UINT8_C(32))
+        );
+
+      auto sigZ =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>
+            (
+                static_cast<std::uint64_t>(static_cast<std::uint64_t>(sig32Z) << static_cast<unsigned>(UINT8_C(32)))
+              | static_cast<std::uint_fast8_t>(static_cast<std::uint_fast8_t>(UINT8_C(1)) << static_cast<unsigned>(UINT8_C(5)))
+            )
+          + static_cast<std::uint64_t>((static_cast<std::uint64_t>(q) << static_cast<unsigned>(UINT8_C(3))))
+        );
+
+      const auto sig_small_masked =
+        static_cast<std::uint_fast16_t>
+        (
+          sigZ & static_cast<std::uint_fast16_t>(UINT16_C(0x1FF))
+        );
+
+      if(sig_small_masked < static_cast<std::uint_fast16_t>(UINT16_C(0x22)))
+      {
+        sigZ &= static_cast<std::uint64_t>(~static_cast<std::uint64_t>(UINT8_C(0x3F)));
+
+        const auto shiftedSigZ = static_cast<std::uint64_t>(sigZ >> static_cast<unsigned>(UINT8_C(6)));
+
+        rem =
+          static_cast<std::uint64_t>
+          (
+              static_cast<std::uint64_t>(sigA << static_cast<unsigned>(UINT8_C(52)))
+            - static_cast<std::uint64_t>(shiftedSigZ * shiftedSigZ)
+          );
+
+        if(static_cast<std::uint_fast8_t>(rem >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint_fast8_t>(UINT8_C(0)))
+        {
+          --sigZ;
+        }
+        else
+        {
+          if(rem != static_cast<std::uint64_t>(UINT8_C(0)))
+          {
+            sigZ =
+              static_cast<std::uint64_t>
+              (
+                sigZ | static_cast<std::uint_fast8_t>(UINT8_C(1))
+              );
+          }
+        }
+      }
+
+      return detail::unrounded_f64 { false, expZ, sigZ };
+    }
+
+    static constexpr auto f64_exp_fixed_sig(const bool signA, const detail::uint128_compound& x_fixed, std::int32_t& expZ, std::uint64_t& sigZ) -> void
+    {
+      // Write x = (k * ln2 / N) + r, with N = 2^SOFT_DOUBLE_EXP_TABLE_BITS
+      // and 0 <= r <= ln2 / N. With k = (m * N) + j, this gives
+      // exp(x) = 2^m * 2^(j/N) * exp(r). The factor 2^(j/N) is taken
+      // from a table generated at compile time and exp(r) is a short
+      // Taylor polynomial. All of this is carried out in fixed-point.
+      // Here, the argument is given as |x| < 1024, with 64 fractional bits,
+      // together with its sign. The unrounded result is delivered in expZ
+      // and sigZ, in the form expected by softfloat_roundPackToF64.
+
+      constexpr auto table_bits = static_cast<unsigned>(SOFT_DOUBLE_EXP_TABLE_BITS);
+
+      constexpr auto degree = detail::exp_table_poly_degree(table_bits);
+
+      // The reciprocal factorials 1/k! for k in [0, 10], with 63 fractional bits.
+      constexpr auto inv_factorials =
+        std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(11))>
+        {
+          static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)),
+          static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)),
+          static_cast<std::uint64_t>(UINT64_C(0x4000000000000000)),
+          static_cast<std::uint64_t>(UINT64_C(0x1555555555555555)),
+          static_cast<std::uint64_t>(UINT64_C(0x0555555555555555)),
+          static_cast<std::uint64_t>(UINT64_C(0x0111111111111111)),
+          static_cast<std::uint64_t>(UINT64_C(0x002D82D82D82D82E)),
+          static_cast<std::uint64_t>(UINT64_C(0x0006806806806807)),
+          static_cast<std::uint64_t>(UINT64_C(0x0000D00D00D00D01)),
+          static_cast<std::uint64_t>(UINT64_C(0x0000171DE3A556C7)),
+          static_cast<std::uint64_t>(UINT64_C(0x0000024FC9F6EF14))
+        };
+
+      // ln2 with 128 fractional bits and 1/ln2 with 62 fractional bits.
+      constexpr auto ln2_hi   = static_cast<std::uint64_t>(UINT64_C(0xB17217F7D1CF79AB));
+      constexpr auto ln2_lo   = static_cast<std::uint64_t>(UINT64_C(0xC9E3B39803F2F6AF));
+      constexpr auto inv_ln2  = static_cast<std::uint64_t>(UINT64_C(0x5C551D94AE0BF85D));
+
+      // Estimate q = floor(|x| * N / ln2) from below, using |x| with
+      // 53 fractional bits. Then set the remainder |x| - (q * ln2 / N),
+      // where ln2 / N = l_hi + (l_lo * 2^-64) with 64 fractional bits.
+      const auto x53 =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(x_fixed.v1 << static_cast<unsigned>(UINT8_C(53)))
+          | static_cast<std::uint64_t>(x_fixed.v0 >> static_cast<unsigned>(UINT8_C(11)))
+        );
+
+      auto q =
+        static_cast<std::uint64_t>
+        (
+          detail::softfloat_mul64To128(x53, inv_ln2).v1 >> static_cast<unsigned>(static_cast<unsigned>(UINT8_C(51)) - table_bits)
+        );
+
+      constexpr auto l_hi = static_cast<std::uint64_t>(ln2_hi >> table_bits);
+      constexpr auto l_lo =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(ln2_lo >> table_bits)
+          | static_cast<std::uint64_t>(ln2_hi << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - table_bits))
+        );
+
+      const auto q_l =
+        detail::softfloat_add128
+        (
+          detail::softfloat_mul64To128(q, l_hi),
+          detail::uint128_compound { detail::softfloat_mul64To128(q, l_lo).v1, static_cast<std::uint64_t>(UINT8_C(0)) }
+        );
+
+      auto rem =
+        detail::uint128_compound
+        {
+          static_cast<std::uint64_t>(x_fixed.v0 - q_l.v0),
+          static_cast<std::uint64_t>
+          (
+              static_cast<std::uint64_t>(x_fixed.v1 - q_l.v1)
+            - static_cast<std::uint64_t>((x_fixed.v0 < q_l.v0) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))
+          )
+        };
+
+      // The estimate of q is low by at most a few units.
+      while((rem.v1 != static_cast<std::uint64_t>(UINT8_C(0))) || (rem.v0 >= l_hi))
+      {
+        rem.v1 =
+          static_cast<std::uint64_t>
+          (
+            rem.v1 - static_cast<std::uint64_t>((rem.v0 < l_hi) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))
+          );
+
+        rem.v0 = static_cast<std::uint64_t>(rem.v0 - l_hi);
+
+        ++q;
+      }
+
+      // For negative x, x = -(q * ln2 / N) - rem = -((q + 1) * ln2 / N) + (ln2 / N - rem).
+      auto r = rem.v0;
+      auto k = static_cast<std::int32_t>(q);
+
+      if(signA)
+      {
+        if(r != static_cast<std::uint64_t>(UINT8_C(0)))
+        {
+          r = static_cast<std::uint64_t>(l_hi - r);
+
+          ++k;
+        }
+
+        k = static_cast<std::int32_t>(-k);
+      }
+
+      // Evaluate exp(r) with 63 fractional bits, where r has 64.
+      auto e = inv_factorials[static_cast<std::size_t>(degree)];
+
+      for(auto i = static_cast<std::size_t>(degree); i > static_cast<std::size_t>(UINT8_C(0)); --i)
+      {
+        e = static_cast<std::uint64_t>(inv_factorials[i - 1U] + detail::softfloat_mul64To128(e, r).v1);
+      }
+
+      const auto j = static_cast<std::uint32_t>(static_cast<std::uint32_t>(k) & static_cast<std::uint32_t>(detail::exp2_table<table_bits>::size() - 1U));
+      const auto m = static_cast<std::int32_t>(static_cast<std::int32_t>(k - static_cast<std::int32_t>(j)) / static_cast<std::int32_t>(detail::exp2_table<table_bits>::size()));
+
+      // The product 2^(j/N) * exp(r) lies in [1, 2] and has 126 fractional bits.
+      const auto p = detail::softfloat_mul64To128(detail::exp2_table_holder<table_bits>::values.data[j], e); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+      sigZ =
+        static_cast<std::uint64_t>
+        (
+            p.v1
+          | static_cast<std::uint64_t>((p.v0 != static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))
+        );
+
+      expZ = static_cast<std::int32_t>(static_cast<std::int32_t>(INT16_C(0x3FE)) + m);
+
+      if(static_cast<std::uint64_t>(sigZ >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint64_t>(UINT8_C(0)))
+      {
+        sigZ = detail::softfloat_shortShiftRightJam64(sigZ, static_cast<std::uint_fast16_t>(UINT8_C(1)));
+
+        ++expZ;
+      }
+    }
+
+    static constexpr auto f64_exp_fixed(const bool signA, const detail::uint128_compound& x_fixed) -> std::uint64_t
+    {
+      // Compute exp(x) with a single rounding, for x given as above.
+      auto expZ = std::int32_t  { };
+      auto sigZ = std::uint64_t { };
+
+      f64_exp_fixed_sig(signA, x_fixed, expZ, sigZ);
+
+      return
+        (expZ > static_cast<std::int32_t>(INT16_C(0x7FD)))
+          ? static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000))
+          : softfloat_roundPackToF64(false, static_cast<std::int16_t>(expZ), sigZ);
+    }
+
+    static constexpr auto f64_exp(const std::uint64_t a) -> std::uint64_t
+    {
+      const auto expA  = detail::expF64UI (a);
+      const auto sigA  = detail::fracF64UI(a);
+      const auto signA = detail::signF64UI(a);
+
+      auto result = std::uint64_t { };
+
+      if(expA >= static_cast<std::int16_t>(INT16_C(0x409)))
+      {
+        // For |x| >= 1024, infinity and NaN, the result is
+        // either NaN, infinity or zero.
+        const auto a_is_nan = ((expA == static_cast<std::int16_t>(INT16_C(0x7FF))) && (sigA != static_cast<std::uint64_t>(UINT8_C(0))));
+
+        result =
+          a_is_nan ? a
+                   : (signA ? static_cast<std::uint64_t>(UINT8_C(0))
+                            : static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000)));
+      }
+      else
+      {
+        result = f64_exp_fixed(signA, f64_abs_fixed128(expA, sigA));
+      }
+
+      return result;
+    }
+
+    static constexpr auto f64_exp2(const std::uint64_t a) -> std::uint64_t
+    {
+      // Compute 2^x = exp(x * ln2), where x * ln2 is formed with 64 fractional
+      // bits from ln2 with 128 fractional bits. Integer x is exact.
+      constexpr auto ln2_hi = static_cast<std::uint64_t>(UINT64_C(0xB17217F7D1CF79AB));
+      constexpr auto ln2_lo = static_cast<std::uint64_t>(UINT64_C(0xC9E3B39803F2F6AF));
+
+      const auto expA  = detail::expF64UI (a);
+      const auto sigA  = detail::fracF64UI(a);
+      const auto signA = detail::signF64UI(a);
+
+      const auto abs_a = static_cast<std::uint64_t>(a & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF)));
+
+      auto result = std::uint64_t { };
+
+      if(abs_a > static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000)))
+      {
+        result = a;
+      }
+      else if((!signA) && (abs_a >= static_cast<std::uint64_t>(UINT64_C(0x4090000000000000))))
+      {
+        // For x >= 1024, the result overflows.
+        result = static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000));
+      }
+      else if(signA && (abs_a > static_cast<std::uint64_t>(UINT64_C(0x4091000000000000))))
+      {
+        // For x < -1088, the result underflows.
+        result = static_cast<std::uint64_t>(UINT8_C(0));
+      }
+      else if(   (expA >= static_cast<std::int16_t>(INT16_C(0x3FF)))
+              && (static_cast<std::uint64_t>(sigA << static_cast<unsigned>(static_cast<std::int16_t>(expA - static_cast<std::int16_t>(INT16_C(0x3F3))))) == static_cast<std::uint64_t>(UINT8_C(0))))
+      {
+        // For integer x, the result is the power of two itself.
+        const auto n_abs =
+          static_cast<std::int32_t>
+          (
+            static_cast<std::uint64_t>(sigA | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000))) >> static_cast<unsigned>(static_cast<std::int16_t>(INT16_C(0x433)) - expA)
+          );
+
+        const auto n = static_cast<std::int32_t>(signA ? -n_abs : n_abs);
+
+        result =
+            (n >= static_cast<std::int32_t>(INT16_C(-1022))) ? detail::packToF64UI(false, static_cast<std::int16_t>(n + static_cast<std::int32_t>(INT16_C(0x3FF))), static_cast<std::uint64_t>(UINT8_C(0)))
+          : (n >= static_cast<std::int32_t>(INT16_C(-1074))) ? static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(n + static_cast<std::int32_t>(INT16_C(1074))))
+          :                                                    static_cast<std::uint64_t>(UINT8_C(0));
+      }
+      else
+      {
+        // Form |x| * ln2 with 64 fractional bits (truncated and jammed).
+        // Subnormal arguments share the scale of the smallest normal.
+        const auto sig =
+          static_cast<std::uint64_t>
+          (
+            (expA == static_cast<std::int16_t>(INT8_C(0)))
+              ? sigA
+              : static_cast<std::uint64_t>(sigA | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)))
+          );
+
+        const auto x_ln2 =
+          detail::softfloat_add128
+          (
+            detail::softfloat_mul64To128(sig, ln2_hi),
+            detail::uint128_compound { detail::softfloat_mul64To128(sig, ln2_lo).v1, static_cast<std::uint64_t>(UINT8_C(0)) }
+          );
+
+        const auto dist =
+          static_cast<std::uint_fast16_t>
+          (
+              static_cast<std::int16_t>(INT16_C(0x433))
+            - ((expA == static_cast<std::int16_t>(INT8_C(0))) ? static_cast<std::int16_t>(INT8_C(1)) : expA)
+          );
+
+        result = f64_exp_fixed(signA, detail::softfloat_shiftRightJam128(x_ln2, dist));
+      }
+
+      return result;
+    }
+
+    static constexpr auto f64_log_fixed64(const std::int16_t expA, const std::uint64_t sigA) -> detail::uint128_compound
+    {
+      // Write x = 2^e * m, with 1 <= m < 2, and take the index j from the top
+      // SOFT_DOUBLE_LOG_TABLE_BITS bits of the fraction of m. The table holds
+      // a reciprocal c ~ 1/m and -log(c). This gives log(x) = e * ln2 - log(c)
+      // + log(1 + r), where r = (c * m) - 1 is exact and |r| < 1/N. The term
+      // log(1 + r) = r - (r^2 * Q(r)) is a short polynomial. The sum is formed
+      // in fixed-point with 116 fractional bits and rounded only once. Around
+      // x = 1, c is 1 or 1/2, so that no cancellation occurs there. Here,
+      // x > 0 is finite with the biased exponent expA and the 64-bit
+      // significand sigA (with its leading bit at bit 63). The sum is
+      // returned unrounded, in two's complement.
+
+      constexpr auto table_bits = static_cast<unsigned>(SOFT_DOUBLE_LOG_TABLE_BITS);
+
+      constexpr auto degree = detail::log_table_poly_degree(table_bits);
+
+      // The reciprocals 1/(k + 2) for k in [0, 19], with 64 fractional bits.
+      constexpr auto inv_integers =
+        std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(20))>
+        {
+          static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)),
+          static_cast<std::uint64_t>(UINT64_C(0x5555555555555555)),
+          static_cast<std::uint64_t>(UINT64_C(0x4000000000000000)),
+          static_cast<std::uint64_t>(UINT64_C(0x3333333333333333)),
+          static_cast<std::uint64_t>(UINT64_C(0x2AAAAAAAAAAAAAAB)),
+          static_cast<std::uint64_t>(UINT64_C(0x2492492492492492)),
+          static_cast<std::uint64_t>(UINT64_C(0x2000000000000000)),
+          static_cast<std::uint64_t>(UINT64_C(0x1C71C71C71C71C72)),
+          static_cast<std::uint64_t>(UINT64_C(0x199999999999999A)),
+          static_cast<std::uint64_t>(UINT64_C(0x1745D1745D1745D1)),
+          static_cast<std::uint64_t>(UINT64_C(0x1555555555555555)),
+          static_cast<std::uint64_t>(UINT64_C(0x13B13B13B13B13B1)),
+          static_cast<std::uint64_t>(UINT64_C(0x1249249249249249)),
+          static_cast<std::uint64_t>(UINT64_C(0x1111111111111111)),
+          static_cast<std::uint64_t>(UINT64_C(0x1000000000000000)),
+          static_cast<std::uint64_t>(UINT64_C(0x0F0F0F0F0F0F0F0F)),
+          static_cast<std::uint64_t>(UINT64_C(0x0E38E38E38E38E39)),
+          static_cast<std::uint64_t>(UINT64_C(0x0D79435E50D79436)),
+          static_cast<std::uint64_t>(UINT64_C(0x0CCCCCCCCCCCCCCD)),
+          static_cast<std::uint64_t>(UINT64_C(0x0C30C30C30C30C31))
+        };
+
+      // ln2 with 128 fractional bits.
+      constexpr auto ln2_hi = static_cast<std::uint64_t>(UINT64_C(0xB17217F7D1CF79AB));
+      constexpr auto ln2_lo = static_cast<std::uint64_t>(UINT64_C(0xC9E3B39803F2F6AF));
+
+      const auto e = static_cast<std::int32_t>(static_cast<std::int32_t>(expA) - static_cast<std::int32_t>(INT16_C(0x3FF)));
+
+      const auto j = static_cast<std::size_t>(static_cast<std::size_t>(sigA >> static_cast<unsigned>(static_cast<unsigned>(UINT8_C(63)) - table_bits)) & static_cast<std::size_t>(detail::log_table<table_bits>::size() - 1U));
+
+      // Form r = (c * m) - 1 exactly, with 126 fractional bits.
+      const auto cm = detail::softfloat_mul64To128(detail::log_table_holder<table_bits>::values.recip[j], sigA); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+      const auto one = detail::uint128_compound { static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(UINT8_C(62))) };
+
+      const auto r_is_neg = (cm.v1 < one.v1);
+
+      const auto r_abs = (r_is_neg ? detail::softfloat_sub128(one, cm) : detail::softfloat_sub128(cm, one));
+
+      // Take |r| with 63 + N_bits fractional bits.
+      const auto r =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(r_abs.v0 >> static_cast<unsigned>(static_cast<unsigned>(UINT8_C(63)) - table_bits))
+          | static_cast<std::uint64_t>(r_abs.v1 << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(1)) + table_bits))
+        );
+
+      // Evaluate Q(r) = sum of (-r)^k / (k + 2), with 64 fractional bits.
+      auto q = inv_integers[static_cast<std::size_t>(degree)];
+
+      for(auto i = static_cast<std::size_t>(degree); i > static_cast<std::size_t>(UINT8_C(0)); --i)
+      {
+        const auto rq = static_cast<std::uint64_t>(detail::softfloat_mul64To128(r, q).v1 >> static_cast<unsigned>(table_bits - 1U));
+
+        q = static_cast<std::uint64_t>(r_is_neg ? static_cast<std::uint64_t>(inv_integers[i - 1U] + rq) : static_cast<std::uint64_t>(inv_integers[i - 1U] - rq));
+      }
+
+      // The term r^2 * Q(r), with 116 fractional bits.
+      const auto r2 = detail::softfloat_mul64To128(r, r);
+
+      const auto r2q =
+        detail::softfloat_shortShiftRightJam128
+        (
+          detail::softfloat_add128
+          (
+            detail::softfloat_mul64To128(r2.v1, q),
+            detail::uint128_compound { detail::softfloat_mul64To128(r2.v0, q).v1, static_cast<std::uint64_t>(UINT8_C(0)) }
+          ),
+          static_cast<std::uint_fast8_t>(static_cast<unsigned>(UINT8_C(10)) + static_cast<unsigned>(table_bits * 2U))
+        );
+
+      // The product |e| * ln2, with 116 fractional bits.
+      const auto e_abs = static_cast<std::uint64_t>((e < static_cast<std::int32_t>(INT8_C(0))) ? -e : e);
+
+      const auto e_ln2_lo = detail::softfloat_mul64To128(e_abs, ln2_lo);
+
+      const auto e_ln2_hi =
+        detail::softfloat_add128
+        (
+          detail::softfloat_mul64To128(e_abs, ln2_hi),
+          detail::uint128_compound { e_ln2_lo.v1, static_cast<std::uint64_t>(UINT8_C(0)) }
+        );
+
+      const auto e_ln2 =
+        detail::uint128_compound
+        {
+          static_cast<std::uint64_t>(static_cast<std::uint64_t>(e_ln2_lo.v0 >> static_cast<unsigned>(UINT8_C(12))) | static_cast<std::uint64_t>(e_ln2_hi.v0 << static_cast<unsigned>(UINT8_C(52)))),
+          static_cast<std::uint64_t>(static_cast<std::uint64_t>(e_ln2_hi.v0 >> static_cast<unsigned>(UINT8_C(12))) | static_cast<std::uint64_t>(e_ln2_hi.v1 << static_cast<unsigned>(UINT8_C(52))))
+        };
+
+      // Sum e * ln2 - log(c) + r - (r^2 * Q(r)) in two's complement.
+      auto sum =
+        detail::uint128_compound
+        {
+          detail::log_table_holder<table_bits>::values.log_lo[j], // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+          detail::log_table_holder<table_bits>::values.log_hi[j]  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        };
+
+      sum = ((e < static_cast<std::int32_t>(INT8_C(0))) ? detail::softfloat_sub128(sum, e_ln2) : detail::softfloat_add128(sum, e_ln2));
+
+      const auto r_116 =
+        detail::uint128_compound
+        {
+          static_cast<std::uint64_t>(static_cast<std::uint64_t>(r_abs.v0 >> static_cast<unsigned>(UINT8_C(10))) | static_cast<std::uint64_t>(r_abs.v1 << static_cast<unsigned>(UINT8_C(54)))),
+          static_cast<std::uint64_t>(r_abs.v1 >> static_cast<unsigned>(UINT8_C(10)))
+        };
+
+      sum =
+        (r_is_neg ? detail::softfloat_sub128(detail::softfloat_sub128(sum, r_116), r2q)
+                  : detail::softfloat_sub128(detail::softfloat_add128(sum, r_116), r2q));
+
+      return sum;
+    }
+
+    static constexpr auto f64_log_fixed(const std::int16_t expA, const std::uint64_t sigA) -> detail::uint128_compound
+    {
+      // The same, for the 53-bit significand sigA of a double.
+      return f64_log_fixed64(expA, static_cast<std::uint64_t>(sigA << static_cast<unsigned>(UINT8_C(11))));
+    }
+
+    static constexpr auto f64_log_round_fixed(detail::uint128_compound sum, const std::uint64_t scale_sig, const std::int32_t scale_exp) -> std::uint64_t
+    {
+      // Round sum * s once, where the sum is an unrounded logarithm
+      // from f64_log_fixed, and s = scale_sig * 2^(scale_exp - 63)
+      // is given with its leading bit set.
+      auto result = std::uint64_t { };
+
+      const auto signZ = (static_cast<std::uint64_t>(sum.v1 >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint64_t>(UINT8_C(0)));
+
+      if(signZ)
+      {
+        sum = detail::softfloat_sub128(detail::uint128_compound { static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT8_C(0)) }, sum);
+      }
+
+      if((sum.v1 == static_cast<std::uint64_t>(UINT8_C(0))) && (sum.v0 == static_cast<std::uint64_t>(UINT8_C(0))))
+      {
+        // This is reached for x = 1 only.
+        result = static_cast<std::uint64_t>(UINT8_C(0));
+      }
+      else
+      {
+        // Normalize the sum such that its leading bit is bit 127.
+        // With 116 fractional bits, that bit has the weight 2^11.
+        auto expZ = static_cast<std::int16_t>(INT16_C(0x409));
+
+        if(sum.v1 == static_cast<std::uint64_t>(UINT8_C(0)))
+        {
+          sum.v1 = sum.v0;
+          sum.v0 = static_cast<std::uint64_t>(UINT8_C(0));
+
+          expZ = static_cast<std::int16_t>(expZ - static_cast<std::int16_t>(INT8_C(64)));
+        }
+
+        const auto shift_dist = detail::softfloat_countLeadingZeros64(sum.v1);
+
+        sum = detail::softfloat_shortShiftLeft128(sum, shift_dist);
+
+        // The leading 64 bits of the sum, times the factor s,
+        // with the remaining bits of the sum jammed.
+        auto p = detail::softfloat_mul64To128(sum.v1, scale_sig);
+
+        p.v0 = static_cast<std::uint64_t>(p.v0 | static_cast<std::uint64_t>((sum.v0 != static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0))));
+
+        result =
+          f64_round_fixed
+          (
+            signZ,
+            static_cast<std::int32_t>
+            (
+                static_cast<std::int32_t>(expZ - static_cast<std::int16_t>(shift_dist))
+              + scale_exp
+              - static_cast<std::int32_t>(INT16_C(0x47C))
+            ),
+            p
+          );
+      }
+
+      return result;
+    }
+
+    static constexpr auto f64_log_scaled(const std::uint64_t a, const std::uint64_t scale_sig, const std::int32_t scale_exp) -> std::uint64_t
+    {
+      // Compute log(x) * s, with the factor s = scale_sig * 2^(scale_exp - 63)
+      // given with its leading bit set. The unrounded logarithm is multiplied
+      // by s and rounded only once. For s = 1, this is log(x) itself.
+      auto expA  = detail::expF64UI (a);
+      auto sigA  = detail::fracF64UI(a);
+
+      const auto signA = detail::signF64UI(a);
+
+      auto result = std::uint64_t { };
+
+      if(expA == static_cast<std::int16_t>(INT16_C(0x7FF)))
+      {
+        // The logarithm of NaN or +infinity is the argument itself,
+        // while the logarithm of -infinity is NaN.
+        result =
+          ((signA && (sigA == static_cast<std::uint64_t>(UINT8_C(0)))) ? my_value_quiet_NaN().my_value : a);
+      }
+      else if((expA == static_cast<std::int16_t>(INT8_C(0))) && (sigA == static_cast<std::uint64_t>(UINT8_C(0))))
+      {
+        // The logarithm of +-0 is -infinity.
+        result = static_cast<std::uint64_t>(UINT64_C(0xFFF0000000000000));
+      }
+      else if(signA)
+      {
+        result = my_value_quiet_NaN().my_value;
+      }
+      else
+      {
+        if(expA == static_cast<std::int16_t>(INT8_C(0)))
+        {
+          softfloat_normSubnormalF64Sig(expA, sigA);
+        }
+        else
+        {
+          sigA |= static_cast<std::uint64_t>(UINT64_C(0x0010000000000000));
+        }
+
+        result = f64_log_round_fixed(f64_log_fixed(expA, sigA), scale_sig, scale_exp);
+      }
+
+      return result;
+    }
+
+    static constexpr auto f64_log(const std::uint64_t a) -> std::uint64_t
+    {
+      return f64_log_scaled(a, static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)), static_cast<std::int32_t>(INT8_C(0)));
+    }
+
+    static constexpr auto f64_log2(const std::uint64_t a) -> std::uint64_t
+    {
+      // Use log2(x) = log(x) * (1/ln2), with 1/ln2 having 63 fractional bits.
+      return f64_log_scaled(a, static_cast<std::uint64_t>(UINT64_C(0xB8AA3B295C17F0BC)), static_cast<std::int32_t>(INT8_C(0)));
+    }
+
+    static constexpr auto f64_log10(const std::uint64_t a) -> std::uint64_t
+    {
+      // Use log10(x) = log(x) * (1/ln10), with 1/ln10 having 65 fractional bits.
+      return f64_log_scaled(a, static_cast<std::uint64_t>(UINT64_C(0xDE5BD8A937287195)), static_cast<std::int32_t>(INT8_C(-2)));
+    }
+
+    static constexpr auto f64_pow_fixed(const std::int16_t expA, const std::uint64_t sigA, const std::uint64_t b) -> std::uint64_t
+    {
+      // Compute |x|^y = exp(y * log|x|) for finite |x| > 0, given by its
+      // biased exponent expA and significand sigA (including its leading bit),
+      // and for finite nonzero y. The logarithm is kept unrounded with 116
+      // fractional bits and multiplied exactly by the 53-bit significand
+      // of y. The product is passed to the exponential with 64 fractional
+      // bits, so that there is only one rounding in the whole computation.
+      const auto expB  = detail::expF64UI (b);
+      const auto signB = detail::signF64UI(b);
+
+      const auto sigB =
+        static_cast<std::uint64_t>
+        (
+          (expB == static_cast<std::int16_t>(INT8_C(0)))
+            ? detail::fracF64UI(b)
+            : static_cast<std::uint64_t>(detail::fracF64UI(b) | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)))
+        );
+
+      // y = sigB * 2^expY (subnormal y has the same scale as the smallest normal).
+      const auto expY =
+        static_cast<std::int32_t>
+        (
+            static_cast<std::int32_t>((expB == static_cast<std::int16_t>(INT8_C(0))) ? INT16_C(1) : expB)
+          - static_cast<std::int32_t>(INT16_C(0x433))
+        );
+
+      auto log_x = f64_log_fixed(expA, sigA);
+
+      const auto sign_log = (static_cast<std::uint64_t>(log_x.v1 >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint64_t>(UINT8_C(0)));
+
+      if(sign_log)
+      {
+        log_x = detail::softfloat_sub128(detail::uint128_compound { static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT8_C(0)) }, log_x);
+      }
+
+      // The exact product |log(x)| * sigB, as a 192-bit value (p2, p1, p0)
+      // such that |y * log(x)| = p * 2^(expY - 116).
+      const auto p_lo = detail::softfloat_mul64To128(log_x.v0, sigB);
+      const auto p_hi = detail::softfloat_mul64To128(log_x.v1, sigB);
+
+      auto p0 = p_lo.v0;
+      auto p1 = static_cast<std::uint64_t>(p_lo.v1 + p_hi.v0);
+      auto p2 = static_cast<std::uint64_t>(p_hi.v1 + static_cast<std::uint64_t>((p1 < p_lo.v1) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0))));
+
+      const auto bit_length =
+        static_cast<std::int32_t>
+        (
+            (p2 != static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<std::int32_t>(INT16_C(192) - static_cast<std::int32_t>(detail::softfloat_countLeadingZeros64(p2)))
+          : (p1 != static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<std::int32_t>(INT16_C(128) - static_cast<std::int32_t>(detail::softfloat_countLeadingZeros64(p1)))
+          :                                                  static_cast<std::int32_t>(INT16_C( 64) - static_cast<std::int32_t>(detail::softfloat_countLeadingZeros64(p0)))
+        );
+
+      const auto sign_t = (sign_log != signB);
+
+      auto result = std::uint64_t { };
+
+      if((bit_length + expY) > static_cast<std::int32_t>(INT16_C(126)))
+      {
+        // Here |y * log(x)| >= 1024, so the result overflows or underflows.
+        result = (sign_t ? static_cast<std::uint64_t>(UINT8_C(0)) : static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000)));
+      }
+      else
+      {
+        // Scale the product to 64 fractional bits (truncating). It then
+        // has fewer than 75 bits and fits in (p1, p0).
+        auto shift = static_cast<std::int32_t>(expY - static_cast<std::int32_t>(INT8_C(52)));
+
+        if(shift < static_cast<std::int32_t>(INT8_C(0)))
+        {
+          for( ; (shift <= static_cast<std::int32_t>(INT8_C(-64))); shift += static_cast<std::int32_t>(INT8_C(64)))
+          {
+            p0 = p1;
+            p1 = p2;
+            p2 = static_cast<std::uint64_t>(UINT8_C(0));
+          }
+
+          const auto dist = static_cast<unsigned>(-shift);
+
+          if(dist != static_cast<unsigned>(UINT8_C(0)))
+          {
+            p0 = static_cast<std::uint64_t>(static_cast<std::uint64_t>(p0 >> dist) | static_cast<std::uint64_t>(p1 << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - dist)));
+            p1 = static_cast<std::uint64_t>(static_cast<std::uint64_t>(p1 >> dist) | static_cast<std::uint64_t>(p2 << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - dist)));
+          }
+        }
+        else
+        {
+          for( ; (shift >= static_cast<std::int32_t>(INT8_C(64))); shift -= static_cast<std::int32_t>(INT8_C(64)))
+          {
+            p1 = p0;
+            p0 = static_cast<std::uint64_t>(UINT8_C(0));
+          }
+
+          const auto dist = static_cast<unsigned>(shift);
+
+          if(dist != static_cast<unsigned>(UINT8_C(0)))
+          {
+            p1 = static_cast<std::uint64_t>(static_cast<std::uint64_t>(p1 << dist) | static_cast<std::uint64_t>(p0 >> static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - dist)));
+            p0 = static_cast<std::uint64_t>(p0 << dist);
+          }
+        }
+
+        result = f64_exp_fixed(sign_t, detail::uint128_compound { p0, p1 });
+      }
+
+      return result;
+    }
+
+    static constexpr auto f64_pow(const std::uint64_t a, const std::uint64_t b) -> std::uint64_t
+    {
+      const auto signA = detail::signF64UI(a);
+            auto expA  = detail::expF64UI (a);
+            auto sigA  = detail::fracF64UI(a);
+
+      const auto signB = detail::signF64UI(b);
+      const auto expB  = detail::expF64UI (b);
+      const auto sigB  = detail::fracF64UI(b);
+
+      const auto a_is_nan  = ((expA == static_cast<std::int16_t>(INT16_C(0x7FF))) && (sigA != static_cast<std::uint64_t>(UINT8_C(0))));
+      const auto b_is_nan  = ((expB == static_cast<std::int16_t>(INT16_C(0x7FF))) && (sigB != static_cast<std::uint64_t>(UINT8_C(0))));
+      const auto a_is_inf  = ((expA == static_cast<std::int16_t>(INT16_C(0x7FF))) && (sigA == static_cast<std::uint64_t>(UINT8_C(0))));
+      const auto b_is_inf  = ((expB == static_cast<std::int16_t>(INT16_C(0x7FF))) && (sigB == static_cast<std::uint64_t>(UINT8_C(0))));
+      const auto a_is_zero = ((expA == static_cast<std::int16_t>(INT8_C (0)))     && (sigA == static_cast<std::uint64_t>(UINT8_C(0))));
+      const auto b_is_zero = ((expB == static_cast<std::int16_t>(INT8_C (0)))     && (sigB == static_cast<std::uint64_t>(UINT8_C(0))));
+
+      // Classify y as an integer (and as odd). Every |y| >= 2^53 is an even
+      // integer, and every nonzero |y| < 1 is not an integer.
+      auto b_is_int = false;
+      auto b_is_odd = false;
+
+      if(expB >= static_cast<std::int16_t>(INT16_C(0x434)))
+      {
+        b_is_int = (!b_is_nan);
+      }
+      else if(expB >= static_cast<std::int16_t>(INT16_C(0x3FF)))
+      {
+        const auto frac_bits = static_cast<unsigned>(static_cast<std::int16_t>(INT16_C(0x433)) - expB);
+
+        const auto sig = static_cast<std::uint64_t>(sigB | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)));
+
+        const auto frac_mask = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << frac_bits) - 1U);
+
+        b_is_int = (static_cast<std::uint64_t>(sig & frac_mask) == static_cast<std::uint64_t>(UINT8_C(0)));
+        b_is_odd = (b_is_int && (static_cast<std::uint64_t>(static_cast<std::uint64_t>(sig >> frac_bits) & 1U) != static_cast<std::uint64_t>(UINT8_C(0))));
+      }
+
+      auto result = std::uint64_t { };
+
+      if(b_is_zero || (a == my_value_one().my_value))
+      {
+        // pow(x, +-0) = 1 and pow(+1, y) = 1, even for NaN.
+        result = my_value_one().my_value;
+      }
+      else if(a_is_nan || b_is_nan)
+      {
+        result = my_value_quiet_NaN().my_value;
+      }
+      else if(b_is_inf)
+      {
+        // pow(-1, +-inf) = 1. Otherwise the result is +0 or +inf,
+        // depending on |x| < 1 and the sign of y.
+        const auto a_abs_is_one = ((expA == static_cast<std::int16_t>(INT16_C(0x3FF))) && (sigA == static_cast<std::uint64_t>(UINT8_C(0))));
+        const auto a_abs_lt_one = (expA < static_cast<std::int16_t>(INT16_C(0x3FF)));
+
+        result =
+          a_abs_is_one ? my_value_one().my_value
+                       : ((a_abs_lt_one != signB) ? static_cast<std::uint64_t>(UINT8_C(0))
+                                                  : static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000)));
+      }
+      else if(a_is_zero || a_is_inf)
+      {
+        // The sign of x is kept only for odd integer y.
+        result = detail::packToF64UI((signA && b_is_odd),
+                                     static_cast<std::int16_t>((a_is_zero == signB) ? INT16_C(0x7FF) : INT16_C(0)),
+                                     static_cast<std::uint64_t>(UINT8_C(0)));
+      }
+      else if(signA && (!b_is_int))
+      {
+        // A negative x with a non-integer y has no real result.
+        result = my_value_quiet_NaN().my_value;
+      }
+      else if(static_cast<std::uint64_t>(a & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF))) == my_value_one().my_value)
+      {
+        // pow(-1, y) = +-1 for integer y.
+        result = detail::packToF64UI(b_is_odd, static_cast<std::int16_t>(INT16_C(0x3FF)), static_cast<std::uint64_t>(UINT8_C(0)));
+      }
+      else if(b == my_value_one().my_value)
+      {
+        result = a;
+      }
+      else if(   (b == static_cast<std::uint64_t>(UINT64_C(0x4000000000000000)))
+              && (expA > static_cast<std::int16_t>(INT16_C(0x200)))
+              && (expA < static_cast<std::int16_t>(INT16_C(0x5FE))))
+      {
+        // pow(x, 2) = x * x, where the square stays a normal number.
+        result = f64_mul(a, a);
+      }
+      else
+      {
+        // Compute |x|^y, then apply the sign of x for odd integer y.
+        if(expA == static_cast<std::int16_t>(INT8_C(0)))
+        {
+          softfloat_normSubnormalF64Sig(expA, sigA);
+        }
+        else
+        {
+          sigA |= static_cast<std::uint64_t>(UINT64_C(0x0010000000000000));
+        }
+
+        result = f64_pow_fixed(expA, sigA, b);
 
-    constexpr soft_double(float f) noexcept // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
-      : my_value
+        result = static_cast<std::uint64_t>(result | static_cast<std::uint64_t>((signA && b_is_odd) ? static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)) : static_cast<std::uint64_t>(UINT8_C(0))));
+      }
+
+      return result;
+    }
+
+    static constexpr auto f64_times_fixed(const bool signA, const std::int16_t expA, const std::uint64_t sigA, const std::uint64_t p) -> std::uint64_t
+    {
+      // Round x * p, where x is normal with the biased exponent expA and the
+      // fraction sigA, and where p < 2 has 63 fractional bits.
+      auto prod =
+        detail::softfloat_mul64To128
         (
-          ((detail::expF32UI(detail::uz_type<float>(f).get_u()) == static_cast<std::int16_t>(INT8_C(0))) && (detail::fracF32UI(detail::uz_type<float>(f).get_u()) == static_cast<std::uint32_t>(UINT8_C(0)))) // NOLINT(cppcoreguidelines-pro-type-union-access)
-            ? detail::packToF64UI
-              (
-                detail::signF32UI(detail::uz_type<float>(f).get_u()), // NOLINT(cppcoreguidelines-pro-type-union-access)
-                static_cast<int>(INT8_C(0)),
-                static_cast<int>(INT8_C(0))
-              )
-            : detail::packToF64UI
-              (
-                detail::signF32UI(detail::uz_type<float>(f).get_u()), // NOLINT(cppcoreguidelines-pro-type-union-access)
-                static_cast<std::int32_t>
-                (
-                    static_cast<std::int32_t>(detail::expF32UI(detail::uz_type<float>(f).get_u())) // NOLINT(cppcoreguidelines-pro-type-union-access)
-                  + static_cast<std::int32_t>(INT16_C(0x380))
-                ),
-                static_cast<std::uint64_t>
-                (
-                  static_cast<std::uint64_t>
-                  (
-                    detail::fracF32UI(detail::uz_type<float>(f).get_u()) // NOLINT(cppcoreguidelines-pro-type-union-access)
-                  ) << static_cast<unsigned>(UINT8_C(29))
-                )
-              )
-        ) { }
+          static_cast<std::uint64_t>(static_cast<std::uint64_t>(sigA | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000))) << static_cast<unsigned>(UINT8_C(11))),
+          p
+        );
 
-    constexpr soft_double(double d) noexcept              // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
-      : my_value(detail::uz_type<double>(d).get_u()) { }  // NOLINT(cppcoreguidelines-pro-type-union-access)
+      auto expZ = static_cast<std::int16_t>(expA - static_cast<std::int16_t>(INT8_C(1)));
 
-    constexpr soft_double(long double ld) noexcept                             // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
-      : my_value(detail::uz_type<double>(static_cast<double>(ld)).get_u()) { } // NOLINT(cppcoreguidelines-pro-type-union-access)
+      // Place the leading bit of the product at bit 126.
+      if(static_cast<std::uint64_t>(prod.v1 >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint64_t>(UINT8_C(0)))
+      {
+        prod = detail::softfloat_shortShiftRightJam128(prod, static_cast<std::uint_fast8_t>(UINT8_C(1)));
 
-    constexpr soft_double(const soft_double& other) noexcept : my_value(other.my_value) { }; // NOLINT(hicpp-use-equals-default,modernize-use-equals-default)
+        ++expZ;
+      }
+      else
+      {
+        const auto shift_dist = static_cast<std::uint_fast8_t>(detail::softfloat_countLeadingZeros64(prod.v1) - 1U);
 
-    constexpr soft_double(soft_double&& other) noexcept
-      : my_value(other.my_value) { }
+        if(shift_dist != static_cast<std::uint_fast8_t>(UINT8_C(0)))
+        {
+          prod = detail::softfloat_shortShiftLeft128(prod, shift_dist);
 
-    explicit constexpr soft_double(std::uint64_t n, detail::nothing&&) noexcept // NOLINT(hicpp-named-parameter,readability-named-parameter)
-      : my_value(static_cast<std::uint64_t>(n)) { }
+          expZ = static_cast<std::int16_t>(expZ - static_cast<std::int16_t>(shift_dist));
+        }
+      }
+
+      const auto sigZ = static_cast<std::uint64_t>(prod.v1 | static_cast<std::uint64_t>((prod.v0 != static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0))));
+
+      return softfloat_roundPackToF64(signA, expZ, sigZ);
+    }
+
+    static constexpr auto f64_abs_fixed(const std::int16_t expA, const std::uint64_t sigA) -> std::uint64_t
+    {
+      // Form |x| with 64 fractional bits (truncated) for normal |x| < 1.
+      const auto sig   = static_cast<std::uint64_t>(sigA | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)));
+      const auto shift = static_cast<std::int16_t>(expA - static_cast<std::int16_t>(INT16_C(0x3F3)));
+
+      return
+        static_cast<std::uint64_t>
+        (
+            (shift >= static_cast<std::int16_t>(INT8_C(  0))) ? static_cast<std::uint64_t>(sig << static_cast<unsigned>(shift))
+          : (shift >  static_cast<std::int16_t>(INT8_C(-64))) ? static_cast<std::uint64_t>(sig >> static_cast<unsigned>(-shift))
+          :                                                     static_cast<std::uint64_t>(UINT8_C(0))
+        );
+    }
 
-    constexpr auto operator=(const soft_double& other) noexcept -> soft_double&
+    static constexpr auto f64_abs_fixed128(const std::int16_t expA, const std::uint64_t sigA) -> detail::uint128_compound
     {
-      if(this != &other)
+      // Form |x| with 64 fractional bits (truncated) for |x| < 1024,
+      // given by its biased exponent expA and its fraction sigA.
+      // The integer part has at most 10 bits. Subnormal arguments
+      // contribute nothing.
+      const auto sig =
+        static_cast<std::uint64_t>
+        (
+          (expA == static_cast<std::int16_t>(INT8_C(0)))
+            ? static_cast<std::uint64_t>(UINT8_C(0))
+            : static_cast<std::uint64_t>(sigA | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)))
+        );
+
+      const auto shift = static_cast<std::int16_t>(expA - static_cast<std::int16_t>(INT16_C(0x3F3)));
+
+      auto x_fixed = detail::uint128_compound { };
+
+      if(shift >= static_cast<std::int16_t>(INT8_C(0)))
+      {
+        x_fixed.v0 = static_cast<std::uint64_t>(sig << static_cast<unsigned>(shift));
+        x_fixed.v1 =
+          static_cast<std::uint64_t>
+          (
+            (shift == static_cast<std::int16_t>(INT8_C(0)))
+              ? static_cast<std::uint64_t>(UINT8_C(0))
+              : static_cast<std::uint64_t>(sig >> static_cast<unsigned>(static_cast<int>(INT8_C(64)) - shift))
+          );
+      }
+      else if(shift > static_cast<std::int16_t>(INT8_C(-64)))
       {
-        my_value = other.my_value;
+        x_fixed.v0 = static_cast<std::uint64_t>(sig >> static_cast<unsigned>(-shift));
       }
 
-      return *this;
+      return x_fixed;
     }
 
-    constexpr auto operator=(soft_double&& other) noexcept -> soft_double&
+    static constexpr auto f64_exp_half(const std::uint64_t a) -> std::uint64_t
     {
-      my_value = other.my_value;
+      // Compute exp(|x|) / 2 with a single rounding, for finite |x| < 1024.
+      // The halving is applied to the exponent before rounding, so that
+      // the result stays finite for exp(|x|) just beyond the largest double.
+      auto expZ = std::int32_t  { };
+      auto sigZ = std::uint64_t { };
 
-      return *this;
+      f64_exp_fixed_sig(false, f64_abs_fixed128(detail::expF64UI(a), detail::fracF64UI(a)), expZ, sigZ);
+
+      --expZ;
+
+      return
+        (expZ > static_cast<std::int32_t>(INT16_C(0x7FD)))
+          ? static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000))
+          : softfloat_roundPackToF64(false, static_cast<std::int16_t>(expZ), sigZ);
     }
 
-    ~soft_double() = default;
+    static constexpr auto f64_expm1(const std::uint64_t a) -> std::uint64_t
+    {
+      // For |x| < 1, expm1(x) = x * P(x) with P(x) = sum of x^k / (k + 1)!
+      // in fixed-point (63 fractional bits), where the first term omitted
+      // is below 2^-65. This retains full relative precision for small |x|.
+      // Beyond that, the unrounded fixed-point exp(x) is reduced by one
+      // and rounded only once.
+      using coef_array_type = std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(20))>;
+
+      constexpr auto coefs =
+        coef_array_type
+        {
+          static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)), static_cast<std::uint64_t>(UINT64_C(0x4000000000000000)),
+          static_cast<std::uint64_t>(UINT64_C(0x1555555555555555)), static_cast<std::uint64_t>(UINT64_C(0x0555555555555555)),
+          static_cast<std::uint64_t>(UINT64_C(0x0111111111111111)), static_cast<std::uint64_t>(UINT64_C(0x002D82D82D82D82E)),
+          static_cast<std::uint64_t>(UINT64_C(0x0006806806806807)), static_cast<std::uint64_t>(UINT64_C(0x0000D00D00D00D01)),
+          static_cast<std::uint64_t>(UINT64_C(0x0000171DE3A556C7)), static_cast<std::uint64_t>(UINT64_C(0x0000024FC9F6EF14)),
+          static_cast<std::uint64_t>(UINT64_C(0x00000035CC8ACFEB)), static_cast<std::uint64_t>(UINT64_C(0x000000047BB63BFE)),
+          static_cast<std::uint64_t>(UINT64_C(0x000000005849184F)), static_cast<std::uint64_t>(UINT64_C(0x00000000064E5D2A)),
+          static_cast<std::uint64_t>(UINT64_C(0x00000000006B9FD0)), static_cast<std::uint64_t>(UINT64_C(0x000000000006B9FD)),
+          static_cast<std::uint64_t>(UINT64_C(0x000000000000654B)), static_cast<std::uint64_t>(UINT64_C(0x00000000000005A1)),
+          static_cast<std::uint64_t>(UINT64_C(0x000000000000004C)), static_cast<std::uint64_t>(UINT64_C(0x0000000000000004))
+        };
 
-    SOFT_DOUBLE_NODISCARD constexpr auto  representation() const -> representation_type { return my_value; }
-    SOFT_DOUBLE_NODISCARD constexpr auto crepresentation() const -> representation_type { return my_value; }
+      const auto signA = detail::signF64UI(a);
+      const auto expA  = detail::expF64UI (a);
+      const auto sigA  = detail::fracF64UI(a);
 
-    static constexpr auto get_rep(const soft_double& a) -> representation_type { return a.crepresentation(); }
+      const auto abs_a = static_cast<std::uint64_t>(a & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF)));
 
-    constexpr operator   signed char     () const { return static_cast<signed char>     (f64_to__i32(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
-    constexpr operator   signed short    () const { return static_cast<signed short>    (f64_to__i32(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions,google-runtime-int)
-    constexpr operator   signed int      () const { return static_cast<signed int>      (f64_to__i32(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
-    constexpr operator   signed long     () const { return static_cast<signed long>     (f64_to__i64(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions,google-runtime-int)
-    constexpr operator   signed long long() const { return static_cast<signed long long>(f64_to__i64(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions,google-runtime-int)
+      auto result = std::uint64_t { };
+
+      if(expA == static_cast<std::int16_t>(INT16_C(0x7FF)))
+      {
+        // expm1(NaN) is NaN, expm1(+inf) = +inf and expm1(-inf) = -1.
+        result =
+          ((sigA != static_cast<std::uint64_t>(UINT8_C(0))) ? a
+                                                            : (signA ? static_cast<std::uint64_t>(UINT64_C(0xBFF0000000000000)) : a));
+      }
+      else if(expA < static_cast<std::int16_t>(INT16_C(0x3C9)))
+      {
+        // For |x| < 2^-54, expm1(x) rounds to x (including zero and subnormals).
+        result = a;
+      }
+      else if(abs_a < my_value_one().my_value)
+      {
+        const auto x = f64_abs_fixed(expA, sigA);
+
+        auto p = coefs.back();
+
+        for(auto k = static_cast<std::size_t>(coefs.size() - 1U); k > static_cast<std::size_t>(UINT8_C(0)); --k)
+        {
+          const auto xp = detail::softfloat_mul64To128(x, p).v1;
+
+          p = static_cast<std::uint64_t>(signA ? static_cast<std::uint64_t>(coefs[k - 1U] - xp) : static_cast<std::uint64_t>(coefs[k - 1U] + xp)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+
+        result = f64_times_fixed(signA, expA, sigA, p);
+      }
+      else if(signA && (abs_a > static_cast<std::uint64_t>(UINT64_C(0x4044000000000000))))
+      {
+        // For x < -40, expm1(x) rounds to -1.
+        result = static_cast<std::uint64_t>(UINT64_C(0xBFF0000000000000));
+      }
+      else if((!signA) && (abs_a > static_cast<std::uint64_t>(UINT64_C(0x40862E42FEFA39EF))))
+      {
+        // For x > log(DBL_MAX), expm1(x) overflows.
+        result = static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000));
+      }
+      else
+      {
+        // Here, |x| >= 1 is exact with 64 fractional bits.
+        auto expZ = std::int32_t  { };
+        auto sigZ = std::uint64_t { };
+
+        f64_exp_fixed_sig(signA, f64_abs_fixed128(expA, sigA), expZ, sigZ);
+
+        // The value of exp(x) is sigZ * 2^(k - 62).
+        const auto k = static_cast<std::int32_t>(expZ - static_cast<std::int32_t>(INT16_C(0x3FE)));
+
+        if(!signA)
+        {
+          // For x >= 1, exp(x) >= e. Subtract one, which loses at most one
+          // leading bit. Beyond 2^62, the one only reaches the jammed bits.
+          if(k <= static_cast<std::int32_t>(INT8_C(62)))
+          {
+            sigZ = static_cast<std::uint64_t>(sigZ - static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(static_cast<std::int32_t>(INT8_C(62)) - k)));
+
+            if(static_cast<std::uint64_t>(sigZ >> static_cast<unsigned>(UINT8_C(62))) == static_cast<std::uint64_t>(UINT8_C(0)))
+            {
+              sigZ = static_cast<std::uint64_t>(sigZ << static_cast<unsigned>(UINT8_C(1)));
+
+              --expZ;
+            }
+          }
+
+          result =
+            (expZ > static_cast<std::int32_t>(INT16_C(0x7FD)))
+              ? static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000))
+              : softfloat_roundPackToF64(false, static_cast<std::int16_t>(expZ), sigZ);
+        }
+        else
+        {
+          // For -40 <= x <= -1, exp(x) < 1/2. Form 1 - exp(x) in [1/2, 1)
+          // with 64 fractional bits, where exp(x) is taken with jamming.
+          const auto e_fixed = detail::softfloat_shiftRightJam64(sigZ, static_cast<std::uint_fast16_t>(-(k + static_cast<std::int32_t>(INT8_C(2)))));
+
+          const auto d = static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(0)) - e_fixed);
+
+          result = softfloat_roundPackToF64(true, static_cast<std::int16_t>(INT16_C(0x3FD)), detail::softfloat_shortShiftRightJam64(d, static_cast<std::uint_fast16_t>(UINT8_C(1))));
+        }
+      }
+
+      return result;
+    }
+
+    static constexpr auto f64_log1p(const std::uint64_t a) -> std::uint64_t
+    {
+      // For |x| < 2^-5, log1p(x) = x * Q(x) with Q(x) = sum of (-x)^k / (k + 1)
+      // in fixed-point (63 fractional bits), whose truncation error is below
+      // 2^-70. Beyond that, 1 + x is formed exactly with a 64-bit significand
+      // and handed to the fixed-point logarithm, which rounds only once.
+      using coef_array_type = std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(14))>;
+
+      constexpr auto coefs =
+        coef_array_type
+        {
+          static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)), static_cast<std::uint64_t>(UINT64_C(0x4000000000000000)),
+          static_cast<std::uint64_t>(UINT64_C(0x2AAAAAAAAAAAAAAB)), static_cast<std::uint64_t>(UINT64_C(0x2000000000000000)),
+          static_cast<std::uint64_t>(UINT64_C(0x199999999999999A)), static_cast<std::uint64_t>(UINT64_C(0x1555555555555555)),
+          static_cast<std::uint64_t>(UINT64_C(0x1249249249249249)), static_cast<std::uint64_t>(UINT64_C(0x1000000000000000)),
+          static_cast<std::uint64_t>(UINT64_C(0x0E38E38E38E38E39)), static_cast<std::uint64_t>(UINT64_C(0x0CCCCCCCCCCCCCCD)),
+          static_cast<std::uint64_t>(UINT64_C(0x0BA2E8BA2E8BA2E9)), static_cast<std::uint64_t>(UINT64_C(0x0AAAAAAAAAAAAAAB)),
+          static_cast<std::uint64_t>(UINT64_C(0x09D89D89D89D89D9)), static_cast<std::uint64_t>(UINT64_C(0x0924924924924925))
+        };
+
+      const auto signA = detail::signF64UI(a);
+      const auto expA  = detail::expF64UI (a);
+      const auto sigA  = detail::fracF64UI(a);
+
+      const auto abs_a = static_cast<std::uint64_t>(a & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF)));
+
+      auto result = std::uint64_t { };
+
+      if(expA < static_cast<std::int16_t>(INT16_C(0x3C9)))
+      {
+        // For |x| < 2^-54, log1p(x) rounds to x (including zero and subnormals).
+        result = a;
+      }
+      else if(signA && (abs_a >= my_value_one().my_value))
+      {
+        // log1p(-1) = -inf, while log1p(x) for x < -1 (and -inf or NaN) is NaN.
+        result =
+          ((abs_a == my_value_one().my_value) ? static_cast<std::uint64_t>(UINT64_C(0xFFF0000000000000))
+                                              : ((abs_a > static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000))) ? a : my_value_quiet_NaN().my_value));
+      }
+      else if(expA == static_cast<std::int16_t>(INT16_C(0x7FF)))
+      {
+        // log1p(+inf) = +inf and log1p(NaN) is NaN.
+        result = a;
+      }
+      else if(abs_a < static_cast<std::uint64_t>(UINT64_C(0x3FA0000000000000)))
+      {
+        const auto x = f64_abs_fixed(expA, sigA);
+
+        auto q = coefs.back();
+
+        for(auto k = static_cast<std::size_t>(coefs.size() - 1U); k > static_cast<std::size_t>(UINT8_C(0)); --k)
+        {
+          const auto xq = detail::softfloat_mul64To128(x, q).v1;
+
+          q = static_cast<std::uint64_t>(signA ? static_cast<std::uint64_t>(coefs[k - 1U] + xq) : static_cast<std::uint64_t>(coefs[k - 1U] - xq)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+
+        result = f64_times_fixed(signA, expA, sigA, q);
+      }
+      else if(expA >= static_cast<std::int16_t>(INT16_C(0x434)))
+      {
+        // For x >= 2^53, log1p(x) = log(x) + log(1 + 1/x), where the second
+        // term lies far below the rounding bits.
+        result =
+          f64_log_round_fixed
+          (
+            f64_log_fixed(expA, static_cast<std::uint64_t>(sigA | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)))),
+            static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)),
+            static_cast<std::int32_t>(INT8_C(0))
+          );
+      }
+      else
+      {
+        // Here, 2^-5 <= |x| < 2^53. With the unit 2^(expA - 0x433) of the last
+        // place of x, the integers x and 1 add up exactly to less than 2^58.
+        const auto x_int   = static_cast<std::uint64_t>(sigA | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)));
+        const auto one_int = static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(static_cast<std::int16_t>(INT16_C(0x433)) - expA));
+
+        const auto u_int = static_cast<std::uint64_t>(signA ? static_cast<std::uint64_t>(one_int - x_int) : static_cast<std::uint64_t>(one_int + x_int));
+
+        const auto shift_dist = detail::softfloat_countLeadingZeros64(u_int);
+
+        const auto expU =
+          static_cast<std::int16_t>
+          (
+              static_cast<std::int16_t>(expA + static_cast<std::int16_t>(INT8_C(11)))
+            - static_cast<std::int16_t>(shift_dist)
+          );
+
+        result =
+          f64_log_round_fixed
+          (
+            f64_log_fixed64(expU, static_cast<std::uint64_t>(u_int << shift_dist)),
+            static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)),
+            static_cast<std::int32_t>(INT8_C(0))
+          );
+      }
+
+      return result;
+    }
+
+    static constexpr auto f64_round_fixed(const bool signZ, const std::int32_t scale, detail::uint128_compound p) -> std::uint64_t
+    {
+      // Round the nonzero value p * 2^scale once. Subnormal results
+      // are handled, whereas overflow must be excluded by the caller.
+      auto expZ = static_cast<std::int32_t>(scale + static_cast<std::int32_t>(INT16_C(0x47C)));
+
+      if(p.v1 == static_cast<std::uint64_t>(UINT8_C(0)))
+      {
+        p.v1 = p.v0;
+        p.v0 = static_cast<std::uint64_t>(UINT8_C(0));
+
+        expZ = static_cast<std::int32_t>(expZ - static_cast<std::int32_t>(INT8_C(64)));
+      }
+
+      // Place the leading bit of p at bit 126.
+      const auto lz = detail::softfloat_countLeadingZeros64(p.v1);
+
+      if(lz == static_cast<std::uint_fast8_t>(UINT8_C(0)))
+      {
+        p = detail::softfloat_shortShiftRightJam128(p, static_cast<std::uint_fast8_t>(UINT8_C(1)));
+
+        ++expZ;
+      }
+      else if(lz > static_cast<std::uint_fast8_t>(UINT8_C(1)))
+      {
+        p = detail::softfloat_shortShiftLeft128(p, static_cast<std::uint_fast8_t>(lz - 1U));
+
+        expZ = static_cast<std::int32_t>(expZ - static_cast<std::int32_t>(lz - 1U));
+      }
+
+      const auto sigZ = static_cast<std::uint64_t>(p.v1 | static_cast<std::uint64_t>((p.v0 != static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0))));
+
+      return softfloat_roundPackToF64(signZ, static_cast<std::int16_t>(expZ), sigZ);
+    }
+
+    static constexpr auto f64_atan2(const std::uint64_t b, const std::uint64_t a) -> std::uint64_t
+    {
+      // Compute atan2(y, x) for y = b and x = a. With n = min(|x|, |y|) and
+      // d = max(|x|, |y|), the angle atan(n / d) in [0, pi/4] is reduced
+      // with c = j/16 ~ n / d to atan(c) + atan(u), where u = (n - (d * c))
+      // / (d + (n * c)) is formed exactly up to its single division.
+      // Then atan(u) = u * S(u^2) is a short series. For d >= 16n, j = 0
+      // and u = n / d keeps its full relative precision. The quadrant is
+      // restored in fixed-point with 125 fractional bits and the result
+      // is rounded only once.
+      using coef_array_type  = std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(12))>;
+      using table_array_type = std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(17))>;
+
+      // The coefficients 1/(2k + 1) of S, with 63 fractional bits.
+      constexpr auto coefs =
+        coef_array_type
+        {
+          static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)), static_cast<std::uint64_t>(UINT64_C(0x2AAAAAAAAAAAAAAB)),
+          static_cast<std::uint64_t>(UINT64_C(0x199999999999999A)), static_cast<std::uint64_t>(UINT64_C(0x1249249249249249)),
+          static_cast<std::uint64_t>(UINT64_C(0x0E38E38E38E38E39)), static_cast<std::uint64_t>(UINT64_C(0x0BA2E8BA2E8BA2E9)),
+          static_cast<std::uint64_t>(UINT64_C(0x09D89D89D89D89D9)), static_cast<std::uint64_t>(UINT64_C(0x0888888888888889)),
+          static_cast<std::uint64_t>(UINT64_C(0x0787878787878788)), static_cast<std::uint64_t>(UINT64_C(0x06BCA1AF286BCA1B)),
+          static_cast<std::uint64_t>(UINT64_C(0x0618618618618618)), static_cast<std::uint64_t>(UINT64_C(0x0590B21642C8590B))
+        };
+
+      // The values atan(j/16) for j in [0, 16], with 63 fractional bits.
+      constexpr auto atan_table =
+        table_array_type
+        {
+          static_cast<std::uint64_t>(UINT64_C(0x0000000000000000)),
+          static_cast<std::uint64_t>(UINT64_C(0x07FD56EDCB3F7A72)), static_cast<std::uint64_t>(UINT64_C(0x0FEADD4D5617B6E3)),
+          static_cast<std::uint64_t>(UINT64_C(0x17B97B4BCE5B0227)), static_cast<std::uint64_t>(UINT64_C(0x1F5B75F92C80DD63)),
+          static_cast<std::uint64_t>(UINT64_C(0x26C4EE6E0FD7979A)), static_cast<std::uint64_t>(UINT64_C(0x2DEC3283C9BDE11D)),
+          static_cast<std::uint64_t>(UINT64_C(0x34C9DD879847F96E)), static_cast<std::uint64_t>(UINT64_C(0x3B58CE0AC3769ED1)),
+          static_cast<std::uint64_t>(UINT64_C(0x4195FA536CC33F15)), static_cast<std::uint64_t>(UINT64_C(0x47802EAF7BFACFCE)),
+          static_cast<std::uint64_t>(UINT64_C(0x4D17C07338DEED10)), static_cast<std::uint64_t>(UINT64_C(0x525E3E8C9A7B8492)),
+          static_cast<std::uint64_t>(UINT64_C(0x5756261C5A6C6040)), static_cast<std::uint64_t>(UINT64_C(0x5C029F15E118CF3A)),
+          static_cast<std::uint64_t>(UINT64_C(0x606742DC56293320)), static_cast<std::uint64_t>(UINT64_C(0x6487ED5110B4611A))
+        };
+
+      // The values pi/2 and pi, with 125 fractional bits.
+      constexpr auto pi_half_q125 = detail::uint128_compound { static_cast<std::uint64_t>(UINT64_C(0x313198A2E0370734)), static_cast<std::uint64_t>(UINT64_C(0x3243F6A8885A308D)) };
+      constexpr auto pi_q125      = detail::uint128_compound { static_cast<std::uint64_t>(UINT64_C(0x62633145C06E0E69)), static_cast<std::uint64_t>(UINT64_C(0x6487ED5110B4611A)) };
+
+      constexpr auto value_pi           = static_cast<std::uint64_t>(UINT64_C(0x400921FB54442D18));
+      constexpr auto value_pi_half      = static_cast<std::uint64_t>(UINT64_C(0x3FF921FB54442D18));
+      constexpr auto value_pi_quarter   = static_cast<std::uint64_t>(UINT64_C(0x3FE921FB54442D18));
+      constexpr auto value_three_pi_4th = static_cast<std::uint64_t>(UINT64_C(0x4002D97C7F3321D2));
+
+      constexpr auto value_inf = static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000));
+
+      const auto signY = detail::signF64UI(b);
+      const auto signX = detail::signF64UI(a);
+
+      const auto abs_y = static_cast<std::uint64_t>(b & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF)));
+      const auto abs_x = static_cast<std::uint64_t>(a & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF)));
+
+      auto result = std::uint64_t { };
+
+      if((abs_y > value_inf) || (abs_x > value_inf))
+      {
+        result = ((abs_y > value_inf) ? b : a);
+      }
+      else
+      {
+        if(abs_y == static_cast<std::uint64_t>(UINT8_C(0)))
+        {
+          // atan2(+-0, x) is +-0 for x > 0 or x = +0, and +-pi otherwise.
+          result = (signX ? value_pi : static_cast<std::uint64_t>(UINT8_C(0)));
+        }
+        else if(abs_x == static_cast<std::uint64_t>(UINT8_C(0)))
+        {
+          result = value_pi_half;
+        }
+        else if(abs_y == value_inf)
+        {
+          result = ((abs_x == value_inf) ? (signX ? value_three_pi_4th : value_pi_quarter) : value_pi_half);
+        }
+        else if(abs_x == value_inf)
+        {
+          result = (signX ? value_pi : static_cast<std::uint64_t>(UINT8_C(0)));
+        }
+        else
+        {
+          const auto swap = (abs_y > abs_x);
+
+          const auto num = (swap ? abs_x : abs_y);
+          const auto den = (swap ? abs_y : abs_x);
+
+          auto expN = detail::expF64UI (num);
+          auto sigN = detail::fracF64UI(num);
+          auto expD = detail::expF64UI (den);
+          auto sigD = detail::fracF64UI(den);
+
+          if(expN == static_cast<std::int16_t>(INT8_C(0))) { softfloat_normSubnormalF64Sig(expN, sigN); } else { sigN |= static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)); }
+          if(expD == static_cast<std::int16_t>(INT8_C(0))) { softfloat_normSubnormalF64Sig(expD, sigD); } else { sigD |= static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)); }
+
+          const auto dist = static_cast<std::int32_t>(static_cast<std::int32_t>(expD) - static_cast<std::int32_t>(expN));
+
+          auto j      = static_cast<std::uint64_t>(UINT8_C(0));
+          auto un     = static_cast<std::uint64_t>(sigN << static_cast<unsigned>(UINT8_C(11)));
+          auto ud     = static_cast<std::uint64_t>(sigD << static_cast<unsigned>(UINT8_C(11)));
+          auto e_u    = static_cast<std::int32_t>(-dist);
+          auto u_neg  = false;
+
+          if(dist < static_cast<std::int32_t>(INT8_C(4)))
+          {
+            // Here n / d >= 1/16. Form n and d with 59 fractional bits,
+            // such that (d * j) / 16 and (n * j) / 16 are exact.
+            const auto n = static_cast<std::uint64_t>(sigN << static_cast<unsigned>(static_cast<std::int32_t>(INT8_C(7)) - dist));
+            const auto d = static_cast<std::uint64_t>(sigD << static_cast<unsigned>(UINT8_C(7)));
+
+            const auto n32 = static_cast<std::uint64_t>(n >> static_cast<unsigned>(UINT8_C(28)));
+            const auto d32 = static_cast<std::uint64_t>(d >> static_cast<unsigned>(UINT8_C(28)));
+
+            j = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(n32 << static_cast<unsigned>(UINT8_C(4))) + static_cast<std::uint64_t>(d32 >> static_cast<unsigned>(UINT8_C(1)))) / d32);
+
+            const auto dj = static_cast<std::uint64_t>(static_cast<std::uint64_t>(d >> static_cast<unsigned>(UINT8_C(4))) * j);
+            const auto nj = static_cast<std::uint64_t>(static_cast<std::uint64_t>(n >> static_cast<unsigned>(UINT8_C(4))) * j);
+
+            u_neg = (n < dj);
+
+            un = static_cast<std::uint64_t>(u_neg ? static_cast<std::uint64_t>(dj - n) : static_cast<std::uint64_t>(n - dj));
+            ud = static_cast<std::uint64_t>(d + nj);
+
+            if(un != static_cast<std::uint64_t>(UINT8_C(0)))
+            {
+              const auto lz_n = detail::softfloat_countLeadingZeros64(un);
+              const auto lz_d = detail::softfloat_countLeadingZeros64(ud);
+
+              un = static_cast<std::uint64_t>(un << static_cast<unsigned>(lz_n));
+              ud = static_cast<std::uint64_t>(ud << static_cast<unsigned>(lz_d));
+
+              e_u = static_cast<std::int32_t>(static_cast<std::int32_t>(lz_d) - static_cast<std::int32_t>(lz_n));
+            }
+          }
+
+          // The reduced angle atan(u) = pu * 2^(e_u - 126), where u <= 1/8.
+          auto pu = detail::uint128_compound { };
+
+          if(un != static_cast<std::uint64_t>(UINT8_C(0)))
+          {
+            const auto q = detail::trig_div_q63(un, ud);
 
-    constexpr operator unsigned char     () const { return static_cast<unsigned char>     (f64_to_ui32(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
-    constexpr operator unsigned short    () const { return static_cast<unsigned short>    (f64_to_ui32(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions,google-runtime-int)
-    constexpr operator unsigned int      () const { return static_cast<unsigned int>      (f64_to_ui32(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
-    constexpr operator unsigned long     () const { return static_cast<unsigned long>     (f64_to_ui64(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions,google-runtime-int)
-    constexpr operator unsigned long long() const { return static_cast<unsigned long long>(f64_to_ui64(my_value)); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions,google-runtime-int)
+            const auto q_top = (static_cast<std::uint64_t>(q.v1 >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint64_t>(UINT8_C(0)));
 
-  private:
-    template<typename FloatingPointType>
-    SOFT_DOUBLE_NODISCARD constexpr auto to_float() const -> typename std::enable_if<(   (sizeof(FloatingPointType) == 4)
-                                                                                      && std::numeric_limits<FloatingPointType>::is_iec559), FloatingPointType>::type
-    {
-      return f64_to_f32(my_value);
-    }
+            const auto sig_u =
+              static_cast<std::uint64_t>
+              (
+                q_top ? q.v1
+                      : static_cast<std::uint64_t>(static_cast<std::uint64_t>(q.v1 << static_cast<unsigned>(UINT8_C(1))) | static_cast<std::uint64_t>(q.v0 >> static_cast<unsigned>(UINT8_C(63))))
+              );
 
-    template<typename FloatingPointType>
-    SOFT_DOUBLE_NODISCARD constexpr auto to_float() const -> typename std::enable_if<(   (sizeof(FloatingPointType) == static_cast<std::size_t>(UINT8_C(8)))
-                                                                                      && std::numeric_limits<FloatingPointType>::is_iec559), FloatingPointType>::type
-    {
-      return static_cast<FloatingPointType>(*static_cast<const volatile FloatingPointType*>(static_cast<const volatile void*>(this))); // NOLINT(bugprone-casting-through-void)
-    }
+            e_u = static_cast<std::int32_t>(q_top ? e_u : static_cast<std::int32_t>(e_u - static_cast<std::int32_t>(INT8_C(1))));
 
-  public:
-    constexpr operator float      () const noexcept { return to_float<float>(); }                            // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
-    constexpr operator double     () const noexcept { return to_float<double>(); }                           // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
-    constexpr operator long double() const noexcept { return static_cast<long double>(to_float<double>()); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+            // Form u^2 with 64 fractional bits, then S(u^2) with 63.
+            const auto shift_u2 = static_cast<std::int32_t>(static_cast<std::int32_t>(-2 * e_u) - static_cast<std::int32_t>(INT8_C(2)));
 
-    constexpr auto operator+=(const soft_double& other) -> soft_double& { my_value = f64_add(my_value, other.my_value); return *this; }
-    constexpr auto operator-=(const soft_double& other) -> soft_double& { my_value = f64_sub(my_value, other.my_value); return *this; }
-    constexpr auto operator*=(const soft_double& other) -> soft_double& { my_value = f64_mul(my_value, other.my_value); return *this; }
-    constexpr auto operator/=(const soft_double& other) -> soft_double& { my_value = f64_div(my_value, other.my_value); return *this; }
+            const auto u2 =
+              static_cast<std::uint64_t>
+              (
+                (shift_u2 < static_cast<std::int32_t>(INT8_C(64)))
+                  ? static_cast<std::uint64_t>(detail::softfloat_mul64To128(sig_u, sig_u).v1 >> static_cast<unsigned>(shift_u2))
+                  : static_cast<std::uint64_t>(UINT8_C(0))
+              );
 
-    // Operators pre-increment and pre-decrement.
-    constexpr auto operator++() -> soft_double& { return *this += my_value_one(); }
-    constexpr auto operator--() -> soft_double& { return *this -= my_value_one(); }
+            auto s = coefs.back();
 
-    // Operators post-increment and post-decrement.
-    constexpr auto operator++(int) -> soft_double { const soft_double w(*this); static_cast<void>(++(*this)); return w; } // NOLINT(performance-no-automatic-move)
-    constexpr auto operator--(int) -> soft_double { const soft_double w(*this); static_cast<void>(--(*this)); return w; } // NOLINT(performance-no-automatic-move)
+            for(auto k = static_cast<std::size_t>(coefs.size() - 1U); k > static_cast<std::size_t>(UINT8_C(0)); --k)
+            {
+              s = static_cast<std::uint64_t>(coefs[k - 1U] - detail::softfloat_mul64To128(u2, s).v1); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            }
 
-    constexpr auto operator+() const -> const soft_double& { return *this; }
-    constexpr auto operator-() const ->       soft_double  { return soft_double { my_value ^ static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(UINT8_C(63))), detail::nothing{} }; }
+            pu = detail::softfloat_mul64To128(sig_u, s);
+          }
 
-    static constexpr auto my_value_zero   () -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0)),                   detail::nothing{} }; }
-    static constexpr auto my_value_one    () -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0x3FF0000000000000)),  detail::nothing{} }; }
-    static constexpr auto my_value_two    () -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0x4000000000000000)),  detail::nothing{} }; }
-    static constexpr auto my_value_half   () -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0x3FE0000000000000)),  detail::nothing{} }; }
-    static constexpr auto my_value_pi     () -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(4614256656552045848)), detail::nothing{} }; }
-    static constexpr auto my_value_pi_half() -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0x3FF921FB54442D18)),  detail::nothing{} }; }
-    static constexpr auto my_value_ln2    () -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(4604418534313441775)), detail::nothing{} }; }
+          if((j == static_cast<std::uint64_t>(UINT8_C(0))) && (!swap) && (!signX))
+          {
+            // The result is atan(u) itself, rounded with full relative precision.
+            result = f64_round_fixed(false, static_cast<std::int32_t>(e_u - static_cast<std::int32_t>(INT8_C(126))), pu);
+          }
+          else
+          {
+            auto r =
+              detail::uint128_compound
+              {
+                static_cast<std::uint64_t>(atan_table[static_cast<std::size_t>(j)] << static_cast<unsigned>(UINT8_C(62))), // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                static_cast<std::uint64_t>(atan_table[static_cast<std::size_t>(j)] >> static_cast<unsigned>(UINT8_C(2)))   // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+              };
+
+            if((pu.v1 | pu.v0) != static_cast<std::uint64_t>(UINT8_C(0)))
+            {
+              const auto atan_u = detail::softfloat_shiftRightJam128(pu, static_cast<std::uint_fast16_t>(static_cast<std::int32_t>(INT8_C(1)) - e_u));
 
-    static constexpr auto my_value_min()           -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(4503599627370496)),    detail::nothing{} }; }
-    static constexpr auto my_value_max()           -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(9218868437227405311)), detail::nothing{} }; }
-    static constexpr auto my_value_lowest()        -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(18442240474082181119)),detail::nothing{} }; }
-    static constexpr auto my_value_epsilon()       -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(4372995238176751616)), detail::nothing{} }; }
-    static constexpr auto my_value_round_error()   -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0x3FE0000000000000)),  detail::nothing{} }; }
-    static constexpr auto my_value_denorm_min()    -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(1)),                   detail::nothing{} }; }
-    static constexpr auto my_value_infinity()      -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000)),  detail::nothing{} }; }
-    static constexpr auto my_value_quiet_NaN()     -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0xFFF8000000000000)),  detail::nothing{} }; }
-    static constexpr auto my_value_signaling_NaN() -> soft_double { return soft_double { static_cast<std::uint64_t>(UINT64_C(0x7FF8000000000000)),  detail::nothing{} }; }
+              r = (u_neg ? detail::softfloat_sub128(r, atan_u) : detail::softfloat_add128(r, atan_u));
+            }
 
-  private:
-    representation_type my_value { };
+            if(swap)
+            {
+              r = (signX ? detail::softfloat_add128(pi_half_q125, r) : detail::softfloat_sub128(pi_half_q125, r));
+            }
+            else if(signX)
+            {
+              r = detail::softfloat_sub128(pi_q125, r);
+            }
 
-    static constexpr auto my_le(const soft_double& a, const soft_double& b) -> bool
-    {
-      return (detail::signF64UI(a.my_value) != detail::signF64UI(b.my_value))
-               ? (detail::signF64UI(a.my_value) ||  (static_cast<std::uint64_t>(a.my_value | b.my_value) & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF))) == static_cast<std::uint64_t>(UINT8_C(0)))
-               : (a.my_value == b.my_value)     || ((  static_cast<unsigned>(detail::signF64UI(a.my_value) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))
-                                                     ^ static_cast<unsigned>((a.my_value < b.my_value)     ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))) != static_cast<unsigned>(UINT8_C(0)));
-    }
+            result = f64_round_fixed(false, static_cast<std::int32_t>(INT8_C(-125)), r);
+          }
+        }
 
-    static constexpr auto my_lt(const soft_double& a, const soft_double& b) -> bool
-    {
-      return (detail::signF64UI(a.my_value) != detail::signF64UI(b.my_value))
-               ? (detail::signF64UI(a.my_value) &&  (static_cast<std::uint64_t>(a.my_value | b.my_value) & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF))) != static_cast<std::uint64_t>(UINT8_C(0)))
-               : (a.my_value != b.my_value)     && ((  static_cast<unsigned>(detail::signF64UI(a.my_value) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))
-                                                     ^ static_cast<unsigned>((a.my_value < b.my_value)     ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))) != static_cast<unsigned>(UINT8_C(0)));
+        result = static_cast<std::uint64_t>(result | static_cast<std::uint64_t>(signY ? static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)) : static_cast<std::uint64_t>(UINT8_C(0))));
+      }
+
+      return result;
     }
 
-    static constexpr auto sign_ab(const std::uint64_t a, const std::uint64_t b) -> bool
+    static constexpr auto f64_scale_pow2(const std::uint64_t a, const std::int32_t n) -> std::uint64_t
     {
-      const auto signA = detail::signF64UI(a);
-      const auto signB = detail::signF64UI(b);
+      // Multiply the finite, nonzero a (which may be subnormal) by 2^n,
+      // where the result must be normal, so that this is exact.
+      auto expA = detail::expF64UI (a);
+      auto sigA = detail::fracF64UI(a);
+
+      if(expA == static_cast<std::int16_t>(INT8_C(0)))
+      {
+        softfloat_normSubnormalF64Sig(expA, sigA);
+      }
+      else
+      {
+        sigA |= static_cast<std::uint64_t>(UINT64_C(0x0010000000000000));
+      }
 
       return
-        static_cast<std::uint_fast8_t>
+        detail::packToF64UI
         (
-            static_cast<std::uint_fast8_t>(signA ? static_cast<std::uint_fast8_t>(UINT8_C(1)) : static_cast<std::uint_fast8_t>(UINT8_C(0)))
-          ^ static_cast<std::uint_fast8_t>(signB ? static_cast<std::uint_fast8_t>(UINT8_C(1)) : static_cast<std::uint_fast8_t>(UINT8_C(0)))
-        ) != static_cast<std::uint_fast8_t>(UINT8_C(0));
+          detail::signF64UI(a),
+          static_cast<std::int16_t>(static_cast<std::int32_t>(static_cast<std::int32_t>(expA) + n) - static_cast<std::int32_t>(INT8_C(1))),
+          sigA
+        );
     }
 
-    static constexpr auto f64_add(const std::uint64_t a, const std::uint64_t b) -> std::uint64_t
+    static constexpr auto f64_hypot(const std::uint64_t a, const std::uint64_t b) -> std::uint64_t
     {
-      const auto signA = detail::signF64UI(a);
+      // Compute sqrt(x^2 + y^2) without undue overflow or underflow and
+      // without division. The arguments are scaled by a power of two
+      // (exactly) if needed, the sum of squares is formed with a fused
+      // multiply-add and the square root is scaled back.
+      constexpr auto value_inf = static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000));
 
-      return ((signA == detail::signF64UI(b)) ? softfloat_addMagsF64(a, b, signA)
-                                              : softfloat_subMagsF64(a, b, signA));
-    }
+      constexpr auto value_two_pow_m600 = static_cast<std::uint64_t>(UINT64_C(0x1A70000000000000));
 
-    static constexpr auto f64_sub(const std::uint64_t a, const std::uint64_t b) -> std::uint64_t
-    {
-      const auto signA = detail::signF64UI(a);
+      const auto abs_a = static_cast<std::uint64_t>(a & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF)));
+      const auto abs_b = static_cast<std::uint64_t>(b & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF)));
 
-      return ((signA == detail::signF64UI(b)) ? softfloat_subMagsF64(a, b, signA)
-                                              : softfloat_addMagsF64(a, b, signA));
-    }
+      const auto big   = ((abs_a > abs_b) ? abs_a : abs_b);
+      const auto small = ((abs_a > abs_b) ? abs_b : abs_a);
 
-    static constexpr auto f64_mul(const std::uint64_t a, const std::uint64_t b) -> std::uint64_t
-    {
-      const auto expA  = detail::expF64UI (a);
-      const auto expB  = detail::expF64UI (b);
+      const auto expBig   = detail::expF64UI(big);
+      const auto expSmall = detail::expF64UI(small);
 
-      auto sigA  = detail::fracF64UI(a);
-      auto sigB  = detail::fracF64UI(b);
+      auto result = std::uint64_t { };
+
+      if((abs_a == value_inf) || (abs_b == value_inf))
+      {
+        // hypot(+-inf, y) is +inf, even for NaN y.
+        result = value_inf;
+      }
+      else if(big > value_inf)
+      {
+        // Propagate the NaN argument as it is, sign included.
+        result = ((abs_a > value_inf) ? a : b);
+      }
+      else if((small == static_cast<std::uint64_t>(UINT8_C(0))) || (static_cast<std::int32_t>(expBig - expSmall) > static_cast<std::int32_t>(INT8_C(27))))
+      {
+        // Here, the square of the smaller argument is negligible.
+        result = big;
+      }
+      else
+      {
+        const auto scale_down = (expBig > static_cast<std::int16_t>(INT16_C(0x5FE)));
+        const auto scale_up   = (expBig < static_cast<std::int16_t>(INT16_C(0x200)));
 
-      const auto signZ = sign_ab(a, b);
+        const auto scale = static_cast<std::int32_t>(scale_down ? INT16_C(-600) : (scale_up ? INT16_C(600) : INT16_C(0)));
 
-      auto result = std::uint64_t { };
+        const auto x = f64_scale_pow2(big,   scale);
+        const auto y = f64_scale_pow2(small, scale);
+
+        result = f64_sqrt(f64_mulAdd(x, x, f64_mul(y, y)));
+
+        if(scale_down)
+        {
+          result =
+            ((static_cast<std::int32_t>(detail::expF64UI(result)) + static_cast<std::int32_t>(INT16_C(600))) > static_cast<std::int32_t>(INT16_C(0x7FE)))
+              ? value_inf
+              : f64_scale_pow2(result, static_cast<std::int32_t>(INT16_C(600)));
+        }
+        else if(scale_up)
+        {
+          result = f64_mul(result, value_two_pow_m600);
+        }
+      }
+
+      return result;
+    }
+
+    static constexpr auto f64_cbrt(const std::uint64_t a) -> std::uint64_t
+    {
+      // Write |x| = m * 2^(3q), with 1 <= m < 8. An estimate of m^(-1/3) is
+      // taken from the bit pattern of m, scaled down by 3 and subtracted
+      // from a constant. Four Newton steps r = r + r * (1 - (m * r^3)) / 3,
+      // which need no division, are carried out in fixed-point, each
+      // about doubling the number of correct bits from the initial five.
+      // Then cbrt(|x|) = m * r^2 * 2^q is rounded only once.
+      const auto signA = detail::signF64UI(a);
+            auto expA  = detail::expF64UI (a);
+            auto sigA  = detail::fracF64UI(a);
 
-      const auto a_is_zero = (   (expA == static_cast<std::int16_t> ( INT8_C(0)))
-                              && (sigA == static_cast<std::uint64_t>(UINT8_C(0))));
+      auto result = std::uint64_t { };
 
-      if(    a_is_zero
-          || (   (expB == static_cast<std::int16_t> ( INT8_C(0)))
-              && (sigB == static_cast<std::uint64_t>(UINT8_C(0)))))
+      if(   (expA == static_cast<std::int16_t>(INT16_C(0x7FF)))
+         || ((expA == static_cast<std::int16_t>(INT8_C(0))) && (sigA == static_cast<std::uint64_t>(UINT8_C(0)))))
       {
-        result = detail::packToF64UI(signZ, static_cast<int>(INT8_C(0)), static_cast<int>(INT8_C(0)));
+        // The cube root of zero, infinity and NaN is the argument itself.
+        result = a;
       }
       else
       {
-        auto expZ =
-          static_cast<std::int16_t>
+        if(expA == static_cast<std::int16_t>(INT8_C(0)))
+        {
+          softfloat_normSubnormalF64Sig(expA, sigA);
+        }
+        else
+        {
+          sigA |= static_cast<std::uint64_t>(UINT64_C(0x0010000000000000));
+        }
+
+        const auto e = static_cast<std::int32_t>(static_cast<std::int32_t>(expA) - static_cast<std::int32_t>(INT16_C(0x3FF)));
+
+        const auto q =
+          static_cast<std::int32_t>
           (
-              static_cast<std::int16_t>(expA + expB)
-            - static_cast<std::int16_t>(INT16_C(0x3FF))
+            (e >= static_cast<std::int32_t>(INT8_C(0)))
+              ? static_cast<std::int32_t>(e / static_cast<std::int32_t>(INT8_C(3)))
+              : static_cast<std::int32_t>(-static_cast<std::int32_t>(static_cast<std::int32_t>(static_cast<std::int32_t>(-e) + static_cast<std::int32_t>(INT8_C(2))) / static_cast<std::int32_t>(INT8_C(3))))
           );
 
-        sigA =
-          static_cast<std::uint64_t>
+        const auto rem = static_cast<unsigned>(e - static_cast<std::int32_t>(q * static_cast<std::int32_t>(INT8_C(3))));
+
+        // The value m with 61 fractional bits, and the bit pattern of m.
+        const auto m61 = static_cast<std::uint64_t>(sigA << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(9)) + rem));
+
+        const auto m_bits =
+          detail::packToF64UI
           (
-            static_cast<std::uint64_t>
-            (
-              sigA | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000))
-            ) << static_cast<unsigned>(UINT8_C(10))
+            false,
+            static_cast<std::int16_t>(static_cast<std::int16_t>(INT16_C(0x3FF)) + static_cast<std::int16_t>(rem)),
+            static_cast<std::uint64_t>(sigA & static_cast<std::uint64_t>(UINT64_C(0x000FFFFFFFFFFFFF)))
           );
 
-        sigB =
+        const auto r_bits = static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT64_C(0x553EF0FF289DD796)) - static_cast<std::uint64_t>(m_bits / 3U));
+
+        // The estimate r ~ m^(-1/3) in (1/2, 1], with 63 fractional bits.
+        auto r =
           static_cast<std::uint64_t>
           (
-            static_cast<std::uint64_t>
-            (
-              sigB | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000))
-            ) << static_cast<unsigned>(UINT8_C(11))
+              static_cast<std::uint64_t>(detail::fracF64UI(r_bits) | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)))
+            << static_cast<unsigned>(static_cast<std::int32_t>(detail::expF64UI(r_bits)) - static_cast<std::int32_t>(INT16_C(0x3F4)))
           );
 
-        // Compute the 128-bit product of sigA and sigB.
+        for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(4)); ++i)
+        {
+          const auto r3 = detail::mul_q63(detail::mul_q63(r, r), r);
 
-        const auto a32 = static_cast<std::uint32_t>(sigA >> static_cast<unsigned>(UINT8_C(32)));
-        const auto a0  = static_cast<std::uint32_t>(sigA);
-        const auto b32 = static_cast<std::uint32_t>(sigB >> static_cast<unsigned>(UINT8_C(32)));
-        const auto b0  = static_cast<std::uint32_t>(sigB);
+          // The product m * r^3 ~ 1, with 63 fractional bits.
+          const auto p = detail::softfloat_mul64To128(m61, r3);
 
-        const auto mid1 = static_cast<std::uint64_t>(                                  (static_cast<std::uint64_t>(a32)) * b0);
-              auto mid  = static_cast<std::uint64_t>(mid1 + static_cast<std::uint64_t>((static_cast<std::uint64_t>(b32)) * a0));
+          const auto w = static_cast<std::uint64_t>(static_cast<std::uint64_t>(p.v1 << static_cast<unsigned>(UINT8_C(3))) | static_cast<std::uint64_t>(p.v0 >> static_cast<unsigned>(UINT8_C(61))));
 
-        auto sig128Z =
-          detail::uint128_compound
-          {
-            static_cast<std::uint64_t>(static_cast<std::uint64_t>(a0)  * b0),
-            static_cast<std::uint64_t>
-            (
-                static_cast<std::uint64_t>(static_cast<std::uint64_t>(a32) * b32)
-              + static_cast<std::uint32_t>(mid >> static_cast<unsigned>(UINT8_C(32)))
-            )
-          };
+          constexpr auto one_q63 = static_cast<std::uint64_t>(UINT64_C(0x8000000000000000));
 
-        if(mid < mid1)
-        {
-          sig128Z.v1 =
+          r =
             static_cast<std::uint64_t>
             (
-                 sig128Z.v1
-              +  static_cast<std::uint64_t>(UINT64_C(0x100000000))
+              (w <= one_q63) ? static_cast<std::uint64_t>(r + static_cast<std::uint64_t>(detail::mul_q63(r, static_cast<std::uint64_t>(one_q63 - w)) / 3U))
+                             : static_cast<std::uint64_t>(r - static_cast<std::uint64_t>(detail::mul_q63(r, static_cast<std::uint64_t>(w - one_q63)) / 3U))
             );
         }
 
-        mid = static_cast<std::uint64_t>(mid << static_cast<unsigned>(UINT8_C(32)));
-
-        sig128Z.v0 = static_cast<std::uint64_t>(sig128Z.v0 + mid);
-
-        sig128Z.v1 =
-          static_cast<std::uint64_t>
+        // The root m * r^2 ~ m^(1/3) has 124 fractional bits.
+        result =
+          f64_round_fixed
           (
-              sig128Z.v1
-            + static_cast<std::uint_fast8_t>
-              (
-                (sig128Z.v0 < mid)
-                  ? static_cast<std::uint_fast8_t>(UINT8_C(1))
-                  : static_cast<std::uint_fast8_t>(UINT8_C(0))
-              )
+            signA,
+            static_cast<std::int32_t>(q - static_cast<std::int32_t>(INT8_C(124))),
+            detail::softfloat_mul64To128(m61, detail::mul_q63(r, r))
           );
+      }
 
-        if(sig128Z.v0 != static_cast<std::uint64_t>(UINT8_C(0)))
-        {
-          sig128Z.v1 =
-            static_cast<std::uint64_t>
-            (
-                sig128Z.v1
-              | static_cast<std::uint_fast8_t>(UINT8_C(1))
-            );
-        }
+      return result;
+    }
+
+    static constexpr auto f64_trig_r_squared(const detail::trig_reduced_argument& r) -> std::uint64_t
+    {
+      // Form u = r^2 (with 64 fractional bits) from the reduced argument,
+      // which has |r| <= pi/4 and thereby r.exp <= -1.
+      const auto sig_sq = detail::softfloat_mul64To128(r.sig, r.sig);
 
-        if(sig128Z.v1 < static_cast<std::uint64_t>(UINT64_C(0x4000000000000000)))
+      const auto shift = static_cast<unsigned>(static_cast<int>(-2 * static_cast<int>(r.exp)) - 2);
+
+      return
+        static_cast<std::uint64_t>
+        (
+          (shift < static_cast<unsigned>(UINT8_C(64))) ? static_cast<std::uint64_t>(sig_sq.v1 >> shift) : static_cast<std::uint64_t>(UINT8_C(0))
+        );
+    }
+
+    static constexpr auto f64_trig_sin_poly(const std::uint64_t u) -> std::uint64_t
+    {
+      // Evaluate S(u) in sin(r) = r * S(r^2), for |r| <= pi/4, with the Taylor
+      // coefficients 1/(2k + 1)! in fixed-point (63 fractional bits).
+      // The first term omitted is below 2^-70 relative to the result.
+      using coef_array_type = std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(10))>;
+
+      constexpr auto coefs =
+        coef_array_type
         {
-          --expZ;
+          static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)), static_cast<std::uint64_t>(UINT64_C(0x1555555555555555)),
+          static_cast<std::uint64_t>(UINT64_C(0x0111111111111111)), static_cast<std::uint64_t>(UINT64_C(0x0006806806806807)),
+          static_cast<std::uint64_t>(UINT64_C(0x0000171DE3A556C7)), static_cast<std::uint64_t>(UINT64_C(0x00000035CC8ACFEB)),
+          static_cast<std::uint64_t>(UINT64_C(0x000000005849184F)), static_cast<std::uint64_t>(UINT64_C(0x00000000006B9FD0)),
+          static_cast<std::uint64_t>(UINT64_C(0x000000000000654B)), static_cast<std::uint64_t>(UINT64_C(0x000000000000004C))
+        };
 
-          sig128Z.v1 <<= static_cast<unsigned>(UINT8_C(1));
-        }
+      auto s = coefs.back();
 
-        result = softfloat_roundPackToF64(signZ, expZ, sig128Z.v1);
+      for(auto k = static_cast<std::size_t>(coefs.size() - 1U); k > static_cast<std::size_t>(UINT8_C(0)); --k)
+      {
+        s = static_cast<std::uint64_t>(coefs[k - 1U] - detail::softfloat_mul64To128(u, s).v1); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
       }
 
-      return result;
+      return s;
     }
 
-    static constexpr auto f64_div(const std::uint64_t a, const std::uint64_t b) -> std::uint64_t
+    static constexpr auto f64_sin_kernel(const detail::trig_reduced_argument& r, bool signZ) -> std::uint64_t
     {
-      const auto expA  = detail::expF64UI(a);
-            auto sigA  = detail::fracF64UI(a);
+      auto p = detail::softfloat_mul64To128(r.sig, f64_trig_sin_poly(f64_trig_r_squared(r)));
 
-      const auto signZ = sign_ab(a, b);
+      auto expZ = static_cast<std::int16_t>(static_cast<std::int16_t>(INT16_C(0x3FE)) + r.exp);
 
-      auto result = std::uint64_t { };
-
-      const auto a_is_zero = (   (expA == static_cast<std::int16_t> ( INT8_C(0)))
-                              && (sigA == static_cast<std::uint64_t>(UINT8_C(0))));
-
-      if(a_is_zero)
+      if(static_cast<std::uint64_t>(p.v1 >> static_cast<unsigned>(UINT8_C(62))) == static_cast<std::uint64_t>(UINT8_C(0)))
       {
-        result = detail::packToF64UI(signZ, static_cast<int>(INT8_C(0)), static_cast<int>(INT8_C(0)));
+        p = detail::softfloat_shortShiftLeft128(p, static_cast<std::uint_fast8_t>(UINT8_C(1)));
+
+        --expZ;
       }
-      else
-      {
-        auto expZ =
-          static_cast<std::int16_t>
-          (
-              static_cast<std::int16_t>(expA - detail::expF64UI(b))
-            + static_cast<std::int16_t>(INT16_C(0x3FE))
-          );
 
-        sigA =
-          static_cast<std::uint64_t>
-          (
-              sigA
-            | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000))
-          );
+      const auto sigZ = static_cast<std::uint64_t>(p.v1 | static_cast<std::uint64_t>((p.v0 != static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0))));
 
-        auto sigB =
-          static_cast<std::uint64_t>
-          (
-              detail::fracF64UI(b)
-            | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000))
-          );
+      return softfloat_roundPackToF64(signZ, expZ, sigZ);
+    }
 
-        if(sigA < sigB)
-        {
-          --expZ;
+    static constexpr auto f64_trig_cos_poly(const std::uint64_t u) -> std::uint64_t
+    {
+      // Evaluate C(u) in cos(r) = C(r^2), for |r| <= pi/4, with the Taylor
+      // coefficients 1/(2k)! in fixed-point (63 fractional bits).
+      // The first term omitted is below 2^-68.
+      using coef_array_type = std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(10))>;
 
-          sigA = static_cast<std::uint64_t>(sigA << static_cast<unsigned>(UINT8_C(11)));
-        }
-        else
+      constexpr auto coefs =
+        coef_array_type
         {
-          sigA = static_cast<std::uint64_t>(sigA << static_cast<unsigned>(UINT8_C(10)));
-        }
+          static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)), static_cast<std::uint64_t>(UINT64_C(0x4000000000000000)),
+          static_cast<std::uint64_t>(UINT64_C(0x0555555555555555)), static_cast<std::uint64_t>(UINT64_C(0x002D82D82D82D82E)),
+          static_cast<std::uint64_t>(UINT64_C(0x0000D00D00D00D01)), static_cast<std::uint64_t>(UINT64_C(0x0000024FC9F6EF14)),
+          static_cast<std::uint64_t>(UINT64_C(0x000000047BB63BFE)), static_cast<std::uint64_t>(UINT64_C(0x00000000064E5D2A)),
+          static_cast<std::uint64_t>(UINT64_C(0x000000000006B9FD)), static_cast<std::uint64_t>(UINT64_C(0x00000000000005A1))
+        };
 
-        sigB <<= static_cast<unsigned>(UINT8_C(11));
+      auto c = coefs.back();
 
-        const auto recip32 =
-          static_cast<std::uint32_t>
-          (
-              detail::softfloat_approxRecip32_1(static_cast<std::uint32_t>(sigB >> static_cast<unsigned>(UINT8_C(32))))
-            - static_cast<unsigned>(UINT8_C(2))
-          );
+      for(auto k = static_cast<std::size_t>(coefs.size() - 1U); k > static_cast<std::size_t>(UINT8_C(0)); --k)
+      {
+        c = static_cast<std::uint64_t>(coefs[k - 1U] - detail::softfloat_mul64To128(u, c).v1); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+      }
 
-        const auto sig32Z =
-          static_cast<std::uint32_t>
-          (
-            static_cast<std::uint64_t>
-            (
-                static_cast<std::uint32_t>(sigA >> static_cast<unsigned>(UINT8_C(32)))
-              * static_cast<std::uint64_t>(recip32)
-            ) >> static_cast<unsigned>(UINT8_C(32))
-          );
+      return c;
+    }
+
+    static constexpr auto f64_cos_kernel(const detail::trig_reduced_argument& r, bool signZ) -> std::uint64_t
+    {
+      const auto c = f64_trig_cos_poly(f64_trig_r_squared(r));
+
+      // Here 1/sqrt(2) <= c <= 1 (which is exactly 2^63).
+      const auto c_is_one = (static_cast<std::uint64_t>(c >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint64_t>(UINT8_C(0)));
+
+      return
+        softfloat_roundPackToF64
+        (
+          signZ,
+          static_cast<std::int16_t>(c_is_one ? INT16_C(0x3FE) : INT16_C(0x3FD)),
+          static_cast<std::uint64_t>(c_is_one ? static_cast<std::uint64_t>(c >> static_cast<unsigned>(UINT8_C(1))) : c)
+        );
+    }
+
+    static constexpr auto f64_trig_quadrant(const detail::trig_reduced_argument& r, std::uint32_t quadrant, bool signA) -> std::uint64_t
+    {
+      // Evaluate sin(x), with x = (n * pi/2) + r and n mod 4 = quadrant,
+      // from the kernels. The cosine uses this with quadrant + 1.
+      const auto negate = (static_cast<std::uint32_t>(quadrant & static_cast<std::uint32_t>(UINT8_C(2))) != static_cast<std::uint32_t>(UINT8_C(0)));
 
-        auto doubleTerm = static_cast<std::uint32_t>(sig32Z << static_cast<unsigned>(UINT8_C(1)));
+      return
+        (static_cast<std::uint32_t>(quadrant & static_cast<std::uint32_t>(UINT8_C(1))) != static_cast<std::uint32_t>(UINT8_C(0)))
+          ? f64_cos_kernel(r, (negate != signA))
+          : f64_sin_kernel(r, ((r.sign != negate) != signA));
+    }
 
-        auto rem =
-          static_cast<std::uint64_t>
-          (
-            static_cast<std::uint64_t>
-            (
-              static_cast<std::uint64_t>
-              (
-                  sigA
-                - static_cast<std::uint64_t>
-                  (
-                      static_cast<std::uint64_t>(doubleTerm)
-                    * static_cast<std::uint32_t>(sigB >> static_cast<unsigned>(UINT8_C(32)))
-                  )
-              )
-              << static_cast<unsigned>(UINT8_C(28))
-            )
-          - static_cast<std::uint64_t>
-            (
-                static_cast<std::uint64_t>(doubleTerm)
-              * static_cast<std::uint32_t>(static_cast<std::uint32_t>(sigB) >> static_cast<unsigned>(UINT8_C(4)))
-            )
-          );
+    static constexpr auto f64_sin(const std::uint64_t a) -> std::uint64_t
+    {
+      const auto signA = detail::signF64UI(a);
+      const auto expA  = detail::expF64UI (a);
+      const auto sigA  = detail::fracF64UI(a);
 
-        auto q =
-          static_cast<std::uint32_t>
-          (
-              static_cast<std::uint32_t>
-              (
-                   static_cast<std::uint64_t>
-                   (
-                       static_cast<std::uint32_t>(rem >> static_cast<unsigned>(UINT8_C(32)))
-                     * static_cast<std::uint64_t>(recip32)
-                   )
-                >> static_cast<unsigned>(UINT8_C(32))
-              )
-            + static_cast<std::uint_fast8_t>(UINT8_C(4))
-          );
+      auto result = std::uint64_t { };
 
-        auto sigZ =
-          static_cast<std::uint64_t>
-          (
-              static_cast<std::uint64_t>(static_cast<std::uint64_t>(sig32Z) << static_cast<unsigned>(UINT8_C(32)))
-            + static_cast<std::uint64_t>(static_cast<std::uint64_t>(q)      << static_cast<unsigned>(UINT8_C( 4)))
-          );
+      if(expA == static_cast<std::int16_t>(INT16_C(0x7FF)))
+      {
+        // sin(NaN) is NaN and sin(+-inf) is also NaN.
+        result = ((sigA != static_cast<std::uint64_t>(UINT8_C(0))) ? a : my_value_quiet_NaN().my_value);
+      }
+      else if(expA < static_cast<std::int16_t>(INT16_C(0x3E4)))
+      {
+        // For |x| < 2^-27, sin(x) rounds to x (including zero and subnormals).
+        result = a;
+      }
+      else
+      {
+        const auto r = detail::trig_reduce(expA, sigA);
 
-        if(static_cast<std::uint_fast16_t>(sigZ & static_cast<std::uint_fast16_t>(UINT16_C(0x1FF))) < static_cast<std::uint_fast16_t>(static_cast<std::uint_fast16_t>(UINT8_C(4)) << static_cast<unsigned>(UINT8_C(4))))
-        {
-          q    = static_cast<std::uint32_t>(q    & static_cast<std::uint32_t>(~static_cast<std::uint32_t>(UINT8_C(7))));
-          sigZ = static_cast<std::uint64_t>(sigZ & static_cast<std::uint64_t>(~static_cast<std::uint64_t>(UINT8_C(0x7F))));
+        result = f64_trig_quadrant(r, r.quadrant, signA);
+      }
 
-          doubleTerm = static_cast<std::uint32_t>(q << static_cast<unsigned>(UINT8_C(1)));
+      return result;
+    }
 
-          rem =
-            static_cast<std::uint64_t>
-            (
-                static_cast<std::uint64_t>
-                (
-                  static_cast<std::uint64_t>
-                  (
-                      rem
-                    - static_cast<std::uint64_t>
-                      (
-                          static_cast<std::uint64_t>(doubleTerm)
-                        * static_cast<std::uint32_t>(sigB >> static_cast<unsigned>(UINT8_C(32)))
-                      )
-                  ) << static_cast<unsigned>(UINT8_C(28))
-                )
-              - static_cast<std::uint64_t>
-                (
-                    static_cast<std::uint64_t>(doubleTerm)
-                  * static_cast<std::uint32_t>(static_cast<std::uint32_t>(sigB) >> static_cast<unsigned>(UINT8_C(4)))
-                )
-            );
+    static constexpr auto f64_cos(const std::uint64_t a) -> std::uint64_t
+    {
+      const auto expA = detail::expF64UI (a);
+      const auto sigA = detail::fracF64UI(a);
 
-          if(static_cast<std::uint_fast8_t>(rem >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint_fast8_t>(UINT8_C(0)))
-          {
-            sigZ =
-              static_cast<std::uint64_t>
-              (
-                  sigZ
-                - static_cast<std::uint_fast8_t>
-                  (
-                    static_cast<std::uint_fast8_t>(UINT8_C(1)) << static_cast<unsigned>(UINT8_C(7))
-                  )
-              );
-          }
-          else
-          {
-            if(rem != static_cast<std::uint64_t>(UINT8_C(0)))
-            {
-              sigZ = static_cast<std::uint64_t>(sigZ | static_cast<std::uint_fast8_t>(UINT8_C(1)));
-            }
-          }
-        }
+      auto result = std::uint64_t { };
+
+      if(expA == static_cast<std::int16_t>(INT16_C(0x7FF)))
+      {
+        // cos(NaN) is NaN and cos(+-inf) is also NaN.
+        result = ((sigA != static_cast<std::uint64_t>(UINT8_C(0))) ? a : my_value_quiet_NaN().my_value);
+      }
+      else if(expA < static_cast<std::int16_t>(INT16_C(0x3E4)))
+      {
+        // For |x| < 2^-27, cos(x) rounds to 1.
+        result = my_value_one().my_value;
+      }
+      else
+      {
+        const auto r = detail::trig_reduce(expA, sigA);
 
-        result = softfloat_roundPackToF64(signZ, expZ, sigZ);
+        result = f64_trig_quadrant(r, static_cast<std::uint32_t>(r.quadrant + 1U), false);
       }
 
       return result;
     }
 
-    static constexpr auto f64_sqrt(const std::uint64_t a) -> std::uint64_t
+    static constexpr auto f64_sincos(const std::uint64_t a, std::uint64_t& s, std::uint64_t& c) -> void
     {
-      auto expA = detail::expF64UI (a);
-      auto sigA = detail::fracF64UI(a);
+      // Compute both sin(x) and cos(x) from a single argument reduction.
+      const auto signA = detail::signF64UI(a);
+      const auto expA  = detail::expF64UI (a);
+      const auto sigA  = detail::fracF64UI(a);
 
-      auto result = std::uint64_t { };
+      if(expA == static_cast<std::int16_t>(INT16_C(0x7FF)))
+      {
+        s = ((sigA != static_cast<std::uint64_t>(UINT8_C(0))) ? a : my_value_quiet_NaN().my_value);
+        c = s;
+      }
+      else if(expA < static_cast<std::int16_t>(INT16_C(0x3E4)))
+      {
+        s = a;
+        c = my_value_one().my_value;
+      }
+      else
+      {
+        const auto r = detail::trig_reduce(expA, sigA);
+
+        s = f64_trig_quadrant(r, r.quadrant, signA);
+        c = f64_trig_quadrant(r, static_cast<std::uint32_t>(r.quadrant + 1U), false);
+      }
+    }
+
+    static constexpr auto f64_tan(const std::uint64_t a) -> std::uint64_t
+    {
+      // Form tan(r) = r * S(r^2) / C(r^2), or -C(r^2) / (r * S(r^2)) in the
+      // odd quadrants, from the same kernels as sin and cos. The quotient
+      // is taken in fixed-point and rounded only once.
+      const auto signA = detail::signF64UI(a);
+      const auto expA  = detail::expF64UI (a);
+      const auto sigA  = detail::fracF64UI(a);
 
-      const auto a_is_zero = (   (expA == static_cast<std::int16_t> ( INT8_C(0)))
-                              && (sigA == static_cast<std::uint64_t>(UINT8_C(0))));
+      auto result = std::uint64_t { };
 
-      if(a_is_zero || detail::signF64UI(a))
+      if(expA == static_cast<std::int16_t>(INT16_C(0x7FF)))
+      {
+        // tan(NaN) is NaN and tan(+-inf) is also NaN.
+        result = ((sigA != static_cast<std::uint64_t>(UINT8_C(0))) ? a : my_value_quiet_NaN().my_value);
+      }
+      else if(expA < static_cast<std::int16_t>(INT16_C(0x3E4)))
       {
+        // For |x| < 2^-27, tan(x) rounds to x (including zero and subnormals).
         result = a;
       }
       else
       {
-        // sig32Z is guaranteed to be a lower bound on the square root
-        // of sig32A, which makes sig32Z also a lower bound on the
-        // square root of sigA.
+        const auto r = detail::trig_reduce(expA, sigA);
 
-        const auto expZ =
-          static_cast<std::int16_t>
-          (
-              static_cast<std::int_fast16_t>
-              (
-                static_cast<std::int_fast16_t> // NOLINT(hicpp-signed-bitwise)
-                (
-                    expA
-                  - static_cast<std::int16_t>(INT16_C(0x3FF))
-                ) >> static_cast<unsigned>(UINT8_C(1))
-              )
-            + static_cast<std::int_fast16_t>(INT16_C(0x3FE))
-          );
+        const auto u = f64_trig_r_squared(r);
 
-        expA =
-          static_cast<std::int16_t>
-          (
-            static_cast<std::uint_fast8_t>(expA) & static_cast<std::uint_fast8_t>(UINT8_C(1))
-          );
+        // Normalize r * S(r^2) and C(r^2) to 64 bits with the leading bit
+        // at bit 63, where each value is (sig / 2^63) * 2^exp.
+        auto rs = detail::softfloat_mul64To128(r.sig, f64_trig_sin_poly(u));
 
-        sigA = static_cast<std::uint64_t>(sigA | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)));
+        auto exp_rs = r.exp;
 
-        const auto sig32A      = static_cast<std::uint32_t>(sigA >> static_cast<unsigned>(UINT8_C(21)));
-        const auto recipSqrt32 = softfloat_approxRecipSqrt32_1(static_cast<std::uint32_t>(expA), sig32A);
-              auto sig32Z      = static_cast<std::uint32_t>
-                                 (
-                                   static_cast<std::uint64_t>(static_cast<std::uint64_t>(sig32A) * recipSqrt32) >> static_cast<unsigned>(UINT8_C(32))
-                                 );
+        const auto rs_shift = static_cast<std::uint_fast8_t>((static_cast<std::uint64_t>(rs.v1 >> static_cast<unsigned>(UINT8_C(62))) == static_cast<std::uint64_t>(UINT8_C(0))) ? UINT8_C(2) : UINT8_C(1));
 
-        if(expA != static_cast<std::int16_t>(INT8_C(0)))
-        {
-          sigA   <<= static_cast<unsigned>(UINT8_C(8));
-          sig32Z >>= static_cast<unsigned>(UINT8_C(1));
-        }
-        else
-        {
-          sigA <<= static_cast<unsigned>(UINT8_C(9));
-        }
+        rs = detail::softfloat_shortShiftLeft128(rs, rs_shift);
 
-        auto rem =
-          static_cast<std::uint64_t>
-          (
-              sigA
-            - static_cast<std::uint64_t>(static_cast<std::uint64_t>(sig32Z) * sig32Z)
-          );
+        exp_rs = static_cast<std::int16_t>(exp_rs - static_cast<std::int16_t>(rs_shift - 1U));
 
-        const auto q =
-          static_cast<std::uint32_t>
-          (
-            static_cast<std::uint64_t>
-            (
-                static_cast<std::uint32_t>(rem >> static_cast<unsigned>(UINT8_C(2)))
-              * static_cast<std::uint64_t>(recipSqrt32)
-            ) >> static_cast<unsigned>(UINT8_C(32))
-          );
+        const auto sig_rs = static_cast<std::uint64_t>(rs.v1 | static_cast<std::uint64_t>((rs.v0 != static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0))));
 
-        auto sigZ =
-          static_cast<std::uint64_t>
-          (
-              static_cast<std::uint64_t>
-              (
-                  static_cast<std::uint64_t>(static_cast<std::uint64_t>(sig32Z) << static_cast<unsigned>(UINT8_C(32)))
-                | static_cast<std::uint_fast8_t>(static_cast<std::uint_fast8_t>(UINT8_C(1)) << static_cast<unsigned>(UINT8_C(5)))
-              )
-            + static_cast<std::uint64_t>((static_cast<std::uint64_t>(q) << static_cast<unsigned>(UINT8_C(3))))
-          );
+        const auto c = f64_trig_cos_poly(u);
 
-        const auto sig_small_masked =
-          static_cast<std::uint_fast16_t>
-          (
-            sigZ & static_cast<std::uint_fast16_t>(UINT16_C(0x1FF))
-          );
+        const auto c_is_one = (static_cast<std::uint64_t>(c >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint64_t>(UINT8_C(0)));
 
-        if(sig_small_masked < static_cast<std::uint_fast16_t>(UINT16_C(0x22)))
-        {
-          sigZ &= static_cast<std::uint64_t>(~static_cast<std::uint64_t>(UINT8_C(0x3F)));
+        const auto sig_c = static_cast<std::uint64_t>(c_is_one ? c : static_cast<std::uint64_t>(c << static_cast<unsigned>(UINT8_C(1))));
+        const auto exp_c = static_cast<std::int16_t>(c_is_one ? INT8_C(0) : INT8_C(-1));
 
-          const auto shiftedSigZ = static_cast<std::uint64_t>(sigZ >> static_cast<unsigned>(UINT8_C(6)));
+        const auto quadrant_is_odd = (static_cast<std::uint32_t>(r.quadrant & static_cast<std::uint32_t>(UINT8_C(1))) != static_cast<std::uint32_t>(UINT8_C(0)));
 
-          rem =
-            static_cast<std::uint64_t>
-            (
-                static_cast<std::uint64_t>(sigA << static_cast<unsigned>(UINT8_C(52)))
-              - static_cast<std::uint64_t>(shiftedSigZ * shiftedSigZ)
-            );
+        const auto q = (quadrant_is_odd ? detail::trig_div_q63(sig_c, sig_rs) : detail::trig_div_q63(sig_rs, sig_c));
 
-          if(static_cast<std::uint_fast8_t>(rem >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint_fast8_t>(UINT8_C(0)))
-          {
-            --sigZ;
-          }
-          else
-          {
-            if(rem != static_cast<std::uint64_t>(UINT8_C(0)))
-            {
-              sigZ =
-                static_cast<std::uint64_t>
-                (
-                  sigZ | static_cast<std::uint_fast8_t>(UINT8_C(1))
-                );
-            }
-          }
-        }
+        const auto exp_q = static_cast<std::int16_t>(quadrant_is_odd ? static_cast<std::int16_t>(exp_c - exp_rs) : static_cast<std::int16_t>(exp_rs - exp_c));
+
+        // The quotient has its leading bit at bit 127 or 126.
+        const auto q_is_large = (static_cast<std::uint64_t>(q.v1 >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint64_t>(UINT8_C(0)));
+
+        const auto sticky =
+          static_cast<std::uint64_t>
+          (
+            (   (q.v0 != static_cast<std::uint64_t>(UINT8_C(0)))
+             || (q_is_large && (static_cast<std::uint64_t>(q.v1 & static_cast<std::uint64_t>(UINT8_C(1))) != static_cast<std::uint64_t>(UINT8_C(0)))))
+              ? static_cast<unsigned>(UINT8_C(1))
+              : static_cast<unsigned>(UINT8_C(0))
+          );
+
+        const auto sigZ = static_cast<std::uint64_t>(static_cast<std::uint64_t>(q_is_large ? static_cast<std::uint64_t>(q.v1 >> static_cast<unsigned>(UINT8_C(1))) : q.v1) | sticky);
 
-        result = softfloat_roundPackToF64(false, expZ, sigZ);
+        const auto expZ = static_cast<std::int16_t>(static_cast<std::int16_t>(q_is_large ? INT16_C(0x3FE) : INT16_C(0x3FD)) + exp_q);
+
+        result = softfloat_roundPackToF64((signA != (r.sign != quadrant_is_odd)), expZ, sigZ);
       }
 
       return result;
     }
 
+    template<detail::round_mode Mode = detail::round_mode::min_mag>
     static constexpr auto f64_to_ui32(const std::uint64_t a) -> std::uint32_t
     {
       const auto expA = detail::expF64UI (a);
@@ -1269,9 +6902,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
         sig = detail::softfloat_shiftRightJam64(sig, static_cast<std::uint_fast16_t>(shiftDist));
       }
 
-      return softfloat_roundToUI32(detail::signF64UI(a), sig);
+      return softfloat_roundToUI32<Mode>(detail::signF64UI(a), sig);
     }
 
+    template<detail::round_mode Mode = detail::round_mode::min_mag>
     static constexpr auto f64_to__i32(std::uint64_t a) -> std::int32_t // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
     {
       const auto expA = detail::expF64UI (a);
@@ -1299,9 +6933,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
         sig = detail::softfloat_shiftRightJam64(sig, static_cast<std::uint_fast16_t>(shiftDist));
       }
 
-      return softfloat_roundToI32(detail::signF64UI(a), sig);
+      return softfloat_roundToI32<Mode>(detail::signF64UI(a), sig);
     }
 
+    template<detail::round_mode Mode = detail::round_mode::min_mag>
     static constexpr auto f64_to_ui64(std::uint64_t a) -> std::uint64_t
     {
       const auto expA = detail::expF64UI (a);
@@ -1324,17 +6959,29 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
           - expA
         );
 
+      // For |a| >= 2^52, the integral significand is shifted left instead
+      // and has no fraction. Otherwise the fraction is kept in sigExtra.v0.
       const auto sigExtra =
-        detail::softfloat_shiftRightJam64Extra
-        (
-          sig,
-          static_cast<std::uint64_t>(UINT8_C(0)),
-          static_cast<std::uint32_t>(shiftDist)
-        );
+        (shiftDist <= static_cast<std::int16_t>(INT8_C(0)))
+          ? detail::uint128_compound
+            {
+              static_cast<std::uint64_t>(UINT8_C(0)),
+              static_cast<std::uint64_t>
+              (
+                (shiftDist > static_cast<std::int16_t>(INT8_C(-64))) ? static_cast<std::uint64_t>(sig << static_cast<unsigned>(-shiftDist)) : static_cast<std::uint64_t>(UINT8_C(0))
+              )
+            }
+          : detail::softfloat_shiftRightJam64Extra
+            (
+              sig,
+              static_cast<std::uint64_t>(UINT8_C(0)),
+              static_cast<std::uint32_t>(shiftDist)
+            );
 
-      return softfloat_roundToUI64(detail::signF64UI(a), sigExtra.v1);
+      return softfloat_roundToUI64<Mode>(detail::signF64UI(a), sigExtra);
     }
 
+    template<detail::round_mode Mode = detail::round_mode::min_mag>
     static constexpr auto f64_to__i64(std::uint64_t a) -> std::int64_t // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
     {
       const auto expA = detail::expF64UI (a);
@@ -1350,22 +6997,209 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
           );
       }
 
-      const auto shiftDist =
-        static_cast<std::int16_t>
-        (
-            static_cast<std::int16_t>(INT16_C(0x433))
-          - expA
-        );
+      const auto shiftDist =
+        static_cast<std::int16_t>
+        (
+            static_cast<std::int16_t>(INT16_C(0x433))
+          - expA
+        );
+
+      // For |a| >= 2^52, the integral significand is shifted left instead
+      // and has no fraction. Otherwise the fraction is kept in sigExtra.v0.
+      const auto sigExtra =
+        (shiftDist <= static_cast<std::int16_t>(INT8_C(0)))
+          ? detail::uint128_compound
+            {
+              static_cast<std::uint64_t>(UINT8_C(0)),
+              static_cast<std::uint64_t>
+              (
+                (shiftDist > static_cast<std::int16_t>(INT8_C(-64))) ? static_cast<std::uint64_t>(sig << static_cast<unsigned>(-shiftDist)) : static_cast<std::uint64_t>(UINT8_C(0))
+              )
+            }
+          : detail::softfloat_shiftRightJam64Extra
+            (
+              sig,
+              static_cast<std::uint64_t>(UINT8_C(0)),
+              static_cast<std::uint32_t>(shiftDist)
+            );
+
+      return softfloat_roundToI64<Mode>(detail::signF64UI(a), sigExtra);
+    }
+
+    static constexpr auto f64_roundToInt(const std::uint64_t a, const detail::round_mode mode) -> std::uint64_t
+    {
+      // Round to an integral value directly on the bit pattern.
+      // The fraction bits below the unit position are masked off,
+      // after adding the rounding increment required by the mode.
+      // A carry out of the significand simply bumps the exponent.
+      const auto expA = detail::expF64UI(a);
+
+      auto uiZ = a;
+
+      if(expA <= static_cast<std::int16_t>(INT16_C(0x3FE)))
+      {
+        // Here |a| < 1, and the result is zero or one (with the sign of a).
+        if(static_cast<std::uint64_t>(a & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF))) != static_cast<std::uint64_t>(UINT8_C(0)))
+        {
+          constexpr auto value_one = static_cast<std::uint64_t>(UINT64_C(0x3FF0000000000000));
+
+          const auto signA = detail::signF64UI(a);
+
+          uiZ = static_cast<std::uint64_t>(a & static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)));
+
+          const auto round_to_one =
+          (
+               ((mode == detail::round_mode::near_even)    && (expA == static_cast<std::int16_t>(INT16_C(0x3FE))) && (detail::fracF64UI(a) != static_cast<std::uint64_t>(UINT8_C(0))))
+            || ((mode == detail::round_mode::near_max_mag) && (expA == static_cast<std::int16_t>(INT16_C(0x3FE))))
+            || ((mode == detail::round_mode::min)          &&   signA)
+            || ((mode == detail::round_mode::max)          && (!signA))
+          );
+
+          if(round_to_one)
+          {
+            uiZ |= value_one;
+          }
+        }
+      }
+      else if(expA < static_cast<std::int16_t>(INT16_C(0x433)))
+      {
+        const auto lastBitMask   = static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(static_cast<std::int16_t>(INT16_C(0x433)) - expA));
+        const auto roundBitsMask = static_cast<std::uint64_t>(lastBitMask - static_cast<std::uint64_t>(UINT8_C(1)));
+
+        if((mode == detail::round_mode::near_even) || (mode == detail::round_mode::near_max_mag))
+        {
+          uiZ = static_cast<std::uint64_t>(uiZ + static_cast<std::uint64_t>(lastBitMask >> static_cast<unsigned>(UINT8_C(1))));
+
+          if((mode == detail::round_mode::near_even) && (static_cast<std::uint64_t>(uiZ & roundBitsMask) == static_cast<std::uint64_t>(UINT8_C(0))))
+          {
+            // This was a tie, so round to even.
+            uiZ &= static_cast<std::uint64_t>(~lastBitMask);
+          }
+        }
+        else if(mode == (detail::signF64UI(uiZ) ? detail::round_mode::min : detail::round_mode::max))
+        {
+          uiZ = static_cast<std::uint64_t>(uiZ + roundBitsMask);
+        }
+
+        uiZ &= static_cast<std::uint64_t>(~roundBitsMask);
+      }
+
+      // Otherwise |a| >= 2^52 is integral already, or a is infinite or NaN.
+      return uiZ;
+    }
+
+    static constexpr auto f64_rem(const std::uint64_t a, const std::uint64_t b, const detail::round_mode mode, std::uint32_t& quo) -> std::uint64_t
+    {
+      // Compute the exact remainder a - (q * b), where q = a / b is rounded
+      // toward zero (round_mode::min_mag, as in fmod) or to nearest with
+      // ties to even (round_mode::near_even, as in remainder). The remainder
+      // is formed by long division on the significands with a shift-subtract
+      // loop, one iteration per unit of exponent difference. The low bits
+      // of |q| are returned in quo.
+      quo = static_cast<std::uint32_t>(UINT8_C(0));
+
+      const auto abs_a = static_cast<std::uint64_t>(a & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF)));
+      const auto abs_b = static_cast<std::uint64_t>(b & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF)));
+
+      constexpr auto value_inf = static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000));
+
+      auto result = std::uint64_t { };
+
+      if((abs_a > value_inf) || (abs_b > value_inf))
+      {
+        result = ((abs_a > value_inf) ? a : b);
+      }
+      else if((abs_a == value_inf) || (abs_b == static_cast<std::uint64_t>(UINT8_C(0))))
+      {
+        result = my_value_quiet_NaN().my_value;
+      }
+      else if((abs_b == value_inf) || (abs_a == static_cast<std::uint64_t>(UINT8_C(0))))
+      {
+        result = a;
+      }
+      else
+      {
+        const auto signA = detail::signF64UI(a);
+
+        auto expA = detail::expF64UI (a);
+        auto sigA = detail::fracF64UI(a);
+        auto expB = detail::expF64UI (b);
+        auto sigB = detail::fracF64UI(b);
+
+        if(expA == static_cast<std::int16_t>(INT8_C(0))) { softfloat_normSubnormalF64Sig(expA, sigA); } else { sigA |= static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)); }
+        if(expB == static_cast<std::int16_t>(INT8_C(0))) { softfloat_normSubnormalF64Sig(expB, sigB); } else { sigB |= static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)); }
+
+        const auto round_to_nearest = (mode == detail::round_mode::near_even);
+
+        if(expA < static_cast<std::int16_t>(expB - (round_to_nearest ? static_cast<std::int16_t>(INT8_C(1)) : static_cast<std::int16_t>(INT8_C(0)))))
+        {
+          // Here |a| < |b| (and |a| < |b| / 2 for remainder), so q is zero.
+          result = a;
+        }
+        else
+        {
+          // The remainder r has the exponent expR (in the sense of the
+          // significands above), while sigD is |b| expressed on that scale.
+          auto sigR = sigA;
+          auto expR = expA;
+          auto sigD = sigB;
+          auto q    = static_cast<std::uint32_t>(UINT8_C(0));
+
+          if(expA < expB)
+          {
+            // Here |b| / 2 <= |a| < |b| for remainder.
+            sigD <<= static_cast<unsigned>(UINT8_C(1));
+          }
+          else
+          {
+            expR = expB;
+
+            for(auto n = static_cast<std::int32_t>(expA - expB); ; --n)
+            {
+              const auto bit = (sigR >= sigB);
+
+              if(bit)
+              {
+                sigR -= sigB;
+              }
+
+              q = static_cast<std::uint32_t>(static_cast<std::uint32_t>(q << static_cast<unsigned>(UINT8_C(1))) | (bit ? static_cast<std::uint32_t>(UINT8_C(1)) : static_cast<std::uint32_t>(UINT8_C(0))));
+
+              if(n == static_cast<std::int32_t>(INT8_C(0)))
+              {
+                break;
+              }
+
+              sigR <<= static_cast<unsigned>(UINT8_C(1));
+            }
+          }
+
+          auto signZ = signA;
 
-      const auto sigExtra =
-        detail::softfloat_shiftRightJam64Extra
-        (
-          sig,
-          static_cast<std::uint64_t>(UINT8_C(0)),
-          static_cast<std::uint32_t>(shiftDist)
-        );
+          if(round_to_nearest)
+          {
+            const auto sigR2 = static_cast<std::uint64_t>(sigR << static_cast<unsigned>(UINT8_C(1)));
+
+            if((sigR2 > sigD) || ((sigR2 == sigD) && (static_cast<std::uint32_t>(q & static_cast<std::uint32_t>(UINT8_C(1))) != static_cast<std::uint32_t>(UINT8_C(0)))))
+            {
+              // Round the quotient up, flipping the sign of the remainder.
+              sigR  = static_cast<std::uint64_t>(sigD - sigR);
+              signZ = (!signZ);
+
+              ++q;
+            }
+          }
+
+          quo = q;
+
+          result =
+            ((sigR == static_cast<std::uint64_t>(UINT8_C(0)))
+              ? detail::packToF64UI(signA, static_cast<std::int16_t>(INT8_C(0)), static_cast<std::uint64_t>(UINT8_C(0)))
+              : softfloat_normRoundPackToF64(signZ, static_cast<std::int16_t>(expR + static_cast<std::int16_t>(INT8_C(9))), sigR));
+        }
+      }
 
-      return softfloat_roundToI64(detail::signF64UI(a), sigExtra.v1);
+      return result;
     }
 
     static constexpr auto f64_to_f32(const std::uint64_t a) -> float
@@ -1485,6 +7319,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
             );
     }
 
+    template<detail::round_mode Mode = detail::round_mode::near_even>
     static constexpr auto my__i64_to_f64(const int64_t a) -> std::uint64_t // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
     {
       return
@@ -1495,7 +7330,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
                 ? detail::packToF64UI(true, static_cast<std::int16_t>(INT16_C(0x43E)), static_cast<int>(INT8_C(0)))
                 : static_cast<std::uint64_t>(UINT8_C(0))
             )
-          : softfloat_normRoundPackToF64
+          : softfloat_normRoundPackToF64<Mode>
             (
               (a < static_cast<std::int64_t>(INT8_C(0))),
               static_cast<std::int16_t>(INT16_C(0x43C)),
@@ -1536,38 +7371,47 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
             );
     }
 
+    template<detail::round_mode Mode = detail::round_mode::near_even>
     static constexpr auto my_ui64_to_f64(const std::uint64_t a) -> std::uint64_t
     {
       return
         (a == static_cast<std::uint64_t>(UINT8_C(0)))
           ? static_cast<std::uint64_t>(UINT8_C(0))
           : (static_cast<std::uint64_t>(a & static_cast<std::uint64_t>(UINT64_C(0x8000000000000000))) != static_cast<std::uint64_t>(UINT8_C(0)))
-              ? softfloat_roundPackToF64    (false, static_cast<std::int16_t>(INT16_C(0x43D)), detail::softfloat_shortShiftRightJam64(a, static_cast<std::uint_fast16_t>(UINT8_C(1))))
-              : softfloat_normRoundPackToF64(false, static_cast<std::int16_t>(INT16_C(0x43C)), a);
+              ? softfloat_roundPackToF64<Mode>    (false, static_cast<std::int16_t>(INT16_C(0x43D)), detail::softfloat_shortShiftRightJam64(a, static_cast<std::uint_fast16_t>(UINT8_C(1))))
+              : softfloat_normRoundPackToF64<Mode>(false, static_cast<std::int16_t>(INT16_C(0x43C)), a);
     }
 
+    template<detail::round_mode Mode = detail::round_mode::min_mag>
     static constexpr auto softfloat_roundToI32(bool sign, std::uint64_t sig) -> std::int32_t
     {
+      // The significand has twelve fraction bits, the lowest one jammed.
+      const auto magnitude = softfloat_roundToUI64Frac12<Mode>(sign, sig);
+
       return
         static_cast<std::int32_t>
         (
           static_cast<std::uint32_t>
           (
-            sign ? detail::negate(static_cast<std::uint32_t>(sig >> static_cast<unsigned>(UINT8_C(12))))
-                 :                static_cast<std::uint32_t>(sig >> static_cast<unsigned>(UINT8_C(12)))
+            sign ? detail::negate(static_cast<std::uint32_t>(magnitude))
+                 :                static_cast<std::uint32_t>(magnitude)
           )
         );
     }
 
-    static constexpr auto softfloat_roundToI64(bool sign, std::uint64_t sig) -> std::int64_t
+    template<detail::round_mode Mode = detail::round_mode::min_mag>
+    static constexpr auto softfloat_roundToI64(bool sign, const detail::uint128_compound& sig_extra) -> std::int64_t
     {
+      const auto magnitude = softfloat_roundToUI64Extra<Mode>(sign, sig_extra);
+
       return
         static_cast<std::int64_t>
         (
-          static_cast<std::uint64_t>(sign ? detail::negate(sig) : sig)
+          static_cast<std::uint64_t>(sign ? detail::negate(magnitude) : magnitude)
         );
     }
 
+    template<detail::round_mode Mode = detail::round_mode::min_mag>
     static constexpr auto softfloat_roundToUI32(bool sign, std::uint64_t sig) -> std::uint32_t
     {
       return
@@ -1575,21 +7419,69 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
         (
           (sign && (sig == static_cast<std::uint64_t>(UINT8_C(0))))
             ? static_cast<std::uint32_t>(UINT8_C(0))
-            : static_cast<std::uint32_t>(sig >> static_cast<unsigned>(UINT8_C(12)))
+            : static_cast<std::uint32_t>(softfloat_roundToUI64Frac12<Mode>(sign, sig))
+        );
+    }
+
+    template<detail::round_mode Mode>
+    static constexpr auto softfloat_roundToUI64Frac12(bool sign, std::uint64_t sig) -> std::uint64_t
+    {
+      // Rounds away the twelve fraction bits of sig in the given mode.
+
+      const auto roundBits = static_cast<std::uint16_t>(sig & static_cast<std::uint64_t>(UINT16_C(0xFFF)));
+
+      auto result =
+        static_cast<std::uint64_t>
+        (
+          static_cast<std::uint64_t>(sig + detail::round_increment<Mode>(sign, static_cast<std::uint16_t>(UINT16_C(0x800)))) >> static_cast<unsigned>(UINT8_C(12))
         );
+
+      if(   (Mode == detail::round_mode::near_even)
+         && (roundBits == static_cast<std::uint16_t>(UINT16_C(0x800))))
+      {
+        result = static_cast<std::uint64_t>(result & static_cast<std::uint64_t>(~static_cast<std::uint64_t>(UINT8_C(1))));
+      }
+
+      return result;
+    }
+
+    template<detail::round_mode Mode>
+    static constexpr auto softfloat_roundToUI64Extra(bool sign, const detail::uint128_compound& sig_extra) -> std::uint64_t
+    {
+      // Rounds the integral part sig_extra.v1, whose fraction (with the
+      // lowest bit jammed) is held in the 64 bits of sig_extra.v0.
+
+      const auto is_increment =
+        ((Mode == detail::round_mode::near_even) || (Mode == detail::round_mode::near_max_mag))
+          ? (sig_extra.v0 >= static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)))
+          : ((Mode == (sign ? detail::round_mode::min : detail::round_mode::max)) && (sig_extra.v0 != static_cast<std::uint64_t>(UINT8_C(0))));
+
+      auto result = static_cast<std::uint64_t>(sig_extra.v1 + (is_increment ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0))));
+
+      if(   (Mode == detail::round_mode::near_even)
+         && (sig_extra.v0 == static_cast<std::uint64_t>(UINT64_C(0x8000000000000000))))
+      {
+        result = static_cast<std::uint64_t>(result & static_cast<std::uint64_t>(~static_cast<std::uint64_t>(UINT8_C(1))));
+      }
+
+      return result;
     }
 
-    static constexpr auto softfloat_roundToUI64(bool sign, std::uint64_t sig) -> std::uint64_t
+    template<detail::round_mode Mode = detail::round_mode::min_mag>
+    static constexpr auto softfloat_roundToUI64(bool sign, const detail::uint128_compound& sig_extra) -> std::uint64_t
     {
+      const auto magnitude = softfloat_roundToUI64Extra<Mode>(sign, sig_extra);
+
       return
         static_cast<std::uint64_t>
         (
-          (sign && (sig == static_cast<std::uint64_t>(UINT8_C(0))))
+          (sign && (magnitude == static_cast<std::uint64_t>(UINT8_C(0))))
             ? static_cast<std::uint64_t>(UINT8_C(0))
-            : sig
+            : magnitude
         );
     }
 
+    template<detail::round_mode Mode = detail::round_mode::near_even>
     static constexpr auto softfloat_addMagsF64(std::uint64_t uiA, std::uint64_t uiB, bool signZ) -> std::uint64_t
     {
       const auto expA = detail::expF64UI(uiA);
@@ -1600,64 +7492,146 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
       auto sigZ = std::uint64_t { };
 
-      if(expDiff == static_cast<std::int16_t>(INT8_C(0)))
+      auto result = std::uint64_t { };
+
+      if(   (expDiff == static_cast<std::int16_t>(INT8_C(0)))
+         && (expA    == static_cast<std::int16_t>(INT8_C(0))))
       {
-        sigZ =
-          static_cast<std::uint64_t>
-          (
-            static_cast<std::uint64_t>
-            (
-                static_cast<std::uint64_t>
-                (
-                  detail::fracF64UI(uiA) + static_cast<std::uint64_t>(UINT64_C(0x0020000000000000))
-                )
-              + detail::fracF64UI(uiB)
-            )
-            << static_cast<unsigned>(UINT8_C(9))
-          );
+        // Zeros and subnormals add exactly, and a carry out of
+        // the fraction field yields the smallest normal exponent.
+        result = static_cast<std::uint64_t>(uiA + detail::fracF64UI(uiB));
       }
       else
       {
-        auto sigA = static_cast<std::uint64_t>(detail::fracF64UI(uiA) << static_cast<unsigned>(UINT8_C(9)));
-        auto sigB = static_cast<std::uint64_t>(detail::fracF64UI(uiB) << static_cast<unsigned>(UINT8_C(9)));
-
-        if(expDiff < static_cast<std::int16_t>(INT8_C(0)))
+        if(expDiff == static_cast<std::int16_t>(INT8_C(0)))
         {
-          expZ = expB;
-
-          sigA =
+          sigZ =
             static_cast<std::uint64_t>
             (
-              (expA != static_cast<std::int16_t>(INT8_C(0)))
-                ? static_cast<std::uint64_t>(sigA + static_cast<std::uint64_t>(UINT64_C(0x2000000000000000)))
-                : static_cast<std::uint64_t>(sigA << static_cast<unsigned>(UINT8_C(1)))
+              static_cast<std::uint64_t>
+              (
+                  static_cast<std::uint64_t>
+                  (
+                    detail::fracF64UI(uiA) + static_cast<std::uint64_t>(UINT64_C(0x0020000000000000))
+                  )
+                + detail::fracF64UI(uiB)
+              )
+              << static_cast<unsigned>(UINT8_C(9))
             );
-
-          sigA = detail::softfloat_shiftRightJam64(sigA, static_cast<std::uint_fast16_t>(-expDiff));
         }
         else
         {
-          sigB =
+          auto sigA = static_cast<std::uint64_t>(detail::fracF64UI(uiA) << static_cast<unsigned>(UINT8_C(9)));
+          auto sigB = static_cast<std::uint64_t>(detail::fracF64UI(uiB) << static_cast<unsigned>(UINT8_C(9)));
+
+          if(expDiff < static_cast<std::int16_t>(INT8_C(0)))
+          {
+            expZ = expB;
+
+            sigA =
+              static_cast<std::uint64_t>
+              (
+                (expA != static_cast<std::int16_t>(INT8_C(0)))
+                  ? static_cast<std::uint64_t>(sigA + static_cast<std::uint64_t>(UINT64_C(0x2000000000000000)))
+                  : static_cast<std::uint64_t>(sigA << static_cast<unsigned>(UINT8_C(1)))
+              );
+
+            sigA = detail::softfloat_shiftRightJam64(sigA, static_cast<std::uint_fast16_t>(-expDiff));
+          }
+          else
+          {
+            sigB =
+              static_cast<std::uint64_t>
+              (
+                (expB != static_cast<std::int16_t>(INT8_C(0)))
+                  ? static_cast<std::uint64_t>(sigB + static_cast<std::uint64_t>(UINT64_C(0x2000000000000000)))
+                  : static_cast<std::uint64_t>(sigB << static_cast<unsigned>(UINT8_C(1)))
+              );
+
+            sigB = detail::softfloat_shiftRightJam64(sigB, static_cast<std::uint_fast16_t>(expDiff));
+          }
+
+          sigZ =
             static_cast<std::uint64_t>
             (
-              (expB != static_cast<std::int16_t>(INT8_C(0)))
-                ? static_cast<std::uint64_t>(sigB + static_cast<std::uint64_t>(UINT64_C(0x2000000000000000)))
-                : static_cast<std::uint64_t>(sigB << static_cast<unsigned>(UINT8_C(1)))
+                static_cast<std::uint64_t>
+                (
+                    sigA
+                  + static_cast<std::uint64_t>(UINT64_C(0x2000000000000000))
+                )
+              + sigB
             );
 
-          sigB = detail::softfloat_shiftRightJam64(sigB, static_cast<std::uint_fast16_t>(expDiff));
+          if(sigZ < static_cast<std::uint64_t>(UINT64_C(0x4000000000000000)))
+          {
+            --expZ;
+
+            sigZ = static_cast<std::uint64_t>(sigZ << static_cast<unsigned>(UINT8_C(1)));
+          }
         }
 
-        sigZ =
-          static_cast<std::uint64_t>
+        result = softfloat_roundPackToF64<Mode>(signZ, expZ, sigZ);
+      }
+
+      return result;
+    }
+
+    template<detail::round_mode Mode = detail::round_mode::near_even>
+    static constexpr auto softfloat_addProdF64(bool signProd, std::int16_t expZ, detail::uint128_compound sig128Z, bool signC, std::int16_t expC, std::uint64_t sigC) -> std::uint64_t
+    {
+      // Adds c to the exact (unrounded) product in f64_mulAdd and rounds
+      // the sum. The upper half of the product and the significand of c
+      // both have their most significant bit at bit 61.
+
+      const auto expDiff = static_cast<std::int16_t>(expZ - expC);
+
+      auto sig128C = detail::uint128_compound { };
+
+      if(expDiff < static_cast<std::int16_t>(INT8_C(0)))
+      {
+        expZ = expC;
+
+        if((signProd == signC) || (expDiff < static_cast<std::int16_t>(INT8_C(-1))))
+        {
+          sig128Z.v1 = detail::softfloat_shiftRightJam64(sig128Z.v1, static_cast<std::uint_fast16_t>(-expDiff));
+        }
+        else
+        {
+          sig128Z = detail::softfloat_shortShiftRightJam128(sig128Z, static_cast<std::uint_fast8_t>(UINT8_C(1)));
+        }
+      }
+      else if(expDiff > static_cast<std::int16_t>(INT8_C(0)))
+      {
+        sig128C =
+          detail::softfloat_shiftRightJam128
           (
-              static_cast<std::uint64_t>
-              (
-                  sigA
-                + static_cast<std::uint64_t>(UINT64_C(0x2000000000000000))
-              )
-            + sigB
+            detail::uint128_compound { static_cast<std::uint64_t>(UINT8_C(0)), sigC },
+            static_cast<std::uint_fast16_t>(expDiff)
           );
+      }
+
+      auto signZ = signProd;
+      auto sigZ  = std::uint64_t { };
+
+      auto result = std::uint64_t { };
+
+      if(signProd == signC)
+      {
+        if(expDiff <= static_cast<std::int16_t>(INT8_C(0)))
+        {
+          sigZ = static_cast<std::uint64_t>(sigC + sig128Z.v1);
+        }
+        else
+        {
+          sig128Z = detail::softfloat_add128(sig128Z, sig128C);
+
+          sigZ = sig128Z.v1;
+        }
+
+        if(sig128Z.v0 != static_cast<std::uint64_t>(UINT8_C(0)))
+        {
+          sigZ = static_cast<std::uint64_t>(sigZ | static_cast<std::uint_fast8_t>(UINT8_C(1)));
+        }
 
         if(sigZ < static_cast<std::uint64_t>(UINT64_C(0x4000000000000000)))
         {
@@ -1665,121 +7639,101 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
           sigZ = static_cast<std::uint64_t>(sigZ << static_cast<unsigned>(UINT8_C(1)));
         }
+
+        result = softfloat_roundPackToF64<Mode>(signZ, expZ, sigZ);
       }
+      else
+      {
+        auto is_complete_cancellation = false;
 
-      return softfloat_roundPackToF64(signZ, expZ, sigZ);
-    }
+        if(expDiff < static_cast<std::int16_t>(INT8_C(0)))
+        {
+          signZ = signC;
 
-    static constexpr auto softfloat_approxRecipSqrt32_1(std::uint32_t oddExpA, std::uint32_t a) -> std::uint32_t
-    {
-      // Returns an approximation to the reciprocal of the square root of the number
-      // represented by a, where a is interpreted as an unsigned fixed-point
-      // number either with one integer bit and 31 fraction bits or with two integer
-      // bits and 30 fraction bits.
-      using softfloat_approx_recip_sqrt_array_type = std::array<std::uint16_t, static_cast<std::size_t>(UINT8_C(16))>;
+          sig128Z = detail::softfloat_sub128(detail::uint128_compound { static_cast<std::uint64_t>(UINT8_C(0)), sigC }, sig128Z);
+        }
+        else if(expDiff == static_cast<std::int16_t>(INT8_C(0)))
+        {
+          sig128Z.v1 = static_cast<std::uint64_t>(sig128Z.v1 - sigC);
 
-      constexpr auto softfloat_approxRecipSqrt_1k0s =
-        softfloat_approx_recip_sqrt_array_type
+          is_complete_cancellation = (   (sig128Z.v1 == static_cast<std::uint64_t>(UINT8_C(0)))
+                                      && (sig128Z.v0 == static_cast<std::uint64_t>(UINT8_C(0))));
+
+          if(static_cast<std::uint_fast8_t>(sig128Z.v1 >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint_fast8_t>(UINT8_C(0)))
+          {
+            signZ = (!signZ);
+
+            sig128Z = detail::softfloat_sub128(detail::uint128_compound { }, sig128Z);
+          }
+        }
+        else
         {
-          static_cast<std::uint16_t>(UINT16_C(0xB4C9)), static_cast<std::uint16_t>(UINT16_C(0xFFAB)), static_cast<std::uint16_t>(UINT16_C(0xAA7D)), static_cast<std::uint16_t>(UINT16_C(0xF11C)),
-          static_cast<std::uint16_t>(UINT16_C(0xA1C5)), static_cast<std::uint16_t>(UINT16_C(0xE4C7)), static_cast<std::uint16_t>(UINT16_C(0x9A43)), static_cast<std::uint16_t>(UINT16_C(0xDA29)),
-          static_cast<std::uint16_t>(UINT16_C(0x93B5)), static_cast<std::uint16_t>(UINT16_C(0xD0E5)), static_cast<std::uint16_t>(UINT16_C(0x8DED)), static_cast<std::uint16_t>(UINT16_C(0xC8B7)),
-          static_cast<std::uint16_t>(UINT16_C(0x88C6)), static_cast<std::uint16_t>(UINT16_C(0xC16D)), static_cast<std::uint16_t>(UINT16_C(0x8424)), static_cast<std::uint16_t>(UINT16_C(0xBAE1))
-        };
+          sig128Z = detail::softfloat_sub128(sig128Z, sig128C);
+        }
 
-      constexpr auto softfloat_approxRecipSqrt_1k1s =
-        softfloat_approx_recip_sqrt_array_type
+        if(is_complete_cancellation)
         {
-          static_cast<std::uint16_t>(UINT16_C(0xA5A5)), static_cast<std::uint16_t>(UINT16_C(0xEA42)), static_cast<std::uint16_t>(UINT16_C(0x8C21)), static_cast<std::uint16_t>(UINT16_C(0xC62D)),
-          static_cast<std::uint16_t>(UINT16_C(0x788F)), static_cast<std::uint16_t>(UINT16_C(0xAA7F)), static_cast<std::uint16_t>(UINT16_C(0x6928)), static_cast<std::uint16_t>(UINT16_C(0x94B6)),
-          static_cast<std::uint16_t>(UINT16_C(0x5CC7)), static_cast<std::uint16_t>(UINT16_C(0x8335)), static_cast<std::uint16_t>(UINT16_C(0x52A6)), static_cast<std::uint16_t>(UINT16_C(0x74E2)),
-          static_cast<std::uint16_t>(UINT16_C(0x4A3E)), static_cast<std::uint16_t>(UINT16_C(0x68FE)), static_cast<std::uint16_t>(UINT16_C(0x432B)), static_cast<std::uint16_t>(UINT16_C(0x5EFD))
-        };
+          result = detail::packToF64UI((Mode == detail::round_mode::min), static_cast<int>(INT8_C(0)), static_cast<int>(INT8_C(0)));
+        }
+        else
+        {
+          if(sig128Z.v1 == static_cast<std::uint64_t>(UINT8_C(0)))
+          {
+            expZ = static_cast<std::int16_t>(expZ - static_cast<std::int16_t>(INT8_C(64)));
 
-      const auto index  =
-        static_cast<std::int16_t>
-        (
-            static_cast<std::uint32_t>
+            sig128Z.v1 = sig128Z.v0;
+            sig128Z.v0 = static_cast<std::uint64_t>(UINT8_C(0));
+          }
+
+          const auto shiftDist =
+            static_cast<std::int_fast8_t>
             (
-              static_cast<std::uint32_t>(a >> static_cast<unsigned>(UINT8_C(27))) & static_cast<std::uint32_t>(UINT8_C(0xE))
-            )
-          + oddExpA
-        );
+                static_cast<std::int_fast8_t>(detail::softfloat_countLeadingZeros64(sig128Z.v1))
+              - static_cast<std::int_fast8_t>(INT8_C(1))
+            );
 
-      const auto eps = static_cast<std::uint16_t>(a >> static_cast<unsigned>(UINT8_C(12)));
+          expZ = static_cast<std::int16_t>(expZ - static_cast<std::int16_t>(shiftDist));
 
-      const auto r0 =
-        static_cast<std::uint16_t>
-        (
-            softfloat_approxRecipSqrt_1k0s[static_cast<std::size_t>(index)] // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-          - static_cast<std::uint16_t>
-            (
-              static_cast<std::uint32_t>
-              (
-                  softfloat_approxRecipSqrt_1k1s[static_cast<std::size_t>(index)] // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-                * static_cast<std::uint32_t>(eps)
-              ) >> static_cast<unsigned>(UINT8_C(20))
-            )
-        );
+          if(shiftDist < static_cast<std::int_fast8_t>(INT8_C(0)))
+          {
+            sigZ = detail::softfloat_shortShiftRightJam64(sig128Z.v1, static_cast<std::uint_fast16_t>(-shiftDist));
+          }
+          else
+          {
+            sig128Z = detail::softfloat_shortShiftLeft128(sig128Z, static_cast<std::uint_fast8_t>(shiftDist));
 
-      auto ESqrR0 = static_cast<std::uint32_t>(static_cast<std::uint32_t>(r0) * r0);
+            sigZ = sig128Z.v1;
+          }
 
-      if(oddExpA == static_cast<std::uint32_t>(UINT8_C(0)))
-      {
-        ESqrR0 <<= static_cast<unsigned>(UINT8_C(1));
+          if(sig128Z.v0 != static_cast<std::uint64_t>(UINT8_C(0)))
+          {
+            sigZ = static_cast<std::uint64_t>(sigZ | static_cast<std::uint_fast8_t>(UINT8_C(1)));
+          }
+
+          result = softfloat_roundPackToF64<Mode>(signZ, expZ, sigZ);
+        }
       }
 
-      const auto sigma0 =
-        static_cast<std::uint32_t>
-        (
-          ~static_cast<std::uint32_t>
-           (
-             static_cast<std::uint64_t>(ESqrR0 * static_cast<std::uint64_t>(a)) >> static_cast<unsigned>(UINT8_C(23))
-           )
-        );
+      return result;
+    }
 
-      auto r =
-        static_cast<std::uint32_t>
-        (
-            static_cast<std::uint32_t>(static_cast<std::uint32_t>(r0) << static_cast<unsigned>(UINT8_C(16)))
-          + static_cast<std::uint32_t>(static_cast<std::uint64_t>(r0 * static_cast<std::uint64_t>(sigma0)) >> static_cast<unsigned>(UINT8_C(25)))
-        );
+    static constexpr auto softfloat_normSubnormalF64Sig(std::int16_t& expA, std::uint64_t& sig) -> void
+    {
+      // Normalizes the subnormal significand sig, setting expA such that
+      // the value represented is unchanged.
 
-      r +=
-        static_cast<std::uint32_t>
+      const auto shiftDist =
+        static_cast<std::int_fast8_t>
         (
-          static_cast<std::uint64_t>
-          (
-              static_cast<std::uint32_t>
-              (
-                  static_cast<std::uint32_t>
-                  (
-                    static_cast<std::uint64_t>(r >> static_cast<unsigned>(UINT8_C(1))) + static_cast<std::uint32_t>(r >> static_cast<unsigned>(UINT8_C(3)))
-                  )
-                - static_cast<std::uint32_t>
-                  (
-                    static_cast<std::uint32_t>(r0) << static_cast<unsigned>(UINT8_C(14))
-                  )
-              )
-            *
-              static_cast<std::uint64_t>
-              (
-                static_cast<std::uint32_t>
-                (
-                  static_cast<std::uint64_t>(static_cast<std::uint64_t>(sigma0) * sigma0) >> static_cast<unsigned>(UINT8_C(32))
-                )
-              )
-          ) >> static_cast<unsigned>(UINT8_C(48))
+            static_cast<std::int_fast8_t>(detail::softfloat_countLeadingZeros64(sig))
+          - static_cast<std::int_fast8_t>(INT8_C(11))
         );
 
-      if(static_cast<std::uint32_t>(r & static_cast<std::uint32_t>(UINT32_C(0x80000000))) == static_cast<std::uint32_t>(UINT8_C(0)))
-      {
-        r = static_cast<std::uint32_t>(UINT32_C(0x80000000));
-      }
-
-      return r;
+      expA = static_cast<std::int16_t>(static_cast<std::int16_t>(INT8_C(1)) - static_cast<std::int16_t>(shiftDist));
+      sig  = static_cast<std::uint64_t>(sig << static_cast<unsigned>(shiftDist));
     }
 
+    template<detail::round_mode Mode = detail::round_mode::near_even>
     static constexpr auto softfloat_normRoundPackToF64(bool sign, std::int16_t expA, std::uint64_t sig) -> std::uint64_t
     {
       auto result = std::uint64_t { };
@@ -1798,72 +7752,97 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
           - static_cast<std::int16_t>(shiftDist)
         );
 
-      if(   (shiftDist >= static_cast<std::int_fast8_t>(INT8_C(10)))
-         && (static_cast<std::uint_fast16_t>(expA) < static_cast<std::uint_fast16_t>(UINT16_C(0x7FD))))
+      if(   (shiftDist >= static_cast<std::int_fast8_t>(INT8_C(10)))
+         && (static_cast<std::uint_fast16_t>(expA) < static_cast<std::uint_fast16_t>(UINT16_C(0x7FD))))
+      {
+        result =
+          detail::packToF64UI
+          (
+            sign,
+            static_cast<std::int16_t>(sig != static_cast<std::uint64_t>(UINT8_C(0)) ? expA : static_cast<std::int16_t>(INT8_C(0))),
+            static_cast<std::uint64_t>(sig << static_cast<unsigned>(shiftDist - static_cast<std::int_fast8_t>(INT8_C(10))))
+          );
+      }
+      else
+      {
+        const auto safeShiftDist =
+          static_cast<std::uint_fast8_t>
+          (
+            detail::my_max(static_cast<std::int_fast8_t>(INT8_C(0)), shiftDist)
+          );
+
+        result = softfloat_roundPackToF64<Mode>(sign, expA, static_cast<std::uint64_t>(sig << static_cast<unsigned>(safeShiftDist)));
+      }
+
+      return result;
+    }
+
+    template<detail::round_mode Mode = detail::round_mode::near_even>
+    static constexpr auto softfloat_roundPackToF64(bool sign, std::int16_t expA, std::uint64_t sig) -> std::uint64_t
+    {
+      // The significand has its leading bit at bit 62 and ten rounding bits.
+      // The rounding increment follows the mode, which is fixed at compile
+      // time so that each instantiation has the branches of its mode only.
+
+      const auto roundIncrement = detail::round_increment<Mode>(sign, static_cast<std::uint16_t>(UINT16_C(0x200)));
+
+      auto result = std::uint64_t { };
+
+      auto is_overflow = false;
+
+      if(static_cast<std::uint16_t>(expA) >= static_cast<std::uint16_t>(UINT16_C(0x7FD)))
+      {
+        if(expA < static_cast<std::int16_t>(INT16_C(0)))
+        {
+          sig  = detail::softfloat_shiftRightJam64(sig, static_cast<std::uint_fast16_t>(-expA)); // LCOV_EXCL_LINE
+          expA = static_cast<std::int16_t>(INT8_C(0));
+        }
+        else
+        {
+          is_overflow =
+            (
+                 (expA > static_cast<std::int16_t>(INT16_C(0x7FD)))
+              || (static_cast<std::uint64_t>(sig + roundIncrement) >= static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)))
+            );
+        }
+      }
+
+      if(is_overflow)
       {
+        // Overflow gives infinity, or the largest finite value
+        // when the mode rounds toward zero from this side.
         result =
-          detail::packToF64UI
+          static_cast<std::uint64_t>
           (
-            sign,
-            static_cast<std::int16_t>(sig != static_cast<std::uint64_t>(UINT8_C(0)) ? expA : static_cast<std::int16_t>(INT8_C(0))),
-            static_cast<std::uint64_t>(sig << static_cast<unsigned>(shiftDist - static_cast<std::int_fast8_t>(INT8_C(10))))
+              detail::packToF64UI(sign, static_cast<std::int16_t>(INT16_C(0x7FF)), static_cast<std::uint64_t>(UINT8_C(0)))
+            - static_cast<std::uint64_t>((roundIncrement == static_cast<std::uint16_t>(UINT8_C(0))) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))
           );
       }
       else
       {
-        const auto safeShiftDist =
-          static_cast<std::uint_fast8_t>
-          (
-            detail::my_max(static_cast<std::int_fast8_t>(INT8_C(0)), shiftDist)
-          );
+        const auto roundBits = static_cast<std::uint16_t>(sig & static_cast<std::uint64_t>(UINT16_C(0x3FF)));
 
-        result = softfloat_roundPackToF64(sign, expA, static_cast<std::uint64_t>(sig << static_cast<unsigned>(safeShiftDist)));
-      }
-
-      return result;
-    }
+        sig = static_cast<std::uint64_t>(static_cast<std::uint64_t>(sig + roundIncrement) >> static_cast<unsigned>(UINT8_C(10)));
 
-    static constexpr auto softfloat_roundPackToF64(bool sign, std::int16_t expA, std::uint64_t sig) -> std::uint64_t
-    {
-      if(expA < static_cast<std::int16_t>(INT16_C(0)))
-      {
-        const auto expA_as_unsigned = static_cast<std::uint16_t>(expA);
+        if(   (Mode == detail::round_mode::near_even)
+           && (roundBits == static_cast<std::uint16_t>(UINT16_C(0x200))))
+        {
+          // Ties go to even.
+          sig = static_cast<std::uint64_t>(sig & static_cast<std::uint64_t>(~static_cast<std::uint64_t>(UINT8_C(1))));
+        }
 
-        if(expA_as_unsigned >= static_cast<std::uint16_t>(UINT16_C(0x7FD)))
+        if(sig == static_cast<std::uint64_t>(UINT8_C(0)))
         {
-          sig  = detail::softfloat_shiftRightJam64(sig, static_cast<std::uint_fast16_t>(-expA)); // LCOV_EXCL_LINE
           expA = static_cast<std::int16_t>(INT8_C(0));
         }
-      }
-
-      const auto roundBits = static_cast<std::uint16_t>(sig & static_cast<std::uint64_t>(UINT16_C(0x3FF)));
-
-      sig =
-        static_cast<std::uint64_t>
-        (
-            static_cast<std::uint64_t>
-            (
-              static_cast<std::uint64_t>(sig + static_cast<std::uint16_t>(UINT16_C(0x200))) >> static_cast<unsigned>(UINT8_C(10))
-            )
-          & static_cast<std::uint64_t>
-            (
-              ~static_cast<std::uint64_t>
-               (
-                 (static_cast<std::uint16_t>(roundBits ^ static_cast<std::uint16_t>(UINT16_C(0x200))) == static_cast<std::uint16_t>(UINT8_C(0)))
-                   ? static_cast<unsigned>(UINT8_C(1))
-                   : static_cast<unsigned>(UINT8_C(0))
-               )
-            )
-        );
 
-      if(sig == static_cast<std::uint64_t>(UINT8_C(0)))
-      {
-        expA = static_cast<std::int16_t>(INT8_C(0));
+        result = detail::packToF64UI(sign, expA, sig);
       }
 
-      return detail::packToF64UI(sign, expA, sig);
+      return result;
     }
 
+    template<detail::round_mode Mode = detail::round_mode::near_even>
     static constexpr auto softfloat_subMagsF64(std::uint64_t uiA, std::uint64_t uiB, bool signZ) -> std::uint64_t
     {
       auto uiZ  = std::uint64_t { };
@@ -1883,7 +7862,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
         if(sigDiff == static_cast<std::int64_t>(INT8_C(0)))
         {
-          uiZ = detail::packToF64UI(false, static_cast<int>(INT8_C(0)), static_cast<int>(INT8_C(0)));
+          // An exact zero difference is negative only when rounding downward.
+          uiZ = detail::packToF64UI((Mode == detail::round_mode::min), static_cast<int>(INT8_C(0)), static_cast<int>(INT8_C(0)));
         }
         else
         {
@@ -1990,44 +7970,247 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
             );
         }
 
-        uiZ = softfloat_normRoundPackToF64(signZ, static_cast<std::int16_t>(expZ - static_cast<std::int16_t>(INT8_C(1))), sigZ);
+        uiZ = softfloat_normRoundPackToF64<Mode>(signZ, static_cast<std::int16_t>(expZ - static_cast<std::int16_t>(INT8_C(1))), sigZ);
       }
 
       return uiZ;
     }
 
+    // Character conversion as std::to_chars, without using native double.
+    // Without a precision, the shortest representation is written that
+    // converts back to x. With a precision, the digits are exact and
+    // rounded to nearest as by printf. Nothing is allocated, and on
+    // success, the characters are not terminated.
+
+    friend constexpr auto to_chars(char* first, char* last, soft_double x) -> to_chars_result
+    {
+      return detail::chars_convert(first, last, x.my_value, chars_format::general, static_cast<std::int32_t>(INT8_C(-1)), true, detail::chars_style { });
+    }
+
+    friend constexpr auto to_chars(char* first, char* last, soft_double x, chars_format fmt) -> to_chars_result
+    {
+      return detail::chars_convert(first, last, x.my_value, fmt, static_cast<std::int32_t>(INT8_C(-1)), false, detail::chars_style { });
+    }
+
+    friend constexpr auto to_chars(char* first, char* last, soft_double x, chars_format fmt, int precision) -> to_chars_result
+    {
+      // A negative precision is taken as 6, as in printf.
+      return
+        detail::chars_convert
+        (
+          first,
+          last,
+          x.my_value,
+          fmt,
+          ((precision < 0) ? static_cast<std::int32_t>(INT8_C(6)) : static_cast<std::int32_t>(precision)),
+          false,
+          detail::chars_style { }
+        );
+    }
+
+    // Character parsing as std::from_chars, without using native double.
+    // The value is rounded to nearest, also for any number of digits,
+    // and nothing is allocated. A plus sign and leading white space are
+    // not accepted. If the value is out of range, x is not modified.
+
+    friend constexpr auto from_chars(const char* first, const char* last, soft_double& x) -> from_chars_result
+    {
+      return from_chars(first, last, x, chars_format::general);
+    }
+
+    friend constexpr auto from_chars(const char* first, const char* last, soft_double& x, chars_format fmt) -> from_chars_result
+    {
+      const auto res = detail::chars_parse(first, last, fmt);
+
+      if(res.ec == chars_errc { })
+      {
+        x.my_value = res.bits;
+      }
+
+      return from_chars_result { res.ptr, res.ec };
+    }
+
     #if !defined(SOFT_DOUBLE_DISABLE_IOSTREAM)
     template<typename char_type, typename traits_type>
     friend auto operator<<(std::basic_ostream<char_type, traits_type>& os, const soft_double& f) -> std::basic_ostream<char_type, traits_type>&
     {
-      // Note that this output stream function relies on
-      // the availability of 64-bit native double.
+      // The stream flags are mapped to the formats of printf, as done
+      // by std::num_put. The characters are made with to_chars, so that
+      // native double is not needed. The decimal point is taken from the
+      // locale, and the width is applied when inserting the string.
+
+      const auto flags = os.flags();
 
-      auto ostr = std::basic_ostringstream<char_type, traits_type> { };
+      const auto field = static_cast<std::ios_base::fmtflags>(flags & std::ios_base::floatfield);
 
-      // Copy all ostream settings from out to local ostr.
-      ostr.flags(os.flags());
-      ostr.imbue(os.getloc());
-      ostr.precision(os.precision());
+      const auto is_hex = (field == static_cast<std::ios_base::fmtflags>(std::ios_base::fixed | std::ios_base::scientific));
 
-      static_cast<void>(ostr << static_cast<double>(f));
+      const auto fmt =
+        (is_hex ? chars_format::hex
+                : ((field == std::ios_base::fixed) ? chars_format::fixed
+                                                   : ((field == std::ios_base::scientific) ? chars_format::scientific
+                                                                                           : chars_format::general)));
 
-      return (os << ostr.str());
+      // The hexadecimal format ignores the precision, as %a does.
+      const auto precision =
+        static_cast<std::int32_t>
+        (
+          is_hex ? static_cast<std::int32_t>(INT8_C(-1))
+                 : ((os.precision() < static_cast<std::streamsize>(0)) ? static_cast<std::int32_t>(INT8_C(6)) : static_cast<std::int32_t>(os.precision()))
+        );
+
+      // The flag uppercase has no effect on %f.
+      const auto style =
+        detail::chars_style
+        {
+          ((fmt != chars_format::fixed) && ((flags & std::ios_base::uppercase) != static_cast<std::ios_base::fmtflags>(0))),
+          ((flags & std::ios_base::showpos)   != static_cast<std::ios_base::fmtflags>(0)),
+          ((flags & std::ios_base::showpoint) != static_cast<std::ios_base::fmtflags>(0)),
+          true
+        };
+
+      using local_string_type = std::basic_string<char_type, traits_type>;
+
+      auto str = local_string_type { };
+
+      const auto& facet_ctype    = std::use_facet<std::ctype<char_type>>(os.getloc());
+      const auto  decimal_point  = std::use_facet<std::numpunct<char_type>>(os.getloc()).decimal_point();
+
+      const auto widen_into_str =
+        [&str, &facet_ctype, &decimal_point](const char* first, const char* last)
+        {
+          str.reserve(static_cast<typename local_string_type::size_type>(last - first));
+
+          for( ; first != last; ++first)
+          {
+            str.push_back((*first == '.') ? decimal_point : facet_ctype.widen(*first));
+          }
+        };
+
+      std::array<char, static_cast<std::size_t>(UINT8_C(64))> buf { };
+
+      const auto res = detail::chars_convert(buf.data(), buf.data() + buf.size(), f.my_value, fmt, precision, false, style);
+
+      if(res.ec == chars_errc { })
+      {
+        widen_into_str(buf.data(), res.ptr);
+      }
+      else
+      {
+        // Large precisions need more room, with at most 309 integer digits.
+        std::string big(static_cast<std::string::size_type>(static_cast<std::string::size_type>(precision) + 340U), '\0');
+
+        const auto res_big = detail::chars_convert(&big[0U], &big[0U] + big.size(), f.my_value, fmt, precision, false, style);
+
+        widen_into_str(&big[0U], res_big.ptr);
+      }
+
+      return (os << str);
     }
 
     template<typename char_type, typename traits_type>
     friend auto operator>>(std::basic_istream<char_type, traits_type>& is, soft_double& f) -> std::basic_istream<char_type, traits_type>&
     {
-      // Note that this input stream function relies on
-      // the availability of 64-bit native double.
+      // The characters of a number are collected as done by std::num_get
+      // and converted with from_chars, so that native double is not needed.
+      // On failure, the value is zero. On overflow, it is the largest
+      // finite value with the sign, and in both cases failbit is set.
+
+      const typename std::basic_istream<char_type, traits_type>::sentry sentry_of_is(is);
+
+      if(sentry_of_is)
+      {
+        const auto& facet_ctype   = std::use_facet<std::ctype<char_type>>(is.getloc());
+        const auto  decimal_point = std::use_facet<std::numpunct<char_type>>(is.getloc()).decimal_point();
+
+        auto str = std::string { };
+
+        auto has_point    = false;
+        auto has_digit    = false;
+        auto has_exponent = false;
+
+        auto* sb = is.rdbuf();
+
+        auto c = sb->sgetc();
+
+        auto accept = true;
+
+        while(accept && (!traits_type::eq_int_type(c, traits_type::eof())))
+        {
+          const auto ch = traits_type::to_char_type(c);
+
+          const auto n = (traits_type::eq(ch, decimal_point) ? '.' : facet_ctype.narrow(ch, '\0'));
+
+          const auto last_is_e = ((!str.empty()) && ((str.back() == 'e') || (str.back() == 'E')));
+
+          if(detail::chars_is_digit(n))
+          {
+            has_digit = (has_digit || (!has_exponent));
+          }
+          else if((n == '+') || (n == '-'))
+          {
+            accept = (str.empty() || last_is_e);
+          }
+          else if(n == '.')
+          {
+            accept = ((!has_point) && (!has_exponent));
+
+            has_point = true;
+          }
+          else if((n == 'e') || (n == 'E'))
+          {
+            accept = (has_digit && (!has_exponent));
+
+            has_exponent = true;
+          }
+          else
+          {
+            accept = false;
+          }
+
+          if(accept)
+          {
+            str.push_back(n);
+
+            c = sb->snextc();
+          }
+        }
+
+        auto err = std::ios_base::goodbit;
+
+        if(traits_type::eq_int_type(c, traits_type::eof()))
+        {
+          err |= std::ios_base::eofbit;
+        }
+
+        // The parser does not take a plus sign.
+        const auto skip = ((!str.empty()) && (str.front() == '+')) ? static_cast<std::size_t>(UINT8_C(1)) : static_cast<std::size_t>(UINT8_C(0));
+
+        const auto first = str.data() + skip;
+        const auto last  = str.data() + str.size();
+
+        const auto res = detail::chars_parse(first, last, chars_format::general);
 
-      auto v = double { };
+        if((res.ec == chars_errc::invalid_argument) || (res.ptr != last))
+        {
+          f = soft_double { static_cast<std::uint64_t>(UINT8_C(0)), detail::nothing { } };
+
+          err |= std::ios_base::failbit;
+        }
+        else if((res.ec == chars_errc::result_out_of_range) && (detail::expF64UI(res.bits) != static_cast<std::int16_t>(INT8_C(0))))
+        {
+          f = (detail::signF64UI(res.bits) ? my_value_lowest() : my_value_max());
 
-      // Receive a floating-point number from the input stream.
-      static_cast<void>(is >> v);
+          err |= std::ios_base::failbit;
+        }
+        else
+        {
+          // This includes underflow to zero, which is no failure in num_get.
+          f = soft_double { res.bits, detail::nothing { } };
+        }
 
-      // Subsequently make a fixed-point object from it.
-      f = v;
+        is.setstate(err);
+      }
 
       return is;
     }
@@ -2042,13 +8225,49 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
     friend constexpr auto fmod(soft_double v1, soft_double v2) -> soft_double // NOLINT(performance-unnecessary-value-param)
     {
-      const auto n_mod = ((v1 < static_cast<int>(INT8_C(0))) ? ceil(v1 / v2) : floor(v1 / v2));
+      auto quo = std::uint32_t { };
 
-      return v1 - (n_mod * v2);
+      return soft_double { f64_rem(v1.my_value, v2.my_value, detail::round_mode::min_mag, quo), detail::nothing{} };
     }
 
     friend constexpr auto sqrt(soft_double x) -> soft_double { return soft_double { f64_sqrt(x.my_value), detail::nothing{} }; } // NOLINT(performance-unnecessary-value-param)
 
+    friend constexpr auto fma(soft_double x, soft_double y, soft_double z) -> soft_double { return soft_double { f64_mulAdd(x.my_value, y.my_value, z.my_value), detail::nothing{} }; } // NOLINT(performance-unnecessary-value-param)
+
+    friend constexpr auto two_sum(soft_double x, soft_double y, soft_double* err) -> soft_double // NOLINT(performance-unnecessary-value-param)
+    {
+      // Error-free sum: returns x + y rounded and stores
+      // the exact remainder (x + y) - result in *err.
+
+      auto err_value = std::uint64_t { };
+
+      const auto result = f64_add_exact(x.my_value, y.my_value, err_value);
+
+      if(err != nullptr)
+      {
+        *err = soft_double { err_value, detail::nothing{} };
+      }
+
+      return soft_double { result, detail::nothing{} };
+    }
+
+    friend constexpr auto two_prod(soft_double x, soft_double y, soft_double* err) -> soft_double // NOLINT(performance-unnecessary-value-param)
+    {
+      // Error-free product: returns x * y rounded and stores
+      // the exact remainder (x * y) - result in *err.
+
+      auto err_value = std::uint64_t { };
+
+      const auto result = f64_mul_exact(x.my_value, y.my_value, err_value);
+
+      if(err != nullptr)
+      {
+        *err = soft_double { err_value, detail::nothing{} };
+      }
+
+      return soft_double { result, detail::nothing{} };
+    }
+
     friend constexpr auto frexp(soft_double x, int* expptr) -> soft_double // NOLINT(performance-unnecessary-value-param)
     {
       const auto expA =
@@ -2099,10 +8318,27 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
         };
     }
 
-    friend constexpr auto floor(soft_double x) -> soft_double;
-    friend constexpr auto ceil (soft_double x) -> soft_double;
+    friend constexpr auto floor    (soft_double x) -> soft_double;
+    friend constexpr auto ceil     (soft_double x) -> soft_double;
+    friend constexpr auto trunc    (soft_double x) -> soft_double;
+    friend constexpr auto round    (soft_double x) -> soft_double;
+    friend constexpr auto lround   (soft_double x) -> long; // NOLINT(google-runtime-int)
+    friend constexpr auto nearbyint(soft_double x) -> soft_double;
+    friend constexpr auto modf     (soft_double x, soft_double* iptr) -> soft_double;
+    friend constexpr auto remainder(soft_double v1, soft_double v2) -> soft_double;
+    friend constexpr auto remquo   (soft_double v1, soft_double v2, int* quo) -> soft_double;
     friend constexpr auto exp  (soft_double x) -> soft_double;
     friend constexpr auto log  (soft_double x) -> soft_double;
+    friend constexpr auto exp2 (soft_double x) -> soft_double;
+    friend constexpr auto log2 (soft_double x) -> soft_double;
+    friend constexpr auto log10(soft_double x) -> soft_double;
+    friend constexpr auto expm1(soft_double x) -> soft_double;
+    friend constexpr auto log1p(soft_double x) -> soft_double;
+    friend constexpr auto sinh (soft_double x) -> soft_double;
+    friend constexpr auto cosh (soft_double x) -> soft_double;
+    friend constexpr auto cbrt (soft_double x) -> soft_double;
+    friend constexpr auto hypot(soft_double x, soft_double y) -> soft_double;
+    friend constexpr auto pow  (soft_double x, soft_double a) -> soft_double;
 
     template<typename UnsignedIntegralType,
              typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
@@ -2180,6 +8416,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     friend constexpr auto cos(soft_double x) -> soft_double;
     friend constexpr auto tan(soft_double x) -> soft_double;
 
+    friend constexpr auto atan2(soft_double y, soft_double x) -> soft_double;
+
+    friend constexpr auto sincos(soft_double x, soft_double* s, soft_double* c) -> void;
+
     friend constexpr auto operator+(const soft_double& a, const soft_double& b) -> soft_double;
     friend constexpr auto operator-(const soft_double& a, const soft_double& b) -> soft_double;
     friend constexpr auto operator*(const soft_double& a, const soft_double& b) -> soft_double;
@@ -2262,6 +8502,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     friend constexpr auto operator==(long double f, const soft_double& a) -> bool;
   };
 
+  // A soft_double is nothing but its representation. It is trivially
+  // copyable and standard-layout, so that arrays of it may be copied,
+  // written and mapped from files bytewise. (The minimal libraries of
+  // some small targets lack the type traits needed to check it.)
+  #if !defined(__AVR__)
+  static_assert(std::is_trivially_copyable<soft_double>::value, "Error: soft_double must be trivially copyable");
+  static_assert(std::is_standard_layout<soft_double>::value, "Error: soft_double must be standard-layout");
+  #endif
+  static_assert(sizeof(soft_double) == sizeof(soft_double::representation_type), "Error: soft_double must have the size of its representation");
+
   constexpr auto operator+(const soft_double& a, const soft_double& b) -> soft_double { return soft_double { soft_double::f64_add(a.my_value, b.my_value), detail::nothing{} }; }
   constexpr auto operator-(const soft_double& a, const soft_double& b) -> soft_double { return soft_double { soft_double::f64_sub(a.my_value, b.my_value), detail::nothing{} }; }
   constexpr auto operator*(const soft_double& a, const soft_double& b) -> soft_double { return soft_double { soft_double::f64_mul(a.my_value, b.my_value), detail::nothing{} }; }
@@ -2348,72 +8598,6 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
   namespace detail {
 
-  constexpr auto sin_pade(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
-  {
-    // PadeApproximant[Sin[x], {x, 0, {7,7}}]
-    // FullSimplify[%]
-
-    //    x (11511339840 - 1640635920 x^2 + 52785432 x^4 - 479249 x^6)
-    // / (7 ( 1644477120  +  39702960 x^2 +   453960 x^4 +   2623 x^6))
-
-    const soft_double coef_sin_top_0(static_cast<std::uint64_t>(UINT64_C(+11511339840)));
-    const soft_double coef_sin_top_1(static_cast<std::int32_t> (INT32_C (-1640635920)));
-    const soft_double coef_sin_top_2(static_cast<std::uint32_t>(UINT32_C(+52785432)));
-    const soft_double coef_sin_top_3(static_cast<std::int32_t> (INT32_C (-479249)));
-
-    const soft_double coef_sin_bot_0(static_cast<std::uint32_t>(UINT32_C(+1644477120)));
-    const soft_double coef_sin_bot_1(static_cast<std::uint32_t>(UINT32_C(+39702960)));
-    const soft_double coef_sin_bot_2(static_cast<std::uint32_t>(UINT32_C(+453960)));
-    const soft_double coef_sin_bot_3(static_cast<std::uint16_t>(UINT16_C(+2623)));
-
-    const soft_double x2(x * x);
-
-    const soft_double top = ((((     + coef_sin_top_3)
-                                * x2 + coef_sin_top_2)
-                                * x2 + coef_sin_top_1)
-                                * x2 + coef_sin_top_0);
-
-    const soft_double bot = ((((     + coef_sin_bot_3)
-                                * x2 + coef_sin_bot_2)
-                                * x2 + coef_sin_bot_1)
-                                * x2 + coef_sin_bot_0);
-
-    return (x * top) / (bot * static_cast<int>(INT8_C(7)));
-  }
-
-  constexpr auto cos_pade(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
-  {
-    // PadeApproximant[Cos[x] - 1, {x, 0, {8,6}}]
-    // FullSimplify[%]
-
-    //   (x^2 (-5491886400 + 346666320 x^2 - 7038360 x^4 + 45469 x^6))
-    // / (24  (  457657200 +   9249240 x^2 +   86030 x^4 +   389 x^6))
-
-    const soft_double coef_cos_top_0(static_cast<std::int64_t> (INT64_C (-5491886400)));
-    const soft_double coef_cos_top_1(static_cast<std::uint32_t>(UINT32_C(+346666320)));
-    const soft_double coef_cos_top_2(static_cast<std::int32_t> (INT32_C (-7038360)));
-    const soft_double coef_cos_top_3(static_cast<std::uint16_t>(UINT16_C(+45469)));
-
-    const soft_double coef_cos_bot_0(static_cast<std::uint32_t>(UINT32_C(457657200)));
-    const soft_double coef_cos_bot_1(static_cast<std::uint32_t>(UINT32_C(9249240)));
-    const soft_double coef_cos_bot_2(static_cast<std::uint32_t>(UINT32_C(86030)));
-    const soft_double coef_cos_bot_3(static_cast<std::uint16_t>(UINT16_C(389)));
-
-    const soft_double x2(x * x);
-
-    const soft_double top = ((((     + coef_cos_top_3)
-                                * x2 + coef_cos_top_2)
-                                * x2 + coef_cos_top_1)
-                                * x2 + coef_cos_top_0);
-
-    const soft_double bot = ((((     + coef_cos_bot_3)
-                                * x2 + coef_cos_bot_2)
-                                * x2 + coef_cos_bot_1)
-                                * x2 + coef_cos_bot_0);
-
-    return soft_double::my_value_one() + ((x2 * top) / (bot * static_cast<int>(INT8_C(24))));
-  }
-
   constexpr auto asin_pade(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
   {
     // Usa a Pade approximation of (asin(x) / x).
@@ -2431,276 +8615,106 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     // -388690947968573359
     //  402271633106633823
     // -190922593544635779
-    //  40839234741969911
-    // -3218334247465525
-    //  45053024618672
-
-    // Denominator:
-    //  140095773199074572
-    // -412040243501752455
-    //  460437824033661973
-    // -243013488210192408
-    //  60946917703998365
-    // -6321063389564933
-    //  174545740275468
-
-    const auto x2 = x * x;
-
-    const soft_double top = (((((((     + INT64_C(45053024618672))
-                                   * x2 - INT64_C(3218334247465525))
-                                   * x2 + INT64_C(40839234741969911))
-                                   * x2 - INT64_C(190922593544635779))
-                                   * x2 + INT64_C(402271633106633823))
-                                   * x2 - INT64_C(388690947968573359))
-                                   * x2 + INT64_C(140095773199074572));
-
-    const soft_double bot = (((((((     + INT64_C(174545740275468))
-                                   * x2 - INT64_C(6321063389564933))
-                                   * x2 + INT64_C(60946917703998365))
-                                   * x2 - INT64_C(243013488210192408))
-                                   * x2 + INT64_C(460437824033661973))
-                                   * x2 - INT64_C(412040243501752455))
-                                   * x2 + INT64_C(140095773199074572));
-
-    return (x * top) / bot;
-  }
-
-  constexpr auto atan_pade(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
-  {
-    // Usa a Pade approximation of atan(x).
-    // Then simplify, extract the coefficients of numerator and denominator.
-
-    // PadeApproximant[ArcTan[x], {x, 0, {10, 10}}]
-    // FullSimplify[%]
-    // CoefficientList[Numerator[Out[2]] / (11 x), x^2]
-    // CoefficientList[Denominator[Out[2]], x^2]
-
-    // Numerator:
-    //  (11 * x) times:
-    //  1322685, 2691780, 1800162, 437580, 27985
-
-    // Denominator:
-    //   14549535, 34459425, 28378350, 9459450, 1091475, 19845
-
-    const auto x2 = x * x;
-
-    const soft_double top = (((((     + UINT32_C(27985))
-                                 * x2 + UINT32_C(437580))
-                                 * x2 + UINT32_C(1800162))
-                                 * x2 + UINT32_C(2691780))
-                                 * x2 + UINT32_C(1322685));
-
-    const soft_double bot = ((((((     + UINT32_C(19845))
-                                  * x2 + UINT32_C(1091475))
-                                  * x2 + UINT32_C(9459450))
-                                  * x2 + UINT32_C(28378350))
-                                  * x2 + UINT32_C(34459425))
-                                  * x2 + UINT32_C(14549535));
-
-    return ((x * static_cast<int>(INT8_C(11))) * top) / bot;
-  }
-
-  } // namespace detail
-
-  constexpr auto sin(soft_double x) -> soft_double // NOLINT(misc-no-recursion)
-  {
-    auto s = soft_double { };
-
-    if(x < static_cast<int>(INT8_C(0)))
-    {
-      s = -sin(-x);
-    }
-    else if(x > static_cast<int>(INT8_C(0)))
-    {
-      // Remove even multiples of pi.
-
-      auto b_negate_sin = false;
-
-      const auto n_pi = static_cast<std::uint32_t>(x / soft_double::my_value_pi());
-
-      if(n_pi != static_cast<std::uint32_t>(UINT8_C(0)))
-      {
-        x -= (soft_double::my_value_pi() * n_pi);
-
-        if(static_cast<std::uint_fast8_t>(n_pi % static_cast<std::uint_fast8_t>(UINT8_C(2))) != static_cast<std::uint_fast8_t>(UINT8_C(0)))
-        {
-          b_negate_sin = (!b_negate_sin);
-        }
-      }
-
-      // Check if the reduced argument is very close to pi/2.
-      const soft_double delta_pi_half  = soft_double::my_value_pi_half() - x;
-      const bool        b_near_pi_half = (fabs(delta_pi_half) < soft_double(static_cast<std::uint64_t>(UINT64_C(0x3FE0C152382D7366)), detail::nothing{}));
-
-      if(b_near_pi_half)
-      {
-        // PadeApproximant[Hypergeometric0F1[1/2, -(dx^2)/4], {dx, 0, {6, 6}}]
-        // FullSimplify[%]
-        //   (39251520 - 18471600 dx^2 + 1075032 dx^4 - 14615 dx^6)
-        // / (39251520 +  1154160 dx^2 +   16632 dx^4 +   127 dx^6)
-
-        const soft_double coef_top_0(static_cast<std::uint32_t>(UINT32_C(+39251520)));
-        const soft_double coef_top_1(static_cast<std::int32_t> (INT32_C (-18471600)));
-        const soft_double coef_top_2(static_cast<std::uint32_t>(UINT32_C(+1075032)));
-        const soft_double coef_top_3(static_cast<std::int16_t> (INT16_C (-14615)));
-
-        const soft_double coef_bot_0(static_cast<std::uint32_t>(UINT32_C(39251520)));
-        const soft_double coef_bot_1(static_cast<std::uint32_t>(UINT32_C(1154160)));
-        const soft_double coef_bot_2(static_cast<std::uint16_t>(UINT16_C(16632)));
-        const soft_double coef_bot_3(static_cast<std::uint8_t> (UINT8_C (127)));
-
-        const soft_double x2(delta_pi_half * delta_pi_half);
-
-        const soft_double top = ((((     + coef_top_3)
-                                    * x2 + coef_top_2)
-                                    * x2 + coef_top_1)
-                                    * x2 + coef_top_0);
-
-        const soft_double bot = ((((     + coef_bot_3)
-                                    * x2 + coef_bot_2)
-                                    * x2 + coef_bot_1)
-                                    * x2 + coef_bot_0);
-
-        s = top / bot;
-      }
-      else
-      {
-        // Reduce the argument to 0 <= x <= pi/2.
-        if(x > soft_double::my_value_pi_half())
-        {
-          x = soft_double::my_value_pi() - x;
-        }
+    //  40839234741969911
+    // -3218334247465525
+    //  45053024618672
 
-        if(x > soft_double(static_cast<std::uint64_t>(UINT64_C(0x3FE0C152382D7366)), detail::nothing{}))
-        {
-          // x is larger than pi/6, scale by 9.
-          x /= static_cast<unsigned>(UINT8_C(9));
+    // Denominator:
+    //  140095773199074572
+    // -412040243501752455
+    //  460437824033661973
+    // -243013488210192408
+    //  60946917703998365
+    // -6321063389564933
+    //  174545740275468
 
-          s = detail::sin_pade(x);
+    const auto x2 = x * x;
 
-          s = (s * static_cast<unsigned>(UINT8_C(3))) - (((s * s) * s) * static_cast<unsigned>(UINT8_C(4)));
-          s = (s * static_cast<unsigned>(UINT8_C(3))) - (((s * s) * s) * static_cast<unsigned>(UINT8_C(4)));
-        }
-        else if(x > soft_double(static_cast<std::uint64_t>(UINT64_C(0x3FC657184AE74487)), detail::nothing{}))
-        {
-          // x is larger than pi/18, scale by 3.
-          x /= static_cast<unsigned>(UINT8_C(3));
+    auto top = soft_double(INT64_C(45053024618672));
 
-          s = detail::sin_pade(x);
+    top = fma(top, x2, soft_double(INT64_C(-3218334247465525)));
+    top = fma(top, x2, soft_double(INT64_C(40839234741969911)));
+    top = fma(top, x2, soft_double(INT64_C(-190922593544635779)));
+    top = fma(top, x2, soft_double(INT64_C(402271633106633823)));
+    top = fma(top, x2, soft_double(INT64_C(-388690947968573359)));
+    top = fma(top, x2, soft_double(INT64_C(140095773199074572)));
 
-          s = (s * static_cast<unsigned>(UINT8_C(3))) - (((s * s) * s) * static_cast<unsigned>(UINT8_C(4)));
-        }
-        else
-        {
-          s = detail::sin_pade(x);
-        }
-      }
+    auto bot = soft_double(INT64_C(174545740275468));
 
-      if(b_negate_sin)
-      {
-        s = -s;
-      }
-    }
-    else
-    {
-      s = static_cast<int>(INT8_C(0));
-    }
+    bot = fma(bot, x2, soft_double(INT64_C(-6321063389564933)));
+    bot = fma(bot, x2, soft_double(INT64_C(60946917703998365)));
+    bot = fma(bot, x2, soft_double(INT64_C(-243013488210192408)));
+    bot = fma(bot, x2, soft_double(INT64_C(460437824033661973)));
+    bot = fma(bot, x2, soft_double(INT64_C(-412040243501752455)));
+    bot = fma(bot, x2, soft_double(INT64_C(140095773199074572)));
 
-    return s;
+    return (x * top) / bot;
   }
 
-  constexpr auto cos(soft_double x) -> soft_double // NOLINT(misc-no-recursion)
+  constexpr auto atan_pade(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
   {
-    auto c = soft_double { };
-
-    if(x < static_cast<int>(INT8_C(0)))
-    {
-      c = cos(-x);
-    }
-    else if(x > static_cast<int>(INT8_C(0)))
-    {
-      // Remove even multiples of pi.
-
-      auto b_negate_cos = false;
+    // Usa a Pade approximation of atan(x).
+    // Then simplify, extract the coefficients of numerator and denominator.
 
-      const auto n_pi = static_cast<std::uint32_t>(x / soft_double::my_value_pi());
+    // PadeApproximant[ArcTan[x], {x, 0, {10, 10}}]
+    // FullSimplify[%]
+    // CoefficientList[Numerator[Out[2]] / (11 x), x^2]
+    // CoefficientList[Denominator[Out[2]], x^2]
 
-      if(n_pi != static_cast<std::uint32_t>(UINT8_C(0)))
-      {
-        x -= (soft_double::my_value_pi() * n_pi);
+    // Numerator:
+    //  (11 * x) times:
+    //  1322685, 2691780, 1800162, 437580, 27985
 
-        if(static_cast<std::uint_fast8_t>(n_pi % static_cast<std::uint_fast8_t>(UINT8_C(2))) != static_cast<std::uint_fast8_t>(UINT8_C(0)))
-        {
-          b_negate_cos = (!b_negate_cos);
-        }
-      }
+    // Denominator:
+    //   14549535, 34459425, 28378350, 9459450, 1091475, 19845
 
-      // Check if the reduced argument is very close to pi/2.
-      const soft_double delta_pi_half  = soft_double::my_value_pi_half() - x;
-      const bool        b_near_pi_half = (fabs(delta_pi_half) < soft_double(static_cast<std::uint64_t>(UINT64_C(0x3FE0C152382D7366)), detail::nothing{}));
+    const auto x2 = x * x;
 
-      if(b_near_pi_half)
-      {
-        // PadeApproximant[Hypergeometric0F1[3/2, -(dx^2)/4], {dx, 0, {6, 6}}]
-        // FullSimplify[%]
-        //      (11511339840 - 1640635920 dx^2 + 52785432 dx^4 - 479249 dx^6)
-        // / (7 ( 1644477120 +   39702960 dx^2 +   453960 dx^4 +   2623 dx^6))
+    auto top = soft_double(UINT32_C(27985));
 
-        // This is the same approximation as the one found in detail::sin_pade().
+    top = fma(top, x2, soft_double(UINT32_C(437580)));
+    top = fma(top, x2, soft_double(UINT32_C(1800162)));
+    top = fma(top, x2, soft_double(UINT32_C(2691780)));
+    top = fma(top, x2, soft_double(UINT32_C(1322685)));
 
-        c = detail::sin_pade(delta_pi_half);
-      }
-      else
-      {
-        // Reduce the argument to 0 <= x <= pi/2.
-        if(x > soft_double::my_value_pi_half())
-        {
-          x = soft_double::my_value_pi() - x;
+    auto bot = soft_double(UINT32_C(19845));
 
-          b_negate_cos = (!b_negate_cos);
-        }
+    bot = fma(bot, x2, soft_double(UINT32_C(1091475)));
+    bot = fma(bot, x2, soft_double(UINT32_C(9459450)));
+    bot = fma(bot, x2, soft_double(UINT32_C(28378350)));
+    bot = fma(bot, x2, soft_double(UINT32_C(34459425)));
+    bot = fma(bot, x2, soft_double(UINT32_C(14549535)));
 
-        if(x > soft_double(static_cast<std::uint64_t>(UINT64_C(0x3FE0C152382D7366)), detail::nothing{}))
-        {
-          // x is larger than pi/6, scale by 9.
-          x /= static_cast<unsigned>(UINT8_C(9));
+    return ((x * static_cast<int>(INT8_C(11))) * top) / bot;
+  }
 
-          c = detail::cos_pade(x);
+  } // namespace detail
 
-          c = (((c * c) * c) * static_cast<unsigned>(UINT8_C(4))) - (c * static_cast<unsigned>(UINT8_C(3)));
-          c = (((c * c) * c) * static_cast<unsigned>(UINT8_C(4))) - (c * static_cast<unsigned>(UINT8_C(3)));
-        }
-        else if(x > soft_double(static_cast<std::uint64_t>(UINT64_C(0x3FC657184AE74487)), detail::nothing{}))
-        {
-          // x is larger than pi/18, scale by 3.
-          x /= static_cast<unsigned>(UINT8_C(3));
+  constexpr auto sin(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  {
+    return soft_double { soft_double::f64_sin(x.my_value), detail::nothing{} };
+  }
 
-          c = detail::cos_pade(x);
+  constexpr auto cos(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  {
+    return soft_double { soft_double::f64_cos(x.my_value), detail::nothing{} };
+  }
 
-          c = (((c * c) * c) * static_cast<unsigned>(UINT8_C(4))) - (c * static_cast<unsigned>(UINT8_C(3)));
-        }
-        else
-        {
-          c = detail::cos_pade(x);
-        }
-      }
+  constexpr auto sincos(soft_double x, soft_double* s, soft_double* c) -> void // NOLINT(performance-unnecessary-value-param)
+  {
+    // Compute sin(x) and cos(x) together, reducing the argument only once.
+    auto u_s = std::uint64_t { };
+    auto u_c = std::uint64_t { };
 
-      if(b_negate_cos)
-      {
-        c = -c;
-      }
-    }
-    else
-    {
-      c = soft_double::my_value_one();
-    }
+    soft_double::f64_sincos(x.my_value, u_s, u_c);
 
-    return c;
+    *s = soft_double { u_s, detail::nothing{} };
+    *c = soft_double { u_c, detail::nothing{} };
   }
 
   constexpr auto tan(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
   {
-    return sin(x) / cos(x);
+    return soft_double { soft_double::f64_tan(x.my_value), detail::nothing{} };
   }
 
   constexpr auto asin(soft_double x) -> soft_double // NOLINT(misc-no-recursion,performance-unnecessary-value-param)
@@ -2850,45 +8864,103 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     return result;
   }
 
+  constexpr auto atan2(soft_double y, soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  {
+    return soft_double { soft_double::f64_atan2(y.my_value, x.my_value), detail::nothing{} };
+  }
+
   constexpr auto floor(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
   {
-    auto result = soft_double { };
+    return soft_double { soft_double::f64_roundToInt(x.my_value, detail::round_mode::min), detail::nothing{} };
+  }
 
-    if(x < static_cast<int>(INT8_C(0)))
-    {
-      const auto xn = static_cast<std::int64_t>(x);
-      const auto fn = soft_double(xn);
+  constexpr auto ceil(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  {
+    return soft_double { soft_double::f64_roundToInt(x.my_value, detail::round_mode::max), detail::nothing{} };
+  }
 
-      const auto is_pure_integer = (fn.my_value == x.my_value);
+  constexpr auto trunc(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  {
+    return soft_double { soft_double::f64_roundToInt(x.my_value, detail::round_mode::min_mag), detail::nothing{} };
+  }
 
-      result =
-        (is_pure_integer ? fn : soft_double(static_cast<std::int64_t>(x - soft_double::my_value_one())));
-    }
-    else
-    {
-      result = soft_double(static_cast<std::int64_t>(x));
-    }
+  constexpr auto round(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  {
+    return soft_double { soft_double::f64_roundToInt(x.my_value, detail::round_mode::near_max_mag), detail::nothing{} };
+  }
 
-    return result;
+  constexpr auto lround(soft_double x) -> long // NOLINT(performance-unnecessary-value-param,google-runtime-int)
+  {
+    return static_cast<long>(soft_double::f64_to__i64(soft_double::f64_roundToInt(x.my_value, detail::round_mode::near_max_mag))); // NOLINT(google-runtime-int)
   }
 
-  constexpr auto ceil(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  constexpr auto nearbyint(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
   {
-    auto result = soft_double { };
+    // The rounding mode is always to nearest (with ties to even).
+    return soft_double { soft_double::f64_roundToInt(x.my_value, detail::round_mode::near_even), detail::nothing{} };
+  }
 
-    if(x < static_cast<int>(INT8_C(0)))
+  constexpr auto modf(soft_double x, soft_double* iptr) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  {
+    const auto expA = detail::expF64UI(x.my_value);
+
+    const auto signed_zero = soft_double { static_cast<std::uint64_t>(x.my_value & static_cast<std::uint64_t>(UINT64_C(0x8000000000000000))), detail::nothing{} };
+
+    auto int_part  = soft_double { };
+    auto frac_part = soft_double { };
+
+    if(expA < static_cast<std::int16_t>(INT16_C(0x3FF)))
     {
-      result = soft_double(static_cast<std::int64_t>(x));
+      // Here |x| < 1 (or x is zero).
+      int_part  = signed_zero;
+      frac_part = x;
+    }
+    else if(expA >= static_cast<std::int16_t>(INT16_C(0x433)))
+    {
+      // Here |x| >= 2^52 is integral, or x is infinite or NaN.
+      int_part  = x;
+      frac_part = (detail::isNaNF64UI(x.my_value) ? x : signed_zero);
     }
     else
     {
-      const auto xn = static_cast<std::int64_t>(x);
-      const auto fn = soft_double(xn);
+      int_part = soft_double { soft_double::f64_roundToInt(x.my_value, detail::round_mode::min_mag), detail::nothing{} };
 
-      const auto is_pure_integer = (fn.my_value == x.my_value);
+      // The difference is exact. A zero difference takes the sign of x.
+      const auto frac_bits = soft_double::f64_sub(x.my_value, int_part.my_value);
 
-      result =
-        (is_pure_integer ? fn : soft_double(static_cast<std::int64_t>(x + soft_double::my_value_one())));
+      frac_part =
+        ((static_cast<std::uint64_t>(frac_bits & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF))) == static_cast<std::uint64_t>(UINT8_C(0)))
+          ? signed_zero
+          : soft_double { frac_bits, detail::nothing{} });
+    }
+
+    if(iptr != nullptr)
+    {
+      *iptr = int_part;
+    }
+
+    return frac_part;
+  }
+
+  constexpr auto remainder(soft_double v1, soft_double v2) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  {
+    auto quo = std::uint32_t { };
+
+    return soft_double { soft_double::f64_rem(v1.my_value, v2.my_value, detail::round_mode::near_even, quo), detail::nothing{} };
+  }
+
+  constexpr auto remquo(soft_double v1, soft_double v2, int* quo) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  {
+    auto quo_bits = std::uint32_t { };
+
+    const auto result = soft_double { soft_double::f64_rem(v1.my_value, v2.my_value, detail::round_mode::near_even, quo_bits), detail::nothing{} };
+
+    if(quo != nullptr)
+    {
+      // Deliver the low 30 bits of the quotient, with the sign of v1 / v2.
+      const auto quo_abs = static_cast<int>(quo_bits & static_cast<std::uint32_t>(UINT32_C(0x3FFFFFFF)));
+
+      *quo = ((detail::signF64UI(v1.my_value) != detail::signF64UI(v2.my_value)) ? -quo_abs : quo_abs);
     }
 
     return result;
@@ -2896,6 +8968,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
   constexpr auto exp(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
   {
+    #if (SOFT_DOUBLE_HAS_TABLE_EXP == 1)
+    return soft_double { soft_double::f64_exp(x.my_value), detail::nothing{} };
+    #else
     // PadeApproximant[Exp[x] - 1, {x, 0, {6, 6}}]
     // FullSimplify[%]
     //   (84 x (7920 + 240 x^2 + x^4))
@@ -2906,7 +8981,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     // Scale the argument such that Exp[x] = Exp[a + n * ln2].
     auto a = x - (n * soft_double::my_value_ln2());
 
-    // Scale the argument yet again with division by 4.
+    // Scale the argument yet again with division by 4. Arguments so small
+    // that their biased exponent would not stay positive are flushed to zero.
     const auto expA = static_cast<int>(detail::expF64UI(a.my_value) - static_cast<int>(INT8_C(2)));
 
     a.my_value =
@@ -2922,15 +8998,23 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     a.my_value =
       static_cast<std::uint64_t>
       (
-          a.my_value
-        | static_cast<std::uint64_t>(static_cast<std::uint64_t>(expA) << static_cast<unsigned>(UINT8_C(52)))
+        (expA > static_cast<int>(INT8_C(0)))
+          ? static_cast<std::uint64_t>(a.my_value | static_cast<std::uint64_t>(static_cast<std::uint64_t>(expA) << static_cast<unsigned>(UINT8_C(52))))
+          : static_cast<std::uint64_t>(UINT8_C(0))
       );
 
     const auto a2 = a * a;
 
     // Use the small-argument Pade approximation having coefficients shown above.
-    const soft_double top = static_cast<std::uint_fast8_t>(UINT8_C(84)) * a * (static_cast<std::uint_fast16_t>(UINT16_C(7920)) + (static_cast<std::uint_fast8_t>(UINT8_C(240)) + a2) * a2);
-    const soft_double bot = static_cast<std::uint_fast32_t>(UINT32_C(665280)) + a * (static_cast<std::int_fast32_t>(INT32_C(-332640)) + a * (static_cast<std::uint_fast32_t>(UINT32_C(75600)) + a * (static_cast<std::int_fast16_t>(INT16_C(-10080)) + a * (static_cast<std::uint_fast16_t>(UINT16_C(840)) + (static_cast<std::int_fast8_t>(INT8_C(-42)) + a) * a))));
+    const soft_double top = static_cast<std::uint_fast8_t>(UINT8_C(84)) * a * fma(a2 + static_cast<std::uint_fast8_t>(UINT8_C(240)), a2, soft_double(static_cast<std::uint_fast16_t>(UINT16_C(7920))));
+
+    auto bot = a + static_cast<std::int_fast8_t>(INT8_C(-42));
+
+    bot = fma(bot, a, soft_double(static_cast<std::uint_fast16_t>(UINT16_C(840))));
+    bot = fma(bot, a, soft_double(static_cast<std::int_fast16_t> (INT16_C (-10080))));
+    bot = fma(bot, a, soft_double(static_cast<std::uint_fast32_t>(UINT32_C(75600))));
+    bot = fma(bot, a, soft_double(static_cast<std::int_fast32_t> (INT32_C (-332640))));
+    bot = fma(bot, a, soft_double(static_cast<std::uint_fast32_t>(UINT32_C(665280))));
 
     auto result  = soft_double::my_value_one() + (top / bot);
 
@@ -2938,10 +9022,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     result *= result;
 
     return ((n != static_cast<int>(INT8_C(0))) ? ldexp(result, n) : result);
+    #endif
   }
 
   constexpr auto log(soft_double x) -> soft_double // NOLINT(misc-no-recursion,performance-unnecessary-value-param)
   {
+    #if (SOFT_DOUBLE_HAS_TABLE_LOG == 1)
+    return soft_double { soft_double::f64_log(x.my_value), detail::nothing{} };
+    #else
     auto result = soft_double { };
 
     if(x < soft_double::my_value_one())
@@ -2996,18 +9084,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
       const auto z  = (a - static_cast<int>(INT8_C(1))) / (a + static_cast<int>(INT8_C(1)));
       const auto z2 = z * z;
 
-      const soft_double pz2 =  (((((     + soft_double(static_cast<std::uint64_t>(UINT64_C(0xC03C92E6C89EC9E1)), detail::nothing{}))
-                                    * z2 + soft_double(static_cast<std::uint64_t>(UINT64_C(0x4078BFE6581C8213)), detail::nothing{}))
-                                    * z2 + soft_double(static_cast<std::uint64_t>(UINT64_C(0xC0975FE114047504)), detail::nothing{}))
-                                    * z2 + soft_double(static_cast<std::uint64_t>(UINT64_C(0x40A0655C8A1C19C3)), detail::nothing{}))
-                                    * z2 + soft_double(static_cast<std::uint64_t>(UINT64_C(0xC08EAA3CA575191A)), detail::nothing{}));
+      auto pz2 = soft_double(static_cast<std::uint64_t>(UINT64_C(0xC03C92E6C89EC9E1)), detail::nothing{});
+
+      pz2 = fma(pz2, z2, soft_double(static_cast<std::uint64_t>(UINT64_C(0x4078BFE6581C8213)), detail::nothing{}));
+      pz2 = fma(pz2, z2, soft_double(static_cast<std::uint64_t>(UINT64_C(0xC0975FE114047504)), detail::nothing{}));
+      pz2 = fma(pz2, z2, soft_double(static_cast<std::uint64_t>(UINT64_C(0x40A0655C8A1C19C3)), detail::nothing{}));
+      pz2 = fma(pz2, z2, soft_double(static_cast<std::uint64_t>(UINT64_C(0xC08EAA3CA575191A)), detail::nothing{}));
 
-      const soft_double qz2 = ((((((     + soft_double(static_cast<std::uint64_t>(UINT64_C(0x3FF0000000000000)), detail::nothing{}))
-                                    * z2 + soft_double(static_cast<std::uint64_t>(UINT64_C(0xC047EBCAB384C2B9)), detail::nothing{}))
-                                    * z2 + soft_double(static_cast<std::uint64_t>(UINT64_C(0x40778E5238FAC622)), detail::nothing{}))
-                                    * z2 + soft_double(static_cast<std::uint64_t>(UINT64_C(0xC090789C42975D7D)), detail::nothing{}))
-                                    * z2 + soft_double(static_cast<std::uint64_t>(UINT64_C(0x4092F38C42908712)), detail::nothing{}))
-                                    * z2 + soft_double(static_cast<std::uint64_t>(UINT64_C(0xC07EAA3CA575191C)), detail::nothing{}));
+      auto qz2 = z2 + soft_double(static_cast<std::uint64_t>(UINT64_C(0xC047EBCAB384C2B9)), detail::nothing{});
+
+      qz2 = fma(qz2, z2, soft_double(static_cast<std::uint64_t>(UINT64_C(0x40778E5238FAC622)), detail::nothing{}));
+      qz2 = fma(qz2, z2, soft_double(static_cast<std::uint64_t>(UINT64_C(0xC090789C42975D7D)), detail::nothing{}));
+      qz2 = fma(qz2, z2, soft_double(static_cast<std::uint64_t>(UINT64_C(0x4092F38C42908712)), detail::nothing{}));
+      qz2 = fma(qz2, z2, soft_double(static_cast<std::uint64_t>(UINT64_C(0xC07EAA3CA575191C)), detail::nothing{}));
 
       result  = ((z * pz2) / qz2) + (n * soft_double::my_value_ln2());
     }
@@ -3017,37 +9106,267 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     }
 
     return result;
+    #endif
   }
 
   constexpr auto pow(soft_double x, soft_double a) -> soft_double // NOLINT(performance-unnecessary-value-param)
   {
-    return exp(a * log(x)); // NOLINT(performance-unnecessary-value-param)
+    return soft_double { soft_double::f64_pow(x.my_value, a.my_value), detail::nothing{} };
+  }
+
+  constexpr auto expm1(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  {
+    return soft_double { soft_double::f64_expm1(x.my_value), detail::nothing{} };
+  }
+
+  constexpr auto log1p(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  {
+    return soft_double { soft_double::f64_log1p(x.my_value), detail::nothing{} };
+  }
+
+  constexpr auto exp2(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  {
+    return soft_double { soft_double::f64_exp2(x.my_value), detail::nothing{} };
+  }
+
+  constexpr auto log2(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  {
+    return soft_double { soft_double::f64_log2(x.my_value), detail::nothing{} };
+  }
+
+  constexpr auto log10(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  {
+    return soft_double { soft_double::f64_log10(x.my_value), detail::nothing{} };
+  }
+
+  constexpr auto cbrt(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  {
+    return soft_double { soft_double::f64_cbrt(x.my_value), detail::nothing{} };
+  }
+
+  constexpr auto hypot(soft_double x, soft_double y) -> soft_double // NOLINT(performance-unnecessary-value-param)
+  {
+    return soft_double { soft_double::f64_hypot(x.my_value, y.my_value), detail::nothing{} };
   }
 
   constexpr auto sinh(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
   {
-    const soft_double ep = exp(x); // NOLINT(performance-unnecessary-value-param)
+    // Use sinh(x) = (t + t / (t + 1)) / 2 with t = expm1(|x|) for moderate |x|,
+    // rearranged as (2t - t^2 / (t + 1)) / 2 for |x| < 1. This stays accurate
+    // for small |x| and needs a single division. All of the halvings are
+    // exact multiplications by 1/2.
+    const auto x_abs = fabs(x);
+
+    // For |x| < 2^-28, sinh(x) rounds to x.
+    const auto x_is_tiny_or_nan =
+      (detail::isNaNF64UI(x.crepresentation()) || (x_abs < soft_double { static_cast<std::uint64_t>(UINT64_C(0x3E30000000000000)), detail::nothing{} }));
+
+    auto result = soft_double { };
 
-    return (ep - (soft_double::my_value_one() / ep)) / static_cast<int>(INT8_C(2));
+    if(x_is_tiny_or_nan)
+    {
+      result = x;
+    }
+    else if(x_abs < static_cast<int>(INT8_C(22)))
+    {
+      const auto t = expm1(x_abs);
+
+      const auto t_over_t_plus_one = t / (t + static_cast<int>(INT8_C(1)));
+
+      result =
+        (
+          (x_abs < static_cast<int>(INT8_C(1)))
+            ? ((t + t) - (t * t_over_t_plus_one))
+            : (t + t_over_t_plus_one)
+        ) * soft_double::my_value_half();
+    }
+    else if(x_abs < static_cast<int>(INT16_C(1024)))
+    {
+      // Beyond that, sinh(|x|) rounds to exp(|x|) / 2, which is formed
+      // in fixed-point and stays finite just beyond log(DBL_MAX).
+      result = soft_double { soft_double::f64_exp_half(x_abs.my_value), detail::nothing{} };
+    }
+    else
+    {
+      result = soft_double::my_value_infinity();
+    }
+
+    return ((x_is_tiny_or_nan || (!(x < static_cast<int>(INT8_C(0))))) ? result : -result);
   }
 
   constexpr auto cosh(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
   {
-    const soft_double ep = exp(x); // NOLINT(performance-unnecessary-value-param)
+    const auto x_abs = fabs(x);
+
+    auto result = soft_double { };
 
-    return (ep + (soft_double::my_value_one() / ep)) / static_cast<int>(INT8_C(2));
+    if(detail::isNaNF64UI(x.crepresentation()))
+    {
+      result = x;
+    }
+    else if(x_abs < soft_double { static_cast<std::uint64_t>(UINT64_C(0x3FD62E42FEFA39EF)), detail::nothing{} })
+    {
+      // For |x| < ln2/2, use cosh(x) = 1 + t^2 / (2 (1 + t)) with t = expm1(|x|).
+      const auto t = expm1(x_abs);
+      const auto w = t + static_cast<int>(INT8_C(1));
+
+      result = soft_double::my_value_one() + ((t * t) / (w + w));
+    }
+    else if(x_abs < static_cast<int>(INT8_C(22)))
+    {
+      // Use cosh(x) = h + (1/4) / h with h = exp(|x|) / 2.
+      const auto h = soft_double { soft_double::f64_exp_half(x_abs.my_value), detail::nothing{} };
+
+      result = h + (soft_double { static_cast<std::uint64_t>(UINT64_C(0x3FD0000000000000)), detail::nothing{} } / h);
+    }
+    else if(x_abs < static_cast<int>(INT16_C(1024)))
+    {
+      result = soft_double { soft_double::f64_exp_half(x_abs.my_value), detail::nothing{} };
+    }
+    else
+    {
+      result = soft_double::my_value_infinity();
+    }
+
+    return result;
   }
 
   constexpr auto tanh(soft_double x) -> soft_double // NOLINT(performance-unnecessary-value-param)
   {
-    const soft_double ep = exp(x); // NOLINT(performance-unnecessary-value-param)
-    const soft_double em = soft_double::my_value_one() / ep;
+    // Use tanh(x) = -t / (t + 2) with t = expm1(-2|x|) for |x| < 1,
+    // and tanh(x) = 1 - 2 / (t + 2) with t = expm1(2|x|) beyond that.
+    const auto x_abs = fabs(x);
+
+    // For |x| < 2^-28, tanh(x) rounds to x.
+    const auto x_is_tiny_or_nan =
+      (detail::isNaNF64UI(x.crepresentation()) || (x_abs < soft_double { static_cast<std::uint64_t>(UINT64_C(0x3E30000000000000)), detail::nothing{} }));
 
-    return (ep - em) / (ep + em);
+    auto result = soft_double { };
+
+    if(x_is_tiny_or_nan)
+    {
+      result = x;
+    }
+    else if(x_abs >= static_cast<int>(INT8_C(22)))
+    {
+      result = soft_double::my_value_one();
+    }
+    else if(x_abs >= static_cast<int>(INT8_C(1)))
+    {
+      const auto t = expm1(x_abs + x_abs);
+
+      result = soft_double::my_value_one() - (soft_double { static_cast<std::uint64_t>(UINT64_C(0x4000000000000000)), detail::nothing{} } / (t + static_cast<int>(INT8_C(2))));
+    }
+    else
+    {
+      const auto t = expm1(-(x_abs + x_abs));
+
+      result = -t / (t + static_cast<int>(INT8_C(2)));
+    }
+
+    return ((x_is_tiny_or_nan || (!(x < static_cast<int>(INT8_C(0))))) ? result : -result);
   }
 
   using float64_t = soft_double;
 
+  namespace detail {
+
+  constexpr auto chars_literal_radix_bits(const char* first, const char* last, unsigned digit_bits) -> std::uint64_t
+  {
+    // The value of an integer literal with 1 bit (binary) or 3 bits
+    // (octal) per digit. Bits beyond 64 only scale the value and are
+    // kept as a sticky bit for the rounding.
+
+    auto w      = static_cast<std::uint64_t>(UINT8_C(0));
+    auto e2     = static_cast<std::int32_t>(INT8_C(0));
+    auto sticky = false;
+
+    for(auto p = first; p != last; ++p)
+    {
+      const auto d = static_cast<unsigned>(*p - '0');
+
+      for(auto i = digit_bits; i != 0U; --i)
+      {
+        const auto b = static_cast<std::uint64_t>(static_cast<unsigned>(d >> static_cast<unsigned>(i - 1U)) & 1U);
+
+        if(w < static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)))
+        {
+          w = static_cast<std::uint64_t>(static_cast<std::uint64_t>(w << static_cast<unsigned>(UINT8_C(1))) | b);
+        }
+        else
+        {
+          ++e2;
+
+          sticky = (sticky || (b != static_cast<std::uint64_t>(UINT8_C(0))));
+        }
+      }
+    }
+
+    return ((w == static_cast<std::uint64_t>(UINT8_C(0))) ? w : chars_hex_to_binary(w, e2, sticky));
+  }
+
+  constexpr auto chars_literal_bits(const char* first, const char* last) -> std::uint64_t
+  {
+    // The representation of a numeric literal without its digit
+    // separators. Its form has been checked by the compiler.
+    // Hexadecimal, binary and octal prefixes are recognized, and
+    // the rest is decimal. Out of range, the results are zero or
+    // infinity, as those of from_chars.
+
+    const auto has_prefix = (((last - first) > static_cast<std::ptrdiff_t>(INT8_C(1))) && (*first == '0'));
+
+    const auto prefix = (has_prefix ? chars_lower(*(first + 1)) : '\0');
+
+    auto is_octal = (has_prefix && (prefix != 'x') && (prefix != 'b'));
+
+    for(auto p = first; (is_octal && (p != last)); ++p)
+    {
+      is_octal = ((*p >= '0') && (*p <= '7'));
+    }
+
+    return
+      static_cast<std::uint64_t>
+      (
+        (has_prefix && (prefix == 'x')) ? chars_parse(first + 2, last, chars_format::hex).bits
+                                        : (has_prefix && (prefix == 'b')) ? chars_literal_radix_bits(first + 2, last, 1U)
+                                                                          : (is_octal ? chars_literal_radix_bits(first + 1, last, 3U)
+                                                                                      : chars_parse(first, last, chars_format::general).bits)
+      );
+  }
+
+  } // namespace detail
+
+  inline namespace literals {
+
+  // The literal 1.2345e-6_sd is a soft_double, which is parsed at
+  // compile time and rounded correctly. As opposed to construction
+  // from double, this is constexpr in every language standard, so
+  // that constexpr tables of soft_double need no initialization at
+  // run time. Digit separators are allowed, as for other literals.
+  template<char... Chars>
+  constexpr auto operator""_sd() -> soft_double
+  {
+    const char chars[] = { Chars... }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+    char digits[sizeof...(Chars)] { }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+    auto count = static_cast<std::size_t>(UINT8_C(0));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < sizeof...(Chars); ++i)
+    {
+      if(chars[i] != '\'')
+      {
+        digits[count] = chars[i];
+
+        ++count;
+      }
+    }
+
+    return soft_double { detail::chars_literal_bits(digits, digits + count), detail::nothing { } }; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  } // namespace literals
+
   #if(__cplusplus >= 201703L)
   } // namespace math::softfloat
   #else
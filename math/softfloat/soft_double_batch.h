@@ -0,0 +1,699 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2012 - 2025.                 //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef SOFT_DOUBLE_BATCH_2025_06_14_H // NOLINT(llvm-header-guard)
+  #define SOFT_DOUBLE_BATCH_2025_06_14_H
+
+  #include <array>
+  #include <cstddef>
+  #include <cstdint>
+
+  #include <math/softfloat/soft_double.h>
+
+  // Batch arithmetic over contiguous buffers of soft_double.
+
+  // The operands are processed in blocks. Each block is unpacked
+  // into structure-of-arrays sign/exponent/significand lanes.
+  // A single branch-free kernel runs across the lanes, and the
+  // results are rounded and repacked. The integer bit manipulation
+  // in these loops is straight-line code which the compiler
+  // is free to vectorize.
+
+  // Lanes that leave the normal range (zero, subnormal, infinity
+  // or NaN operands, or results that would be subnormal or
+  // overflow) are flagged and recomputed with the scalar kernels.
+  // So the batch results are bit-identical to the scalar operators.
+
+  #if(__cplusplus >= 201703L)
+  namespace math::softfloat::batch {
+  #else
+  namespace math { namespace softfloat { namespace batch { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  namespace detail {
+
+  constexpr auto block_size = static_cast<std::size_t>(UINT8_C(64));
+
+  // All lanes are 64 bits wide, so that the comparisons and selections
+  // below stay within one vector type. Conditions are carried as masks
+  // (all zeros or all ones) rather than as branches.
+
+  template<const std::size_t LaneCount>
+  struct unpacked_lanes
+  {
+    std::array<std::uint64_t, LaneCount> sign    { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::array<std::int64_t,  LaneCount> exp     { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::array<std::uint64_t, LaneCount> sig     { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::array<std::uint64_t, LaneCount> special { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  constexpr auto mask_of(bool b) -> std::uint64_t
+  {
+    return static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(0)) - static_cast<std::uint64_t>(b ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0))));
+  }
+
+  constexpr auto select(std::uint64_t mask, std::uint64_t x, std::uint64_t y) -> std::uint64_t
+  {
+    return static_cast<std::uint64_t>(static_cast<std::uint64_t>(x & mask) | static_cast<std::uint64_t>(y & static_cast<std::uint64_t>(~mask)));
+  }
+
+  constexpr auto exp_is_not_normal(std::int64_t e) -> std::uint64_t
+  {
+    // Zero and subnormal operands have a biased exponent of 0,
+    // infinity and NaN have 0x7FF.
+    return mask_of(static_cast<std::uint64_t>(e - static_cast<std::int64_t>(INT8_C(1))) >= static_cast<std::uint64_t>(UINT16_C(0x7FE)));
+  }
+
+  constexpr auto exp_is_out_of_kernel_range(std::int64_t e) -> std::uint64_t
+  {
+    // Results with a biased exponent outside of [0, 0x7FC] underflow
+    // or could overflow in softfloat_roundPackToF64.
+    return mask_of(static_cast<std::uint64_t>(e) > static_cast<std::uint64_t>(UINT16_C(0x7FC)));
+  }
+
+  constexpr auto clz_step(std::uint64_t x, unsigned shift) -> std::uint64_t
+  {
+    // Mask for one step of the binary search in count_leading_zeros:
+    // set when the upper shift bits of x are all zero.
+    return mask_of(x < static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - shift)));
+  }
+
+  constexpr auto count_leading_zeros(std::uint64_t x) -> std::uint64_t
+  {
+    // Branch-free binary search for the leading one bit of a nonzero
+    // argument. Unlike a count-leading-zeros instruction, this also
+    // vectorizes on targets having no vector lzcnt. The steps are
+    // written out, since a loop here prevents vectorizing the caller.
+
+    const auto m32 = clz_step(x,  static_cast<unsigned>(UINT8_C(32))); x = select(m32, static_cast<std::uint64_t>(x << static_cast<unsigned>(UINT8_C(32))), x);
+    const auto m16 = clz_step(x,  static_cast<unsigned>(UINT8_C(16))); x = select(m16, static_cast<std::uint64_t>(x << static_cast<unsigned>(UINT8_C(16))), x);
+    const auto m08 = clz_step(x,  static_cast<unsigned>(UINT8_C( 8))); x = select(m08, static_cast<std::uint64_t>(x << static_cast<unsigned>(UINT8_C( 8))), x);
+    const auto m04 = clz_step(x,  static_cast<unsigned>(UINT8_C( 4))); x = select(m04, static_cast<std::uint64_t>(x << static_cast<unsigned>(UINT8_C( 4))), x);
+    const auto m02 = clz_step(x,  static_cast<unsigned>(UINT8_C( 2))); x = select(m02, static_cast<std::uint64_t>(x << static_cast<unsigned>(UINT8_C( 2))), x);
+    const auto m01 = clz_step(x,  static_cast<unsigned>(UINT8_C( 1)));
+
+    return
+      static_cast<std::uint64_t>
+      (
+          static_cast<std::uint64_t>(m32 & static_cast<std::uint64_t>(UINT8_C(32)))
+        + static_cast<std::uint64_t>(m16 & static_cast<std::uint64_t>(UINT8_C(16)))
+        + static_cast<std::uint64_t>(m08 & static_cast<std::uint64_t>(UINT8_C( 8)))
+        + static_cast<std::uint64_t>(m04 & static_cast<std::uint64_t>(UINT8_C( 4)))
+        + static_cast<std::uint64_t>(m02 & static_cast<std::uint64_t>(UINT8_C( 2)))
+        + static_cast<std::uint64_t>(m01 & static_cast<std::uint64_t>(UINT8_C( 1)))
+      );
+  }
+
+  template<const std::size_t LaneCount>
+  auto unpack(const soft_double* src, std::size_t count, std::uint64_t sign_flip, unpacked_lanes<LaneCount>& dst) -> void
+  {
+    // Unpack the sign, the biased exponent and the significand
+    // (including the hidden bit) of each lane.
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      const auto u = static_cast<std::uint64_t>(src[i].crepresentation() ^ sign_flip); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      dst.sign[i] = static_cast<std::uint64_t>(u >> static_cast<unsigned>(UINT8_C(63)));
+      dst.exp [i] = static_cast<std::int64_t>(::math::softfloat::detail::expF64UI(u));
+      dst.sig [i] = static_cast<std::uint64_t>(::math::softfloat::detail::fracF64UI(u) | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)));
+    }
+  }
+
+  template<const std::size_t LaneCount>
+  auto repack(const unpacked_lanes<LaneCount>& z, std::size_t count, soft_double* dst) -> void
+  {
+    // Round-to-nearest-even and pack each lane. The significand
+    // carries its leading bit at bit 62 and the exponent is that
+    // expected by softfloat_roundPackToF64. Within the kernel range,
+    // neither underflow nor overflow can occur. The special lanes
+    // are packed too, and subsequently overwritten by the caller.
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      const auto round_bits = static_cast<std::uint64_t>(z.sig[i] & static_cast<std::uint64_t>(UINT16_C(0x3FF)));
+
+      const auto sig_rounded =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(static_cast<std::uint64_t>(z.sig[i] + static_cast<std::uint64_t>(UINT16_C(0x200))) >> static_cast<unsigned>(UINT8_C(10)))
+          & static_cast<std::uint64_t>(~static_cast<std::uint64_t>(mask_of(round_bits == static_cast<std::uint64_t>(UINT16_C(0x200))) & static_cast<std::uint64_t>(UINT8_C(1))))
+        );
+
+      dst[i] = // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        soft_double
+        (
+          ::math::softfloat::detail::packToF64UI
+          (
+            (z.sign[i] != static_cast<std::uint64_t>(UINT8_C(0))),
+            static_cast<std::uint64_t>(z.exp[i]),
+            sig_rounded
+          ),
+          ::math::softfloat::detail::nothing()
+        );
+    }
+  }
+
+  template<const std::size_t LaneCount>
+  auto kernel_add(const unpacked_lanes<LaneCount>& a, const unpacked_lanes<LaneCount>& b, std::size_t count, unpacked_lanes<LaneCount>& z) -> void
+  {
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      // Order the operands by magnitude so that |x| >= |y|.
+      const auto key_a = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(a.exp[i]) << static_cast<unsigned>(UINT8_C(53))) | a.sig[i]);
+      const auto key_b = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(b.exp[i]) << static_cast<unsigned>(UINT8_C(53))) | b.sig[i]);
+
+      const auto b_is_larger = mask_of(key_b > key_a);
+
+      const auto exp_x = static_cast<std::int64_t>(select(b_is_larger, static_cast<std::uint64_t>(b.exp[i]), static_cast<std::uint64_t>(a.exp[i])));
+      const auto exp_y = static_cast<std::int64_t>(select(b_is_larger, static_cast<std::uint64_t>(a.exp[i]), static_cast<std::uint64_t>(b.exp[i])));
+
+      const auto sig_x = static_cast<std::uint64_t>(select(b_is_larger, b.sig[i], a.sig[i]) << static_cast<unsigned>(UINT8_C(10)));
+      const auto sig_y = static_cast<std::uint64_t>(select(b_is_larger, a.sig[i], b.sig[i]) << static_cast<unsigned>(UINT8_C(10)));
+
+      // Align y with a clamped shift-right-jam. A distance of 63 or more
+      // leaves only the sticky bit, exactly as in softfloat_shiftRightJam64.
+      const auto exp_diff = static_cast<std::uint64_t>(exp_x - exp_y);
+
+      const auto dist = select(mask_of(exp_diff < static_cast<std::uint64_t>(UINT8_C(63))), exp_diff, static_cast<std::uint64_t>(UINT8_C(63)));
+
+      const auto lost = static_cast<std::uint64_t>(sig_y << static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(64)) - dist) & static_cast<std::uint64_t>(UINT8_C(63))));
+
+      const auto sig_y_aligned =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(sig_y >> dist)
+          | static_cast<std::uint64_t>
+            (
+                mask_of(dist != static_cast<std::uint64_t>(UINT8_C(0)))
+              & mask_of(lost != static_cast<std::uint64_t>(UINT8_C(0)))
+              & static_cast<std::uint64_t>(UINT8_C(1))
+            )
+        );
+
+      // Magnitude addition: the sum lies in [2^62, 2^64)
+      // and is brought to [2^62, 2^63) with a jamming shift.
+      const auto sum       = static_cast<std::uint64_t>(sig_x + sig_y_aligned);
+      const auto sum_carry = static_cast<std::uint64_t>(sum >> static_cast<unsigned>(UINT8_C(63)));
+      const auto sum_norm  = static_cast<std::uint64_t>(static_cast<std::uint64_t>(sum >> sum_carry) | static_cast<std::uint64_t>(sum & sum_carry));
+
+      // Magnitude subtraction: the difference lies in [0, 2^63).
+      const auto dif = static_cast<std::uint64_t>(sig_x - sig_y_aligned);
+
+      const auto is_add = mask_of(a.sign[i] == b.sign[i]);
+
+      const auto sig_z = select(is_add, sum_norm, dif);
+
+      // Normalize the leading bit to bit 62. This is only needed
+      // for the difference (the sum is already normalized) but
+      // is done for all lanes.
+      const auto shift =
+        static_cast<std::uint64_t>
+        (
+            count_leading_zeros(static_cast<std::uint64_t>(sig_z | static_cast<std::uint64_t>(UINT8_C(1))))
+          - static_cast<std::uint64_t>(UINT8_C(1))
+        );
+
+      z.sign[i] = select(b_is_larger, b.sign[i], a.sign[i]);
+      z.sig [i] = static_cast<std::uint64_t>(sig_z << shift);
+      z.exp [i] =
+        static_cast<std::int64_t>
+        (
+            static_cast<std::int64_t>(exp_x - static_cast<std::int64_t>(static_cast<std::uint64_t>(UINT8_C(1)) + shift))
+          + static_cast<std::int64_t>(sum_carry & is_add)
+        );
+
+      z.special[i] =
+        static_cast<std::uint64_t>
+        (
+            exp_is_not_normal(a.exp[i])
+          | exp_is_not_normal(b.exp[i])
+          | static_cast<std::uint64_t>(static_cast<std::uint64_t>(~is_add) & mask_of(dif == static_cast<std::uint64_t>(UINT8_C(0))))
+          | exp_is_out_of_kernel_range(z.exp[i])
+        );
+    }
+  }
+
+  template<const std::size_t LaneCount>
+  auto kernel_mul(const unpacked_lanes<LaneCount>& a, const unpacked_lanes<LaneCount>& b, std::size_t count, unpacked_lanes<LaneCount>& z) -> void
+  {
+    // The full products are formed first, since
+    // 64x64->128-bit multiplication does not vectorize.
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      const auto sig128 =
+        ::math::softfloat::detail::softfloat_mul64To128
+        (
+          static_cast<std::uint64_t>(a.sig[i] << static_cast<unsigned>(UINT8_C(10))),
+          static_cast<std::uint64_t>(b.sig[i] << static_cast<unsigned>(UINT8_C(11)))
+        );
+
+      z.sig[i] =
+        static_cast<std::uint64_t>
+        (
+            sig128.v1
+          | static_cast<std::uint64_t>(mask_of(sig128.v0 != static_cast<std::uint64_t>(UINT8_C(0))) & static_cast<std::uint64_t>(UINT8_C(1)))
+        );
+    }
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      // The high half lies in [2^61, 2^63). Normalize to [2^62, 2^63).
+      const auto norm = static_cast<std::uint64_t>(static_cast<std::uint64_t>(z.sig[i] >> static_cast<unsigned>(UINT8_C(62))) ^ static_cast<std::uint64_t>(UINT8_C(1)));
+
+      z.sign[i] = static_cast<std::uint64_t>(a.sign[i] ^ b.sign[i]);
+      z.sig [i] = static_cast<std::uint64_t>(z.sig[i] << norm);
+      z.exp [i] =
+        static_cast<std::int64_t>
+        (
+            static_cast<std::int64_t>(a.exp[i] + b.exp[i])
+          - static_cast<std::int64_t>(static_cast<std::int64_t>(INT16_C(0x3FF)) + static_cast<std::int64_t>(norm))
+        );
+
+      z.special[i] =
+        static_cast<std::uint64_t>
+        (
+            exp_is_not_normal(a.exp[i])
+          | exp_is_not_normal(b.exp[i])
+          | exp_is_out_of_kernel_range(z.exp[i])
+        );
+    }
+  }
+
+  template<const std::size_t LaneCount>
+  auto kernel_div(const unpacked_lanes<LaneCount>& a, const unpacked_lanes<LaneCount>& b, std::size_t count, unpacked_lanes<LaneCount>& z) -> void
+  {
+    // This is the 32-bit reciprocal kernel of f64_div, in which both
+    // correction steps are replaced by selections. The rounded result
+    // is the same as that of the scalar kernel (whichever division
+    // kernel that one uses) since both are correctly rounded.
+
+    std::array<std::uint64_t, LaneCount> sig_b { };
+    std::array<std::uint64_t, LaneCount> recip { };
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      const auto a_is_less = static_cast<std::uint64_t>(mask_of(a.sig[i] < b.sig[i]) & static_cast<std::uint64_t>(UINT8_C(1)));
+
+      z.sign[i] = static_cast<std::uint64_t>(a.sign[i] ^ b.sign[i]);
+      z.sig [i] = static_cast<std::uint64_t>(a.sig[i] << static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(10)) + a_is_less));
+      z.exp [i] =
+        static_cast<std::int64_t>
+        (
+            static_cast<std::int64_t>(static_cast<std::int64_t>(a.exp[i] - b.exp[i]) + static_cast<std::int64_t>(INT16_C(0x3FE)))
+          - static_cast<std::int64_t>(a_is_less)
+        );
+
+      sig_b[i] = static_cast<std::uint64_t>(b.sig[i] << static_cast<unsigned>(UINT8_C(11)));
+
+      z.special[i] =
+        static_cast<std::uint64_t>
+        (
+            exp_is_not_normal(a.exp[i])
+          | exp_is_not_normal(b.exp[i])
+          | exp_is_out_of_kernel_range(z.exp[i])
+        );
+    }
+
+    // The reciprocal seed needs one hardware division per lane.
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      recip[i] =
+        static_cast<std::uint32_t>
+        (
+            ::math::softfloat::detail::softfloat_approxRecip32_1(static_cast<std::uint32_t>(sig_b[i] >> static_cast<unsigned>(UINT8_C(32))))
+          - static_cast<unsigned>(UINT8_C(2))
+        );
+    }
+
+    constexpr auto mask32 = static_cast<std::uint64_t>(UINT32_C(0xFFFFFFFF));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      const auto sig_b_hi = static_cast<std::uint64_t>(sig_b[i] >> static_cast<unsigned>(UINT8_C(32)));
+      const auto sig_b_lo = static_cast<std::uint64_t>(static_cast<std::uint64_t>(sig_b[i] & mask32) >> static_cast<unsigned>(UINT8_C(4)));
+
+      const auto sig32Z = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(z.sig[i] >> static_cast<unsigned>(UINT8_C(32))) * recip[i]) >> static_cast<unsigned>(UINT8_C(32)));
+
+      const auto double_term = static_cast<std::uint64_t>(static_cast<std::uint64_t>(sig32Z << static_cast<unsigned>(UINT8_C(1))) & mask32);
+
+      const auto rem =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(static_cast<std::uint64_t>(z.sig[i] - static_cast<std::uint64_t>(double_term * sig_b_hi)) << static_cast<unsigned>(UINT8_C(28)))
+          - static_cast<std::uint64_t>(double_term * sig_b_lo)
+        );
+
+      const auto q =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>
+            (
+                static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(rem >> static_cast<unsigned>(UINT8_C(32))) * recip[i]) >> static_cast<unsigned>(UINT8_C(32)))
+              + static_cast<std::uint64_t>(UINT8_C(4))
+            )
+          & mask32
+        );
+
+      const auto sigZ =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(sig32Z << static_cast<unsigned>(UINT8_C(32)))
+          + static_cast<std::uint64_t>(q      << static_cast<unsigned>(UINT8_C( 4)))
+        );
+
+      // The quotient may be off by a few units in its last place.
+      // In this case, compute the exact remainder of the truncated
+      // quotient to set the final bits.
+      const auto q_fix           = static_cast<std::uint64_t>(q & static_cast<std::uint64_t>(~static_cast<std::uint64_t>(UINT8_C(7))));
+      const auto double_term_fix = static_cast<std::uint64_t>(static_cast<std::uint64_t>(q_fix << static_cast<unsigned>(UINT8_C(1))) & mask32);
+
+      const auto rem_fix =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(static_cast<std::uint64_t>(rem - static_cast<std::uint64_t>(double_term_fix * sig_b_hi)) << static_cast<unsigned>(UINT8_C(28)))
+          - static_cast<std::uint64_t>(double_term_fix * sig_b_lo)
+        );
+
+      const auto sigZ_trunc = static_cast<std::uint64_t>(sigZ & static_cast<std::uint64_t>(~static_cast<std::uint64_t>(UINT8_C(0x7F))));
+
+      const auto sigZ_fix =
+        select
+        (
+          mask_of(static_cast<std::uint64_t>(rem_fix >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint64_t>(UINT8_C(0))),
+          static_cast<std::uint64_t>(sigZ_trunc - static_cast<std::uint64_t>(UINT8_C(0x80))),
+          static_cast<std::uint64_t>(sigZ_trunc | static_cast<std::uint64_t>(mask_of(rem_fix != static_cast<std::uint64_t>(UINT8_C(0))) & static_cast<std::uint64_t>(UINT8_C(1))))
+        );
+
+      z.sig[i] =
+        select
+        (
+          mask_of(static_cast<std::uint64_t>(sigZ & static_cast<std::uint64_t>(UINT16_C(0x1FF))) < static_cast<std::uint64_t>(UINT8_C(0x40))),
+          sigZ_fix,
+          sigZ
+        );
+    }
+  }
+
+  template<const std::size_t LaneCount>
+  auto kernel_sqrt(const unpacked_lanes<LaneCount>& a, std::size_t count, unpacked_lanes<LaneCount>& z) -> void
+  {
+    // This is f64_sqrt, with the final correction step
+    // replaced by a selection.
+
+    std::array<std::uint64_t, LaneCount> recip_sqrt { };
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      z.sign[i] = static_cast<std::uint64_t>(UINT8_C(0));
+      z.exp [i] =
+        static_cast<std::int64_t>
+        (
+            static_cast<std::int64_t>(static_cast<std::int64_t>(a.exp[i] - static_cast<std::int64_t>(INT16_C(0x3FF))) >> static_cast<unsigned>(UINT8_C(1))) // NOLINT(hicpp-signed-bitwise)
+          + static_cast<std::int64_t>(INT16_C(0x3FE))
+        );
+
+      // Negative operands are special, as are zero, subnormal,
+      // infinite and NaN operands.
+      z.special[i] =
+        static_cast<std::uint64_t>
+        (
+            exp_is_not_normal(a.exp[i])
+          | mask_of(a.sign[i] != static_cast<std::uint64_t>(UINT8_C(0)))
+        );
+    }
+
+    // The reciprocal square root seed uses a table lookup per lane.
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      recip_sqrt[i] =
+        ::math::softfloat::detail::softfloat_approxRecipSqrt32_1
+        (
+          static_cast<std::uint32_t>(static_cast<std::uint64_t>(a.exp[i]) & static_cast<std::uint64_t>(UINT8_C(1))),
+          static_cast<std::uint32_t>(a.sig[i] >> static_cast<unsigned>(UINT8_C(21)))
+        );
+    }
+
+    constexpr auto mask32 = static_cast<std::uint64_t>(UINT32_C(0xFFFFFFFF));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      const auto odd_exp = static_cast<std::uint64_t>(static_cast<std::uint64_t>(a.exp[i]) & static_cast<std::uint64_t>(UINT8_C(1)));
+
+      const auto sig32A = static_cast<std::uint64_t>(a.sig[i] >> static_cast<unsigned>(UINT8_C(21)));
+      const auto sig32Z = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(sig32A * recip_sqrt[i]) >> static_cast<unsigned>(UINT8_C(32))) >> odd_exp);
+
+      const auto sigA = static_cast<std::uint64_t>(a.sig[i] << static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(9)) - odd_exp));
+
+      const auto rem = static_cast<std::uint64_t>(sigA - static_cast<std::uint64_t>(sig32Z * sig32Z));
+
+      const auto q =
+        static_cast<std::uint64_t>
+        (
+          static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(rem >> static_cast<unsigned>(UINT8_C(2))) & mask32) * recip_sqrt[i]) >> static_cast<unsigned>(UINT8_C(32))
+        );
+
+      const auto sigZ =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(static_cast<std::uint64_t>(sig32Z << static_cast<unsigned>(UINT8_C(32))) | static_cast<std::uint64_t>(UINT8_C(0x20)))
+          + static_cast<std::uint64_t>(q << static_cast<unsigned>(UINT8_C(3)))
+        );
+
+      const auto sigZ_trunc   = static_cast<std::uint64_t>(sigZ & static_cast<std::uint64_t>(~static_cast<std::uint64_t>(UINT8_C(0x3F))));
+      const auto shifted_sigZ = static_cast<std::uint64_t>(sigZ_trunc >> static_cast<unsigned>(UINT8_C(6)));
+
+      const auto rem_fix =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(sigA << static_cast<unsigned>(UINT8_C(52)))
+          - static_cast<std::uint64_t>(shifted_sigZ * shifted_sigZ)
+        );
+
+      const auto sigZ_fix =
+        select
+        (
+          mask_of(static_cast<std::uint64_t>(rem_fix >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint64_t>(UINT8_C(0))),
+          static_cast<std::uint64_t>(sigZ_trunc - static_cast<std::uint64_t>(UINT8_C(1))),
+          static_cast<std::uint64_t>(sigZ_trunc | static_cast<std::uint64_t>(mask_of(rem_fix != static_cast<std::uint64_t>(UINT8_C(0))) & static_cast<std::uint64_t>(UINT8_C(1))))
+        );
+
+      z.sig[i] =
+        select
+        (
+          mask_of(static_cast<std::uint64_t>(sigZ & static_cast<std::uint64_t>(UINT16_C(0x1FF))) < static_cast<std::uint64_t>(UINT8_C(0x22))),
+          sigZ_fix,
+          sigZ
+        );
+    }
+  }
+
+  template<const std::size_t LaneCount>
+  auto any_special(const unpacked_lanes<LaneCount>& z, std::size_t count) -> bool
+  {
+    auto special = static_cast<std::uint64_t>(UINT8_C(0));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      special |= z.special[i];
+    }
+
+    return (special != static_cast<std::uint64_t>(UINT8_C(0)));
+  }
+
+  template<const std::size_t LaneCount,
+           typename KernelFunctionType,
+           typename ScalarFunctionType>
+  auto binary_lanes(const soft_double*  pa,
+                    const soft_double*  pb,
+                          soft_double*  pr,
+                          std::size_t   count,
+                          std::uint64_t sign_flip_b,
+                          KernelFunctionType kernel,
+                          ScalarFunctionType scalar) -> void
+  {
+    // Process up to LaneCount lanes: unpack, run the kernel, recompute
+    // the special lanes with the scalar operator and repack. The special
+    // lanes are recomputed before repacking, since the result may
+    // alias an operand.
+
+    unpacked_lanes<LaneCount> lanes_a { };
+    unpacked_lanes<LaneCount> lanes_b { };
+    unpacked_lanes<LaneCount> lanes_z { };
+
+    std::array<soft_double, LaneCount> fixed { };
+
+    unpack(pa, count, static_cast<std::uint64_t>(UINT8_C(0)), lanes_a);
+    unpack(pb, count, sign_flip_b,                            lanes_b);
+
+    kernel(lanes_a, lanes_b, count, lanes_z);
+
+    const auto has_special = any_special(lanes_z, count);
+
+    if(has_special)
+    {
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+      {
+        if(lanes_z.special[i] != static_cast<std::uint64_t>(UINT8_C(0)))
+        {
+          fixed[i] = scalar(pa[i], pb[i]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
+    }
+
+    repack(lanes_z, count, pr);
+
+    if(has_special)
+    {
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+      {
+        if(lanes_z.special[i] != static_cast<std::uint64_t>(UINT8_C(0)))
+        {
+          pr[i] = fixed[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
+    }
+  }
+
+  template<const std::size_t LaneCount,
+           typename KernelFunctionType,
+           typename ScalarFunctionType>
+  auto unary_lanes(const soft_double* pa,
+                         soft_double* pr,
+                         std::size_t  count,
+                         KernelFunctionType kernel,
+                         ScalarFunctionType scalar) -> void
+  {
+    unpacked_lanes<LaneCount> lanes_a { };
+    unpacked_lanes<LaneCount> lanes_z { };
+
+    std::array<soft_double, LaneCount> fixed { };
+
+    unpack(pa, count, static_cast<std::uint64_t>(UINT8_C(0)), lanes_a);
+
+    kernel(lanes_a, count, lanes_z);
+
+    const auto has_special = any_special(lanes_z, count);
+
+    if(has_special)
+    {
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+      {
+        if(lanes_z.special[i] != static_cast<std::uint64_t>(UINT8_C(0)))
+        {
+          fixed[i] = scalar(pa[i]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
+    }
+
+    repack(lanes_z, count, pr);
+
+    if(has_special)
+    {
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+      {
+        if(lanes_z.special[i] != static_cast<std::uint64_t>(UINT8_C(0)))
+        {
+          pr[i] = fixed[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
+    }
+  }
+
+  template<typename KernelFunctionType,
+           typename ScalarFunctionType>
+  auto binary_blocks(const soft_double*  a,
+                     const soft_double*  b,
+                           soft_double*  r,
+                           std::size_t   n,
+                           std::uint64_t sign_flip_b,
+                           KernelFunctionType kernel,
+                           ScalarFunctionType scalar) -> void
+  {
+    for(auto offset = static_cast<std::size_t>(UINT8_C(0)); offset < n; offset += block_size)
+    {
+      const auto count = (((n - offset) < block_size) ? (n - offset) : block_size);
+
+      binary_lanes<block_size>(a + offset, b + offset, r + offset, count, sign_flip_b, kernel, scalar); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  template<typename KernelFunctionType,
+           typename ScalarFunctionType>
+  auto unary_blocks(const soft_double* a,
+                          soft_double* r,
+                          std::size_t  n,
+                          KernelFunctionType kernel,
+                          ScalarFunctionType scalar) -> void
+  {
+    for(auto offset = static_cast<std::size_t>(UINT8_C(0)); offset < n; offset += block_size)
+    {
+      const auto count = (((n - offset) < block_size) ? (n - offset) : block_size);
+
+      unary_lanes<block_size>(a + offset, r + offset, count, kernel, scalar); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  constexpr auto sign_flip_none() -> std::uint64_t { return static_cast<std::uint64_t>(UINT8_C(0)); }
+  constexpr auto sign_flip_neg () -> std::uint64_t { return static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(UINT8_C(63))); }
+
+  } // namespace detail
+
+  // r[i] = a[i] + b[i] for i in [0, n).
+  inline auto add(const soft_double* a, const soft_double* b, soft_double* r, std::size_t n) -> void
+  {
+    detail::binary_blocks(a, b, r, n, detail::sign_flip_none(), detail::kernel_add<detail::block_size>, [](const soft_double& x, const soft_double& y) { return x + y; });
+  }
+
+  // r[i] = a[i] - b[i] for i in [0, n).
+  inline auto sub(const soft_double* a, const soft_double* b, soft_double* r, std::size_t n) -> void
+  {
+    detail::binary_blocks(a, b, r, n, detail::sign_flip_neg(), detail::kernel_add<detail::block_size>, [](const soft_double& x, const soft_double& y) { return x - y; });
+  }
+
+  // r[i] = a[i] * b[i] for i in [0, n).
+  inline auto mul(const soft_double* a, const soft_double* b, soft_double* r, std::size_t n) -> void
+  {
+    detail::binary_blocks(a, b, r, n, detail::sign_flip_none(), detail::kernel_mul<detail::block_size>, [](const soft_double& x, const soft_double& y) { return x * y; });
+  }
+
+  // r[i] = a[i] / b[i] for i in [0, n).
+  inline auto div(const soft_double* a, const soft_double* b, soft_double* r, std::size_t n) -> void
+  {
+    detail::binary_blocks(a, b, r, n, detail::sign_flip_none(), detail::kernel_div<detail::block_size>, [](const soft_double& x, const soft_double& y) { return x / y; });
+  }
+
+  // r[i] = sqrt(a[i]) for i in [0, n).
+  inline auto sqrt(const soft_double* a, soft_double* r, std::size_t n) -> void
+  {
+    detail::unary_blocks(a, r, n, detail::kernel_sqrt<detail::block_size>, [](const soft_double& x) { return sqrt(x); });
+  }
+
+  // The fused multiply-add adds to the exact 128-bit product with a wide
+  // alignment and cancellation logic that does not split into lane-wise
+  // operations. It loops over the scalar kernel, but shares the interface
+  // of the batch operations above.
+
+  // r[i] = fma(a[i], b[i], c[i]) for i in [0, n), with a single rounding.
+  inline auto fma(const soft_double* a, const soft_double* b, const soft_double* c, soft_double* r, std::size_t n) -> void
+  {
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < n; ++i)
+    {
+      r[i] = fma(a[i], b[i], c[i]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::softfloat::batch
+  #else
+  } // namespace batch
+  } // namespace softfloat
+  } // namespace math
+  #endif
+
+#endif // SOFT_DOUBLE_BATCH_2025_06_14_H
@@ -0,0 +1,424 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2012 - 2025.                 //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef SOFT_DOUBLE_BINARY_2025_08_10_H // NOLINT(llvm-header-guard)
+  #define SOFT_DOUBLE_BINARY_2025_08_10_H
+
+  #include <algorithm>
+  #include <array>
+  #include <cstddef>
+  #include <cstdint>
+  #include <cstring>
+  #include <fstream>
+  #include <istream>
+  #include <ostream>
+  #include <type_traits>
+  #include <utility>
+  #include <vector>
+
+  #include <math/softfloat/soft_double.h>
+  #include <util/utility/util_memory_mapped_file.h>
+  #include <util/utility/util_noncopyable.h>
+
+  #if (defined(__cpp_lib_span) && (__cpp_lib_span >= 202002L))
+  #include <span>
+  #endif
+
+  // A binary container of soft_double values, for checkpoints and
+  // the like. It consists of a header of 24 bytes followed by the
+  // representations of the values, each as 8 little-endian bytes.
+  //
+  //   offset  size  content
+  //        0     4  magic "SDBL"
+  //        4     1  format version (1)
+  //        5     1  byte order of the values (1 for little-endian)
+  //        6     1  flags (bit 0 set if there is a checksum)
+  //        7     1  reserved (0)
+  //        8     8  count of values, little-endian
+  //       16     8  checksum of the representations, little-endian
+  //       24        the values
+  //
+  // The checksum is FNV-1a taken over the 64-bit representations
+  // rather than bytes. It detects accidents, such as truncation or
+  // flipped bits, but it is not a cryptographic hash.
+  //
+  // Since soft_double is trivially copyable and standard-layout
+  // with the size of its representation, a mapped file can be read
+  // in place on little-endian hosts. The values of mapped_array are
+  // those of the mapping, without any copy.
+
+  #if(__cplusplus >= 201703L)
+  namespace math::softfloat {
+  #else
+  namespace math { namespace softfloat { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  #if (defined(__cpp_lib_span) && (__cpp_lib_span >= 202002L))
+
+  template<typename T>
+  using span = std::span<T>;
+
+  #else
+
+  // A minimal stand-in for std::span (C++20) of dynamic extent.
+  template<typename T>
+  class span
+  {
+  public:
+    using element_type    = T;
+    using value_type      = typename std::remove_cv<T>::type;
+    using size_type       = std::size_t;
+    using pointer         = T*;
+    using reference       = T&;
+    using iterator        = T*;
+
+    constexpr span() noexcept = default;
+
+    constexpr span(pointer p, size_type n) noexcept : my_data(p), my_size(n) { }
+
+    template<typename ContainerType,
+             typename std::enable_if<std::is_convertible<decltype(std::declval<ContainerType&>().data()), pointer>::value>::type const* = nullptr>
+    constexpr span(ContainerType&& c) noexcept : my_data(c.data()), my_size(static_cast<size_type>(c.size())) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    SOFT_DOUBLE_NODISCARD constexpr auto data () const noexcept -> pointer   { return my_data; }
+    SOFT_DOUBLE_NODISCARD constexpr auto size () const noexcept -> size_type { return my_size; }
+    SOFT_DOUBLE_NODISCARD constexpr auto empty() const noexcept -> bool      { return (my_size == static_cast<size_type>(UINT8_C(0))); }
+
+    SOFT_DOUBLE_NODISCARD constexpr auto begin() const noexcept -> iterator { return my_data; }
+    SOFT_DOUBLE_NODISCARD constexpr auto end  () const noexcept -> iterator { return my_data + my_size; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    constexpr auto operator[](size_type i) const noexcept -> reference { return my_data[i]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  private:
+    pointer   my_data { nullptr };
+    size_type my_size { };
+  };
+
+  #endif
+
+  namespace binary {
+
+  enum class errc
+  {
+    ok = 0,
+    io_error,
+    invalid_header,
+    truncated,
+    checksum_mismatch,
+    byte_order
+  };
+
+  namespace detail {
+
+  constexpr auto header_size  = static_cast<std::size_t>(UINT8_C(24));
+  constexpr auto value_size   = static_cast<std::size_t>(UINT8_C(8));
+
+  // Values are converted in blocks of this many.
+  constexpr auto block_count  = static_cast<std::size_t>(UINT16_C(4096));
+
+  constexpr auto version      = static_cast<std::uint8_t>(UINT8_C(1));
+  constexpr auto little       = static_cast<std::uint8_t>(UINT8_C(1));
+  constexpr auto has_checksum = static_cast<std::uint8_t>(UINT8_C(1));
+
+  constexpr auto fnv_offset   = static_cast<std::uint64_t>(UINT64_C(0xCBF29CE484222325));
+  constexpr auto fnv_prime    = static_cast<std::uint64_t>(UINT64_C(0x00000100000001B3));
+
+  using header_type = std::array<char, header_size>;
+
+  constexpr auto checksum_step(std::uint64_t h, std::uint64_t u) noexcept -> std::uint64_t
+  {
+    return static_cast<std::uint64_t>(static_cast<std::uint64_t>(h ^ u) * fnv_prime);
+  }
+
+  inline auto store_le(char* p, std::uint64_t u) noexcept -> void
+  {
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(8)); ++i)
+    {
+      p[i] = static_cast<char>(static_cast<std::uint8_t>(u >> static_cast<unsigned>(i * 8U))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  inline auto load_le(const char* p) noexcept -> std::uint64_t
+  {
+    auto u = static_cast<std::uint64_t>(UINT8_C(0));
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(8)); ++i)
+    {
+      u |= static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint8_t>(p[i])) << static_cast<unsigned>(i * 8U)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    return u;
+  }
+
+  inline auto host_is_little_endian() noexcept -> bool
+  {
+    const auto u = static_cast<std::uint32_t>(UINT8_C(1));
+
+    auto c = static_cast<unsigned char>(UINT8_C(0));
+
+    static_cast<void>(std::memcpy(&c, &u, static_cast<std::size_t>(UINT8_C(1))));
+
+    return (c == static_cast<unsigned char>(UINT8_C(1)));
+  }
+
+  inline auto checksum(span<const soft_double> values) noexcept -> std::uint64_t
+  {
+    auto h = fnv_offset;
+
+    for(const auto& x : values)
+    {
+      h = checksum_step(h, x.crepresentation());
+    }
+
+    return h;
+  }
+
+  inline auto make_header(std::uint64_t count, bool with_checksum, std::uint64_t sum) noexcept -> header_type
+  {
+    header_type header { };
+
+    header[0U] = 'S';
+    header[1U] = 'D';
+    header[2U] = 'B';
+    header[3U] = 'L';
+    header[4U] = static_cast<char>(version);
+    header[5U] = static_cast<char>(little);
+    header[6U] = static_cast<char>(with_checksum ? has_checksum : static_cast<std::uint8_t>(UINT8_C(0)));
+
+    store_le(header.data() + static_cast<std::size_t>(UINT8_C( 8)), count); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    store_le(header.data() + static_cast<std::size_t>(UINT8_C(16)), (with_checksum ? sum : static_cast<std::uint64_t>(UINT8_C(0)))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return header;
+  }
+
+  struct header_info
+  {
+    errc          ec            { };      // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint64_t count         { };      // NOLINT(misc-non-private-member-variables-in-classes)
+    bool          with_checksum { false }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint64_t sum           { };      // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  inline auto parse_header(const char* p) noexcept -> header_info
+  {
+    auto result = header_info { };
+
+    const auto flags = static_cast<std::uint8_t>(p[6U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    const auto is_valid =
+      (   (std::memcmp(p, "SDBL", static_cast<std::size_t>(UINT8_C(4))) == 0)
+       && (static_cast<std::uint8_t>(p[4U]) == version) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+       && (static_cast<std::uint8_t>(p[5U]) == little)  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+       && (static_cast<std::uint8_t>(flags & static_cast<std::uint8_t>(~has_checksum)) == static_cast<std::uint8_t>(UINT8_C(0))));
+
+    if(is_valid)
+    {
+      result.count         = load_le(p + static_cast<std::size_t>(UINT8_C( 8))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      result.with_checksum = (flags == has_checksum);
+      result.sum           = load_le(p + static_cast<std::size_t>(UINT8_C(16))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+    else
+    {
+      result.ec = errc::invalid_header;
+    }
+
+    return result;
+  }
+
+  } // namespace detail
+
+  // Write the values with a header, and a checksum if wanted.
+  inline auto write(std::ostream& os, span<const soft_double> values, bool with_checksum = true) -> errc
+  {
+    const auto sum = (with_checksum ? detail::checksum(values) : static_cast<std::uint64_t>(UINT8_C(0)));
+
+    const auto header = detail::make_header(static_cast<std::uint64_t>(values.size()), with_checksum, sum);
+
+    static_cast<void>(os.write(header.data(), static_cast<std::streamsize>(header.size())));
+
+    std::vector<char> buffer(static_cast<std::size_t>(detail::block_count * detail::value_size));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); ((i < values.size()) && os.good()); i += detail::block_count)
+    {
+      const auto n = (std::min)(detail::block_count, static_cast<std::size_t>(values.size() - i));
+
+      for(auto j = static_cast<std::size_t>(UINT8_C(0)); j < n; ++j)
+      {
+        detail::store_le(buffer.data() + static_cast<std::size_t>(j * detail::value_size), values[i + j].crepresentation()); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      static_cast<void>(os.write(buffer.data(), static_cast<std::streamsize>(n * detail::value_size)));
+    }
+
+    return (os.good() ? errc::ok : errc::io_error);
+  }
+
+  // Read one container from the stream, appending its values.
+  inline auto read(std::istream& is, std::vector<soft_double>& values) -> errc
+  {
+    detail::header_type header { };
+
+    static_cast<void>(is.read(header.data(), static_cast<std::streamsize>(header.size())));
+
+    auto result = ((static_cast<std::size_t>(is.gcount()) == header.size()) ? errc::ok : errc::truncated);
+
+    const auto info = ((result == errc::ok) ? detail::parse_header(header.data()) : detail::header_info { });
+
+    result = ((result == errc::ok) ? info.ec : result);
+
+    std::vector<char> buffer(static_cast<std::size_t>(detail::block_count * detail::value_size));
+
+    auto h = detail::fnv_offset;
+
+    for(auto i = static_cast<std::uint64_t>(UINT8_C(0)); ((i < info.count) && (result == errc::ok)); i += detail::block_count)
+    {
+      const auto n = static_cast<std::size_t>((std::min)(static_cast<std::uint64_t>(detail::block_count), static_cast<std::uint64_t>(info.count - i)));
+
+      static_cast<void>(is.read(buffer.data(), static_cast<std::streamsize>(n * detail::value_size)));
+
+      result = ((static_cast<std::size_t>(is.gcount()) == static_cast<std::size_t>(n * detail::value_size)) ? errc::ok : errc::truncated);
+
+      if(result == errc::ok)
+      {
+        const auto offset = values.size();
+
+        values.resize(static_cast<std::size_t>(offset + n));
+
+        for(auto j = static_cast<std::size_t>(UINT8_C(0)); j < n; ++j)
+        {
+          const auto u = detail::load_le(buffer.data() + static_cast<std::size_t>(j * detail::value_size)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          h = detail::checksum_step(h, u);
+
+          values[offset + j] = soft_double(u, ::math::softfloat::detail::nothing());
+        }
+      }
+    }
+
+    if((result == errc::ok) && info.with_checksum && (h != info.sum))
+    {
+      result = errc::checksum_mismatch;
+    }
+
+    return result;
+  }
+
+  inline auto write_file(const char* path, span<const soft_double> values, bool with_checksum = true) -> errc
+  {
+    std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    return (out.is_open() ? write(out, values, with_checksum) : errc::io_error);
+  }
+
+  inline auto read_file(const char* path, std::vector<soft_double>& values) -> errc
+  {
+    std::ifstream in(path, std::ios::in | std::ios::binary | std::ios::ate);
+
+    auto result = errc::io_error;
+
+    if(in.is_open())
+    {
+      // The size of the file bounds the count of values, which
+      // saves growing the vector step by step.
+      const auto file_size = static_cast<std::streamoff>(in.tellg());
+
+      if(file_size > static_cast<std::streamoff>(detail::header_size))
+      {
+        values.reserve(static_cast<std::size_t>(values.size() + static_cast<std::size_t>(static_cast<std::size_t>(static_cast<std::size_t>(file_size) - detail::header_size) / detail::value_size)));
+      }
+
+      static_cast<void>(in.seekg(0, std::ios::beg));
+
+      result = read(in, values);
+    }
+
+    return result;
+  }
+
+  // The values of a container file, mapped into memory and used in
+  // place. This needs a little-endian host, and otherwise reports
+  // byte_order, in which case read_file() still works.
+  class mapped_array : private ::util::noncopyable
+  {
+  public:
+    explicit mapped_array(const char* path, bool verify_checksum = true)
+      : my_file(path)
+    {
+      if(!my_file.is_open())
+      {
+        my_error = errc::io_error;
+      }
+      else if(my_file.size() < detail::header_size)
+      {
+        my_error = errc::truncated;
+      }
+      else
+      {
+        const auto info = detail::parse_header(my_file.data());
+
+        const auto available = static_cast<std::uint64_t>(static_cast<std::size_t>(my_file.size() - detail::header_size) / detail::value_size);
+
+        const auto p_values = my_file.data() + detail::header_size; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        if(info.ec != errc::ok)
+        {
+          my_error = info.ec;
+        }
+        else if(info.count > available)
+        {
+          my_error = errc::truncated;
+        }
+        else if((!detail::host_is_little_endian()) || ((reinterpret_cast<std::uintptr_t>(p_values) % alignof(soft_double)) != static_cast<std::uintptr_t>(UINT8_C(0)))) // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        {
+          my_error = errc::byte_order;
+        }
+        else
+        {
+          my_values = span<const soft_double>(reinterpret_cast<const soft_double*>(p_values), static_cast<std::size_t>(info.count)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+          if(verify_checksum && info.with_checksum && (detail::checksum(my_values) != info.sum))
+          {
+            my_error = errc::checksum_mismatch;
+          }
+        }
+      }
+
+      if(my_error != errc::ok)
+      {
+        my_values = span<const soft_double> { };
+      }
+    }
+
+    ~mapped_array() = default;
+
+    SOFT_DOUBLE_NODISCARD auto error  () const noexcept -> errc { return my_error; }
+    SOFT_DOUBLE_NODISCARD auto is_open() const noexcept -> bool { return (my_error == errc::ok); }
+
+    SOFT_DOUBLE_NODISCARD auto values() const noexcept -> span<const soft_double> { return my_values; }
+
+    SOFT_DOUBLE_NODISCARD auto size () const noexcept -> std::size_t          { return my_values.size(); }
+    SOFT_DOUBLE_NODISCARD auto begin() const noexcept -> const soft_double*   { return my_values.data(); }
+    SOFT_DOUBLE_NODISCARD auto end  () const noexcept -> const soft_double*   { return my_values.data() + my_values.size(); } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    auto operator[](std::size_t i) const noexcept -> const soft_double& { return my_values[i]; }
+
+  private:
+    ::util::memory_mapped_file my_file;
+    span<const soft_double>    my_values { };
+    errc                       my_error  { errc::ok };
+  };
+
+  } // namespace binary
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::softfloat
+  #else
+  } // namespace softfloat
+  } // namespace math
+  #endif
+
+#endif // SOFT_DOUBLE_BINARY_2025_08_10_H
@@ -0,0 +1,378 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2012 - 2025.                 //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef SOFT_DOUBLE_DOUBLE_2025_07_19_H // NOLINT(llvm-header-guard)
+  #define SOFT_DOUBLE_DOUBLE_2025_07_19_H
+
+  #include <cstdint>
+  #include <limits>
+  #include <type_traits>
+
+  #include <math/softfloat/soft_double.h>
+
+  // The double-double type soft_double_double, holding an unevaluated
+  // sum hi + lo of two soft_double values with |lo| <= ulp(hi) / 2.
+  // This gives 106 bits of precision (about 32 decimal digits) with
+  // the exponent range of soft_double.
+
+  // The arithmetic is built on the error-free transformations two_sum
+  // and two_prod of soft_double, which take a rounded result and its
+  // exact error from one pass over the significands. Addition and
+  // multiplication have relative errors of a few units of 2^-106,
+  // division and square root a few more. The results are not correctly
+  // rounded. Where the full 106 bits are needed throughout, soft_quad
+  // is faster, since each operation here takes several soft_double
+  // operations. The type is rather meant for compensated algorithms,
+  // such as summations or dot products that accumulate in double-double
+  // and otherwise compute in soft_double.
+
+  #if(__cplusplus >= 201703L)
+  namespace math::softfloat {
+  #else
+  namespace math { namespace softfloat { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  class soft_double_double;
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::softfloat
+  #else
+  } // namespace softfloat
+  } // namespace math
+  #endif
+
+  namespace std {
+
+  // Forward declaration of the specialization of numeric_limits for soft_double_double.
+  template<>
+  SOFT_DOUBLE_NUM_LIMITS_CLASS_TYPE numeric_limits<::math::softfloat::soft_double_double>;
+
+  } // namespace std
+
+  #if(__cplusplus >= 201703L)
+  namespace math::softfloat {
+  #else
+  namespace math { namespace softfloat { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  class soft_double_double final
+  {
+  public:
+    constexpr soft_double_double() noexcept = default;
+
+    template<typename UnsignedIntegralType,
+             typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
+                                      && std::is_unsigned<UnsignedIntegralType>::value)>::type const* = nullptr>
+    constexpr soft_double_double(UnsignedIntegralType u) noexcept // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+      : soft_double_double(from_ui64(static_cast<std::uint64_t>(u))) { }
+
+    template<typename SignedIntegralType,
+             typename std::enable_if<(   std::is_integral<SignedIntegralType>::value
+                                      && std::is_signed  <SignedIntegralType>::value)>::type const* = nullptr>
+    constexpr soft_double_double(SignedIntegralType n) noexcept // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+      : soft_double_double
+        (
+          (n < static_cast<SignedIntegralType>(0))
+            ? -from_ui64(detail::negate(static_cast<std::uint64_t>(static_cast<std::int64_t>(n))))
+            :  from_ui64(               static_cast<std::uint64_t>(static_cast<std::int64_t>(n)))
+        ) { }
+
+    constexpr soft_double_double(float  f) noexcept : my_hi(soft_double(static_cast<double>(f))) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    constexpr soft_double_double(double d) noexcept : my_hi(soft_double(d)) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    constexpr soft_double_double(const soft_double& d) noexcept : my_hi(d) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    // Construct from two parts that are already normalized,
+    // in other words hi == hi + lo in soft_double arithmetic.
+    constexpr soft_double_double(const soft_double& hi, const soft_double& lo) noexcept : my_hi(hi), my_lo(lo) { }
+
+    constexpr soft_double_double(const soft_double_double&) noexcept = default;
+    constexpr soft_double_double(soft_double_double&&) noexcept = default;
+
+    ~soft_double_double() = default;
+
+    constexpr auto operator=(const soft_double_double&) noexcept -> soft_double_double& = default;
+    constexpr auto operator=(soft_double_double&&) noexcept -> soft_double_double& = default;
+
+    SOFT_DOUBLE_NODISCARD constexpr auto hi() const noexcept -> soft_double { return my_hi; }
+    SOFT_DOUBLE_NODISCARD constexpr auto lo() const noexcept -> soft_double { return my_lo; }
+
+    // The normalized hi part is the sum hi + lo rounded to soft_double.
+    explicit constexpr operator soft_double() const noexcept { return my_hi; }
+
+    explicit constexpr operator float () const noexcept { return static_cast<float> (my_hi); }
+    explicit constexpr operator double() const noexcept { return static_cast<double>(my_hi); }
+
+    explicit constexpr operator long double() const noexcept
+    {
+      return static_cast<long double>(static_cast<long double>(static_cast<double>(my_hi)) + static_cast<long double>(static_cast<double>(my_lo)));
+    }
+
+    constexpr auto operator+=(const soft_double_double& other) noexcept -> soft_double_double& { *this = dd_add(*this, other); return *this; }
+    constexpr auto operator-=(const soft_double_double& other) noexcept -> soft_double_double& { *this = dd_add(*this, -other); return *this; }
+    constexpr auto operator*=(const soft_double_double& other) noexcept -> soft_double_double& { *this = dd_mul(*this, other); return *this; }
+    constexpr auto operator/=(const soft_double_double& other) noexcept -> soft_double_double& { *this = dd_div(*this, other); return *this; }
+
+    constexpr auto operator++() noexcept -> soft_double_double& { *this = dd_add(*this, soft_double_double(soft_double::my_value_one())); return *this; }
+    constexpr auto operator--() noexcept -> soft_double_double& { *this = dd_add(*this, soft_double_double(-soft_double::my_value_one())); return *this; }
+
+    constexpr auto operator++(int) noexcept -> soft_double_double { const auto w = *this; static_cast<void>(++(*this)); return w; }
+    constexpr auto operator--(int) noexcept -> soft_double_double { const auto w = *this; static_cast<void>(--(*this)); return w; }
+
+    constexpr auto operator+() const noexcept -> soft_double_double { return *this; }
+    constexpr auto operator-() const noexcept -> soft_double_double { return soft_double_double { -my_hi, -my_lo }; }
+
+    static constexpr auto my_value_zero       () noexcept -> soft_double_double { return soft_double_double { soft_double::my_value_zero() }; }
+    static constexpr auto my_value_one        () noexcept -> soft_double_double { return soft_double_double { soft_double::my_value_one() }; }
+    static constexpr auto my_value_min        () noexcept -> soft_double_double { return soft_double_double { soft_double { static_cast<std::uint64_t>(UINT64_C(0x0360000000000000)), detail::nothing() } }; }
+    static constexpr auto my_value_max        () noexcept -> soft_double_double { return soft_double_double { soft_double::my_value_max(), soft_double { static_cast<std::uint64_t>(UINT64_C(0x7C8FFFFFFFFFFFFF)), detail::nothing() } }; }
+    static constexpr auto my_value_lowest     () noexcept -> soft_double_double { return -my_value_max(); }
+    static constexpr auto my_value_epsilon    () noexcept -> soft_double_double { return soft_double_double { soft_double { static_cast<std::uint64_t>(UINT64_C(0x3970000000000000)), detail::nothing() } }; }
+    static constexpr auto my_value_round_error() noexcept -> soft_double_double { return soft_double_double { soft_double::my_value_half() }; }
+    static constexpr auto my_value_denorm_min () noexcept -> soft_double_double { return soft_double_double { soft_double::my_value_denorm_min() }; }
+    static constexpr auto my_value_infinity   () noexcept -> soft_double_double { return soft_double_double { soft_double::my_value_infinity() }; }
+    static constexpr auto my_value_quiet_NaN  () noexcept -> soft_double_double { return soft_double_double { soft_double::my_value_quiet_NaN() }; }
+
+    friend constexpr auto operator+(const soft_double_double& a, const soft_double_double& b) noexcept -> soft_double_double { return dd_add(a,  b); }
+    friend constexpr auto operator-(const soft_double_double& a, const soft_double_double& b) noexcept -> soft_double_double { return dd_add(a, -b); }
+    friend constexpr auto operator*(const soft_double_double& a, const soft_double_double& b) noexcept -> soft_double_double { return dd_mul(a,  b); }
+    friend constexpr auto operator/(const soft_double_double& a, const soft_double_double& b) noexcept -> soft_double_double { return dd_div(a,  b); }
+
+    // The comparisons compare the hi parts first, then the lo parts.
+    friend constexpr auto operator==(const soft_double_double& a, const soft_double_double& b) noexcept -> bool { return ((a.my_hi == b.my_hi) && (a.my_lo == b.my_lo)); }
+    friend constexpr auto operator!=(const soft_double_double& a, const soft_double_double& b) noexcept -> bool { return ((a.my_hi != b.my_hi) || (a.my_lo != b.my_lo)); }
+    friend constexpr auto operator< (const soft_double_double& a, const soft_double_double& b) noexcept -> bool { return ((a.my_hi < b.my_hi) || ((a.my_hi == b.my_hi) && (a.my_lo < b.my_lo))); }
+    friend constexpr auto operator<=(const soft_double_double& a, const soft_double_double& b) noexcept -> bool { return ((a.my_hi < b.my_hi) || ((a.my_hi == b.my_hi) && (a.my_lo <= b.my_lo))); }
+    friend constexpr auto operator> (const soft_double_double& a, const soft_double_double& b) noexcept -> bool { return (b <  a); }
+    friend constexpr auto operator>=(const soft_double_double& a, const soft_double_double& b) noexcept -> bool { return (b <= a); }
+
+    friend constexpr auto (isnan)   (const soft_double_double& x) noexcept -> bool { return (hi_is_non_finite(x) && (detail::fracF64UI(x.my_hi.crepresentation()) != static_cast<std::uint64_t>(UINT8_C(0)))); }
+    friend constexpr auto (isinf)   (const soft_double_double& x) noexcept -> bool { return (hi_is_non_finite(x) && (detail::fracF64UI(x.my_hi.crepresentation()) == static_cast<std::uint64_t>(UINT8_C(0)))); }
+    friend constexpr auto (isfinite)(const soft_double_double& x) noexcept -> bool { return (!hi_is_non_finite(x)); }
+    friend constexpr auto (signbit) (const soft_double_double& x) noexcept -> bool { return detail::signF64UI(x.my_hi.crepresentation()); }
+
+    friend constexpr auto abs (const soft_double_double& x) noexcept -> soft_double_double { return (detail::signF64UI(x.my_hi.crepresentation()) ? -x : x); }
+    friend constexpr auto fabs(const soft_double_double& x) noexcept -> soft_double_double { return (detail::signF64UI(x.my_hi.crepresentation()) ? -x : x); }
+
+    friend constexpr auto sqrt(const soft_double_double& x) noexcept -> soft_double_double { return dd_sqrt(x); }
+
+    #if !defined(SOFT_DOUBLE_DISABLE_IOSTREAM)
+    template<typename char_type, typename traits_type>
+    friend auto operator<<(std::basic_ostream<char_type, traits_type>& os, const soft_double_double& f) -> std::basic_ostream<char_type, traits_type>&
+    {
+      // Note that this output stream function relies on native long double,
+      // which limits the number of significant digits that are printed.
+      return (os << static_cast<long double>(f));
+    }
+    #endif // !SOFT_DOUBLE_DISABLE_IOSTREAM
+
+  private:
+    soft_double my_hi { }; // NOLINT(readability-identifier-naming)
+    soft_double my_lo { }; // NOLINT(readability-identifier-naming)
+
+    static constexpr auto hi_is_non_finite(const soft_double_double& x) noexcept -> bool
+    {
+      return (detail::expF64UI(x.my_hi.crepresentation()) == static_cast<std::int16_t>(INT16_C(0x7FF)));
+    }
+
+    static constexpr auto is_zero(const soft_double& x) noexcept -> bool
+    {
+      return (static_cast<std::uint64_t>(x.crepresentation() & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF))) == static_cast<std::uint64_t>(UINT8_C(0)));
+    }
+
+    static constexpr auto normalize(const soft_double& hi, const soft_double& lo) noexcept -> soft_double_double
+    {
+      // Renormalize an unevaluated sum hi + lo.
+      // A non-finite hi is passed on with a zero lo, since the
+      // error terms would otherwise turn into NaN.
+
+      auto err = soft_double { };
+
+      const auto s = two_sum(hi, lo, &err);
+
+      return
+        (detail::expF64UI(s.crepresentation()) == static_cast<std::int16_t>(INT16_C(0x7FF)))
+          ? soft_double_double { s, soft_double::my_value_zero() }
+          : soft_double_double { s, err };
+    }
+
+    static constexpr auto from_ui64(const std::uint64_t u) noexcept -> soft_double_double
+    {
+      // Both 32-bit halves convert exactly, and their sum is then exact in two parts.
+      return
+        normalize
+        (
+          soft_double(static_cast<std::uint64_t>(u & static_cast<std::uint64_t>(UINT64_C(0xFFFFFFFF00000000)))),
+          soft_double(static_cast<std::uint64_t>(u & static_cast<std::uint64_t>(UINT64_C(0x00000000FFFFFFFF))))
+        );
+    }
+
+    static constexpr auto mul_by_soft_double(const soft_double_double& a, const soft_double& b) noexcept -> soft_double_double
+    {
+      auto p2 = soft_double { };
+
+      const auto p1 = two_prod(a.my_hi, b, &p2);
+
+      return normalize(p1, p2 + (a.my_lo * b));
+    }
+
+    static constexpr auto dd_add(const soft_double_double& a, const soft_double_double& b) noexcept -> soft_double_double
+    {
+      // Sum both parts with two_sum, which keeps the relative error
+      // small also under cancellation of the hi parts.
+
+      auto s2 = soft_double { };
+      auto t2 = soft_double { };
+
+      const auto s1 = two_sum(a.my_hi, b.my_hi, &s2);
+      const auto t1 = two_sum(a.my_lo, b.my_lo, &t2);
+
+      const auto u = normalize(s1, s2 + t1);
+
+      return normalize(u.my_hi, u.my_lo + t2);
+    }
+
+    static constexpr auto dd_mul(const soft_double_double& a, const soft_double_double& b) noexcept -> soft_double_double
+    {
+      auto p2 = soft_double { };
+
+      const auto p1 = two_prod(a.my_hi, b.my_hi, &p2);
+
+      return normalize(p1, p2 + ((a.my_hi * b.my_lo) + (a.my_lo * b.my_hi)));
+    }
+
+    static constexpr auto dd_div(const soft_double_double& a, const soft_double_double& b) noexcept -> soft_double_double
+    {
+      // Long division with three soft_double quotient digits,
+      // where each remainder is formed in double-double.
+
+      if(is_zero(b.my_hi))
+      {
+        const auto sign_inf =
+          static_cast<std::uint64_t>
+          (
+              static_cast<std::uint64_t>(a.my_hi.crepresentation() ^ b.my_hi.crepresentation())
+            & static_cast<std::uint64_t>(UINT64_C(0x8000000000000000))
+          );
+
+        return
+          (is_zero(a.my_hi) || detail::isNaNF64UI(a.my_hi.crepresentation()))
+            ? my_value_quiet_NaN()
+            : soft_double_double { soft_double { static_cast<std::uint64_t>(soft_double::my_value_infinity().crepresentation() | sign_inf), detail::nothing() } };
+      }
+
+      const auto q1 = a.my_hi / b.my_hi;
+
+      if(detail::expF64UI(q1.crepresentation()) == static_cast<std::int16_t>(INT16_C(0x7FF)))
+      {
+        return soft_double_double { q1 };
+      }
+
+      auto r = dd_add(a, -mul_by_soft_double(b, q1));
+
+      const auto q2 = r.my_hi / b.my_hi;
+
+      r = dd_add(r, -mul_by_soft_double(b, q2));
+
+      const auto q3 = r.my_hi / b.my_hi;
+
+      const auto q = normalize(q1, q2);
+
+      return dd_add(q, soft_double_double { q3 });
+    }
+
+    static constexpr auto dd_sqrt(const soft_double_double& x) noexcept -> soft_double_double
+    {
+      // One Newton step on the correctly rounded square root s of hi:
+      // sqrt(x) = s + (x - s^2) / (2 s), with s^2 formed exactly.
+
+      if(is_zero(x.my_hi))
+      {
+        return soft_double_double { x.my_hi };
+      }
+
+      if(detail::signF64UI(x.my_hi.crepresentation()))
+      {
+        return my_value_quiet_NaN();
+      }
+
+      const auto s = sqrt(x.my_hi);
+
+      if(detail::expF64UI(s.crepresentation()) == static_cast<std::int16_t>(INT16_C(0x7FF)))
+      {
+        return soft_double_double { s };
+      }
+
+      auto s2_lo = soft_double { };
+
+      const auto s2_hi = two_prod(s, s, &s2_lo);
+
+      const auto r = dd_add(x, -soft_double_double { s2_hi, s2_lo });
+
+      const auto correction = r.my_hi / (s + s);
+
+      auto err = soft_double { };
+
+      const auto hi = two_sum(s, correction, &err);
+
+      return soft_double_double { hi, err };
+    }
+  };
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::softfloat
+  #else
+  } // namespace softfloat
+  } // namespace math
+  #endif
+
+  namespace std {
+
+  // Specialization of numeric_limits for soft_double_double.
+  template<>
+  SOFT_DOUBLE_NUM_LIMITS_CLASS_TYPE numeric_limits<::math::softfloat::soft_double_double>
+  {
+  public:
+    static constexpr bool               is_specialized    = true;
+    static constexpr float_denorm_style has_denorm        = denorm_present;
+    static constexpr bool               has_denorm_loss   = false;
+    static constexpr bool               has_infinity      = true;
+    static constexpr bool               has_quiet_NaN     = true;
+    static constexpr bool               has_signaling_NaN = false;
+    static constexpr bool               is_bounded        = true;
+    static constexpr bool               is_iec559         = false;
+    static constexpr bool               is_integer        = false;
+    static constexpr bool               is_exact          = false;
+    static constexpr bool               is_signed         = true;
+    static constexpr bool               is_modulo         = false;
+    static constexpr bool               traps             = false;
+    static constexpr bool               tinyness_before   = false;
+    static constexpr float_round_style  round_style       = round_to_nearest;
+    static constexpr int                radix             = static_cast<int>(INT8_C(2));
+
+    static constexpr int                digits            = static_cast<int>(INT8_C(106));
+    static constexpr int                digits10          = static_cast<int>(INT8_C(31));
+    static constexpr int                max_digits10      = static_cast<int>(INT8_C(33));
+    static constexpr int                max_exponent      = static_cast<int>(INT16_C(1024));
+    static constexpr int                max_exponent10    = static_cast<int>(INT16_C(308));
+    static constexpr int                min_exponent      = static_cast<int>(INT16_C(-968));
+    static constexpr int                min_exponent10    = static_cast<int>(INT16_C(-291));
+
+    static constexpr auto (min)        () noexcept -> ::math::softfloat::soft_double_double { return ::math::softfloat::soft_double_double::my_value_min(); }
+    static constexpr auto (max)        () noexcept -> ::math::softfloat::soft_double_double { return ::math::softfloat::soft_double_double::my_value_max(); }
+    static constexpr auto lowest       () noexcept -> ::math::softfloat::soft_double_double { return ::math::softfloat::soft_double_double::my_value_lowest(); }
+    static constexpr auto epsilon      () noexcept -> ::math::softfloat::soft_double_double { return ::math::softfloat::soft_double_double::my_value_epsilon(); }
+    static constexpr auto round_error  () noexcept -> ::math::softfloat::soft_double_double { return ::math::softfloat::soft_double_double::my_value_round_error(); }
+    static constexpr auto denorm_min   () noexcept -> ::math::softfloat::soft_double_double { return ::math::softfloat::soft_double_double::my_value_denorm_min(); }
+    static constexpr auto infinity     () noexcept -> ::math::softfloat::soft_double_double { return ::math::softfloat::soft_double_double::my_value_infinity(); }
+    static constexpr auto quiet_NaN    () noexcept -> ::math::softfloat::soft_double_double { return ::math::softfloat::soft_double_double::my_value_quiet_NaN(); }
+    static constexpr auto signaling_NaN() noexcept -> ::math::softfloat::soft_double_double { return ::math::softfloat::soft_double_double::my_value_quiet_NaN(); }
+  };
+
+  } // namespace std
+
+#endif // SOFT_DOUBLE_DOUBLE_2025_07_19_H
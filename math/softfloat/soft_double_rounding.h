@@ -0,0 +1,420 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2012 - 2025.                 //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef SOFT_DOUBLE_ROUNDING_2025_07_26_H // NOLINT(llvm-header-guard)
+  #define SOFT_DOUBLE_ROUNDING_2025_07_26_H
+
+  #include <cstdint>
+  #include <limits>
+  #include <type_traits>
+
+  #include <math/softfloat/soft_double.h>
+
+  // The class template basic_soft_double<RoundingPolicy>, a binary64 type
+  // whose arithmetic rounds in the direction of its rounding policy:
+  // to nearest (ties to even), toward zero, upward or downward.
+
+  // The policy is fixed at compile time. Each operation instantiates the
+  // rounding kernels of soft_double for that one direction, so there is no
+  // run-time rounding mode and no branch on it. The basic operations
+  // +, -, *, /, sqrt and fma are correctly rounded in the direction of the
+  // policy, also for subnormal results, with overflow going to infinity
+  // or to the largest finite value as in IEEE 754. Conversions from 64-bit
+  // integers round by the policy, and conversions to integers round to an
+  // integral value in the direction of the policy.
+
+  // The elementary functions are not provided here. Convert to soft_double
+  // for these, which rounds to nearest.
+
+  #if(__cplusplus >= 201703L)
+  namespace math::softfloat {
+  #else
+  namespace math { namespace softfloat { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  struct round_to_nearest_even
+  {
+    static constexpr detail::round_mode     mode       = detail::round_mode::near_even;
+    static constexpr std::float_round_style round_style = std::round_to_nearest;
+  };
+
+  struct round_toward_zero
+  {
+    static constexpr detail::round_mode     mode       = detail::round_mode::min_mag;
+    static constexpr std::float_round_style round_style = std::round_toward_zero;
+  };
+
+  struct round_upward
+  {
+    static constexpr detail::round_mode     mode       = detail::round_mode::max;
+    static constexpr std::float_round_style round_style = std::round_toward_infinity;
+  };
+
+  struct round_downward
+  {
+    static constexpr detail::round_mode     mode       = detail::round_mode::min;
+    static constexpr std::float_round_style round_style = std::round_toward_neg_infinity;
+  };
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::softfloat
+  #else
+  } // namespace softfloat
+  } // namespace math
+  #endif
+
+  namespace std {
+
+  // Forward declaration of the specialization of numeric_limits for basic_soft_double.
+  template<typename RoundingPolicy>
+  SOFT_DOUBLE_NUM_LIMITS_CLASS_TYPE numeric_limits<::math::softfloat::basic_soft_double<RoundingPolicy>>;
+
+  } // namespace std
+
+  #if(__cplusplus >= 201703L)
+  namespace math::softfloat {
+  #else
+  namespace math { namespace softfloat { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  template<typename RoundingPolicy>
+  class basic_soft_double final
+  {
+  public:
+    using representation_type = std::uint64_t;
+    using rounding_policy     = RoundingPolicy;
+
+    static constexpr detail::round_mode mode = RoundingPolicy::mode;
+
+    constexpr basic_soft_double() noexcept = default;
+
+    template<typename UnsignedIntegralType,
+             typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
+                                      && std::is_unsigned<UnsignedIntegralType>::value)>::type const* = nullptr>
+    constexpr basic_soft_double(UnsignedIntegralType u) noexcept // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+      : my_value(soft_double::my_ui64_to_f64<mode>(static_cast<std::uint64_t>(u))) { }
+
+    template<typename SignedIntegralType,
+             typename std::enable_if<(   std::is_integral<SignedIntegralType>::value
+                                      && std::is_signed  <SignedIntegralType>::value)>::type const* = nullptr>
+    constexpr basic_soft_double(SignedIntegralType n) noexcept // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+      : my_value(soft_double::my__i64_to_f64<mode>(static_cast<std::int64_t>(n))) { }
+
+    // These conversions are exact.
+    constexpr basic_soft_double(float  f) noexcept : my_value(soft_double(f).crepresentation()) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    constexpr basic_soft_double(double d) noexcept : my_value(soft_double(d).crepresentation()) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    constexpr basic_soft_double(const soft_double& d) noexcept : my_value(d.crepresentation()) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    explicit constexpr basic_soft_double(std::uint64_t n, detail::nothing&&) noexcept // NOLINT(hicpp-named-parameter,readability-named-parameter)
+      : my_value(n) { }
+
+    constexpr basic_soft_double(const basic_soft_double&) noexcept = default;
+    constexpr basic_soft_double(basic_soft_double&&) noexcept = default;
+
+    ~basic_soft_double() = default;
+
+    constexpr auto operator=(const basic_soft_double&) noexcept -> basic_soft_double& = default;
+    constexpr auto operator=(basic_soft_double&&) noexcept -> basic_soft_double& = default;
+
+    SOFT_DOUBLE_NODISCARD constexpr auto  representation() const noexcept -> representation_type { return my_value; }
+    SOFT_DOUBLE_NODISCARD constexpr auto crepresentation() const noexcept -> representation_type { return my_value; }
+
+    explicit constexpr operator soft_double() const noexcept { return soft_double { my_value, detail::nothing{} }; }
+
+    explicit constexpr operator double     () const noexcept { return static_cast<double>(soft_double { my_value, detail::nothing{} }); }
+    explicit constexpr operator long double() const noexcept { return static_cast<long double>(soft_double { my_value, detail::nothing{} }); }
+
+    // Conversions to integers round to an integral value in the direction
+    // of the policy, and then take the low bits for the narrower types.
+    template<typename SignedIntegralType,
+             typename std::enable_if<(   std::is_integral<SignedIntegralType>::value
+                                      && std::is_signed  <SignedIntegralType>::value)>::type const* = nullptr>
+    explicit constexpr operator SignedIntegralType() const noexcept { return static_cast<SignedIntegralType>(soft_double::f64_to__i64<mode>(my_value)); }
+
+    template<typename UnsignedIntegralType,
+             typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
+                                      && std::is_unsigned<UnsignedIntegralType>::value)>::type const* = nullptr>
+    explicit constexpr operator UnsignedIntegralType() const noexcept { return static_cast<UnsignedIntegralType>(soft_double::f64_to_ui64<mode>(my_value)); }
+
+    constexpr auto operator+=(const basic_soft_double& other) noexcept -> basic_soft_double& { my_value = my_add(my_value, other.my_value); return *this; }
+    constexpr auto operator-=(const basic_soft_double& other) noexcept -> basic_soft_double& { my_value = my_add(my_value, negated(other.my_value)); return *this; }
+    constexpr auto operator*=(const basic_soft_double& other) noexcept -> basic_soft_double& { my_value = my_mul(my_value, other.my_value); return *this; }
+    constexpr auto operator/=(const basic_soft_double& other) noexcept -> basic_soft_double& { my_value = my_div(my_value, other.my_value); return *this; }
+
+    constexpr auto operator+() const noexcept -> basic_soft_double { return *this; }
+    constexpr auto operator-() const noexcept -> basic_soft_double { return basic_soft_double { negated(my_value), detail::nothing{} }; }
+
+    static constexpr auto my_value_zero       () noexcept -> basic_soft_double { return basic_soft_double { soft_double::my_value_zero() }; }
+    static constexpr auto my_value_one        () noexcept -> basic_soft_double { return basic_soft_double { soft_double::my_value_one() }; }
+    static constexpr auto my_value_min        () noexcept -> basic_soft_double { return basic_soft_double { soft_double::my_value_min() }; }
+    static constexpr auto my_value_max        () noexcept -> basic_soft_double { return basic_soft_double { soft_double::my_value_max() }; }
+    static constexpr auto my_value_lowest     () noexcept -> basic_soft_double { return basic_soft_double { soft_double::my_value_lowest() }; }
+    static constexpr auto my_value_epsilon    () noexcept -> basic_soft_double { return basic_soft_double { soft_double::my_value_epsilon() }; }
+    static constexpr auto my_value_denorm_min () noexcept -> basic_soft_double { return basic_soft_double { soft_double::my_value_denorm_min() }; }
+    static constexpr auto my_value_infinity   () noexcept -> basic_soft_double { return basic_soft_double { soft_double::my_value_infinity() }; }
+    static constexpr auto my_value_quiet_NaN  () noexcept -> basic_soft_double { return basic_soft_double { soft_double::my_value_quiet_NaN() }; }
+
+    // The maximum rounding error is half a unit in the last place
+    // when rounding to nearest and one unit in the last place otherwise.
+    static constexpr auto my_value_round_error() noexcept -> basic_soft_double
+    {
+      return
+        basic_soft_double
+        {
+          (mode == detail::round_mode::near_even) ? soft_double::my_value_round_error() : soft_double::my_value_one()
+        };
+    }
+
+    friend constexpr auto operator+(const basic_soft_double& a, const basic_soft_double& b) noexcept -> basic_soft_double { return basic_soft_double { my_add(a.my_value, b.my_value),          detail::nothing{} }; }
+    friend constexpr auto operator-(const basic_soft_double& a, const basic_soft_double& b) noexcept -> basic_soft_double { return basic_soft_double { my_add(a.my_value, negated(b.my_value)), detail::nothing{} }; }
+    friend constexpr auto operator*(const basic_soft_double& a, const basic_soft_double& b) noexcept -> basic_soft_double { return basic_soft_double { my_mul(a.my_value, b.my_value),          detail::nothing{} }; }
+    friend constexpr auto operator/(const basic_soft_double& a, const basic_soft_double& b) noexcept -> basic_soft_double { return basic_soft_double { my_div(a.my_value, b.my_value),          detail::nothing{} }; }
+
+    // The comparisons are those of soft_double.
+    friend constexpr auto operator==(const basic_soft_double& a, const basic_soft_double& b) noexcept -> bool { return (static_cast<soft_double>(a) == static_cast<soft_double>(b)); }
+    friend constexpr auto operator!=(const basic_soft_double& a, const basic_soft_double& b) noexcept -> bool { return (static_cast<soft_double>(a) != static_cast<soft_double>(b)); }
+    friend constexpr auto operator< (const basic_soft_double& a, const basic_soft_double& b) noexcept -> bool { return (static_cast<soft_double>(a) <  static_cast<soft_double>(b)); }
+    friend constexpr auto operator<=(const basic_soft_double& a, const basic_soft_double& b) noexcept -> bool { return (static_cast<soft_double>(a) <= static_cast<soft_double>(b)); }
+    friend constexpr auto operator> (const basic_soft_double& a, const basic_soft_double& b) noexcept -> bool { return (static_cast<soft_double>(a) >  static_cast<soft_double>(b)); }
+    friend constexpr auto operator>=(const basic_soft_double& a, const basic_soft_double& b) noexcept -> bool { return (static_cast<soft_double>(a) >= static_cast<soft_double>(b)); }
+
+    friend constexpr auto (isnan)   (const basic_soft_double& x) noexcept -> bool { return detail::isNaNF64UI(x.my_value); }
+    friend constexpr auto (isinf)   (const basic_soft_double& x) noexcept -> bool { return is_inf(x.my_value); }
+    friend constexpr auto (isfinite)(const basic_soft_double& x) noexcept -> bool { return (!is_non_finite(x.my_value)); }
+    friend constexpr auto (signbit) (const basic_soft_double& x) noexcept -> bool { return detail::signF64UI(x.my_value); }
+
+    friend constexpr auto abs (const basic_soft_double& x) noexcept -> basic_soft_double { return basic_soft_double { static_cast<std::uint64_t>(x.my_value & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF))), detail::nothing{} }; }
+    friend constexpr auto fabs(const basic_soft_double& x) noexcept -> basic_soft_double { return basic_soft_double { static_cast<std::uint64_t>(x.my_value & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF))), detail::nothing{} }; }
+
+    friend constexpr auto sqrt(const basic_soft_double& x) noexcept -> basic_soft_double { return basic_soft_double { my_sqrt(x.my_value), detail::nothing{} }; }
+
+    friend constexpr auto fma(const basic_soft_double& x, const basic_soft_double& y, const basic_soft_double& z) noexcept -> basic_soft_double
+    {
+      return basic_soft_double { my_fma(x.my_value, y.my_value, z.my_value), detail::nothing{} };
+    }
+
+    #if !defined(SOFT_DOUBLE_DISABLE_IOSTREAM)
+    template<typename char_type, typename traits_type>
+    friend auto operator<<(std::basic_ostream<char_type, traits_type>& os, const basic_soft_double& f) -> std::basic_ostream<char_type, traits_type>&
+    {
+      return (os << static_cast<soft_double>(f));
+    }
+    #endif // !SOFT_DOUBLE_DISABLE_IOSTREAM
+
+  private:
+    representation_type my_value { };
+
+    // The rounding kernels of soft_double expect finite operands (and
+    // a nonzero divisor). The special values are sorted out here first,
+    // as in IEEE 754, on a branch that finite operands rarely take.
+
+    static constexpr auto is_non_finite(std::uint64_t u) noexcept -> bool
+    {
+      return (detail::expF64UI(u) == static_cast<std::int16_t>(INT16_C(0x7FF)));
+    }
+
+    static constexpr auto is_inf(std::uint64_t u) noexcept -> bool
+    {
+      return (is_non_finite(u) && (detail::fracF64UI(u) == static_cast<std::uint64_t>(UINT8_C(0))));
+    }
+
+    static constexpr auto is_zero(std::uint64_t u) noexcept -> bool
+    {
+      return (static_cast<std::uint64_t>(u & static_cast<std::uint64_t>(UINT64_C(0x7FFFFFFFFFFFFFFF))) == static_cast<std::uint64_t>(UINT8_C(0)));
+    }
+
+    static constexpr auto negated(std::uint64_t u) noexcept -> std::uint64_t
+    {
+      return static_cast<std::uint64_t>(u ^ static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)));
+    }
+
+    static constexpr auto sign_ab(std::uint64_t a, std::uint64_t b) noexcept -> bool
+    {
+      return (detail::signF64UI(a) != detail::signF64UI(b));
+    }
+
+    static constexpr auto quiet_nan() noexcept -> std::uint64_t
+    {
+      return soft_double::my_value_quiet_NaN().crepresentation();
+    }
+
+    static constexpr auto my_add(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t
+    {
+      auto result = std::uint64_t { };
+
+      if(is_non_finite(a) || is_non_finite(b))
+      {
+        // The sum of infinities having opposite signs is NaN.
+        result =
+          (
+               detail::isNaNF64UI(a)
+            || detail::isNaNF64UI(b)
+            || (is_non_finite(a) && is_non_finite(b) && sign_ab(a, b))
+          )
+          ? quiet_nan()
+          : (is_non_finite(a) ? a : b);
+      }
+      else
+      {
+        result = soft_double::f64_add<mode>(a, b);
+      }
+
+      return result;
+    }
+
+    static constexpr auto my_mul(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t
+    {
+      auto result = std::uint64_t { };
+
+      if(is_non_finite(a) || is_non_finite(b))
+      {
+        // The product of infinity and zero is NaN.
+        result =
+          (detail::isNaNF64UI(a) || detail::isNaNF64UI(b) || is_zero(a) || is_zero(b))
+            ? quiet_nan()
+            : detail::packToF64UI(sign_ab(a, b), static_cast<std::int16_t>(INT16_C(0x7FF)), static_cast<std::uint64_t>(UINT8_C(0)));
+      }
+      else
+      {
+        result = soft_double::f64_mul<mode>(a, b);
+      }
+
+      return result;
+    }
+
+    static constexpr auto my_div(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t
+    {
+      auto result = std::uint64_t { };
+
+      if(is_non_finite(a) || is_non_finite(b) || is_zero(b))
+      {
+        // Here inf/inf and 0/0 are NaN, inf/b and a/0 are infinite
+        // and a/inf is zero.
+        if(   detail::isNaNF64UI(a)
+           || detail::isNaNF64UI(b)
+           || (is_non_finite(a) && is_non_finite(b))
+           || (is_zero(a) && is_zero(b)))
+        {
+          result = quiet_nan();
+        }
+        else
+        {
+          result =
+            (is_non_finite(a) || is_zero(b))
+              ? detail::packToF64UI(sign_ab(a, b), static_cast<std::int16_t>(INT16_C(0x7FF)), static_cast<std::uint64_t>(UINT8_C(0)))
+              : detail::packToF64UI(sign_ab(a, b), static_cast<int>(INT8_C(0)), static_cast<int>(INT8_C(0)));
+        }
+      }
+      else
+      {
+        result = soft_double::f64_div<mode>(a, b);
+      }
+
+      return result;
+    }
+
+    static constexpr auto my_sqrt(std::uint64_t a) noexcept -> std::uint64_t
+    {
+      auto result = std::uint64_t { };
+
+      if(detail::isNaNF64UI(a) || (detail::signF64UI(a) && (!is_zero(a))))
+      {
+        result = quiet_nan();
+      }
+      else
+      {
+        // The kernel returns a signed zero as is, and so is +inf here.
+        result = (is_non_finite(a) ? a : soft_double::f64_sqrt<mode>(a));
+      }
+
+      return result;
+    }
+
+    static constexpr auto my_fma(std::uint64_t a, std::uint64_t b, std::uint64_t c) noexcept -> std::uint64_t
+    {
+      auto result = std::uint64_t { };
+
+      if(is_non_finite(a) || is_non_finite(b))
+      {
+        // The product is NaN or infinite. It is exact, so it can
+        // simply be added to c.
+        result = my_add(my_mul(a, b), c);
+      }
+      else if(is_non_finite(c))
+      {
+        result = (detail::isNaNF64UI(c) ? quiet_nan() : c);
+      }
+      else
+      {
+        result = soft_double::f64_mulAdd<mode>(a, b, c);
+      }
+
+      return result;
+    }
+  };
+
+  using soft_double_toward_zero = basic_soft_double<round_toward_zero>;
+  using soft_double_upward      = basic_soft_double<round_upward>;
+  using soft_double_downward    = basic_soft_double<round_downward>;
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::softfloat
+  #else
+  } // namespace softfloat
+  } // namespace math
+  #endif
+
+  namespace std {
+
+  // Specialization of numeric_limits for basic_soft_double.
+  template<typename RoundingPolicy>
+  SOFT_DOUBLE_NUM_LIMITS_CLASS_TYPE numeric_limits<::math::softfloat::basic_soft_double<RoundingPolicy>>
+  {
+  private:
+    using local_soft_double_type = ::math::softfloat::basic_soft_double<RoundingPolicy>;
+
+  public:
+    static constexpr bool               is_specialized    = true;
+    static constexpr float_denorm_style has_denorm        = denorm_present;
+    static constexpr bool               has_denorm_loss   = false;
+    static constexpr bool               has_infinity      = true;
+    static constexpr bool               has_quiet_NaN     = true;
+    static constexpr bool               has_signaling_NaN = false;
+    static constexpr bool               is_bounded        = true;
+    static constexpr bool               is_iec559         = false;
+    static constexpr bool               is_integer        = false;
+    static constexpr bool               is_exact          = false;
+    static constexpr bool               is_signed         = true;
+    static constexpr bool               is_modulo         = false;
+    static constexpr bool               traps             = false;
+    static constexpr bool               tinyness_before   = false;
+    static constexpr float_round_style  round_style       = RoundingPolicy::round_style;
+    static constexpr int                radix             = static_cast<int>(INT8_C(2));
+
+    static constexpr int                digits            = static_cast<int>(INT8_C(53));
+    static constexpr int                digits10          = static_cast<int>(INT8_C(15));
+    static constexpr int                max_digits10      = static_cast<int>(INT8_C(17));
+    static constexpr int                max_exponent      = static_cast<int>(INT16_C(1024));
+    static constexpr int                max_exponent10    = static_cast<int>(INT16_C(308));
+    static constexpr int                min_exponent      = static_cast<int>(INT16_C(-1021));
+    static constexpr int                min_exponent10    = static_cast<int>(INT16_C(-307));
+
+    static constexpr auto (min)        () noexcept -> local_soft_double_type { return local_soft_double_type::my_value_min(); }
+    static constexpr auto (max)        () noexcept -> local_soft_double_type { return local_soft_double_type::my_value_max(); }
+    static constexpr auto lowest       () noexcept -> local_soft_double_type { return local_soft_double_type::my_value_lowest(); }
+    static constexpr auto epsilon      () noexcept -> local_soft_double_type { return local_soft_double_type::my_value_epsilon(); }
+    static constexpr auto round_error  () noexcept -> local_soft_double_type { return local_soft_double_type::my_value_round_error(); }
+    static constexpr auto denorm_min   () noexcept -> local_soft_double_type { return local_soft_double_type::my_value_denorm_min(); }
+    static constexpr auto infinity     () noexcept -> local_soft_double_type { return local_soft_double_type::my_value_infinity(); }
+    static constexpr auto quiet_NaN    () noexcept -> local_soft_double_type { return local_soft_double_type::my_value_quiet_NaN(); }
+    static constexpr auto signaling_NaN() noexcept -> local_soft_double_type { return local_soft_double_type::my_value_quiet_NaN(); }
+  };
+
+  } // namespace std
+
+#endif // SOFT_DOUBLE_ROUNDING_2025_07_26_H
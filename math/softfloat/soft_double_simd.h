@@ -0,0 +1,207 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2012 - 2025.                 //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef SOFT_DOUBLE_SIMD_2025_06_21_H // NOLINT(llvm-header-guard)
+  #define SOFT_DOUBLE_SIMD_2025_06_21_H
+
+  #include <array>
+  #include <cstddef>
+  #include <cstdint>
+
+  #include <math/softfloat/soft_double_batch.h>
+
+  // The packed type soft_double_x<LaneCount> holds LaneCount soft_double
+  // values in 64-bit integer lanes. Arithmetic runs the branch-free lane
+  // kernels of soft_double_batch.h across all lanes at once. With 4 or 8
+  // lanes, these map onto AVX2, AVX-512 or NEON integer vectors. Neither
+  // intrinsics nor any particular instruction set are required, however,
+  // since the kernels are portable C++ that the compiler vectorizes.
+
+  // Lanes needing special handling (zero, subnormal, infinite or NaN
+  // operands, underflow or overflow) are blended in from the scalar
+  // kernels. Rounding ties are resolved in the lanes by masks.
+  // Every lane is bit-identical to the corresponding scalar operation.
+
+  #if(__cplusplus >= 201703L)
+  namespace math::softfloat {
+  #else
+  namespace math { namespace softfloat { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  template<const std::size_t LaneCount>
+  class soft_double_x final
+  {
+  public:
+    static_assert(((LaneCount > static_cast<std::size_t>(UINT8_C(0))) && (LaneCount <= batch::detail::block_size)),
+                  "Error: The lane count of soft_double_x must lie in the range [1, 64]");
+
+    using value_type = soft_double;
+
+    // Comparisons return one mask per lane (all ones for true).
+    using mask_type = std::array<std::uint64_t, LaneCount>;
+
+    static constexpr auto lane_count() -> std::size_t { return LaneCount; }
+
+    constexpr soft_double_x() noexcept = default;
+
+    explicit soft_double_x(const soft_double& v) noexcept
+    {
+      my_lanes.fill(v);
+    }
+
+    constexpr soft_double_x(const soft_double_x&) noexcept = default;
+    constexpr soft_double_x(soft_double_x&&) noexcept = default;
+
+    ~soft_double_x() = default;
+
+    constexpr auto operator=(const soft_double_x&) noexcept -> soft_double_x& = default;
+    constexpr auto operator=(soft_double_x&&) noexcept -> soft_double_x& = default;
+
+    static auto load(const soft_double* p) -> soft_double_x
+    {
+      soft_double_x result { };
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < LaneCount; ++i)
+      {
+        result.my_lanes[i] = p[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      return result;
+    }
+
+    auto store(soft_double* p) const -> void
+    {
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < LaneCount; ++i)
+      {
+        p[i] = my_lanes[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+
+    auto operator[](std::size_t i)       ->       soft_double& { return my_lanes[i]; } // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    auto operator[](std::size_t i) const -> const soft_double& { return my_lanes[i]; } // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+    auto operator+=(const soft_double_x& other) -> soft_double_x& { batch::detail::binary_lanes<LaneCount>(my_lanes.data(), other.my_lanes.data(), my_lanes.data(), LaneCount, batch::detail::sign_flip_none(), batch::detail::kernel_add<LaneCount>, [](const soft_double& x, const soft_double& y) { return x + y; }); return *this; }
+    auto operator-=(const soft_double_x& other) -> soft_double_x& { batch::detail::binary_lanes<LaneCount>(my_lanes.data(), other.my_lanes.data(), my_lanes.data(), LaneCount, batch::detail::sign_flip_neg (), batch::detail::kernel_add<LaneCount>, [](const soft_double& x, const soft_double& y) { return x - y; }); return *this; }
+    auto operator*=(const soft_double_x& other) -> soft_double_x& { batch::detail::binary_lanes<LaneCount>(my_lanes.data(), other.my_lanes.data(), my_lanes.data(), LaneCount, batch::detail::sign_flip_none(), batch::detail::kernel_mul<LaneCount>, [](const soft_double& x, const soft_double& y) { return x * y; }); return *this; }
+    auto operator/=(const soft_double_x& other) -> soft_double_x& { batch::detail::binary_lanes<LaneCount>(my_lanes.data(), other.my_lanes.data(), my_lanes.data(), LaneCount, batch::detail::sign_flip_none(), batch::detail::kernel_div<LaneCount>, [](const soft_double& x, const soft_double& y) { return x / y; }); return *this; }
+
+    auto operator+() const -> const soft_double_x& { return *this; }
+
+    auto operator-() const -> soft_double_x
+    {
+      soft_double_x result { };
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < LaneCount; ++i)
+      {
+        result.my_lanes[i] = -my_lanes[i];
+      }
+
+      return result;
+    }
+
+    friend auto operator+(const soft_double_x& a, const soft_double_x& b) -> soft_double_x { return soft_double_x(a) += b; }
+    friend auto operator-(const soft_double_x& a, const soft_double_x& b) -> soft_double_x { return soft_double_x(a) -= b; }
+    friend auto operator*(const soft_double_x& a, const soft_double_x& b) -> soft_double_x { return soft_double_x(a) *= b; }
+    friend auto operator/(const soft_double_x& a, const soft_double_x& b) -> soft_double_x { return soft_double_x(a) /= b; }
+
+    friend auto sqrt(const soft_double_x& a) -> soft_double_x
+    {
+      soft_double_x result { };
+
+      batch::detail::unary_lanes<LaneCount>(a.my_lanes.data(), result.my_lanes.data(), LaneCount, batch::detail::kernel_sqrt<LaneCount>, [](const soft_double& x) { return sqrt(x); });
+
+      return result;
+    }
+
+    // The comparisons follow my_lt and my_le of soft_double
+    // (and the bitwise equality of operator==) lane by lane.
+
+    friend auto operator==(const soft_double_x& a, const soft_double_x& b) -> mask_type { return compare(a, b, [](std::uint64_t ua, std::uint64_t ub) { return batch::detail::mask_of(ua == ub); }); }
+    friend auto operator!=(const soft_double_x& a, const soft_double_x& b) -> mask_type { return compare(a, b, [](std::uint64_t ua, std::uint64_t ub) { return batch::detail::mask_of(ua != ub); }); }
+    friend auto operator< (const soft_double_x& a, const soft_double_x& b) -> mask_type { return compare(a, b, [](std::uint64_t ua, std::uint64_t ub) { return lane_lt(ua, ub); }); }
+    friend auto operator<=(const soft_double_x& a, const soft_double_x& b) -> mask_type { return compare(a, b, [](std::uint64_t ua, std::uint64_t ub) { return lane_le(ua, ub); }); }
+    friend auto operator> (const soft_double_x& a, const soft_double_x& b) -> mask_type { return compare(a, b, [](std::uint64_t ua, std::uint64_t ub) { return static_cast<std::uint64_t>(~lane_le(ua, ub)); }); }
+    friend auto operator>=(const soft_double_x& a, const soft_double_x& b) -> mask_type { return compare(a, b, [](std::uint64_t ua, std::uint64_t ub) { return static_cast<std::uint64_t>(~lane_lt(ua, ub)); }); }
+
+    // Blend: lane i of the result is a[i] where mask[i] is set, else b[i].
+    friend auto select(const mask_type& mask, const soft_double_x& a, const soft_double_x& b) -> soft_double_x
+    {
+      soft_double_x result { };
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < LaneCount; ++i)
+      {
+        result.my_lanes[i] =
+          soft_double
+          (
+            batch::detail::select(mask[i], a.my_lanes[i].crepresentation(), b.my_lanes[i].crepresentation()),
+            detail::nothing()
+          );
+      }
+
+      return result;
+    }
+
+  private:
+    std::array<soft_double, LaneCount> my_lanes { };
+
+    static constexpr auto sign_mask() -> std::uint64_t { return batch::detail::sign_flip_neg(); }
+
+    static constexpr auto lane_lt(std::uint64_t ua, std::uint64_t ub) -> std::uint64_t
+    {
+      const auto sign_a = batch::detail::mask_of((ua & sign_mask()) != static_cast<std::uint64_t>(UINT8_C(0)));
+
+      const auto both_are_zero = batch::detail::mask_of(static_cast<std::uint64_t>(static_cast<std::uint64_t>(ua | ub) & static_cast<std::uint64_t>(~sign_mask())) == static_cast<std::uint64_t>(UINT8_C(0)));
+
+      return
+        batch::detail::select
+        (
+          batch::detail::mask_of(static_cast<std::uint64_t>(ua ^ ub) >= sign_mask()),
+          static_cast<std::uint64_t>(sign_a & static_cast<std::uint64_t>(~both_are_zero)),
+          static_cast<std::uint64_t>(batch::detail::mask_of(ua != ub) & static_cast<std::uint64_t>(sign_a ^ batch::detail::mask_of(ua < ub)))
+        );
+    }
+
+    static constexpr auto lane_le(std::uint64_t ua, std::uint64_t ub) -> std::uint64_t
+    {
+      const auto sign_a = batch::detail::mask_of((ua & sign_mask()) != static_cast<std::uint64_t>(UINT8_C(0)));
+
+      const auto both_are_zero = batch::detail::mask_of(static_cast<std::uint64_t>(static_cast<std::uint64_t>(ua | ub) & static_cast<std::uint64_t>(~sign_mask())) == static_cast<std::uint64_t>(UINT8_C(0)));
+
+      return
+        batch::detail::select
+        (
+          batch::detail::mask_of(static_cast<std::uint64_t>(ua ^ ub) >= sign_mask()),
+          static_cast<std::uint64_t>(sign_a | both_are_zero),
+          static_cast<std::uint64_t>(batch::detail::mask_of(ua == ub) | static_cast<std::uint64_t>(sign_a ^ batch::detail::mask_of(ua < ub)))
+        );
+    }
+
+    template<typename LaneCompareFunctionType>
+    static auto compare(const soft_double_x& a, const soft_double_x& b, LaneCompareFunctionType lane_compare) -> mask_type
+    {
+      mask_type result { };
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < LaneCount; ++i)
+      {
+        result[i] = lane_compare(a.my_lanes[i].crepresentation(), b.my_lanes[i].crepresentation());
+      }
+
+      return result;
+    }
+  };
+
+  using soft_double_x4 = soft_double_x<static_cast<std::size_t>(UINT8_C(4))>;
+  using soft_double_x8 = soft_double_x<static_cast<std::size_t>(UINT8_C(8))>;
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::softfloat
+  #else
+  } // namespace softfloat
+  } // namespace math
+  #endif
+
+#endif // SOFT_DOUBLE_SIMD_2025_06_21_H
@@ -0,0 +1,350 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2012 - 2025.                 //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef SOFT_DOUBLE_TEXT_READER_2025_08_03_H // NOLINT(llvm-header-guard)
+  #define SOFT_DOUBLE_TEXT_READER_2025_08_03_H
+
+  #include <algorithm>
+  #include <cstddef>
+  #include <cstdint>
+  #include <fstream>
+  #include <istream>
+  #include <thread>
+  #include <vector>
+
+  #include <math/softfloat/soft_double.h>
+  #include <util/utility/util_memory_mapped_file.h>
+
+  // Reading of many soft_double values from text, as in files of
+  // comma-separated or white-space-separated columns. The values
+  // are appended in the order of the text (row by row) to one
+  // contiguous vector.
+
+  // Each value is converted with from_chars, so that native double
+  // is not needed. The fields are separated by white space and/or
+  // the delimiter, and a leading plus sign is accepted. An empty
+  // field, as between two delimiters, or any other text is an error.
+
+  // A file is mapped into memory if possible, and read in chunks
+  // ending on line boundaries otherwise. Larger texts can be split
+  // on line boundaries for several threads, each of which parses
+  // its part into a vector of its own. These are joined in order.
+
+  #if(__cplusplus >= 201703L)
+  namespace math::softfloat::text {
+  #else
+  namespace math { namespace softfloat { namespace text { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  // The delimiter is used besides white space. A thread count of 0
+  // takes that of the hardware. The chunk size applies to streams.
+  struct read_options
+  {
+    char        delimiter    { ',' };                                          // NOLINT(misc-non-private-member-variables-in-classes)
+    unsigned    thread_count { static_cast<unsigned>(UINT8_C(1)) };            // NOLINT(misc-non-private-member-variables-in-classes)
+    std::size_t chunk_size   { static_cast<std::size_t>(UINT32_C(0x400000)) }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  // The count of values appended, and for the first error its code
+  // and line (counted from 1). A file that can not be opened or read,
+  // such as a directory, is reported as invalid_argument on line 0.
+  struct read_result
+  {
+    std::size_t count { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::size_t line  { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    chars_errc  ec    { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  namespace detail {
+
+  // Below this size per thread, additional threads do not pay off.
+  constexpr auto min_bytes_per_thread = static_cast<std::size_t>(UINT32_C(0x10000));
+
+  struct chunk_result
+  {
+    std::size_t count { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::size_t lines { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    chars_errc  ec    { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  inline auto is_blank(char c) -> bool
+  {
+    return ((c == ' ') || (c == '\t') || (c == '\r'));
+  }
+
+  inline auto parse_chunk(const char* first, const char* last, std::vector<soft_double>& values, char delimiter) -> chunk_result
+  {
+    // Parse up to the first error. The count of lines is that of the
+    // line ends passed, so that it gives the line of an error.
+
+    auto result = chunk_result { };
+
+    auto after_value     = false;
+    auto after_delimiter = false;
+
+    auto p = first;
+
+    while((p != last) && (result.ec == chars_errc { }))
+    {
+      const auto c = *p;
+
+      if(is_blank(c))
+      {
+        ++p;
+      }
+      else if(c == '\n')
+      {
+        result.ec = (after_delimiter ? chars_errc::invalid_argument : chars_errc { });
+
+        if(!after_delimiter)
+        {
+          ++result.lines;
+          ++p;
+
+          after_value = false;
+        }
+      }
+      else if(c == delimiter)
+      {
+        result.ec = (after_value ? chars_errc { } : chars_errc::invalid_argument);
+
+        ++p;
+
+        after_value     = false;
+        after_delimiter = true;
+      }
+      else
+      {
+        const auto start = static_cast<const char*>(((c == '+') && (static_cast<std::ptrdiff_t>(last - p) > static_cast<std::ptrdiff_t>(INT8_C(1))) && (*(p + 1) != '-')) ? (p + 1) : p); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        auto x = soft_double { };
+
+        const auto res = from_chars(start, last, x);
+
+        // A value must be followed by a separator.
+        const auto is_separated = ((res.ptr == last) || is_blank(*res.ptr) || (*res.ptr == '\n') || (*res.ptr == delimiter));
+
+        result.ec = ((res.ec != chars_errc { }) ? res.ec : (is_separated ? chars_errc { } : chars_errc::invalid_argument));
+
+        if(result.ec == chars_errc { })
+        {
+          values.push_back(x);
+
+          ++result.count;
+
+          p = res.ptr;
+
+          after_value     = true;
+          after_delimiter = false;
+        }
+      }
+    }
+
+    if((result.ec == chars_errc { }) && after_delimiter)
+    {
+      result.ec = chars_errc::invalid_argument;
+    }
+
+    return result;
+  }
+
+  } // namespace detail
+
+  // Parse the text in [first, last), appending the values.
+  inline auto parse(const char* first, const char* last, std::vector<soft_double>& values, const read_options& options = read_options { }) -> read_result
+  {
+    const auto size = static_cast<std::size_t>(last - first);
+
+    auto thread_count = ((options.thread_count == 0U) ? std::thread::hardware_concurrency() : options.thread_count);
+
+    if(thread_count == 0U)
+    {
+      thread_count = 1U;
+    }
+
+    if(static_cast<std::size_t>(size / thread_count) < detail::min_bytes_per_thread)
+    {
+      thread_count = static_cast<unsigned>(static_cast<std::size_t>(size / detail::min_bytes_per_thread) + 1U);
+    }
+
+    auto result = read_result { };
+
+    if(thread_count == 1U)
+    {
+      const auto res = detail::parse_chunk(first, last, values, options.delimiter);
+
+      result = read_result { res.count, ((res.ec == chars_errc { }) ? static_cast<std::size_t>(UINT8_C(0)) : static_cast<std::size_t>(res.lines + 1U)), res.ec };
+    }
+    else
+    {
+      // Split the text after line ends near equal parts.
+      std::vector<const char*> bounds(static_cast<std::size_t>(thread_count + 1U), first);
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(1)); i < thread_count; ++i)
+      {
+        auto q = first + static_cast<std::size_t>(static_cast<std::size_t>(size / thread_count) * i); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        q = ((q < bounds[i - 1U]) ? bounds[i - 1U] : q);
+
+        while((q != last) && (*q != '\n'))
+        {
+          ++q;
+        }
+
+        bounds[i] = ((q != last) ? (q + 1) : q); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      bounds.back() = last;
+
+      std::vector<std::vector<soft_double>> parts  (static_cast<std::size_t>(thread_count));
+      std::vector<detail::chunk_result>     results(static_cast<std::size_t>(thread_count));
+      std::vector<std::thread>              threads;
+
+      threads.reserve(static_cast<std::size_t>(thread_count));
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < thread_count; ++i)
+      {
+        threads.emplace_back
+        (
+          [&bounds, &parts, &results, &options, i]()
+          {
+            results[i] = detail::parse_chunk(bounds[i], bounds[i + 1U], parts[i], options.delimiter);
+          }
+        );
+      }
+
+      for(auto& t : threads)
+      {
+        t.join();
+      }
+
+      // Join the parts in order, up to the first error.
+      auto total = values.size();
+
+      for(const auto& part : parts)
+      {
+        total += part.size();
+      }
+
+      values.reserve(total);
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); ((i < thread_count) && (result.ec == chars_errc { })); ++i)
+      {
+        values.insert(values.end(), parts[i].cbegin(), parts[i].cend());
+
+        result.count += results[i].count;
+        result.line  += results[i].lines;
+        result.ec     = results[i].ec;
+      }
+
+      result.line = ((result.ec == chars_errc { }) ? static_cast<std::size_t>(UINT8_C(0)) : static_cast<std::size_t>(result.line + 1U));
+    }
+
+    return result;
+  }
+
+  // Read the text of a stream in chunks, each of which ends on a
+  // line boundary and is parsed as above. Only a line longer than
+  // the chunk size enlarges the buffer.
+  inline auto read(std::istream& is, std::vector<soft_double>& values, const read_options& options = read_options { }) -> read_result
+  {
+    std::vector<char> buffer((options.chunk_size == 0U) ? static_cast<std::size_t>(UINT32_C(0x400000)) : options.chunk_size);
+
+    auto result = read_result { };
+
+    auto kept     = static_cast<std::size_t>(UINT8_C(0));
+    auto lines    = static_cast<std::size_t>(UINT8_C(0));
+    auto is_final = false;
+
+    while((!is_final) && (result.ec == chars_errc { }))
+    {
+      static_cast<void>(is.read(buffer.data() + kept, static_cast<std::streamsize>(buffer.size() - kept))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      // A stream that fails other than at its end, for instance one
+      // opened on a directory, can not be read.
+      const auto has_read_error = (is.fail() && (!is.eof()));
+
+      const auto filled = static_cast<std::size_t>(kept + static_cast<std::size_t>(is.gcount()));
+
+      is_final = (has_read_error || (filled < buffer.size()));
+
+      auto end = filled;
+
+      if(!is_final)
+      {
+        while((end != static_cast<std::size_t>(UINT8_C(0))) && (buffer[end - 1U] != '\n'))
+        {
+          --end;
+        }
+      }
+
+      if(has_read_error)
+      {
+        result.line = static_cast<std::size_t>(UINT8_C(0));
+        result.ec   = chars_errc::invalid_argument;
+      }
+      else if((!is_final) && (end == static_cast<std::size_t>(UINT8_C(0))))
+      {
+        kept = filled;
+
+        buffer.resize(static_cast<std::size_t>(buffer.size() * 2U));
+      }
+      else
+      {
+        const auto res = parse(buffer.data(), buffer.data() + end, values, options); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        result.count += res.count;
+        result.ec     = res.ec;
+        result.line   = ((res.ec == chars_errc { }) ? static_cast<std::size_t>(UINT8_C(0)) : static_cast<std::size_t>(lines + res.line));
+
+        for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < end; ++i)
+        {
+          lines += ((buffer[i] == '\n') ? 1U : 0U);
+        }
+
+        kept = static_cast<std::size_t>(filled - end);
+
+        std::copy(buffer.cbegin() + static_cast<std::ptrdiff_t>(end), buffer.cbegin() + static_cast<std::ptrdiff_t>(filled), buffer.begin());
+      }
+    }
+
+    return result;
+  }
+
+  // Read the text of a file, which is mapped into memory if possible.
+  inline auto read_file(const char* path, std::vector<soft_double>& values, const read_options& options = read_options { }) -> read_result
+  {
+    auto result = read_result { static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(UINT8_C(0)), chars_errc::invalid_argument };
+
+    const ::util::memory_mapped_file file(path);
+
+    if(file.is_open())
+    {
+      result = parse(file.begin(), file.end(), values, options);
+    }
+    else
+    {
+      std::ifstream in(path, std::ios::in | std::ios::binary);
+
+      if(in.is_open())
+      {
+        result = read(in, values, options);
+      }
+    }
+
+    return result;
+  }
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::softfloat::text
+  #else
+  } // namespace text
+  } // namespace softfloat
+  } // namespace math
+  #endif
+
+#endif // SOFT_DOUBLE_TEXT_READER_2025_08_03_H
@@ -0,0 +1,874 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2012 - 2025.                 //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef SOFT_FLOAT_2025_07_05_H // NOLINT(llvm-header-guard)
+  #define SOFT_FLOAT_2025_07_05_H
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <limits>
+  #include <type_traits>
+
+  #include <math/softfloat/soft_double.h>
+
+  // Generic IEEE-754 binary interchange formats soft_float<ExpBits, FracBits>
+  // having one sign bit, ExpBits exponent bits and FracBits stored fraction bits.
+
+  // The kernels for addition, subtraction, multiplication, division and
+  // square root are written once for all formats. They round to nearest
+  // (with ties to even), support subnormals, infinities and NaN, and
+  // are correctly rounded. The significands are held in the narrowest
+  // unsigned integral types that suffice (as selected by uint_type_helper),
+  // so that (for instance) soft_float16 gets by with 16-bit and 32-bit
+  // arithmetic. This pays off on small 8/16-bit microcontrollers.
+
+  // The formats are limited to at most 32 bits in total. The 64-bit
+  // format is soft_double itself, whose kernels rely on 128-bit products.
+  // All formats convert exactly to soft_double (and are rounded correctly
+  // when converted back). The elementary functions can be evaluated
+  // via soft_double.
+
+  #if(__cplusplus >= 201703L)
+  namespace math::softfloat {
+  #else
+  namespace math { namespace softfloat { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  template<const unsigned ExpBits,
+           const unsigned FracBits>
+  class soft_float;
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::softfloat
+  #else
+  } // namespace softfloat
+  } // namespace math
+  #endif
+
+  namespace std {
+
+  // Forward declaration of the specialization of numeric_limits for soft_float.
+  template<const unsigned ExpBits,
+           const unsigned FracBits>
+  SOFT_DOUBLE_NUM_LIMITS_CLASS_TYPE numeric_limits<::math::softfloat::soft_float<ExpBits, FracBits>>;
+
+  } // namespace std
+
+  #if(__cplusplus >= 201703L)
+  namespace math::softfloat {
+  #else
+  namespace math { namespace softfloat { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  namespace detail {
+
+  template<typename UnsignedIntegralType>
+  constexpr auto soft_float_clz(UnsignedIntegralType a) -> unsigned
+  {
+    // Returns the number of leading 0 bits of a within its own width.
+    // The narrowest of the count-leading-zeros functions is used.
+    constexpr auto width = static_cast<unsigned>(std::numeric_limits<UnsignedIntegralType>::digits);
+
+    return
+      static_cast<unsigned>
+      (
+        (width <= static_cast<unsigned>(UINT8_C(16)))
+          ? static_cast<unsigned>(softfloat_countLeadingZeros16(static_cast<std::uint16_t>(a)) - static_cast<unsigned>(static_cast<unsigned>(UINT8_C(16)) - width))
+          : ((width <= static_cast<unsigned>(UINT8_C(32)))
+              ? static_cast<unsigned>(softfloat_countLeadingZeros32(static_cast<std::uint32_t>(a)))
+              : static_cast<unsigned>(softfloat_countLeadingZeros64(static_cast<std::uint64_t>(a))))
+      );
+  }
+
+  template<typename UnsignedIntegralType>
+  constexpr auto soft_float_shift_right_jam(UnsignedIntegralType a, unsigned dist) -> UnsignedIntegralType
+  {
+    // Shifts a right by dist bits. Any nonzero bits shifted off are
+    // "jammed" into the least significant bit of the result.
+    constexpr auto width = static_cast<unsigned>(std::numeric_limits<UnsignedIntegralType>::digits);
+
+    using local_unsigned_type = UnsignedIntegralType;
+
+    return
+      static_cast<local_unsigned_type>
+      (
+        (dist == static_cast<unsigned>(UINT8_C(0)))
+          ? a
+          : ((dist < width)
+              ? static_cast<local_unsigned_type>
+                (
+                    static_cast<local_unsigned_type>(a >> dist)
+                  | static_cast<local_unsigned_type>
+                    (
+                      (static_cast<local_unsigned_type>(a & static_cast<local_unsigned_type>(static_cast<local_unsigned_type>(static_cast<local_unsigned_type>(1U) << dist) - static_cast<local_unsigned_type>(1U))) != static_cast<local_unsigned_type>(0U))
+                        ? static_cast<local_unsigned_type>(1U)
+                        : static_cast<local_unsigned_type>(0U)
+                    )
+                )
+              : static_cast<local_unsigned_type>((a != static_cast<local_unsigned_type>(0U)) ? static_cast<local_unsigned_type>(1U) : static_cast<local_unsigned_type>(0U)))
+      );
+  }
+
+  } // namespace detail
+
+  template<const unsigned ExpBits,
+           const unsigned FracBits>
+  class soft_float final
+  {
+  private:
+    // The significands carry this many extra low-order bits
+    // (guard, round and sticky) before rounding.
+    static constexpr auto guard_bits = static_cast<unsigned>(UINT8_C(3));
+
+  public:
+    static_assert((ExpBits >= static_cast<unsigned>(UINT8_C(2))) && (ExpBits <= static_cast<unsigned>(UINT8_C(10))),
+                  "Error: The exponent field of soft_float must have between 2 and 10 bits");
+
+    static_assert((FracBits >= static_cast<unsigned>(UINT8_C(1))) && ((static_cast<unsigned>(UINT8_C(1)) + ExpBits + FracBits) <= static_cast<unsigned>(UINT8_C(32))),
+                  "Error: soft_float is intended for formats having at most 32 bits (use soft_double for 64 bits)");
+
+    using representation_type = typename detail::uint_type_helper<static_cast<int>(static_cast<unsigned>(UINT8_C(1)) + ExpBits + FracBits)>::exact_unsigned_type;
+
+    // The significand type holds the hidden bit, the fraction, the
+    // guard bits and one carry bit. The wide type holds the double-width
+    // products, dividends and radicands of the significands.
+    using significand_type = typename detail::uint_type_helper<static_cast<int>(FracBits + guard_bits + static_cast<unsigned>(UINT8_C(2)))>::exact_unsigned_type;
+    using wide_type        = typename detail::uint_type_helper<static_cast<int>(static_cast<unsigned>(UINT8_C(2)) * (FracBits + guard_bits + static_cast<unsigned>(UINT8_C(1))))>::exact_unsigned_type;
+
+    using exponent_type = std::int16_t;
+
+    static constexpr auto exponent_bits = ExpBits;
+    static constexpr auto fraction_bits = FracBits;
+
+    constexpr soft_float() noexcept = default;
+
+    template<typename UnsignedIntegralType,
+             typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
+                                      && std::is_unsigned<UnsignedIntegralType>::value)>::type const* = nullptr>
+    constexpr soft_float(UnsignedIntegralType u) noexcept : my_value(sf_from_ui64(false, static_cast<std::uint64_t>(u))) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    template<typename SignedIntegralType,
+             typename std::enable_if<(   std::is_integral<SignedIntegralType>::value
+                                      && std::is_signed  <SignedIntegralType>::value)>::type const* = nullptr>
+    constexpr soft_float(SignedIntegralType n) noexcept // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+      : my_value
+        (
+          sf_from_ui64
+          (
+            (n < static_cast<SignedIntegralType>(0)),
+            (n < static_cast<SignedIntegralType>(0)) ? detail::negate(static_cast<std::uint64_t>(static_cast<std::int64_t>(n)))
+                                                     :                static_cast<std::uint64_t>(static_cast<std::int64_t>(n))
+          )
+        ) { }
+
+    // A float is widened via double, which is exact also for subnormal floats.
+    constexpr soft_float(float  f) noexcept : my_value(sf_from_f64(soft_double(static_cast<double>(f)).crepresentation())) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    constexpr soft_float(double d) noexcept : my_value(sf_from_f64(soft_double(d).crepresentation())) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    explicit constexpr soft_float(const soft_double& d) noexcept : my_value(sf_from_f64(d.crepresentation())) { }
+
+    constexpr soft_float(const representation_type u, const detail::nothing&) noexcept : my_value(u) { }
+
+    constexpr soft_float(const soft_float&) noexcept = default;
+    constexpr soft_float(soft_float&&) noexcept = default;
+
+    ~soft_float() = default;
+
+    constexpr auto operator=(const soft_float&) noexcept -> soft_float& = default;
+    constexpr auto operator=(soft_float&&) noexcept -> soft_float& = default;
+
+    SOFT_DOUBLE_NODISCARD constexpr auto  representation() noexcept ->       representation_type& { return my_value; }
+    SOFT_DOUBLE_NODISCARD constexpr auto  representation() const noexcept -> representation_type  { return my_value; }
+    SOFT_DOUBLE_NODISCARD constexpr auto crepresentation() const noexcept -> representation_type  { return my_value; }
+
+    // The conversion to soft_double is exact. All other conversions are via soft_double.
+    explicit constexpr operator soft_double() const noexcept { return soft_double { sf_to_f64(my_value), detail::nothing() }; }
+
+    explicit constexpr operator float      () const noexcept { return static_cast<float>      (static_cast<double>(*this)); }
+    explicit constexpr operator double     () const noexcept { return static_cast<double>     (static_cast<soft_double>(*this)); }
+    explicit constexpr operator long double() const noexcept { return static_cast<long double>(static_cast<soft_double>(*this)); }
+
+    explicit constexpr operator std::int32_t () const noexcept { return static_cast<std::int32_t> (static_cast<soft_double>(*this)); }
+    explicit constexpr operator std::int64_t () const noexcept { return static_cast<std::int64_t> (static_cast<soft_double>(*this)); }
+    explicit constexpr operator std::uint32_t() const noexcept { return static_cast<std::uint32_t>(static_cast<soft_double>(*this)); }
+    explicit constexpr operator std::uint64_t() const noexcept { return static_cast<std::uint64_t>(static_cast<soft_double>(*this)); }
+
+    constexpr auto operator+=(const soft_float& other) noexcept -> soft_float& { my_value = sf_add(my_value, other.my_value); return *this; }
+    constexpr auto operator-=(const soft_float& other) noexcept -> soft_float& { my_value = sf_sub(my_value, other.my_value); return *this; }
+    constexpr auto operator*=(const soft_float& other) noexcept -> soft_float& { my_value = sf_mul(my_value, other.my_value); return *this; }
+    constexpr auto operator/=(const soft_float& other) noexcept -> soft_float& { my_value = sf_div(my_value, other.my_value); return *this; }
+
+    constexpr auto operator++() noexcept -> soft_float& { my_value = sf_add(my_value, my_value_one().my_value); return *this; }
+    constexpr auto operator--() noexcept -> soft_float& { my_value = sf_sub(my_value, my_value_one().my_value); return *this; }
+
+    constexpr auto operator++(int) noexcept -> soft_float { const auto w = *this; static_cast<void>(++(*this)); return w; }
+    constexpr auto operator--(int) noexcept -> soft_float { const auto w = *this; static_cast<void>(--(*this)); return w; }
+
+    constexpr auto operator+() const noexcept -> soft_float { return soft_float { my_value, detail::nothing() }; }
+    constexpr auto operator-() const noexcept -> soft_float { return soft_float { static_cast<representation_type>(my_value ^ sign_mask()), detail::nothing() }; }
+
+    static constexpr auto my_value_zero      () noexcept -> soft_float { return soft_float { static_cast<representation_type>(0U), detail::nothing() }; }
+    static constexpr auto my_value_one       () noexcept -> soft_float { return soft_float { static_cast<representation_type>(static_cast<representation_type>(bias()) << FracBits), detail::nothing() }; }
+    static constexpr auto my_value_min       () noexcept -> soft_float { return soft_float { static_cast<representation_type>(static_cast<representation_type>(1U) << FracBits), detail::nothing() }; }
+    static constexpr auto my_value_max       () noexcept -> soft_float { return soft_float { static_cast<representation_type>(exp_mask() - static_cast<representation_type>(1U)), detail::nothing() }; }
+    static constexpr auto my_value_lowest    () noexcept -> soft_float { return soft_float { static_cast<representation_type>(sign_mask() | static_cast<representation_type>(exp_mask() - static_cast<representation_type>(1U))), detail::nothing() }; }
+    static constexpr auto my_value_epsilon   () noexcept -> soft_float { return soft_float { sf_round_pack(false, static_cast<exponent_type>(bias() - static_cast<exponent_type>(FracBits)), static_cast<significand_type>(static_cast<significand_type>(1U) << lead_bit)), detail::nothing() }; }
+    static constexpr auto my_value_round_error() noexcept -> soft_float { return soft_float { sf_round_pack(false, static_cast<exponent_type>(bias() - static_cast<exponent_type>(1)), static_cast<significand_type>(static_cast<significand_type>(1U) << lead_bit)), detail::nothing() }; }
+    static constexpr auto my_value_denorm_min() noexcept -> soft_float { return soft_float { static_cast<representation_type>(1U), detail::nothing() }; }
+    static constexpr auto my_value_infinity  () noexcept -> soft_float { return soft_float { exp_mask(), detail::nothing() }; }
+    static constexpr auto my_value_quiet_NaN () noexcept -> soft_float { return soft_float { static_cast<representation_type>(exp_mask() | quiet_bit()), detail::nothing() }; }
+
+    friend constexpr auto operator+(const soft_float& a, const soft_float& b) noexcept -> soft_float { return soft_float { sf_add(a.my_value, b.my_value), detail::nothing() }; }
+    friend constexpr auto operator-(const soft_float& a, const soft_float& b) noexcept -> soft_float { return soft_float { sf_sub(a.my_value, b.my_value), detail::nothing() }; }
+    friend constexpr auto operator*(const soft_float& a, const soft_float& b) noexcept -> soft_float { return soft_float { sf_mul(a.my_value, b.my_value), detail::nothing() }; }
+    friend constexpr auto operator/(const soft_float& a, const soft_float& b) noexcept -> soft_float { return soft_float { sf_div(a.my_value, b.my_value), detail::nothing() }; }
+
+    // The comparisons follow IEEE-754: NaN is unordered and -0 == +0.
+    friend constexpr auto operator==(const soft_float& a, const soft_float& b) noexcept -> bool { return   sf_eq(a.my_value, b.my_value); }
+    friend constexpr auto operator!=(const soft_float& a, const soft_float& b) noexcept -> bool { return (!sf_eq(a.my_value, b.my_value)); }
+    friend constexpr auto operator< (const soft_float& a, const soft_float& b) noexcept -> bool { return   sf_lt(a.my_value, b.my_value); }
+    friend constexpr auto operator<=(const soft_float& a, const soft_float& b) noexcept -> bool { return   sf_le(a.my_value, b.my_value); }
+    friend constexpr auto operator> (const soft_float& a, const soft_float& b) noexcept -> bool { return   sf_lt(b.my_value, a.my_value); }
+    friend constexpr auto operator>=(const soft_float& a, const soft_float& b) noexcept -> bool { return   sf_le(b.my_value, a.my_value); }
+
+    friend constexpr auto (isnan)   (const soft_float& x) noexcept -> bool { return (static_cast<representation_type>(x.my_value & abs_mask()) >  exp_mask()); }
+    friend constexpr auto (isinf)   (const soft_float& x) noexcept -> bool { return (static_cast<representation_type>(x.my_value & abs_mask()) == exp_mask()); }
+    friend constexpr auto (isfinite)(const soft_float& x) noexcept -> bool { return (static_cast<representation_type>(x.my_value & abs_mask()) <  exp_mask()); }
+    friend constexpr auto (signbit) (const soft_float& x) noexcept -> bool { return (static_cast<representation_type>(x.my_value & sign_mask()) != static_cast<representation_type>(0U)); }
+
+    friend constexpr auto abs (const soft_float& x) noexcept -> soft_float { return soft_float { static_cast<representation_type>(x.my_value & abs_mask()), detail::nothing() }; }
+    friend constexpr auto fabs(const soft_float& x) noexcept -> soft_float { return soft_float { static_cast<representation_type>(x.my_value & abs_mask()), detail::nothing() }; }
+
+    friend constexpr auto sqrt(const soft_float& x) noexcept -> soft_float { return soft_float { sf_sqrt(x.my_value), detail::nothing() }; }
+
+    #if !defined(SOFT_DOUBLE_DISABLE_IOSTREAM)
+    template<typename char_type, typename traits_type>
+    friend auto operator<<(std::basic_ostream<char_type, traits_type>& os, const soft_float& f) -> std::basic_ostream<char_type, traits_type>&
+    {
+      // The value is printed via its exact soft_double representation.
+      return (os << static_cast<soft_double>(f));
+    }
+    #endif // !SOFT_DOUBLE_DISABLE_IOSTREAM
+
+  private:
+    representation_type my_value { }; // NOLINT(readability-identifier-naming)
+
+    // Position of the leading (hidden) bit of the significand
+    // when it carries the guard bits.
+    static constexpr auto lead_bit = static_cast<unsigned>(FracBits + guard_bits);
+
+    static constexpr auto bias     () noexcept -> exponent_type       { return static_cast<exponent_type>(static_cast<exponent_type>(static_cast<exponent_type>(1) << static_cast<unsigned>(ExpBits - static_cast<unsigned>(UINT8_C(1)))) - static_cast<exponent_type>(1)); }
+    static constexpr auto exp_max  () noexcept -> exponent_type       { return static_cast<exponent_type>(static_cast<exponent_type>(static_cast<exponent_type>(1) << ExpBits) - static_cast<exponent_type>(1)); }
+    static constexpr auto sign_mask() noexcept -> representation_type { return static_cast<representation_type>(static_cast<representation_type>(1U) << static_cast<unsigned>(ExpBits + FracBits)); }
+    static constexpr auto frac_mask() noexcept -> representation_type { return static_cast<representation_type>(static_cast<representation_type>(static_cast<representation_type>(1U) << FracBits) - static_cast<representation_type>(1U)); }
+    static constexpr auto exp_mask () noexcept -> representation_type { return static_cast<representation_type>(static_cast<representation_type>(exp_max()) << FracBits); }
+    static constexpr auto abs_mask () noexcept -> representation_type { return static_cast<representation_type>(exp_mask() | frac_mask()); }
+    static constexpr auto quiet_bit() noexcept -> representation_type { return static_cast<representation_type>(static_cast<representation_type>(1U) << static_cast<unsigned>(FracBits - static_cast<unsigned>(UINT8_C(1)))); }
+
+    static constexpr auto sf_sign(const representation_type a) noexcept -> bool                { return (static_cast<representation_type>(a & sign_mask()) != static_cast<representation_type>(0U)); }
+    static constexpr auto sf_exp (const representation_type a) noexcept -> exponent_type       { return static_cast<exponent_type>(static_cast<representation_type>(a >> FracBits) & static_cast<representation_type>(exp_max())); }
+    static constexpr auto sf_frac(const representation_type a) noexcept -> representation_type { return static_cast<representation_type>(a & frac_mask()); }
+
+    static constexpr auto sf_is_nan (const representation_type a) noexcept -> bool { return (static_cast<representation_type>(a & abs_mask()) >  exp_mask()); }
+    static constexpr auto sf_is_inf (const representation_type a) noexcept -> bool { return (static_cast<representation_type>(a & abs_mask()) == exp_mask()); }
+    static constexpr auto sf_is_zero(const representation_type a) noexcept -> bool { return (static_cast<representation_type>(a & abs_mask()) == static_cast<representation_type>(0U)); }
+
+    static constexpr auto sf_pack(const bool sign, const representation_type exp_and_frac) noexcept -> representation_type
+    {
+      return static_cast<representation_type>((sign ? sign_mask() : static_cast<representation_type>(0U)) | exp_and_frac);
+    }
+
+    static constexpr auto sf_unpack(const representation_type a, exponent_type& expA) noexcept -> significand_type
+    {
+      // Unpacks a finite, nonzero value to a significand having its
+      // leading bit at FracBits. Subnormals are normalized, whereby
+      // their exponent can become zero or negative.
+      expA = sf_exp(a);
+
+      auto sig = static_cast<significand_type>(sf_frac(a));
+
+      if(expA == static_cast<exponent_type>(0))
+      {
+        const auto shift =
+          static_cast<unsigned>
+          (
+              detail::soft_float_clz(sig)
+            - static_cast<unsigned>(static_cast<unsigned>(std::numeric_limits<significand_type>::digits) - static_cast<unsigned>(FracBits + static_cast<unsigned>(UINT8_C(1))))
+          );
+
+        sig  = static_cast<significand_type>(sig << shift);
+        expA = static_cast<exponent_type>(static_cast<exponent_type>(1) - static_cast<exponent_type>(shift));
+      }
+      else
+      {
+        sig = static_cast<significand_type>(sig | static_cast<significand_type>(static_cast<significand_type>(1U) << FracBits));
+      }
+
+      return sig;
+    }
+
+    static constexpr auto sf_round_pack(const bool sign, exponent_type expA, significand_type sig) noexcept -> representation_type
+    {
+      // Rounds and packs the value sig * 2^(expA - bias - lead_bit),
+      // where the leading bit of sig is at lead_bit (or sig is zero).
+      // The guard bits are rounded to nearest, with ties to even.
+      if(expA < static_cast<exponent_type>(1))
+      {
+        // The result is subnormal (or could round up to the smallest normal).
+        sig  = detail::soft_float_shift_right_jam(sig, static_cast<unsigned>(static_cast<exponent_type>(1) - expA));
+        expA = static_cast<exponent_type>(1);
+      }
+
+      constexpr auto half      = static_cast<significand_type>(static_cast<significand_type>(1U) << static_cast<unsigned>(guard_bits - static_cast<unsigned>(UINT8_C(1))));
+      constexpr auto round_msk = static_cast<significand_type>(static_cast<significand_type>(static_cast<significand_type>(1U) << guard_bits) - static_cast<significand_type>(1U));
+
+      const auto round_bits = static_cast<significand_type>(sig & round_msk);
+
+      auto sig_r = static_cast<significand_type>(static_cast<significand_type>(sig + half) >> guard_bits);
+
+      if(round_bits == half)
+      {
+        sig_r = static_cast<significand_type>(sig_r & static_cast<significand_type>(~static_cast<significand_type>(1U)));
+      }
+
+      // A significand that has rounded up to 2^(FracBits + 1) carries
+      // into the exponent. A subnormal one has no hidden bit.
+      const auto exp_field =
+        static_cast<exponent_type>
+        (
+            static_cast<exponent_type>(expA - static_cast<exponent_type>(1))
+          + static_cast<exponent_type>(sig_r >> FracBits)
+        );
+
+      return
+        static_cast<representation_type>
+        (
+          (exp_field >= exp_max())
+            ? sf_pack(sign, exp_mask())
+            : sf_pack
+              (
+                sign,
+                static_cast<representation_type>
+                (
+                    static_cast<representation_type>(static_cast<representation_type>(exp_field) << FracBits)
+                  | static_cast<representation_type>(static_cast<representation_type>(sig_r) & frac_mask())
+                )
+              )
+        );
+    }
+
+    static constexpr auto sf_normalize_round_pack(const bool sign, exponent_type expA, significand_type sig) noexcept -> representation_type
+    {
+      // As sf_round_pack, for a nonzero sig whose leading bit is at or below lead_bit.
+      const auto shift =
+        static_cast<unsigned>
+        (
+            detail::soft_float_clz(sig)
+          - static_cast<unsigned>(static_cast<unsigned>(std::numeric_limits<significand_type>::digits) - static_cast<unsigned>(lead_bit + static_cast<unsigned>(UINT8_C(1))))
+        );
+
+      return sf_round_pack(sign, static_cast<exponent_type>(expA - static_cast<exponent_type>(shift)), static_cast<significand_type>(sig << shift));
+    }
+
+    static constexpr auto sf_propagate_nan(const representation_type a, const representation_type b) noexcept -> representation_type
+    {
+      return (sf_is_nan(a) ? a : b);
+    }
+
+    static constexpr auto sf_add_mags(const representation_type a, const representation_type b, const bool signZ) noexcept -> representation_type
+    {
+      // Adds the magnitudes of the finite, nonzero values a and b.
+      auto expA = exponent_type { };
+      auto expB = exponent_type { };
+
+      auto sigA = static_cast<significand_type>(sf_unpack(a, expA) << guard_bits);
+      auto sigB = static_cast<significand_type>(sf_unpack(b, expB) << guard_bits);
+
+      if(expA < expB)
+      {
+        const auto tmp_sig = sigA; sigA = sigB; sigB = tmp_sig;
+        const auto tmp_exp = expA; expA = expB; expB = tmp_exp;
+      }
+
+      sigB = detail::soft_float_shift_right_jam(sigB, static_cast<unsigned>(expA - expB));
+
+      auto sigZ = static_cast<significand_type>(sigA + sigB);
+
+      if(static_cast<significand_type>(sigZ >> static_cast<unsigned>(lead_bit + static_cast<unsigned>(UINT8_C(1)))) != static_cast<significand_type>(0U))
+      {
+        sigZ = detail::soft_float_shift_right_jam(sigZ, static_cast<unsigned>(UINT8_C(1)));
+
+        ++expA;
+      }
+
+      return sf_round_pack(signZ, expA, sigZ);
+    }
+
+    static constexpr auto sf_sub_mags(const representation_type a, const representation_type b, bool signZ) noexcept -> representation_type
+    {
+      // Subtracts the magnitude of b from that of a, both finite and nonzero.
+      // With three guard bits, the alignment of the smaller operand
+      // (with jamming) retains enough bits for correct rounding.
+      auto expA = exponent_type { };
+      auto expB = exponent_type { };
+
+      auto sigA = static_cast<significand_type>(sf_unpack(a, expA) << guard_bits);
+      auto sigB = static_cast<significand_type>(sf_unpack(b, expB) << guard_bits);
+
+      if((expA < expB) || ((expA == expB) && (sigA < sigB)))
+      {
+        const auto tmp_sig = sigA; sigA = sigB; sigB = tmp_sig;
+        const auto tmp_exp = expA; expA = expB; expB = tmp_exp;
+
+        signZ = (!signZ);
+      }
+
+      sigB = detail::soft_float_shift_right_jam(sigB, static_cast<unsigned>(expA - expB));
+
+      const auto sigZ = static_cast<significand_type>(sigA - sigB);
+
+      return
+        static_cast<representation_type>
+        (
+          (sigZ == static_cast<significand_type>(0U))
+            ? static_cast<representation_type>(0U)
+            : sf_normalize_round_pack(signZ, expA, sigZ)
+        );
+    }
+
+    static constexpr auto sf_add_or_sub(const representation_type a, const representation_type b, const bool is_sub) noexcept -> representation_type
+    {
+      const auto signA = sf_sign(a);
+      const auto signB = static_cast<bool>(sf_sign(b) != is_sub);
+
+      auto result = representation_type { };
+
+      if(sf_is_nan(a) || sf_is_nan(b))
+      {
+        result = sf_propagate_nan(a, b);
+      }
+      else if(sf_is_inf(a) || sf_is_inf(b))
+      {
+        result =
+          ((sf_is_inf(a) && sf_is_inf(b) && (signA != signB))
+            ? my_value_quiet_NaN().my_value
+            : (sf_is_inf(a) ? a : sf_pack(signB, exp_mask())));
+      }
+      else if(sf_is_zero(b))
+      {
+        // Here, -0 + +0 is +0 (when rounding to nearest).
+        result = ((sf_is_zero(a) && (signA != signB)) ? static_cast<representation_type>(0U) : a);
+      }
+      else if(sf_is_zero(a))
+      {
+        result = sf_pack(signB, static_cast<representation_type>(b & abs_mask()));
+      }
+      else
+      {
+        result = ((signA == signB) ? sf_add_mags(a, b, signA) : sf_sub_mags(a, b, signA));
+      }
+
+      return result;
+    }
+
+    static constexpr auto sf_add(const representation_type a, const representation_type b) noexcept -> representation_type { return sf_add_or_sub(a, b, false); }
+    static constexpr auto sf_sub(const representation_type a, const representation_type b) noexcept -> representation_type { return sf_add_or_sub(a, b, true); }
+
+    static constexpr auto sf_mul(const representation_type a, const representation_type b) noexcept -> representation_type
+    {
+      const auto signZ = static_cast<bool>(sf_sign(a) != sf_sign(b));
+
+      auto result = representation_type { };
+
+      if(sf_is_nan(a) || sf_is_nan(b))
+      {
+        result = sf_propagate_nan(a, b);
+      }
+      else if(sf_is_inf(a) || sf_is_inf(b))
+      {
+        result = ((sf_is_zero(a) || sf_is_zero(b)) ? my_value_quiet_NaN().my_value : sf_pack(signZ, exp_mask()));
+      }
+      else if(sf_is_zero(a) || sf_is_zero(b))
+      {
+        result = sf_pack(signZ, static_cast<representation_type>(0U));
+      }
+      else
+      {
+        auto expA = exponent_type { };
+        auto expB = exponent_type { };
+
+        const auto sigA = sf_unpack(a, expA);
+        const auto sigB = sf_unpack(b, expB);
+
+        // The product has its leading bit at 2 * FracBits + guard_bits
+        // (or one above), and is jammed down to lead_bit.
+        const auto sig_prod = static_cast<wide_type>(static_cast<wide_type>(static_cast<wide_type>(sigA) * static_cast<wide_type>(sigB)) << guard_bits);
+
+        const auto prod_is_high = (static_cast<wide_type>(sig_prod >> static_cast<unsigned>((static_cast<unsigned>(UINT8_C(2)) * FracBits) + guard_bits + static_cast<unsigned>(UINT8_C(1)))) != static_cast<wide_type>(0U));
+
+        const auto sigZ =
+          static_cast<significand_type>
+          (
+            detail::soft_float_shift_right_jam(sig_prod, static_cast<unsigned>(FracBits + (prod_is_high ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))))
+          );
+
+        const auto expZ =
+          static_cast<exponent_type>
+          (
+              static_cast<exponent_type>(expA + expB)
+            - static_cast<exponent_type>(bias() - (prod_is_high ? static_cast<exponent_type>(1) : static_cast<exponent_type>(0)))
+          );
+
+        result = sf_round_pack(signZ, expZ, sigZ);
+      }
+
+      return result;
+    }
+
+    static constexpr auto sf_div(const representation_type a, const representation_type b) noexcept -> representation_type
+    {
+      const auto signZ = static_cast<bool>(sf_sign(a) != sf_sign(b));
+
+      auto result = representation_type { };
+
+      if(sf_is_nan(a) || sf_is_nan(b))
+      {
+        result = sf_propagate_nan(a, b);
+      }
+      else if(sf_is_inf(a))
+      {
+        result = (sf_is_inf(b) ? my_value_quiet_NaN().my_value : sf_pack(signZ, exp_mask()));
+      }
+      else if(sf_is_inf(b))
+      {
+        result = sf_pack(signZ, static_cast<representation_type>(0U));
+      }
+      else if(sf_is_zero(b))
+      {
+        result = (sf_is_zero(a) ? my_value_quiet_NaN().my_value : sf_pack(signZ, exp_mask()));
+      }
+      else if(sf_is_zero(a))
+      {
+        result = sf_pack(signZ, static_cast<representation_type>(0U));
+      }
+      else
+      {
+        auto expA = exponent_type { };
+        auto expB = exponent_type { };
+
+        const auto sigA = sf_unpack(a, expA);
+        const auto sigB = sf_unpack(b, expB);
+
+        // The integer quotient of sigA * 2^(lead_bit + 1) and sigB
+        // lies in (2^lead_bit, 2^(lead_bit + 2)). The remainder
+        // is jammed into its least significant bit.
+        const auto num = static_cast<wide_type>(static_cast<wide_type>(sigA) << static_cast<unsigned>(lead_bit + static_cast<unsigned>(UINT8_C(1))));
+
+        const auto quo_is_high = (sigA >= sigB);
+
+        auto quo = static_cast<wide_type>(num / static_cast<wide_type>(sigB));
+
+        if(static_cast<wide_type>(num % static_cast<wide_type>(sigB)) != static_cast<wide_type>(0U))
+        {
+          quo = static_cast<wide_type>(quo | static_cast<wide_type>(1U));
+        }
+
+        const auto sigZ =
+          static_cast<significand_type>
+          (
+            quo_is_high ? detail::soft_float_shift_right_jam(quo, static_cast<unsigned>(UINT8_C(1))) : quo
+          );
+
+        const auto expZ =
+          static_cast<exponent_type>
+          (
+              static_cast<exponent_type>(expA - expB)
+            + static_cast<exponent_type>(bias() - (quo_is_high ? static_cast<exponent_type>(0) : static_cast<exponent_type>(1)))
+          );
+
+        result = sf_round_pack(signZ, expZ, sigZ);
+      }
+
+      return result;
+    }
+
+    static constexpr auto sf_sqrt(const representation_type a) noexcept -> representation_type
+    {
+      auto result = representation_type { };
+
+      if(sf_is_nan(a))
+      {
+        result = a;
+      }
+      else if(sf_is_zero(a))
+      {
+        result = a;
+      }
+      else if(sf_sign(a))
+      {
+        result = my_value_quiet_NaN().my_value;
+      }
+      else if(sf_is_inf(a))
+      {
+        result = a;
+      }
+      else
+      {
+        auto expA = exponent_type { };
+
+        const auto sigA = sf_unpack(a, expA);
+
+        // Scale the radicand to 2 * lead_bit + 1 or 2 * lead_bit + 2 bits,
+        // such that the remaining power of two is even. The integer square
+        // root then has its leading bit at lead_bit.
+        const auto unbiased_exp = static_cast<exponent_type>(expA - bias());
+
+        const auto shift_even = static_cast<exponent_type>(static_cast<exponent_type>(static_cast<exponent_type>(2) * static_cast<exponent_type>(lead_bit)) - static_cast<exponent_type>(FracBits));
+
+        const auto shift_is_odd = (static_cast<unsigned>(static_cast<exponent_type>(unbiased_exp - static_cast<exponent_type>(FracBits)) - shift_even) % static_cast<unsigned>(UINT8_C(2))) != static_cast<unsigned>(UINT8_C(0));
+
+        const auto shift = static_cast<exponent_type>(shift_even + (shift_is_odd ? static_cast<exponent_type>(1) : static_cast<exponent_type>(0)));
+
+        const auto rad = static_cast<wide_type>(static_cast<wide_type>(sigA) << static_cast<unsigned>(shift));
+
+        // Compute the integer square root bit by bit.
+        auto root = static_cast<wide_type>(0U);
+        auto rem  = rad;
+        auto bit  = static_cast<wide_type>(static_cast<wide_type>(1U) << static_cast<unsigned>(static_cast<unsigned>(std::numeric_limits<wide_type>::digits) - static_cast<unsigned>(UINT8_C(2))));
+
+        while(bit > rad)
+        {
+          bit = static_cast<wide_type>(bit >> static_cast<unsigned>(UINT8_C(2)));
+        }
+
+        while(bit != static_cast<wide_type>(0U))
+        {
+          if(rem >= static_cast<wide_type>(root + bit))
+          {
+            rem  = static_cast<wide_type>(rem - static_cast<wide_type>(root + bit));
+            root = static_cast<wide_type>(static_cast<wide_type>(root >> static_cast<unsigned>(UINT8_C(1))) + bit);
+          }
+          else
+          {
+            root = static_cast<wide_type>(root >> static_cast<unsigned>(UINT8_C(1)));
+          }
+
+          bit = static_cast<wide_type>(bit >> static_cast<unsigned>(UINT8_C(2)));
+        }
+
+        if(rem != static_cast<wide_type>(0U))
+        {
+          root = static_cast<wide_type>(root | static_cast<wide_type>(1U));
+        }
+
+        const auto expZ =
+          static_cast<exponent_type>
+          (
+              static_cast<exponent_type>(static_cast<exponent_type>(static_cast<exponent_type>(unbiased_exp - static_cast<exponent_type>(FracBits)) - shift) / static_cast<exponent_type>(2))
+            + static_cast<exponent_type>(lead_bit)
+            + bias()
+          );
+
+        result = sf_round_pack(false, expZ, static_cast<significand_type>(root));
+      }
+
+      return result;
+    }
+
+    static constexpr auto sf_eq(const representation_type a, const representation_type b) noexcept -> bool
+    {
+      return
+        (
+             (!sf_is_nan(a))
+          && (!sf_is_nan(b))
+          && ((a == b) || (sf_is_zero(a) && sf_is_zero(b)))
+        );
+    }
+
+    static constexpr auto sf_lt(const representation_type a, const representation_type b) noexcept -> bool
+    {
+      // For equal signs, the magnitudes are ordered as their bit patterns.
+      const auto signA = sf_sign(a);
+      const auto signB = sf_sign(b);
+
+      return
+        (
+             (!sf_is_nan(a))
+          && (!sf_is_nan(b))
+          && ((signA != signB) ? (signA && (!(sf_is_zero(a) && sf_is_zero(b))))
+                               : ((a != b) && (signA != (a < b))))
+        );
+    }
+
+    static constexpr auto sf_le(const representation_type a, const representation_type b) noexcept -> bool
+    {
+      return (sf_lt(a, b) || sf_eq(a, b));
+    }
+
+    static constexpr auto sf_from_ui64(const bool sign, const std::uint64_t u) noexcept -> representation_type
+    {
+      // Convert the magnitude u (with the given sign), rounding once.
+      const auto msb = static_cast<exponent_type>(static_cast<exponent_type>(63) - static_cast<exponent_type>(detail::softfloat_countLeadingZeros64(u)));
+
+      return
+        static_cast<representation_type>
+        (
+          (u == static_cast<std::uint64_t>(UINT8_C(0)))
+            ? static_cast<representation_type>(0U)
+            : ((msb > static_cast<exponent_type>(lead_bit))
+                ? sf_round_pack(sign, static_cast<exponent_type>(bias() + msb), static_cast<significand_type>(detail::softfloat_shiftRightJam64(u, static_cast<std::uint_fast16_t>(msb - static_cast<exponent_type>(lead_bit)))))
+                : sf_round_pack(sign, static_cast<exponent_type>(bias() + msb), static_cast<significand_type>(u << static_cast<unsigned>(static_cast<exponent_type>(lead_bit) - msb))))
+        );
+    }
+
+    static constexpr auto sf_from_f64(const std::uint64_t a) noexcept -> representation_type
+    {
+      // Round a soft_double value to this format. The exponents of
+      // subnormal soft_double values lie far below the range of
+      // this format, so these round to zero.
+      const auto signA = detail::signF64UI(a);
+      const auto expA  = detail::expF64UI (a);
+      const auto fracA = detail::fracF64UI(a);
+
+      auto result = representation_type { };
+
+      if(expA == static_cast<std::int16_t>(INT16_C(0x7FF)))
+      {
+        result = ((fracA != static_cast<std::uint64_t>(UINT8_C(0))) ? sf_pack(signA, static_cast<representation_type>(exp_mask() | quiet_bit())) : sf_pack(signA, exp_mask()));
+      }
+      else if(expA == static_cast<std::int16_t>(INT8_C(0)))
+      {
+        result = sf_pack(signA, static_cast<representation_type>(0U));
+      }
+      else
+      {
+        const auto sig = static_cast<std::uint64_t>(fracA | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)));
+
+        const auto expZ = static_cast<std::int16_t>(static_cast<std::int16_t>(expA - static_cast<std::int16_t>(INT16_C(0x3FF))) + bias());
+
+        result =
+          sf_round_pack
+          (
+            signA,
+            expZ,
+            static_cast<significand_type>(detail::softfloat_shiftRightJam64(sig, static_cast<std::uint_fast16_t>(static_cast<unsigned>(UINT8_C(52)) - lead_bit)))
+          );
+      }
+
+      return result;
+    }
+
+    static constexpr auto sf_to_f64(const representation_type a) noexcept -> std::uint64_t
+    {
+      // Widen this format to soft_double, which is exact.
+      const auto signA = sf_sign(a);
+
+      auto result = std::uint64_t { };
+
+      if(sf_is_nan(a))
+      {
+        result = soft_double::my_value_quiet_NaN().crepresentation();
+      }
+      else if(sf_is_inf(a))
+      {
+        result = detail::packToF64UI(signA, static_cast<std::int16_t>(INT16_C(0x7FF)), static_cast<std::uint64_t>(UINT8_C(0)));
+      }
+      else if(sf_is_zero(a))
+      {
+        result = detail::packToF64UI(signA, static_cast<std::int16_t>(INT8_C(0)), static_cast<std::uint64_t>(UINT8_C(0)));
+      }
+      else
+      {
+        auto expA = exponent_type { };
+
+        const auto sigA = sf_unpack(a, expA);
+
+        const auto frac64 =
+          static_cast<std::uint64_t>
+          (
+              static_cast<std::uint64_t>(static_cast<std::uint64_t>(sigA) & static_cast<std::uint64_t>(frac_mask()))
+            << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(52)) - FracBits)
+          );
+
+        result =
+          detail::packToF64UI
+          (
+            signA,
+            static_cast<std::int16_t>(static_cast<std::int16_t>(expA - bias()) + static_cast<std::int16_t>(INT16_C(0x3FF))),
+            frac64
+          );
+      }
+
+      return result;
+    }
+  };
+
+  // The IEEE-754 binary16 and binary32 formats, and the bfloat16 format.
+  using soft_float16  = soft_float<static_cast<unsigned>(UINT8_C(5)), static_cast<unsigned>(UINT8_C(10))>;
+  using soft_bfloat16 = soft_float<static_cast<unsigned>(UINT8_C(8)), static_cast<unsigned>(UINT8_C( 7))>;
+  using soft_float32  = soft_float<static_cast<unsigned>(UINT8_C(8)), static_cast<unsigned>(UINT8_C(23))>;
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::softfloat
+  #else
+  } // namespace softfloat
+  } // namespace math
+  #endif
+
+  namespace std {
+
+  // Specialization of numeric_limits for soft_float.
+  template<const unsigned ExpBits,
+           const unsigned FracBits>
+  SOFT_DOUBLE_NUM_LIMITS_CLASS_TYPE numeric_limits<::math::softfloat::soft_float<ExpBits, FracBits>>
+  {
+  private:
+    using local_float_type = ::math::softfloat::soft_float<ExpBits, FracBits>;
+
+    static constexpr auto local_bias = static_cast<int>(static_cast<int>(1 << static_cast<unsigned>(ExpBits - 1U)) - 1);
+
+  public:
+    static constexpr bool               is_specialized    = true;
+    static constexpr float_denorm_style has_denorm        = denorm_present;
+    static constexpr bool               has_denorm_loss   = false;
+    static constexpr bool               has_infinity      = true;
+    static constexpr bool               has_quiet_NaN     = true;
+    static constexpr bool               has_signaling_NaN = false;
+    static constexpr bool               is_bounded        = true;
+    static constexpr bool               is_iec559         = false;
+    static constexpr bool               is_integer        = false;
+    static constexpr bool               is_exact          = false;
+    static constexpr bool               is_signed         = true;
+    static constexpr bool               is_modulo         = false;
+    static constexpr bool               traps             = false;
+    static constexpr bool               tinyness_before   = false;
+    static constexpr float_round_style  round_style       = round_to_nearest;
+    static constexpr int                radix             = static_cast<int>(INT8_C(2));
+
+    // Here, 0.30103 approximates log10(2) and 0.30103 * 2^16 = 19728.
+    static constexpr int                digits            = static_cast<int>(FracBits + 1U);
+    static constexpr int                digits10          = static_cast<int>((static_cast<std::int32_t>(FracBits) * INT32_C(19728)) >> 16U);
+    static constexpr int                max_digits10      = static_cast<int>(((static_cast<std::int32_t>(FracBits + 1U) * INT32_C(19728)) >> 16U) + INT32_C(2));
+    static constexpr int                max_exponent      = static_cast<int>(local_bias + 1);
+    static constexpr int                max_exponent10    = static_cast<int>((static_cast<std::int32_t>(local_bias + 1) * INT32_C(19728)) >> 16U);
+    static constexpr int                min_exponent      = static_cast<int>(2 - local_bias);
+    static constexpr int                min_exponent10    = static_cast<int>(-((static_cast<std::int32_t>(local_bias - 1) * INT32_C(19728)) >> 16U));
+
+    static constexpr auto (min)        () noexcept -> local_float_type { return local_float_type::my_value_min(); }
+    static constexpr auto (max)        () noexcept -> local_float_type { return local_float_type::my_value_max(); }
+    static constexpr auto lowest       () noexcept -> local_float_type { return local_float_type::my_value_lowest(); }
+    static constexpr auto epsilon      () noexcept -> local_float_type { return local_float_type::my_value_epsilon(); }
+    static constexpr auto round_error  () noexcept -> local_float_type { return local_float_type::my_value_round_error(); }
+    static constexpr auto denorm_min   () noexcept -> local_float_type { return local_float_type::my_value_denorm_min(); }
+    static constexpr auto infinity     () noexcept -> local_float_type { return local_float_type::my_value_infinity(); }
+    static constexpr auto quiet_NaN    () noexcept -> local_float_type { return local_float_type::my_value_quiet_NaN(); }
+    static constexpr auto signaling_NaN() noexcept -> local_float_type { return local_float_type::my_value_quiet_NaN(); }
+  };
+
+  } // namespace std
+
+#endif // SOFT_FLOAT_2025_07_05_H
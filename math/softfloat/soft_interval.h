@@ -0,0 +1,720 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2012 - 2025.                 //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef SOFT_INTERVAL_2025_07_27_H // NOLINT(llvm-header-guard)
+  #define SOFT_INTERVAL_2025_07_27_H
+
+  #include <array>
+  #include <cstddef>
+  #include <cstdint>
+  #include <type_traits>
+
+  #include <math/softfloat/soft_double_rounding.h>
+
+  // The class soft_interval, a closed interval [lo, hi] having bounds
+  // of type soft_double. The result of each operation encloses the
+  // exact result for every pair of points in the operands. The lower
+  // bound is rounded downward and the upper bound upward.
+
+  // For point operands, as they arise when an interval computation is
+  // started from ordinary numbers, the bounds of mul, div and sqrt are
+  // taken from one and the same unrounded result of the soft_double
+  // kernels, which is rounded once in each direction. The bounds of add
+  // and sub are taken from the sum to nearest and its exact error. The
+  // other cases use the directed operations of basic_soft_double.
+
+  // The functions exp and log are evaluated in interval arithmetic
+  // with tabulated enclosures of their coefficients, so that their
+  // enclosures are guaranteed as well. These do not depend on the
+  // configuration of the elementary functions of soft_double.
+
+  // An interval having a NaN bound is NaN. The division by an interval
+  // containing zero gives the entire real line.
+
+  #if(__cplusplus >= 201703L)
+  namespace math::softfloat {
+  #else
+  namespace math { namespace softfloat { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  class soft_interval final
+  {
+  public:
+    using representation_type = std::uint64_t;
+
+    constexpr soft_interval() noexcept = default;
+
+    // The integers that are not representable are enclosed
+    // by their neighbors.
+    template<typename UnsignedIntegralType,
+             typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
+                                      && std::is_unsigned<UnsignedIntegralType>::value)>::type const* = nullptr>
+    constexpr soft_interval(UnsignedIntegralType u) noexcept // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+      : my_lo(soft_double::my_ui64_to_f64<detail::round_mode::min>(static_cast<std::uint64_t>(u))),
+        my_hi(soft_double::my_ui64_to_f64<detail::round_mode::max>(static_cast<std::uint64_t>(u))) { }
+
+    template<typename SignedIntegralType,
+             typename std::enable_if<(   std::is_integral<SignedIntegralType>::value
+                                      && std::is_signed  <SignedIntegralType>::value)>::type const* = nullptr>
+    constexpr soft_interval(SignedIntegralType n) noexcept // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+      : my_lo(soft_double::my__i64_to_f64<detail::round_mode::min>(static_cast<std::int64_t>(n))),
+        my_hi(soft_double::my__i64_to_f64<detail::round_mode::max>(static_cast<std::int64_t>(n))) { }
+
+    constexpr soft_interval(float  f) noexcept : my_lo(soft_double(f).crepresentation()), my_hi(my_lo) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    constexpr soft_interval(double d) noexcept : my_lo(soft_double(d).crepresentation()), my_hi(my_lo) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    constexpr soft_interval(const soft_double& x) noexcept : my_lo(x.crepresentation()), my_hi(my_lo) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    constexpr soft_interval(const soft_double& lo, const soft_double& hi) noexcept
+      : my_lo(lo.crepresentation()),
+        my_hi(hi.crepresentation()) { }
+
+    constexpr soft_interval(const soft_interval&) noexcept = default;
+    constexpr soft_interval(soft_interval&&) noexcept = default;
+
+    ~soft_interval() = default;
+
+    constexpr auto operator=(const soft_interval&) noexcept -> soft_interval& = default;
+    constexpr auto operator=(soft_interval&&) noexcept -> soft_interval& = default;
+
+    SOFT_DOUBLE_NODISCARD constexpr auto lower() const noexcept -> soft_double { return soft_double { my_lo, detail::nothing{} }; }
+    SOFT_DOUBLE_NODISCARD constexpr auto upper() const noexcept -> soft_double { return soft_double { my_hi, detail::nothing{} }; }
+
+    constexpr auto operator+=(const soft_interval& other) noexcept -> soft_interval& { *this = my_add(*this, other); return *this; }
+    constexpr auto operator-=(const soft_interval& other) noexcept -> soft_interval& { *this = my_add(*this, -other); return *this; }
+    constexpr auto operator*=(const soft_interval& other) noexcept -> soft_interval& { *this = my_mul(*this, other); return *this; }
+    constexpr auto operator/=(const soft_interval& other) noexcept -> soft_interval& { *this = my_div(*this, other); return *this; }
+
+    constexpr auto operator+() const noexcept -> soft_interval { return *this; }
+    constexpr auto operator-() const noexcept -> soft_interval { return soft_interval { negated(my_hi), negated(my_lo), detail::nothing{} }; }
+
+    friend constexpr auto operator+(const soft_interval& a, const soft_interval& b) noexcept -> soft_interval { return my_add(a,  b); }
+    friend constexpr auto operator-(const soft_interval& a, const soft_interval& b) noexcept -> soft_interval { return my_add(a, -b); }
+    friend constexpr auto operator*(const soft_interval& a, const soft_interval& b) noexcept -> soft_interval { return my_mul(a,  b); }
+    friend constexpr auto operator/(const soft_interval& a, const soft_interval& b) noexcept -> soft_interval { return my_div(a,  b); }
+
+    // Two intervals are equal if their bounds are equal.
+    friend constexpr auto operator==(const soft_interval& a, const soft_interval& b) noexcept -> bool { return ((a.lower() == b.lower()) && (a.upper() == b.upper())); }
+    friend constexpr auto operator!=(const soft_interval& a, const soft_interval& b) noexcept -> bool { return ((a.lower() != b.lower()) || (a.upper() != b.upper())); }
+
+    friend constexpr auto (isnan)(const soft_interval& x) noexcept -> bool { return is_nan(x); }
+
+    friend constexpr auto contains(const soft_interval& x, const soft_double& v) noexcept -> bool
+    {
+      return ((!is_nan(x)) && (x.lower() <= v) && (v <= x.upper()));
+    }
+
+    // The width is rounded upward, so that it bounds the exact width.
+    friend constexpr auto width(const soft_interval& x) noexcept -> soft_double
+    {
+      return soft_double { up_add(x.my_hi, negated(x.my_lo)), detail::nothing{} };
+    }
+
+    friend constexpr auto sqrt(const soft_interval& x) noexcept -> soft_interval { return my_sqrt(x); }
+    friend constexpr auto exp (const soft_interval& x) noexcept -> soft_interval { return my_exp (x); }
+    friend constexpr auto log (const soft_interval& x) noexcept -> soft_interval { return my_log (x); }
+
+    #if !defined(SOFT_DOUBLE_DISABLE_IOSTREAM)
+    template<typename char_type, typename traits_type>
+    friend auto operator<<(std::basic_ostream<char_type, traits_type>& os, const soft_interval& x) -> std::basic_ostream<char_type, traits_type>&
+    {
+      return (os << '[' << x.lower() << ", " << x.upper() << ']');
+    }
+    #endif // !SOFT_DOUBLE_DISABLE_IOSTREAM
+
+  private:
+    representation_type my_lo { };
+    representation_type my_hi { };
+
+    explicit constexpr soft_interval(std::uint64_t lo, std::uint64_t hi, detail::nothing&&) noexcept // NOLINT(hicpp-named-parameter,readability-named-parameter)
+      : my_lo(lo),
+        my_hi(hi) { }
+
+    using down_type = soft_double_downward;
+    using up_type   = soft_double_upward;
+
+    static constexpr auto is_non_finite(std::uint64_t u) noexcept -> bool
+    {
+      return (detail::expF64UI(u) == static_cast<std::int16_t>(INT16_C(0x7FF)));
+    }
+
+    static constexpr auto is_normal(std::uint64_t u) noexcept -> bool
+    {
+      return
+      (
+           static_cast<std::uint16_t>(detail::expF64UI(u) - static_cast<std::int16_t>(INT8_C(1)))
+        <  static_cast<std::uint16_t>(UINT16_C(0x7FE))
+      );
+    }
+
+    static constexpr auto is_zero    (std::uint64_t u) noexcept -> bool { return detail::isZeroF64UI(u); }
+    static constexpr auto is_non_neg (std::uint64_t u) noexcept -> bool { return ((!detail::signF64UI(u)) || is_zero(u)); }
+    static constexpr auto is_non_pos (std::uint64_t u) noexcept -> bool { return (  detail::signF64UI(u)  || is_zero(u)); }
+
+    static constexpr auto is_nan(const soft_interval& x) noexcept -> bool
+    {
+      return (detail::isNaNF64UI(x.my_lo) || detail::isNaNF64UI(x.my_hi));
+    }
+
+    static constexpr auto is_point(const soft_interval& x) noexcept -> bool { return (x.my_lo == x.my_hi); }
+
+    static constexpr auto negated(std::uint64_t u) noexcept -> std::uint64_t
+    {
+      return static_cast<std::uint64_t>(u ^ static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)));
+    }
+
+    static constexpr auto nan_interval() noexcept -> soft_interval
+    {
+      return soft_interval { soft_double::my_value_quiet_NaN().crepresentation(), soft_double::my_value_quiet_NaN().crepresentation(), detail::nothing{} };
+    }
+
+    static constexpr auto entire() noexcept -> soft_interval
+    {
+      return soft_interval { negated(soft_double::my_value_infinity().crepresentation()), soft_double::my_value_infinity().crepresentation(), detail::nothing{} };
+    }
+
+    // The neighbors of a finite, nonzero value in the direction
+    // of -inf and +inf, respectively.
+    static constexpr auto next_down(std::uint64_t u) noexcept -> std::uint64_t
+    {
+      return (detail::signF64UI(u) ? static_cast<std::uint64_t>(u + 1U) : static_cast<std::uint64_t>(u - 1U));
+    }
+
+    static constexpr auto next_up(std::uint64_t u) noexcept -> std::uint64_t
+    {
+      return (detail::signF64UI(u) ? static_cast<std::uint64_t>(u - 1U) : static_cast<std::uint64_t>(u + 1U));
+    }
+
+    // The directed operations on the bounds. In the products and quotients
+    // of bounds, zero times infinity is zero, as for the sets of points.
+    static constexpr auto dn_add(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t { return (down_type { a, detail::nothing{} } + down_type { b, detail::nothing{} }).crepresentation(); }
+    static constexpr auto up_add(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t { return (up_type   { a, detail::nothing{} } + up_type   { b, detail::nothing{} }).crepresentation(); }
+
+    static constexpr auto dn_mul(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t
+    {
+      return ((is_zero(a) || is_zero(b)) ? static_cast<std::uint64_t>(UINT8_C(0)) : (down_type { a, detail::nothing{} } * down_type { b, detail::nothing{} }).crepresentation());
+    }
+
+    static constexpr auto up_mul(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t
+    {
+      return ((is_zero(a) || is_zero(b)) ? static_cast<std::uint64_t>(UINT8_C(0)) : (up_type { a, detail::nothing{} } * up_type { b, detail::nothing{} }).crepresentation());
+    }
+
+    // Here the divisor is nonzero.
+    static constexpr auto dn_div(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t
+    {
+      return (is_zero(a) ? static_cast<std::uint64_t>(UINT8_C(0)) : (down_type { a, detail::nothing{} } / down_type { b, detail::nothing{} }).crepresentation());
+    }
+
+    static constexpr auto up_div(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t
+    {
+      return (is_zero(a) ? static_cast<std::uint64_t>(UINT8_C(0)) : (up_type { a, detail::nothing{} } / up_type { b, detail::nothing{} }).crepresentation());
+    }
+
+    static constexpr auto min_of(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t
+    {
+      return ((soft_double { b, detail::nothing{} } < soft_double { a, detail::nothing{} }) ? b : a);
+    }
+
+    static constexpr auto max_of(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t
+    {
+      return ((soft_double { a, detail::nothing{} } < soft_double { b, detail::nothing{} }) ? b : a);
+    }
+
+    static constexpr auto round_both(const detail::unrounded_f64& z) noexcept -> soft_interval
+    {
+      // Round one unrounded result in both directions. Away from overflow,
+      // the bounds are the truncated significand and, if any rounding bits
+      // are set, its successor, which carries into the exponent as needed.
+
+      auto result = soft_interval { };
+
+      if(static_cast<std::uint16_t>(z.exp) < static_cast<std::uint16_t>(UINT16_C(0x7FD)))
+      {
+        const auto trunc = detail::packToF64UI(z.sign, z.exp, static_cast<std::uint64_t>(z.sig >> static_cast<unsigned>(UINT8_C(10))));
+
+        const auto away =
+          static_cast<std::uint64_t>
+          (
+              trunc
+            + static_cast<std::uint64_t>((static_cast<std::uint64_t>(z.sig & static_cast<std::uint64_t>(UINT16_C(0x3FF))) != static_cast<std::uint64_t>(UINT8_C(0))) ? 1U : 0U)
+          );
+
+        result = (z.sign ? soft_interval { away, trunc, detail::nothing{} } : soft_interval { trunc, away, detail::nothing{} });
+      }
+      else
+      {
+        result =
+          soft_interval
+          {
+            soft_double::softfloat_roundPackToF64<detail::round_mode::min>(z.sign, z.exp, z.sig),
+            soft_double::softfloat_roundPackToF64<detail::round_mode::max>(z.sign, z.exp, z.sig),
+            detail::nothing{}
+          };
+      }
+
+      return result;
+    }
+
+    static constexpr auto add_point(std::uint64_t a, std::uint64_t b) noexcept -> soft_interval
+    {
+      auto result = soft_interval { };
+
+      auto err = std::uint64_t { };
+
+      const auto z = (is_non_finite(a) || is_non_finite(b)) ? a : soft_double::f64_add_exact(a, b, err);
+
+      if(is_non_finite(a) || is_non_finite(b) || is_non_finite(z))
+      {
+        result = soft_interval { dn_add(a, b), up_add(a, b), detail::nothing{} };
+      }
+      else
+      {
+        // The sum is to nearest, so the bounds are the sum itself
+        // or its neighbor on the side of the error.
+        const auto err_is_zero = is_zero(err);
+
+        result =
+          soft_interval
+          {
+            ((err_is_zero || (!detail::signF64UI(err))) ? z : next_down(z)),
+            ((err_is_zero ||   detail::signF64UI(err))  ? z : next_up  (z)),
+            detail::nothing{}
+          };
+      }
+
+      return result;
+    }
+
+    static constexpr auto mul_point(std::uint64_t a, std::uint64_t b) noexcept -> soft_interval
+    {
+      // Normal operands take the kernel directly. The others,
+      // being rare, go through the directed operations.
+      return
+        (is_normal(a) && is_normal(b))
+          ? round_both(soft_double::f64_mul_unrounded(a, b))
+          : (detail::isNaNF64UI(a) || detail::isNaNF64UI(b))
+              ? nan_interval()
+              : soft_interval { dn_mul(a, b), up_mul(a, b), detail::nothing{} };
+    }
+
+    static constexpr auto div_point(std::uint64_t a, std::uint64_t b) noexcept -> soft_interval
+    {
+      // Here the divisor is nonzero.
+      return
+        (is_normal(a) && is_normal(b))
+          ? round_both(soft_double::f64_div_unrounded(a, b))
+          : (detail::isNaNF64UI(a) || detail::isNaNF64UI(b))
+              ? nan_interval()
+              : soft_interval { dn_div(a, b), up_div(a, b), detail::nothing{} };
+    }
+
+    static constexpr auto my_add(const soft_interval& a, const soft_interval& b) noexcept -> soft_interval
+    {
+      return
+        (is_point(a) && is_point(b))
+          ? add_point(a.my_lo, b.my_lo)
+          : soft_interval { dn_add(a.my_lo, b.my_lo), up_add(a.my_hi, b.my_hi), detail::nothing{} };
+    }
+
+    static constexpr auto my_mul(const soft_interval& a, const soft_interval& b) noexcept -> soft_interval
+    {
+      return ((is_point(a) && is_point(b)) ? mul_point(a.my_lo, b.my_lo) : mul_bounds(a, b));
+    }
+
+    static constexpr auto mul_bounds(const soft_interval& a, const soft_interval& b) noexcept -> soft_interval
+    {
+      auto result = soft_interval { };
+
+      if(is_nan(a) || is_nan(b))
+      {
+        result = nan_interval();
+      }
+      else
+      {
+        // Select the products of the bounds from the signs of the bounds.
+        // Only if both intervals contain zero in their interiors are more
+        // than two products needed.
+        const auto a1 = a.my_lo; const auto a2 = a.my_hi;
+        const auto b1 = b.my_lo; const auto b2 = b.my_hi;
+
+        if(is_non_neg(a1))
+        {
+          result = is_non_neg(b1) ? soft_interval { dn_mul(a1, b1), up_mul(a2, b2), detail::nothing{} }
+                 : is_non_pos(b2) ? soft_interval { dn_mul(a2, b1), up_mul(a1, b2), detail::nothing{} }
+                 :                  soft_interval { dn_mul(a2, b1), up_mul(a2, b2), detail::nothing{} };
+        }
+        else if(is_non_pos(a2))
+        {
+          result = is_non_neg(b1) ? soft_interval { dn_mul(a1, b2), up_mul(a2, b1), detail::nothing{} }
+                 : is_non_pos(b2) ? soft_interval { dn_mul(a2, b2), up_mul(a1, b1), detail::nothing{} }
+                 :                  soft_interval { dn_mul(a1, b2), up_mul(a1, b1), detail::nothing{} };
+        }
+        else
+        {
+          result = is_non_neg(b1) ? soft_interval { dn_mul(a1, b2), up_mul(a2, b2), detail::nothing{} }
+                 : is_non_pos(b2) ? soft_interval { dn_mul(a2, b1), up_mul(a1, b1), detail::nothing{} }
+                 :                  soft_interval { min_of(dn_mul(a1, b2), dn_mul(a2, b1)), max_of(up_mul(a1, b1), up_mul(a2, b2)), detail::nothing{} };
+        }
+      }
+
+      return result;
+    }
+
+    static constexpr auto my_div(const soft_interval& a, const soft_interval& b) noexcept -> soft_interval
+    {
+      return ((is_point(a) && is_point(b) && (!is_zero(b.my_lo))) ? div_point(a.my_lo, b.my_lo) : div_bounds(a, b));
+    }
+
+    static constexpr auto div_bounds(const soft_interval& a, const soft_interval& b) noexcept -> soft_interval
+    {
+      auto result = soft_interval { };
+
+      const auto a1 = a.my_lo; const auto a2 = a.my_hi;
+      const auto b1 = b.my_lo; const auto b2 = b.my_hi;
+
+      if(is_nan(a) || is_nan(b) || (is_zero(b1) && is_zero(b2)))
+      {
+        result = nan_interval();
+      }
+      else if(is_non_pos(b1) && is_non_neg(b2))
+      {
+        result = entire();
+      }
+      else if(!detail::signF64UI(b1))
+      {
+        result = is_non_neg(a1) ? soft_interval { dn_div(a1, b2), up_div(a2, b1), detail::nothing{} }
+               : is_non_pos(a2) ? soft_interval { dn_div(a1, b1), up_div(a2, b2), detail::nothing{} }
+               :                  soft_interval { dn_div(a1, b1), up_div(a2, b1), detail::nothing{} };
+      }
+      else
+      {
+        result = is_non_neg(a1) ? soft_interval { dn_div(a2, b2), up_div(a1, b1), detail::nothing{} }
+               : is_non_pos(a2) ? soft_interval { dn_div(a2, b1), up_div(a1, b2), detail::nothing{} }
+               :                  soft_interval { dn_div(a2, b2), up_div(a1, b2), detail::nothing{} };
+      }
+
+      return result;
+    }
+
+    static constexpr auto my_sqrt(const soft_interval& x) noexcept -> soft_interval
+    {
+      auto result = soft_interval { };
+
+      if(is_nan(x) || (detail::signF64UI(x.my_hi) && (!is_zero(x.my_hi))))
+      {
+        result = nan_interval();
+      }
+      else
+      {
+        // The part of the interval below zero is cut off.
+        const auto lo = (detail::signF64UI(x.my_lo) ? static_cast<std::uint64_t>(UINT8_C(0)) : x.my_lo);
+        const auto hi = x.my_hi;
+
+        if((lo == hi) && (!is_zero(lo)) && (!is_non_finite(lo)))
+        {
+          result = round_both(soft_double::f64_sqrt_unrounded(lo));
+        }
+        else
+        {
+          result =
+            soft_interval
+            {
+              sqrt(down_type { lo, detail::nothing{} }).crepresentation(),
+              sqrt(up_type   { hi, detail::nothing{} }).crepresentation(),
+              detail::nothing{}
+            };
+        }
+      }
+
+      return result;
+    }
+
+    static constexpr auto my_exp(const soft_interval& x) noexcept -> soft_interval
+    {
+      // The function exp is increasing, so the bounds of the result
+      // are those of the enclosures of exp at the bounds of x.
+      return
+        is_nan(x)
+          ? nan_interval()
+          : is_point(x)
+              ? exp_enclosure(x.my_lo)
+              : soft_interval { exp_enclosure(x.my_lo).my_lo, exp_enclosure(x.my_hi).my_hi, detail::nothing{} };
+    }
+
+    static constexpr auto my_log(const soft_interval& x) noexcept -> soft_interval
+    {
+      auto result = soft_interval { };
+
+      if(is_nan(x) || (detail::signF64UI(x.my_hi) && (!is_zero(x.my_hi))))
+      {
+        result = nan_interval();
+      }
+      else if(is_point(x))
+      {
+        result = log_enclosure(x.my_lo);
+      }
+      else
+      {
+        // The function log is increasing. Its lower bound
+        // is -inf if the interval reaches zero.
+        result =
+          soft_interval
+          {
+            is_non_pos(x.my_lo) ? negated(soft_double::my_value_infinity().crepresentation()) : log_enclosure(x.my_lo).my_lo,
+            log_enclosure(x.my_hi).my_hi,
+            detail::nothing{}
+          };
+      }
+
+      return result;
+    }
+
+    // ln2 = c1 + c2, where c1 has 32 significant bits, so that k * c1
+    // is exact for |k| < 2^21, and c2 is enclosed by [c2_lo, c2_hi].
+    static constexpr auto ln2_c1() noexcept -> std::uint64_t { return static_cast<std::uint64_t>(UINT64_C(0x3FE62E42FEE00000)); }
+
+    static constexpr auto ln2_c2() noexcept -> soft_interval
+    {
+      return
+        soft_interval
+        {
+          static_cast<std::uint64_t>(UINT64_C(0x3DEA39EF35793C76)),
+          static_cast<std::uint64_t>(UINT64_C(0x3DEA39EF35793C77)),
+          detail::nothing{}
+        };
+    }
+
+    static constexpr auto exp_enclosure(std::uint64_t x) noexcept -> soft_interval
+    {
+      auto result = soft_interval { };
+
+      const auto xd = soft_double { x, detail::nothing{} };
+
+      if(detail::isNaNF64UI(x))
+      {
+        result = nan_interval();
+      }
+      else if(xd >= soft_double(static_cast<int>(INT16_C(710))))
+      {
+        // Here exp(x) > max, and exp(inf) = inf.
+        result = soft_interval { is_non_finite(x) ? x : soft_double::my_value_max().crepresentation(), soft_double::my_value_infinity().crepresentation(), detail::nothing{} };
+      }
+      else if(xd <= soft_double(static_cast<int>(INT16_C(-746))))
+      {
+        // Here 0 < exp(x) < denorm_min, and exp(-inf) = 0.
+        result = soft_interval { static_cast<std::uint64_t>(UINT8_C(0)), is_non_finite(x) ? static_cast<std::uint64_t>(UINT8_C(0)) : soft_double::my_value_denorm_min().crepresentation(), detail::nothing{} };
+      }
+      else
+      {
+        // The reciprocal factorials 1/j! for j in [0, 14], enclosed
+        // by their neighboring binary64 values.
+        constexpr auto inv_factorials_lo =
+          std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(15))>
+          {
+            static_cast<std::uint64_t>(UINT64_C(0x3FF0000000000000)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FF0000000000000)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FE0000000000000)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FC5555555555555)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FA5555555555555)),
+            static_cast<std::uint64_t>(UINT64_C(0x3F81111111111111)),
+            static_cast<std::uint64_t>(UINT64_C(0x3F56C16C16C16C16)),
+            static_cast<std::uint64_t>(UINT64_C(0x3F2A01A01A01A01A)),
+            static_cast<std::uint64_t>(UINT64_C(0x3EFA01A01A01A01A)),
+            static_cast<std::uint64_t>(UINT64_C(0x3EC71DE3A556C733)),
+            static_cast<std::uint64_t>(UINT64_C(0x3E927E4FB7789F5C)),
+            static_cast<std::uint64_t>(UINT64_C(0x3E5AE64567F544E3)),
+            static_cast<std::uint64_t>(UINT64_C(0x3E21EED8EFF8D897)),
+            static_cast<std::uint64_t>(UINT64_C(0x3DE6124613A86D09)),
+            static_cast<std::uint64_t>(UINT64_C(0x3DA93974A8C07C9D))
+          };
+
+        constexpr auto inv_factorials_hi =
+          std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(15))>
+          {
+            static_cast<std::uint64_t>(UINT64_C(0x3FF0000000000000)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FF0000000000000)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FE0000000000000)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FC5555555555556)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FA5555555555556)),
+            static_cast<std::uint64_t>(UINT64_C(0x3F81111111111112)),
+            static_cast<std::uint64_t>(UINT64_C(0x3F56C16C16C16C17)),
+            static_cast<std::uint64_t>(UINT64_C(0x3F2A01A01A01A01B)),
+            static_cast<std::uint64_t>(UINT64_C(0x3EFA01A01A01A01B)),
+            static_cast<std::uint64_t>(UINT64_C(0x3EC71DE3A556C734)),
+            static_cast<std::uint64_t>(UINT64_C(0x3E927E4FB7789F5D)),
+            static_cast<std::uint64_t>(UINT64_C(0x3E5AE64567F544E4)),
+            static_cast<std::uint64_t>(UINT64_C(0x3E21EED8EFF8D898)),
+            static_cast<std::uint64_t>(UINT64_C(0x3DE6124613A86D0A)),
+            static_cast<std::uint64_t>(UINT64_C(0x3DA93974A8C07C9E))
+          };
+
+        // Reduce x = (k * ln2) + r with k = nearest(x / ln2), so that
+        // |r| < 0.347. Only the reduced argument r needs to be enclosed.
+        const auto k =
+          static_cast<std::int32_t>
+          (
+            soft_double::f64_to__i64<detail::round_mode::near_even>
+            (
+              soft_double::f64_mul(x, static_cast<std::uint64_t>(UINT64_C(0x3FF71547652B82FE)))
+            )
+          );
+
+        const auto kd = soft_interval { soft_double(k) };
+
+        const auto r = (soft_interval { x, x, detail::nothing{} } - (kd * soft_interval { ln2_c1(), ln2_c1(), detail::nothing{} })) - (kd * ln2_c2());
+
+        // The Taylor polynomial of degree 14. Its remainder is less
+        // than |r| * 2^-61 for |r| < 0.347, and so vanishes with r.
+        auto p = soft_interval { inv_factorials_lo.back(), inv_factorials_hi.back(), detail::nothing{} };
+
+        for(auto j = static_cast<std::size_t>(inv_factorials_lo.size() - 1U); j > static_cast<std::size_t>(UINT8_C(0)); --j)
+        {
+          p = soft_interval { inv_factorials_lo[j - 1U], inv_factorials_hi[j - 1U], detail::nothing{} } + (r * p);
+        }
+
+        p += r * soft_interval { static_cast<std::uint64_t>(UINT64_C(0xBC20000000000000)), static_cast<std::uint64_t>(UINT64_C(0x3C20000000000000)), detail::nothing{} };
+
+        // Scale with 2^k in two steps, each by a normal power of two.
+        const auto k1 = static_cast<std::int32_t>(k / 2);
+        const auto k2 = static_cast<std::int32_t>(k - k1);
+
+        result = (p * pow2(k1)) * pow2(k2);
+      }
+
+      return result;
+    }
+
+    static constexpr auto log_enclosure(std::uint64_t x) noexcept -> soft_interval
+    {
+      auto result = soft_interval { };
+
+      if(detail::isNaNF64UI(x) || (detail::signF64UI(x) && (!is_zero(x))))
+      {
+        result = nan_interval();
+      }
+      else if(is_zero(x))
+      {
+        result = soft_interval { negated(soft_double::my_value_infinity().crepresentation()), negated(soft_double::my_value_infinity().crepresentation()), detail::nothing{} };
+      }
+      else if(is_non_finite(x))
+      {
+        result = soft_interval { x, x, detail::nothing{} };
+      }
+      else
+      {
+        // The reciprocals 1/(2j + 1) for j in [0, 13], enclosed
+        // by their neighboring binary64 values.
+        constexpr auto inv_odd_lo =
+          std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(14))>
+          {
+            static_cast<std::uint64_t>(UINT64_C(0x3FF0000000000000)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FD5555555555555)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FC9999999999999)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FC2492492492492)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FBC71C71C71C71C)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FB745D1745D1745)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FB3B13B13B13B13)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FB1111111111111)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FAE1E1E1E1E1E1E)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FAAF286BCA1AF28)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FA8618618618618)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FA642C8590B2164)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FA47AE147AE147A)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FA2F684BDA12F68))
+          };
+
+        constexpr auto inv_odd_hi =
+          std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(14))>
+          {
+            static_cast<std::uint64_t>(UINT64_C(0x3FF0000000000000)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FD5555555555556)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FC999999999999A)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FC2492492492493)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FBC71C71C71C71D)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FB745D1745D1746)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FB3B13B13B13B14)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FB1111111111112)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FAE1E1E1E1E1E1F)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FAAF286BCA1AF29)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FA8618618618619)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FA642C8590B2165)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FA47AE147AE147B)),
+            static_cast<std::uint64_t>(UINT64_C(0x3FA2F684BDA12F69))
+          };
+
+        // Split x = m * 2^e with m in [0.75, 1.5).
+        auto expA = detail::expF64UI(x);
+        auto sigA = detail::fracF64UI(x);
+
+        if(expA == static_cast<std::int16_t>(INT8_C(0))) { soft_double::softfloat_normSubnormalF64Sig(expA, sigA); }
+
+        sigA &= static_cast<std::uint64_t>(UINT64_C(0x000FFFFFFFFFFFFF));
+
+        const auto m_is_large = (sigA >= static_cast<std::uint64_t>(UINT64_C(0x0008000000000000)));
+
+        const auto e =
+          static_cast<std::int32_t>
+          (
+              static_cast<std::int32_t>(expA)
+            - static_cast<std::int32_t>(m_is_large ? INT16_C(0x3FE) : INT16_C(0x3FF))
+          );
+
+        const auto m =
+          soft_interval
+          {
+            detail::packToF64UI(false, m_is_large ? static_cast<std::int16_t>(INT16_C(0x3FE)) : static_cast<std::int16_t>(INT16_C(0x3FF)), sigA),
+            detail::packToF64UI(false, m_is_large ? static_cast<std::int16_t>(INT16_C(0x3FE)) : static_cast<std::int16_t>(INT16_C(0x3FF)), sigA),
+            detail::nothing{}
+          };
+
+        // log(m) = 2 * atanh(s) with s = (m - 1) / (m + 1) and |s| <= 0.2,
+        // as 2s times the series in w = s^2 of degree 13. Its remainder
+        // is positive and less than w * 2^-64.
+        const auto one = soft_interval { soft_double::my_value_one() };
+
+        const auto s = (m - one) / (m + one);
+        const auto w = s * s;
+
+        auto p = soft_interval { inv_odd_lo.back(), inv_odd_hi.back(), detail::nothing{} };
+
+        for(auto j = static_cast<std::size_t>(inv_odd_lo.size() - 1U); j > static_cast<std::size_t>(UINT8_C(0)); --j)
+        {
+          p = soft_interval { inv_odd_lo[j - 1U], inv_odd_hi[j - 1U], detail::nothing{} } + (w * p);
+        }
+
+        p += w * soft_interval { static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT64_C(0x3BF0000000000000)), detail::nothing{} };
+
+        const auto ed = soft_interval { soft_double(e) };
+
+        result = (((s * p) * pow2(1)) + (ed * ln2_c2())) + (ed * soft_interval { ln2_c1(), ln2_c1(), detail::nothing{} });
+      }
+
+      return result;
+    }
+
+    static constexpr auto pow2(std::int32_t n) noexcept -> soft_interval
+    {
+      // The power of two 2^n for a normal result.
+      return
+        soft_interval
+        {
+          detail::packToF64UI(false, static_cast<std::int16_t>(static_cast<std::int32_t>(INT16_C(0x3FF)) + n), static_cast<std::uint64_t>(UINT8_C(0))),
+          detail::packToF64UI(false, static_cast<std::int16_t>(static_cast<std::int32_t>(INT16_C(0x3FF)) + n), static_cast<std::uint64_t>(UINT8_C(0))),
+          detail::nothing{}
+        };
+    }
+  };
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::softfloat
+  #else
+  } // namespace softfloat
+  } // namespace math
+  #endif
+
+#endif // SOFT_INTERVAL_2025_07_27_H
@@ -0,0 +1,1091 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2012 - 2025.                 //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef SOFT_QUAD_2025_07_12_H // NOLINT(llvm-header-guard)
+  #define SOFT_QUAD_2025_07_12_H
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <limits>
+  #include <type_traits>
+
+  #include <math/softfloat/soft_double.h>
+
+  // The IEEE-754 binary128 format soft_quad, having one sign bit,
+  // 15 exponent bits and 112 stored fraction bits (113 bits of precision,
+  // or about 34 decimal digits).
+
+  // The value is stored in a uint128_compound, and the kernels use the
+  // same 64-bit building blocks as soft_double (with 64x64->128-bit
+  // products). Addition, subtraction, multiplication, division and square
+  // root round to nearest (with ties to even) and are correctly rounded,
+  // including subnormals, infinities and NaN. Division and square root
+  // develop their results in a few digits of 28 or 29 bits each, using
+  // one native 64/32-bit division per digit.
+
+  // The conversion from soft_double to soft_quad is exact, and the
+  // conversion back is correctly rounded.
+
+  #if(__cplusplus >= 201703L)
+  namespace math::softfloat {
+  #else
+  namespace math { namespace softfloat { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  class soft_quad;
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::softfloat
+  #else
+  } // namespace softfloat
+  } // namespace math
+  #endif
+
+  namespace std {
+
+  // Forward declaration of the specialization of numeric_limits for soft_quad.
+  template<>
+  SOFT_DOUBLE_NUM_LIMITS_CLASS_TYPE numeric_limits<::math::softfloat::soft_quad>;
+
+  } // namespace std
+
+  #if(__cplusplus >= 201703L)
+  namespace math::softfloat {
+  #else
+  namespace math { namespace softfloat { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  namespace detail {
+
+  struct soft_quad_u256
+  {
+    std::uint64_t w0 { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint64_t w1 { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint64_t w2 { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint64_t w3 { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  constexpr auto soft_quad_add_carry(std::uint64_t& sum, std::uint64_t addend) -> std::uint64_t
+  {
+    sum = static_cast<std::uint64_t>(sum + addend);
+
+    return static_cast<std::uint64_t>((sum < addend) ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)));
+  }
+
+  constexpr auto soft_quad_mul128To256(const uint128_compound& a, const uint128_compound& b) -> soft_quad_u256
+  {
+    // Returns the full 256-bit product of a and b.
+    const auto p00 = softfloat_mul64To128(a.v0, b.v0);
+    const auto p01 = softfloat_mul64To128(a.v0, b.v1);
+    const auto p10 = softfloat_mul64To128(a.v1, b.v0);
+    const auto p11 = softfloat_mul64To128(a.v1, b.v1);
+
+    soft_quad_u256 w { };
+
+    w.w0 = p00.v0;
+    w.w1 = p00.v1;
+
+    auto carry = soft_quad_add_carry(w.w1, p01.v0);
+
+    carry = static_cast<std::uint64_t>(carry + soft_quad_add_carry(w.w1, p10.v0));
+
+    w.w2 = p11.v0;
+
+    auto carry_hi = soft_quad_add_carry(w.w2, p01.v1);
+
+    carry_hi = static_cast<std::uint64_t>(carry_hi + soft_quad_add_carry(w.w2, p10.v1));
+    carry_hi = static_cast<std::uint64_t>(carry_hi + soft_quad_add_carry(w.w2, carry));
+
+    w.w3 = static_cast<std::uint64_t>(p11.v1 + carry_hi);
+
+    return w;
+  }
+
+  constexpr auto soft_quad_mul128By64(const uint128_compound& a, std::uint64_t b) -> uint128_compound
+  {
+    // Returns the low 128 bits of the product of a and b.
+    const auto p0 = softfloat_mul64To128(a.v0, b);
+
+    return uint128_compound { p0.v0, static_cast<std::uint64_t>(p0.v1 + static_cast<std::uint64_t>(a.v1 * b)) };
+  }
+
+  constexpr auto soft_quad_lt128(const uint128_compound& a, const uint128_compound& b) -> bool
+  {
+    return ((a.v1 < b.v1) || ((a.v1 == b.v1) && (a.v0 < b.v0)));
+  }
+
+  constexpr auto soft_quad_is_zero128(const uint128_compound& a) -> bool
+  {
+    return (static_cast<std::uint64_t>(a.v1 | a.v0) == static_cast<std::uint64_t>(UINT8_C(0)));
+  }
+
+  constexpr auto soft_quad_shiftLeft128(const uint128_compound& a, unsigned dist) -> uint128_compound
+  {
+    // Shifts a left by dist bits, where dist must be less than 128.
+    return
+      (dist < static_cast<unsigned>(UINT8_C(64)))
+        ? softfloat_shortShiftLeft128(a, static_cast<std::uint_fast8_t>(dist))
+        : uint128_compound { static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(a.v0 << static_cast<unsigned>(dist - static_cast<unsigned>(UINT8_C(64)))) };
+  }
+
+  constexpr auto soft_quad_shiftRight128(const uint128_compound& a, unsigned dist) -> uint128_compound
+  {
+    // Shifts a right by dist bits, where dist must be less than 128.
+    return
+      (dist == static_cast<unsigned>(UINT8_C(0)))
+        ? a
+        : ((dist < static_cast<unsigned>(UINT8_C(64)))
+            ? uint128_compound
+              {
+                static_cast<std::uint64_t>(static_cast<std::uint64_t>(a.v0 >> dist) | static_cast<std::uint64_t>(a.v1 << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - dist))),
+                static_cast<std::uint64_t>(a.v1 >> dist)
+              }
+            : uint128_compound { static_cast<std::uint64_t>(a.v1 >> static_cast<unsigned>(dist - static_cast<unsigned>(UINT8_C(64)))), static_cast<std::uint64_t>(UINT8_C(0)) });
+  }
+
+  constexpr auto soft_quad_shiftRightJam128(const uint128_compound& a, std::uint32_t dist) -> uint128_compound
+  {
+    // As softfloat_shiftRightJam128, but dist can also be zero or exceed
+    // the range of std::uint_fast16_t.
+    return
+      (dist == static_cast<std::uint32_t>(UINT8_C(0)))
+        ? a
+        : ((dist < static_cast<std::uint32_t>(UINT8_C(128)))
+            ? softfloat_shiftRightJam128(a, static_cast<std::uint_fast16_t>(dist))
+            : uint128_compound
+              {
+                static_cast<std::uint64_t>(soft_quad_is_zero128(a) ? static_cast<unsigned>(UINT8_C(0)) : static_cast<unsigned>(UINT8_C(1))),
+                static_cast<std::uint64_t>(UINT8_C(0))
+              });
+  }
+
+  constexpr auto soft_quad_shiftRightJam256To128(const soft_quad_u256& w, unsigned dist) -> uint128_compound
+  {
+    // Shifts w right by dist bits (with 64 < dist < 128) and returns the
+    // low 128 bits of the result, with any nonzero bits shifted off
+    // jammed into the least significant bit.
+    const auto s = static_cast<unsigned>(dist - static_cast<unsigned>(UINT8_C(64)));
+
+    const auto sticky =
+      (   (w.w0 != static_cast<std::uint64_t>(UINT8_C(0)))
+       || (static_cast<std::uint64_t>(w.w1 << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - s)) != static_cast<std::uint64_t>(UINT8_C(0))));
+
+    return
+      uint128_compound
+      {
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(w.w1 >> s)
+          | static_cast<std::uint64_t>(w.w2 << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - s))
+          | static_cast<std::uint64_t>(sticky ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0)))
+        ),
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(w.w2 >> s)
+          | static_cast<std::uint64_t>(w.w3 << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - s))
+        )
+      };
+  }
+
+  constexpr auto soft_quad_countLeadingZeros128(const uint128_compound& a) -> unsigned
+  {
+    return
+      static_cast<unsigned>
+      (
+        (a.v1 != static_cast<std::uint64_t>(UINT8_C(0)))
+          ? static_cast<unsigned>(softfloat_countLeadingZeros64(a.v1))
+          : static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) + static_cast<unsigned>(softfloat_countLeadingZeros64(a.v0)))
+      );
+  }
+
+  } // namespace detail
+
+  class soft_quad final
+  {
+  public:
+    using representation_type = detail::uint128_compound;
+
+    using exponent_type = std::int32_t;
+
+    constexpr soft_quad() noexcept = default;
+
+    template<typename UnsignedIntegralType,
+             typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
+                                      && std::is_unsigned<UnsignedIntegralType>::value)>::type const* = nullptr>
+    constexpr soft_quad(UnsignedIntegralType u) noexcept : my_value(f128_from_ui64(false, static_cast<std::uint64_t>(u))) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    template<typename SignedIntegralType,
+             typename std::enable_if<(   std::is_integral<SignedIntegralType>::value
+                                      && std::is_signed  <SignedIntegralType>::value)>::type const* = nullptr>
+    constexpr soft_quad(SignedIntegralType n) noexcept // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+      : my_value
+        (
+          f128_from_ui64
+          (
+            (n < static_cast<SignedIntegralType>(0)),
+            (n < static_cast<SignedIntegralType>(0)) ? detail::negate(static_cast<std::uint64_t>(static_cast<std::int64_t>(n)))
+                                                     :                static_cast<std::uint64_t>(static_cast<std::int64_t>(n))
+          )
+        ) { }
+
+    // A float is widened via double, which is exact also for subnormal floats.
+    constexpr soft_quad(float  f) noexcept : my_value(f128_from_f64(soft_double(static_cast<double>(f)).crepresentation())) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    constexpr soft_quad(double d) noexcept : my_value(f128_from_f64(soft_double(d).crepresentation())) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    constexpr soft_quad(const soft_double& d) noexcept : my_value(f128_from_f64(d.crepresentation())) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    constexpr soft_quad(const representation_type& u, const detail::nothing&) noexcept : my_value(u) { }
+
+    constexpr soft_quad(const soft_quad&) noexcept = default;
+    constexpr soft_quad(soft_quad&&) noexcept = default;
+
+    ~soft_quad() = default;
+
+    constexpr auto operator=(const soft_quad&) noexcept -> soft_quad& = default;
+    constexpr auto operator=(soft_quad&&) noexcept -> soft_quad& = default;
+
+    SOFT_DOUBLE_NODISCARD constexpr auto  representation() noexcept ->       representation_type& { return my_value; }
+    SOFT_DOUBLE_NODISCARD constexpr auto  representation() const noexcept -> representation_type  { return my_value; }
+    SOFT_DOUBLE_NODISCARD constexpr auto crepresentation() const noexcept -> representation_type  { return my_value; }
+
+    // The conversion to soft_double rounds once. The integral conversions
+    // truncate toward zero (and saturate when out of range).
+    explicit constexpr operator soft_double() const noexcept { return soft_double { f128_to_f64(my_value), detail::nothing() }; }
+
+    explicit constexpr operator float () const noexcept { return static_cast<float> (static_cast<double>(*this)); }
+    explicit constexpr operator double() const noexcept { return static_cast<double>(static_cast<soft_double>(*this)); }
+
+    explicit constexpr operator long double() const noexcept
+    {
+      // Use the sum of the leading two soft_double parts, which
+      // retains the precision of a wider native long double.
+      const auto hi = static_cast<soft_double>(*this);
+
+      return
+        static_cast<long double>
+        (
+            static_cast<long double>(static_cast<double>(hi))
+          + static_cast<long double>(static_cast<double>(static_cast<soft_double>(*this - soft_quad(hi))))
+        );
+    }
+
+    explicit constexpr operator std::int32_t () const noexcept { return static_cast<std::int32_t> (f128_to_i64(my_value, static_cast<std::int64_t>(INT32_MIN), static_cast<std::int64_t>(INT32_MAX))); }
+    explicit constexpr operator std::int64_t () const noexcept { return                            f128_to_i64(my_value, static_cast<std::int64_t>(INT64_MIN), static_cast<std::int64_t>(INT64_MAX)); }
+    explicit constexpr operator std::uint32_t() const noexcept { return static_cast<std::uint32_t>(f128_to_ui64(my_value, static_cast<std::uint64_t>(UINT32_MAX))); }
+    explicit constexpr operator std::uint64_t() const noexcept { return                            f128_to_ui64(my_value, static_cast<std::uint64_t>(UINT64_MAX)); }
+
+    constexpr auto operator+=(const soft_quad& other) noexcept -> soft_quad& { my_value = f128_add(my_value, other.my_value); return *this; }
+    constexpr auto operator-=(const soft_quad& other) noexcept -> soft_quad& { my_value = f128_sub(my_value, other.my_value); return *this; }
+    constexpr auto operator*=(const soft_quad& other) noexcept -> soft_quad& { my_value = f128_mul(my_value, other.my_value); return *this; }
+    constexpr auto operator/=(const soft_quad& other) noexcept -> soft_quad& { my_value = f128_div(my_value, other.my_value); return *this; }
+
+    constexpr auto operator++() noexcept -> soft_quad& { my_value = f128_add(my_value, my_value_one().my_value); return *this; }
+    constexpr auto operator--() noexcept -> soft_quad& { my_value = f128_sub(my_value, my_value_one().my_value); return *this; }
+
+    constexpr auto operator++(int) noexcept -> soft_quad { const auto w = *this; static_cast<void>(++(*this)); return w; }
+    constexpr auto operator--(int) noexcept -> soft_quad { const auto w = *this; static_cast<void>(--(*this)); return w; }
+
+    constexpr auto operator+() const noexcept -> soft_quad { return soft_quad { my_value, detail::nothing() }; }
+    constexpr auto operator-() const noexcept -> soft_quad { return soft_quad { representation_type { my_value.v0, static_cast<std::uint64_t>(my_value.v1 ^ sign_mask()) }, detail::nothing() }; }
+
+    static constexpr auto my_value_zero       () noexcept -> soft_quad { return soft_quad { representation_type { }, detail::nothing() }; }
+    static constexpr auto my_value_one        () noexcept -> soft_quad { return soft_quad { representation_type { static_cast<std::uint64_t>(UINT8_C(0)),                  static_cast<std::uint64_t>(UINT64_C(0x3FFF000000000000)) }, detail::nothing() }; }
+    static constexpr auto my_value_min        () noexcept -> soft_quad { return soft_quad { representation_type { static_cast<std::uint64_t>(UINT8_C(0)),                  static_cast<std::uint64_t>(UINT64_C(0x0001000000000000)) }, detail::nothing() }; }
+    static constexpr auto my_value_max        () noexcept -> soft_quad { return soft_quad { representation_type { static_cast<std::uint64_t>(UINT64_C(0xFFFFFFFFFFFFFFFF)), static_cast<std::uint64_t>(UINT64_C(0x7FFEFFFFFFFFFFFF)) }, detail::nothing() }; }
+    static constexpr auto my_value_lowest     () noexcept -> soft_quad { return soft_quad { representation_type { static_cast<std::uint64_t>(UINT64_C(0xFFFFFFFFFFFFFFFF)), static_cast<std::uint64_t>(UINT64_C(0xFFFEFFFFFFFFFFFF)) }, detail::nothing() }; }
+    static constexpr auto my_value_epsilon    () noexcept -> soft_quad { return soft_quad { representation_type { static_cast<std::uint64_t>(UINT8_C(0)),                  static_cast<std::uint64_t>(UINT64_C(0x3F8F000000000000)) }, detail::nothing() }; }
+    static constexpr auto my_value_round_error() noexcept -> soft_quad { return soft_quad { representation_type { static_cast<std::uint64_t>(UINT8_C(0)),                  static_cast<std::uint64_t>(UINT64_C(0x3FFE000000000000)) }, detail::nothing() }; }
+    static constexpr auto my_value_denorm_min () noexcept -> soft_quad { return soft_quad { representation_type { static_cast<std::uint64_t>(UINT8_C(1)),                  static_cast<std::uint64_t>(UINT8_C(0)) },                  detail::nothing() }; }
+    static constexpr auto my_value_infinity   () noexcept -> soft_quad { return soft_quad { representation_type { static_cast<std::uint64_t>(UINT8_C(0)),                  static_cast<std::uint64_t>(UINT64_C(0x7FFF000000000000)) }, detail::nothing() }; }
+    static constexpr auto my_value_quiet_NaN  () noexcept -> soft_quad { return soft_quad { representation_type { static_cast<std::uint64_t>(UINT8_C(0)),                  static_cast<std::uint64_t>(UINT64_C(0x7FFF800000000000)) }, detail::nothing() }; }
+
+    friend constexpr auto operator+(const soft_quad& a, const soft_quad& b) noexcept -> soft_quad { return soft_quad { f128_add(a.my_value, b.my_value), detail::nothing() }; }
+    friend constexpr auto operator-(const soft_quad& a, const soft_quad& b) noexcept -> soft_quad { return soft_quad { f128_sub(a.my_value, b.my_value), detail::nothing() }; }
+    friend constexpr auto operator*(const soft_quad& a, const soft_quad& b) noexcept -> soft_quad { return soft_quad { f128_mul(a.my_value, b.my_value), detail::nothing() }; }
+    friend constexpr auto operator/(const soft_quad& a, const soft_quad& b) noexcept -> soft_quad { return soft_quad { f128_div(a.my_value, b.my_value), detail::nothing() }; }
+
+    // The comparisons follow IEEE-754: NaN is unordered and -0 == +0.
+    friend constexpr auto operator==(const soft_quad& a, const soft_quad& b) noexcept -> bool { return   f128_eq(a.my_value, b.my_value); }
+    friend constexpr auto operator!=(const soft_quad& a, const soft_quad& b) noexcept -> bool { return (!f128_eq(a.my_value, b.my_value)); }
+    friend constexpr auto operator< (const soft_quad& a, const soft_quad& b) noexcept -> bool { return   f128_lt(a.my_value, b.my_value); }
+    friend constexpr auto operator<=(const soft_quad& a, const soft_quad& b) noexcept -> bool { return   f128_le(a.my_value, b.my_value); }
+    friend constexpr auto operator> (const soft_quad& a, const soft_quad& b) noexcept -> bool { return   f128_lt(b.my_value, a.my_value); }
+    friend constexpr auto operator>=(const soft_quad& a, const soft_quad& b) noexcept -> bool { return   f128_le(b.my_value, a.my_value); }
+
+    friend constexpr auto (isnan)   (const soft_quad& x) noexcept -> bool { return   f128_is_nan(x.my_value); }
+    friend constexpr auto (isinf)   (const soft_quad& x) noexcept -> bool { return   f128_is_inf(x.my_value); }
+    friend constexpr auto (isfinite)(const soft_quad& x) noexcept -> bool { return (f128_exp(x.my_value) != exp_max()); }
+    friend constexpr auto (signbit) (const soft_quad& x) noexcept -> bool { return   f128_sign(x.my_value); }
+
+    friend constexpr auto abs (const soft_quad& x) noexcept -> soft_quad { return soft_quad { representation_type { x.my_value.v0, static_cast<std::uint64_t>(x.my_value.v1 & static_cast<std::uint64_t>(~sign_mask())) }, detail::nothing() }; }
+    friend constexpr auto fabs(const soft_quad& x) noexcept -> soft_quad { return soft_quad { representation_type { x.my_value.v0, static_cast<std::uint64_t>(x.my_value.v1 & static_cast<std::uint64_t>(~sign_mask())) }, detail::nothing() }; }
+
+    friend constexpr auto sqrt(const soft_quad& x) noexcept -> soft_quad { return soft_quad { f128_sqrt(x.my_value), detail::nothing() }; }
+
+    #if !defined(SOFT_DOUBLE_DISABLE_IOSTREAM)
+    template<typename char_type, typename traits_type>
+    friend auto operator<<(std::basic_ostream<char_type, traits_type>& os, const soft_quad& f) -> std::basic_ostream<char_type, traits_type>&
+    {
+      // Note that this output stream function relies on native long double,
+      // which limits the number of significant digits that are printed.
+      return (os << static_cast<long double>(f));
+    }
+    #endif // !SOFT_DOUBLE_DISABLE_IOSTREAM
+
+  private:
+    representation_type my_value { }; // NOLINT(readability-identifier-naming)
+
+    // The significands carry three extra low-order bits (guard, round
+    // and sticky) before rounding, placing the leading bit at bit 115.
+    static constexpr auto frac_bits = static_cast<unsigned>(UINT8_C(112));
+    static constexpr auto lead_bit  = static_cast<unsigned>(UINT8_C(115));
+
+    static constexpr auto bias     () noexcept -> exponent_type { return static_cast<exponent_type>(INT32_C(0x3FFF)); }
+    static constexpr auto exp_max  () noexcept -> exponent_type { return static_cast<exponent_type>(INT32_C(0x7FFF)); }
+    static constexpr auto sign_mask() noexcept -> std::uint64_t { return static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)); }
+    static constexpr auto frac_mask() noexcept -> std::uint64_t { return static_cast<std::uint64_t>(UINT64_C(0x0000FFFFFFFFFFFF)); }
+    static constexpr auto hidden   () noexcept -> std::uint64_t { return static_cast<std::uint64_t>(UINT64_C(0x0001000000000000)); }
+
+    static constexpr auto f128_sign(const representation_type& a) noexcept -> bool          { return (static_cast<std::uint64_t>(a.v1 & sign_mask()) != static_cast<std::uint64_t>(UINT8_C(0))); }
+    static constexpr auto f128_exp (const representation_type& a) noexcept -> exponent_type { return static_cast<exponent_type>(static_cast<std::uint64_t>(a.v1 >> static_cast<unsigned>(UINT8_C(48))) & static_cast<std::uint64_t>(UINT16_C(0x7FFF))); }
+
+    static constexpr auto f128_frac_is_zero(const representation_type& a) noexcept -> bool
+    {
+      return (static_cast<std::uint64_t>(static_cast<std::uint64_t>(a.v1 & frac_mask()) | a.v0) == static_cast<std::uint64_t>(UINT8_C(0)));
+    }
+
+    static constexpr auto f128_is_nan (const representation_type& a) noexcept -> bool { return ((f128_exp(a) == exp_max()) && (!f128_frac_is_zero(a))); }
+    static constexpr auto f128_is_inf (const representation_type& a) noexcept -> bool { return ((f128_exp(a) == exp_max()) &&   f128_frac_is_zero(a)); }
+    static constexpr auto f128_is_zero(const representation_type& a) noexcept -> bool { return ((f128_exp(a) == static_cast<exponent_type>(0)) && f128_frac_is_zero(a)); }
+
+    static constexpr auto f128_pack(const bool sign, const std::uint64_t exp_and_frac_hi, const std::uint64_t frac_lo) noexcept -> representation_type
+    {
+      return representation_type { frac_lo, static_cast<std::uint64_t>((sign ? sign_mask() : static_cast<std::uint64_t>(UINT8_C(0))) | exp_and_frac_hi) };
+    }
+
+    static constexpr auto f128_pack_inf (const bool sign) noexcept -> representation_type { return f128_pack(sign, my_value_infinity().my_value.v1, static_cast<std::uint64_t>(UINT8_C(0))); }
+    static constexpr auto f128_pack_zero(const bool sign) noexcept -> representation_type { return f128_pack(sign, static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT8_C(0))); }
+
+    static constexpr auto f128_unpack(const representation_type& a, exponent_type& expA) noexcept -> representation_type
+    {
+      // Unpacks a finite, nonzero value to a significand having its
+      // leading bit at bit 112. Subnormals are normalized, whereby
+      // their exponent can become zero or negative.
+      expA = f128_exp(a);
+
+      auto sig = representation_type { a.v0, static_cast<std::uint64_t>(a.v1 & frac_mask()) };
+
+      if(expA == static_cast<exponent_type>(0))
+      {
+        const auto shift = static_cast<unsigned>(detail::soft_quad_countLeadingZeros128(sig) - static_cast<unsigned>(UINT8_C(15)));
+
+        sig  = detail::soft_quad_shiftLeft128(sig, shift);
+        expA = static_cast<exponent_type>(static_cast<exponent_type>(1) - static_cast<exponent_type>(shift));
+      }
+      else
+      {
+        sig.v1 = static_cast<std::uint64_t>(sig.v1 | hidden());
+      }
+
+      return sig;
+    }
+
+    static constexpr auto f128_round_pack(const bool sign, exponent_type expA, representation_type sig) noexcept -> representation_type
+    {
+      // Rounds and packs the value sig * 2^(expA - bias - lead_bit),
+      // where the leading bit of sig is at lead_bit (or sig is zero).
+      // The guard bits are rounded to nearest, with ties to even.
+      if(expA < static_cast<exponent_type>(1))
+      {
+        // The result is subnormal (or could round up to the smallest normal).
+        sig  = detail::soft_quad_shiftRightJam128(sig, static_cast<std::uint32_t>(static_cast<exponent_type>(1) - expA));
+        expA = static_cast<exponent_type>(1);
+      }
+
+      const auto round_bits = static_cast<std::uint64_t>(sig.v0 & static_cast<std::uint64_t>(UINT8_C(7)));
+
+      auto sig_r =
+        detail::soft_quad_shiftRight128
+        (
+          detail::softfloat_add128(sig, representation_type { static_cast<std::uint64_t>(UINT8_C(4)), static_cast<std::uint64_t>(UINT8_C(0)) }),
+          static_cast<unsigned>(UINT8_C(3))
+        );
+
+      if(round_bits == static_cast<std::uint64_t>(UINT8_C(4)))
+      {
+        sig_r.v0 = static_cast<std::uint64_t>(sig_r.v0 & static_cast<std::uint64_t>(~static_cast<std::uint64_t>(UINT8_C(1))));
+      }
+
+      // A significand that has rounded up to 2^113 carries into
+      // the exponent. A subnormal one has no hidden bit.
+      const auto exp_field =
+        static_cast<exponent_type>
+        (
+            static_cast<exponent_type>(expA - static_cast<exponent_type>(1))
+          + static_cast<exponent_type>(sig_r.v1 >> static_cast<unsigned>(UINT8_C(48)))
+        );
+
+      return
+        (exp_field >= exp_max())
+          ? f128_pack_inf(sign)
+          : f128_pack
+            (
+              sign,
+              static_cast<std::uint64_t>
+              (
+                  static_cast<std::uint64_t>(static_cast<std::uint64_t>(exp_field) << static_cast<unsigned>(UINT8_C(48)))
+                | static_cast<std::uint64_t>(sig_r.v1 & frac_mask())
+              ),
+              sig_r.v0
+            );
+    }
+
+    static constexpr auto f128_normalize_round_pack(const bool sign, exponent_type expA, const representation_type& sig) noexcept -> representation_type
+    {
+      // As f128_round_pack, for a nonzero sig whose leading bit is at or below lead_bit.
+      const auto shift = static_cast<unsigned>(detail::soft_quad_countLeadingZeros128(sig) - static_cast<unsigned>(static_cast<unsigned>(UINT8_C(127)) - lead_bit));
+
+      return f128_round_pack(sign, static_cast<exponent_type>(expA - static_cast<exponent_type>(shift)), detail::soft_quad_shiftLeft128(sig, shift));
+    }
+
+    static constexpr auto f128_propagate_nan(const representation_type& a, const representation_type& b) noexcept -> representation_type
+    {
+      return (f128_is_nan(a) ? a : b);
+    }
+
+    static constexpr auto f128_add_mags(const representation_type& a, const representation_type& b, const bool signZ) noexcept -> representation_type
+    {
+      // Adds the magnitudes of the finite, nonzero values a and b.
+      auto expA = exponent_type { };
+      auto expB = exponent_type { };
+
+      auto sigA = detail::softfloat_shortShiftLeft128(f128_unpack(a, expA), static_cast<std::uint_fast8_t>(UINT8_C(3)));
+      auto sigB = detail::softfloat_shortShiftLeft128(f128_unpack(b, expB), static_cast<std::uint_fast8_t>(UINT8_C(3)));
+
+      if(expA < expB)
+      {
+        const auto tmp_sig = sigA; sigA = sigB; sigB = tmp_sig;
+        const auto tmp_exp = expA; expA = expB; expB = tmp_exp;
+      }
+
+      sigB = detail::soft_quad_shiftRightJam128(sigB, static_cast<std::uint32_t>(expA - expB));
+
+      auto sigZ = detail::softfloat_add128(sigA, sigB);
+
+      if(static_cast<std::uint64_t>(sigZ.v1 >> static_cast<unsigned>(lead_bit + static_cast<unsigned>(UINT8_C(1)) - static_cast<unsigned>(UINT8_C(64)))) != static_cast<std::uint64_t>(UINT8_C(0)))
+      {
+        sigZ = detail::softfloat_shortShiftRightJam128(sigZ, static_cast<std::uint_fast8_t>(UINT8_C(1)));
+
+        ++expA;
+      }
+
+      return f128_round_pack(signZ, expA, sigZ);
+    }
+
+    static constexpr auto f128_sub_mags(const representation_type& a, const representation_type& b, bool signZ) noexcept -> representation_type
+    {
+      // Subtracts the magnitude of b from that of a, both finite and nonzero.
+      // With three guard bits, the alignment of the smaller operand
+      // (with jamming) retains enough bits for correct rounding.
+      auto expA = exponent_type { };
+      auto expB = exponent_type { };
+
+      auto sigA = detail::softfloat_shortShiftLeft128(f128_unpack(a, expA), static_cast<std::uint_fast8_t>(UINT8_C(3)));
+      auto sigB = detail::softfloat_shortShiftLeft128(f128_unpack(b, expB), static_cast<std::uint_fast8_t>(UINT8_C(3)));
+
+      if((expA < expB) || ((expA == expB) && detail::soft_quad_lt128(sigA, sigB)))
+      {
+        const auto tmp_sig = sigA; sigA = sigB; sigB = tmp_sig;
+        const auto tmp_exp = expA; expA = expB; expB = tmp_exp;
+
+        signZ = (!signZ);
+      }
+
+      sigB = detail::soft_quad_shiftRightJam128(sigB, static_cast<std::uint32_t>(expA - expB));
+
+      const auto sigZ = detail::softfloat_sub128(sigA, sigB);
+
+      return
+        detail::soft_quad_is_zero128(sigZ)
+          ? f128_pack_zero(false)
+          : f128_normalize_round_pack(signZ, expA, sigZ);
+    }
+
+    static constexpr auto f128_add_or_sub(const representation_type& a, const representation_type& b, const bool is_sub) noexcept -> representation_type
+    {
+      const auto signA = f128_sign(a);
+      const auto signB = static_cast<bool>(f128_sign(b) != is_sub);
+
+      auto result = representation_type { };
+
+      if(f128_is_nan(a) || f128_is_nan(b))
+      {
+        result = f128_propagate_nan(a, b);
+      }
+      else if(f128_is_inf(a) || f128_is_inf(b))
+      {
+        result =
+          ((f128_is_inf(a) && f128_is_inf(b) && (signA != signB))
+            ? my_value_quiet_NaN().my_value
+            : (f128_is_inf(a) ? a : f128_pack_inf(signB)));
+      }
+      else if(f128_is_zero(b))
+      {
+        // Here, -0 + +0 is +0 (when rounding to nearest).
+        result = ((f128_is_zero(a) && (signA != signB)) ? f128_pack_zero(false) : a);
+      }
+      else if(f128_is_zero(a))
+      {
+        result = f128_pack(signB, static_cast<std::uint64_t>(b.v1 & static_cast<std::uint64_t>(~sign_mask())), b.v0);
+      }
+      else
+      {
+        result = ((signA == signB) ? f128_add_mags(a, b, signA) : f128_sub_mags(a, b, signA));
+      }
+
+      return result;
+    }
+
+    static constexpr auto f128_add(const representation_type& a, const representation_type& b) noexcept -> representation_type { return f128_add_or_sub(a, b, false); }
+    static constexpr auto f128_sub(const representation_type& a, const representation_type& b) noexcept -> representation_type { return f128_add_or_sub(a, b, true); }
+
+    static constexpr auto f128_mul(const representation_type& a, const representation_type& b) noexcept -> representation_type
+    {
+      const auto signZ = static_cast<bool>(f128_sign(a) != f128_sign(b));
+
+      auto result = representation_type { };
+
+      if(f128_is_nan(a) || f128_is_nan(b))
+      {
+        result = f128_propagate_nan(a, b);
+      }
+      else if(f128_is_inf(a) || f128_is_inf(b))
+      {
+        result = ((f128_is_zero(a) || f128_is_zero(b)) ? my_value_quiet_NaN().my_value : f128_pack_inf(signZ));
+      }
+      else if(f128_is_zero(a) || f128_is_zero(b))
+      {
+        result = f128_pack_zero(signZ);
+      }
+      else
+      {
+        auto expA = exponent_type { };
+        auto expB = exponent_type { };
+
+        const auto sigA = f128_unpack(a, expA);
+        const auto sigB = f128_unpack(b, expB);
+
+        // The product has its leading bit at bit 224 (or 225),
+        // and is jammed down to lead_bit.
+        const auto prod = detail::soft_quad_mul128To256(sigA, sigB);
+
+        const auto prod_is_high = (static_cast<std::uint64_t>(prod.w3 >> static_cast<unsigned>(UINT8_C(33))) != static_cast<std::uint64_t>(UINT8_C(0)));
+
+        const auto sigZ =
+          detail::soft_quad_shiftRightJam256To128
+          (
+            prod,
+            static_cast<unsigned>((static_cast<unsigned>(UINT8_C(2)) * frac_bits) - lead_bit + (prod_is_high ? static_cast<unsigned>(UINT8_C(1)) : static_cast<unsigned>(UINT8_C(0))))
+          );
+
+        const auto expZ =
+          static_cast<exponent_type>
+          (
+              static_cast<exponent_type>(expA + expB)
+            - static_cast<exponent_type>(bias() - (prod_is_high ? static_cast<exponent_type>(1) : static_cast<exponent_type>(0)))
+          );
+
+        result = f128_round_pack(signZ, expZ, sigZ);
+      }
+
+      return result;
+    }
+
+    static constexpr auto f128_div(const representation_type& a, const representation_type& b) noexcept -> representation_type
+    {
+      const auto signZ = static_cast<bool>(f128_sign(a) != f128_sign(b));
+
+      auto result = representation_type { };
+
+      if(f128_is_nan(a) || f128_is_nan(b))
+      {
+        result = f128_propagate_nan(a, b);
+      }
+      else if(f128_is_inf(a))
+      {
+        result = (f128_is_inf(b) ? my_value_quiet_NaN().my_value : f128_pack_inf(signZ));
+      }
+      else if(f128_is_inf(b))
+      {
+        result = f128_pack_zero(signZ);
+      }
+      else if(f128_is_zero(b))
+      {
+        result = (f128_is_zero(a) ? my_value_quiet_NaN().my_value : f128_pack_inf(signZ));
+      }
+      else if(f128_is_zero(a))
+      {
+        result = f128_pack_zero(signZ);
+      }
+      else
+      {
+        auto expA = exponent_type { };
+        auto expB = exponent_type { };
+
+        const auto sigA = f128_unpack(a, expA);
+        const auto sigB = f128_unpack(b, expB);
+
+        // Develop the integer quotient of rem * 2^lead_bit and sigB, where
+        // rem (which is sigA or 2 * sigA) lies in [sigB, 2 * sigB). The 116
+        // quotient bits are found in one digit of 28 bits followed by three
+        // digits of 29 bits. Each digit is estimated from below by dividing
+        // the leading bits of the remainder by the (incremented) leading 32
+        // bits of sigB, and is then corrected upward by at most two. The
+        // remainders are computed modulo 2^128, which is exact since their
+        // true values are small. The final remainder is jammed into the
+        // least significant bit of the quotient.
+        const auto quo_is_high = (!detail::soft_quad_lt128(sigA, sigB));
+
+        auto rem = (quo_is_high ? sigA : detail::softfloat_shortShiftLeft128(sigA, static_cast<std::uint_fast8_t>(UINT8_C(1))));
+
+        const auto divisor_top = static_cast<std::uint64_t>(static_cast<std::uint64_t>(detail::soft_quad_shiftRight128(sigB, static_cast<unsigned>(UINT8_C(81))).v0) + static_cast<std::uint64_t>(UINT8_C(1)));
+
+        auto quo = representation_type { };
+
+        for(auto   digit_index = static_cast<unsigned>(UINT8_C(0));
+                   digit_index < static_cast<unsigned>(UINT8_C(4));
+                 ++digit_index)
+        {
+          const auto digit_bits =
+            static_cast<unsigned>
+            (
+              (digit_index == static_cast<unsigned>(UINT8_C(0))) ? static_cast<unsigned>(UINT8_C(28)) : static_cast<unsigned>(UINT8_C(29))
+            );
+
+          auto q =
+            static_cast<std::uint64_t>
+            (
+                detail::soft_quad_shiftRight128(rem, static_cast<unsigned>(static_cast<unsigned>(UINT8_C(81)) - digit_bits)).v0
+              / divisor_top
+            );
+
+          rem = detail::softfloat_sub128(detail::soft_quad_shiftLeft128(rem, digit_bits), detail::soft_quad_mul128By64(sigB, q));
+
+          while(!detail::soft_quad_lt128(rem, sigB))
+          {
+            rem = detail::softfloat_sub128(rem, sigB);
+
+            ++q;
+          }
+
+          quo = detail::softfloat_add128(detail::soft_quad_shiftLeft128(quo, digit_bits), representation_type { q, static_cast<std::uint64_t>(UINT8_C(0)) });
+        }
+
+        if(!detail::soft_quad_is_zero128(rem))
+        {
+          quo.v0 = static_cast<std::uint64_t>(quo.v0 | static_cast<std::uint64_t>(UINT8_C(1)));
+        }
+
+        const auto expZ =
+          static_cast<exponent_type>
+          (
+              static_cast<exponent_type>(expA - expB)
+            + static_cast<exponent_type>(bias() - (quo_is_high ? static_cast<exponent_type>(0) : static_cast<exponent_type>(1)))
+          );
+
+        result = f128_round_pack(signZ, expZ, quo);
+      }
+
+      return result;
+    }
+
+    static constexpr auto f128_sqrt(const representation_type& a) noexcept -> representation_type
+    {
+      auto result = representation_type { };
+
+      if(f128_is_nan(a) || f128_is_zero(a))
+      {
+        result = a;
+      }
+      else if(f128_sign(a))
+      {
+        result = my_value_quiet_NaN().my_value;
+      }
+      else if(f128_is_inf(a))
+      {
+        result = a;
+      }
+      else
+      {
+        auto expA = exponent_type { };
+
+        const auto sigA = f128_unpack(a, expA);
+
+        // Take the integer square root of the radicand N = sigA * 2^k,
+        // where k (118 or 119) makes the remaining power of two even.
+        // The root then has its leading bit at lead_bit.
+        const auto unbiased_exp = static_cast<exponent_type>(expA - bias());
+
+        const auto exp_is_odd = ((unbiased_exp % static_cast<exponent_type>(2)) != static_cast<exponent_type>(0));
+
+        const auto k = static_cast<unsigned>(exp_is_odd ? static_cast<unsigned>(UINT8_C(119)) : static_cast<unsigned>(UINT8_C(118)));
+
+        // Begin with the 32-bit root of the leading 64 bits, N >> 168,
+        // using Newton iteration from above.
+        const auto n_top = detail::soft_quad_shiftRight128(sigA, static_cast<unsigned>(static_cast<unsigned>(UINT16_C(168)) - k)).v0;
+
+        auto s_top = static_cast<std::uint64_t>(static_cast<std::uint64_t>(n_top >> static_cast<unsigned>(UINT8_C(33))) + static_cast<std::uint64_t>(UINT64_C(0x80000000)));
+
+        for(auto s_next = static_cast<std::uint64_t>(static_cast<std::uint64_t>(s_top + static_cast<std::uint64_t>(n_top / s_top)) >> static_cast<unsigned>(UINT8_C(1)));
+                 s_next < s_top;
+                 s_next = static_cast<std::uint64_t>(static_cast<std::uint64_t>(s_top + static_cast<std::uint64_t>(n_top / s_top)) >> static_cast<unsigned>(UINT8_C(1))))
+        {
+          s_top = s_next;
+        }
+
+        auto root = representation_type { s_top, static_cast<std::uint64_t>(UINT8_C(0)) };
+        auto rem  = representation_type { static_cast<std::uint64_t>(n_top - static_cast<std::uint64_t>(s_top * s_top)), static_cast<std::uint64_t>(UINT8_C(0)) };
+
+        // Append three digits of 28 bits, each from the next 56 bits
+        // of the radicand. The remainder N_j - root^2 (computed modulo
+        // 2^128, which is exact since its true value is small) is used
+        // to estimate each digit, which is then corrected by a few units.
+        for(auto   digit_index = static_cast<unsigned>(UINT8_C(0));
+                   digit_index < static_cast<unsigned>(UINT8_C(3));
+                 ++digit_index)
+        {
+          const auto root_shift = static_cast<unsigned>(static_cast<unsigned>(UINT8_C(28)) * digit_index);
+
+          const auto root_top = static_cast<std::uint64_t>(detail::soft_quad_shiftRight128(root, root_shift).v0 + static_cast<std::uint64_t>(UINT8_C(1)));
+
+          const auto rem_top =
+            static_cast<std::uint64_t>
+            (
+              (digit_index == static_cast<unsigned>(UINT8_C(0)))
+                ? static_cast<std::uint64_t>(rem.v0 << static_cast<unsigned>(UINT8_C(27)))
+                : detail::soft_quad_shiftRight128(rem, static_cast<unsigned>(root_shift - static_cast<unsigned>(UINT8_C(27)))).v0
+            );
+
+          const auto q = static_cast<std::uint64_t>(rem_top / root_top);
+
+          const auto n_shift = static_cast<unsigned>(static_cast<unsigned>(static_cast<unsigned>(UINT8_C(56)) * digit_index) + k - static_cast<unsigned>(UINT8_C(112)));
+
+          const auto n_digits =
+            (n_shift < static_cast<unsigned>(UINT8_C(128)))
+              ? static_cast<std::uint64_t>(detail::soft_quad_shiftLeft128(sigA, n_shift).v0 & static_cast<std::uint64_t>(UINT64_C(0x00FFFFFFFFFFFFFF)))
+              : static_cast<std::uint64_t>(UINT8_C(0));
+
+          // Here, (root * 2^28 + q)^2 - (root * 2^28)^2 = (root * 2^29 + q) * q.
+          rem =
+            detail::softfloat_sub128
+            (
+              detail::softfloat_add128(detail::soft_quad_shiftLeft128(rem, static_cast<unsigned>(UINT8_C(56))), representation_type { n_digits, static_cast<std::uint64_t>(UINT8_C(0)) }),
+              detail::soft_quad_mul128By64(detail::softfloat_add128(detail::soft_quad_shiftLeft128(root, static_cast<unsigned>(UINT8_C(29))), representation_type { q, static_cast<std::uint64_t>(UINT8_C(0)) }), q)
+            );
+
+          root = detail::softfloat_add128(detail::soft_quad_shiftLeft128(root, static_cast<unsigned>(UINT8_C(28))), representation_type { q, static_cast<std::uint64_t>(UINT8_C(0)) });
+
+          const auto one = representation_type { static_cast<std::uint64_t>(UINT8_C(1)), static_cast<std::uint64_t>(UINT8_C(0)) };
+
+          while(static_cast<std::uint64_t>(rem.v1 >> static_cast<unsigned>(UINT8_C(63))) != static_cast<std::uint64_t>(UINT8_C(0)))
+          {
+            // The remainder is negative, so decrement the root.
+            root = detail::softfloat_sub128(root, one);
+            rem  = detail::softfloat_add128(rem, detail::softfloat_add128(detail::softfloat_shortShiftLeft128(root, static_cast<std::uint_fast8_t>(UINT8_C(1))), one));
+          }
+
+          while(!detail::soft_quad_lt128(rem, detail::softfloat_add128(detail::softfloat_shortShiftLeft128(root, static_cast<std::uint_fast8_t>(UINT8_C(1))), one)))
+          {
+            // The remainder is at least 2 * root + 1, so increment the root.
+            rem  = detail::softfloat_sub128(rem, detail::softfloat_add128(detail::softfloat_shortShiftLeft128(root, static_cast<std::uint_fast8_t>(UINT8_C(1))), one));
+            root = detail::softfloat_add128(root, one);
+          }
+        }
+
+        if(!detail::soft_quad_is_zero128(rem))
+        {
+          root.v0 = static_cast<std::uint64_t>(root.v0 | static_cast<std::uint64_t>(UINT8_C(1)));
+        }
+
+        const auto expZ =
+          static_cast<exponent_type>
+          (
+              static_cast<exponent_type>(static_cast<exponent_type>(unbiased_exp - (exp_is_odd ? static_cast<exponent_type>(1) : static_cast<exponent_type>(0))) / static_cast<exponent_type>(2))
+            + bias()
+          );
+
+        result = f128_round_pack(false, expZ, root);
+      }
+
+      return result;
+    }
+
+    static constexpr auto f128_eq(const representation_type& a, const representation_type& b) noexcept -> bool
+    {
+      return
+        (
+             (!f128_is_nan(a))
+          && (!f128_is_nan(b))
+          && (((a.v0 == b.v0) && (a.v1 == b.v1)) || (f128_is_zero(a) && f128_is_zero(b)))
+        );
+    }
+
+    static constexpr auto f128_lt(const representation_type& a, const representation_type& b) noexcept -> bool
+    {
+      // For equal signs, the magnitudes are ordered as their bit patterns.
+      const auto signA = f128_sign(a);
+      const auto signB = f128_sign(b);
+
+      return
+        (
+             (!f128_is_nan(a))
+          && (!f128_is_nan(b))
+          && ((signA != signB) ? (signA && (!(f128_is_zero(a) && f128_is_zero(b))))
+                               : (((a.v0 != b.v0) || (a.v1 != b.v1)) && (signA != detail::soft_quad_lt128(a, b))))
+        );
+    }
+
+    static constexpr auto f128_le(const representation_type& a, const representation_type& b) noexcept -> bool
+    {
+      return (f128_lt(a, b) || f128_eq(a, b));
+    }
+
+    static constexpr auto f128_from_ui64(const bool sign, const std::uint64_t u) noexcept -> representation_type
+    {
+      // Every 64-bit integer is exactly representable.
+      const auto shift = static_cast<unsigned>(static_cast<unsigned>(UINT8_C(49)) + static_cast<unsigned>(detail::softfloat_countLeadingZeros64(u)));
+
+      const auto sig = detail::soft_quad_shiftLeft128(representation_type { u, static_cast<std::uint64_t>(UINT8_C(0)) }, shift);
+
+      const auto expZ = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(bias()) + frac_bits) - shift);
+
+      return
+        (u == static_cast<std::uint64_t>(UINT8_C(0)))
+          ? f128_pack_zero(false)
+          : f128_pack
+            (
+              sign,
+              static_cast<std::uint64_t>(static_cast<std::uint64_t>(expZ << static_cast<unsigned>(UINT8_C(48))) | static_cast<std::uint64_t>(sig.v1 & frac_mask())),
+              sig.v0
+            );
+    }
+
+    static constexpr auto f128_from_f64(const std::uint64_t a) noexcept -> representation_type
+    {
+      // Widen a soft_double value, which is exact.
+      const auto signA = detail::signF64UI(a);
+      const auto expA  = detail::expF64UI (a);
+      const auto fracA = detail::fracF64UI(a);
+
+      auto result = representation_type { };
+
+      if(expA == static_cast<std::int16_t>(INT16_C(0x7FF)))
+      {
+        result = ((fracA != static_cast<std::uint64_t>(UINT8_C(0))) ? f128_pack(signA, my_value_quiet_NaN().my_value.v1, static_cast<std::uint64_t>(UINT8_C(0))) : f128_pack_inf(signA));
+      }
+      else if((expA == static_cast<std::int16_t>(INT8_C(0))) && (fracA == static_cast<std::uint64_t>(UINT8_C(0))))
+      {
+        result = f128_pack_zero(signA);
+      }
+      else
+      {
+        // Place the leading bit of the (normalized) soft_double
+        // significand at bit 52 and then widen the fraction.
+        auto expZ = static_cast<exponent_type>(expA);
+        auto sig  = static_cast<std::uint64_t>(fracA | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)));
+
+        if(expA == static_cast<std::int16_t>(INT8_C(0)))
+        {
+          const auto shift = static_cast<unsigned>(static_cast<unsigned>(detail::softfloat_countLeadingZeros64(fracA)) - static_cast<unsigned>(UINT8_C(11)));
+
+          sig  = static_cast<std::uint64_t>(fracA << shift);
+          expZ = static_cast<exponent_type>(static_cast<exponent_type>(1) - static_cast<exponent_type>(shift));
+        }
+
+        const auto frac =
+          detail::softfloat_shortShiftLeft128
+          (
+            representation_type { static_cast<std::uint64_t>(sig & static_cast<std::uint64_t>(UINT64_C(0x000FFFFFFFFFFFFF))), static_cast<std::uint64_t>(UINT8_C(0)) },
+            static_cast<std::uint_fast8_t>(UINT8_C(60))
+          );
+
+        expZ = static_cast<exponent_type>(static_cast<exponent_type>(expZ - static_cast<exponent_type>(INT16_C(0x3FF))) + bias());
+
+        result = f128_pack(signA, static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(expZ) << static_cast<unsigned>(UINT8_C(48))) | frac.v1), frac.v0);
+      }
+
+      return result;
+    }
+
+    static constexpr auto f128_to_f64(const representation_type& a) noexcept -> std::uint64_t
+    {
+      // Round to soft_double, to nearest with ties to even.
+      const auto signA = f128_sign(a);
+
+      auto result = std::uint64_t { };
+
+      if(f128_is_nan(a))
+      {
+        result = soft_double::my_value_quiet_NaN().crepresentation();
+      }
+      else if(f128_is_inf(a))
+      {
+        result = detail::packToF64UI(signA, static_cast<std::int16_t>(INT16_C(0x7FF)), static_cast<std::uint64_t>(UINT8_C(0)));
+      }
+      else if(f128_is_zero(a))
+      {
+        result = detail::packToF64UI(signA, static_cast<std::int16_t>(INT8_C(0)), static_cast<std::uint64_t>(UINT8_C(0)));
+      }
+      else
+      {
+        auto expA = exponent_type { };
+
+        // Jam the significand down to 64 bits with its leading bit at 62,
+        // leaving ten bits to round below the 53 bits of soft_double.
+        const auto sig128 = detail::soft_quad_shiftRightJam128(f128_unpack(a, expA), static_cast<std::uint32_t>(UINT8_C(50)));
+
+        auto sig  = sig128.v0;
+        auto expZ = static_cast<exponent_type>(static_cast<exponent_type>(expA - bias()) + static_cast<exponent_type>(INT16_C(0x3FF)));
+
+        if(expZ < static_cast<exponent_type>(1))
+        {
+          sig  = detail::softfloat_shiftRightJam64(sig, static_cast<std::uint_fast16_t>((expZ < static_cast<exponent_type>(INT8_C(-63))) ? static_cast<exponent_type>(INT8_C(64)) : static_cast<exponent_type>(static_cast<exponent_type>(1) - expZ)));
+          expZ = static_cast<exponent_type>(1);
+        }
+
+        const auto round_bits = static_cast<std::uint64_t>(sig & static_cast<std::uint64_t>(UINT16_C(0x3FF)));
+
+        sig = static_cast<std::uint64_t>(static_cast<std::uint64_t>(sig + static_cast<std::uint64_t>(UINT16_C(0x200))) >> static_cast<unsigned>(UINT8_C(10)));
+
+        if(round_bits == static_cast<std::uint64_t>(UINT16_C(0x200)))
+        {
+          sig = static_cast<std::uint64_t>(sig & static_cast<std::uint64_t>(~static_cast<std::uint64_t>(UINT8_C(1))));
+        }
+
+        const auto exp_field = static_cast<exponent_type>(static_cast<exponent_type>(expZ - static_cast<exponent_type>(1)) + static_cast<exponent_type>(sig >> static_cast<unsigned>(UINT8_C(52))));
+
+        result =
+          (exp_field >= static_cast<exponent_type>(INT16_C(0x7FF)))
+            ? detail::packToF64UI(signA, static_cast<std::int16_t>(INT16_C(0x7FF)), static_cast<std::uint64_t>(UINT8_C(0)))
+            : detail::packToF64UI(signA, static_cast<std::int16_t>(exp_field), static_cast<std::uint64_t>(sig & static_cast<std::uint64_t>(UINT64_C(0x000FFFFFFFFFFFFF))));
+      }
+
+      return result;
+    }
+
+    static constexpr auto f128_to_ui64_magnitude(const representation_type& a, bool& is_too_large) noexcept -> std::uint64_t
+    {
+      // Returns the magnitude of the finite value a truncated toward zero.
+      auto expA = exponent_type { };
+
+      const auto sigA = f128_unpack(a, expA);
+
+      const auto unbiased_exp = static_cast<exponent_type>(expA - bias());
+
+      is_too_large = (unbiased_exp >= static_cast<exponent_type>(64));
+
+      return
+        ((unbiased_exp < static_cast<exponent_type>(0)) || is_too_large)
+          ? static_cast<std::uint64_t>(UINT8_C(0))
+          : detail::soft_quad_shiftRight128(sigA, static_cast<unsigned>(static_cast<exponent_type>(frac_bits) - unbiased_exp)).v0;
+    }
+
+    static constexpr auto f128_to_ui64(const representation_type& a, const std::uint64_t max_value) noexcept -> std::uint64_t
+    {
+      auto is_too_large = false;
+
+      const auto u =
+        (f128_is_nan(a) || f128_is_zero(a))
+          ? static_cast<std::uint64_t>(UINT8_C(0))
+          : (f128_is_inf(a) ? max_value : f128_to_ui64_magnitude(a, is_too_large));
+
+      return
+        (f128_sign(a) ? static_cast<std::uint64_t>(UINT8_C(0))
+                      : ((is_too_large || (u > max_value)) ? max_value : u));
+    }
+
+    static constexpr auto f128_to_i64(const representation_type& a, const std::int64_t min_value, const std::int64_t max_value) noexcept -> std::int64_t
+    {
+      const auto signA = f128_sign(a);
+
+      auto is_too_large = false;
+
+      const auto u =
+        (f128_is_nan(a) || f128_is_zero(a))
+          ? static_cast<std::uint64_t>(UINT8_C(0))
+          : (f128_is_inf(a) ? static_cast<std::uint64_t>(UINT64_MAX) : f128_to_ui64_magnitude(a, is_too_large));
+
+      const auto limit =
+        static_cast<std::uint64_t>
+        (
+          signA ? detail::negate(static_cast<std::uint64_t>(min_value))
+                : static_cast<std::uint64_t>(max_value)
+        );
+
+      return
+        static_cast<std::int64_t>
+        (
+          (is_too_large || (u > limit))
+            ? (signA ? min_value : max_value)
+            : (signA ? static_cast<std::int64_t>(detail::negate(u)) : static_cast<std::int64_t>(u))
+        );
+    }
+  };
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::softfloat
+  #else
+  } // namespace softfloat
+  } // namespace math
+  #endif
+
+  namespace std {
+
+  // Specialization of numeric_limits for soft_quad.
+  template<>
+  SOFT_DOUBLE_NUM_LIMITS_CLASS_TYPE numeric_limits<::math::softfloat::soft_quad>
+  {
+  public:
+    static constexpr bool               is_specialized    = true;
+    static constexpr float_denorm_style has_denorm        = denorm_present;
+    static constexpr bool               has_denorm_loss   = false;
+    static constexpr bool               has_infinity      = true;
+    static constexpr bool               has_quiet_NaN     = true;
+    static constexpr bool               has_signaling_NaN = false;
+    static constexpr bool               is_bounded        = true;
+    static constexpr bool               is_iec559         = false;
+    static constexpr bool               is_integer        = false;
+    static constexpr bool               is_exact          = false;
+    static constexpr bool               is_signed         = true;
+    static constexpr bool               is_modulo         = false;
+    static constexpr bool               traps             = false;
+    static constexpr bool               tinyness_before   = false;
+    static constexpr float_round_style  round_style       = round_to_nearest;
+    static constexpr int                radix             = static_cast<int>(INT8_C(2));
+
+    static constexpr int                digits            = static_cast<int>(INT16_C(113));
+    static constexpr int                digits10          = static_cast<int>(INT8_C(33));
+    static constexpr int                max_digits10      = static_cast<int>(INT8_C(36));
+    static constexpr int                max_exponent      = static_cast<int>(INT32_C(16384));
+    static constexpr int                max_exponent10    = static_cast<int>(INT16_C(4932));
+    static constexpr int                min_exponent      = static_cast<int>(INT32_C(-16381));
+    static constexpr int                min_exponent10    = static_cast<int>(INT16_C(-4931));
+
+    static constexpr auto (min)        () noexcept -> ::math::softfloat::soft_quad { return ::math::softfloat::soft_quad::my_value_min(); }
+    static constexpr auto (max)        () noexcept -> ::math::softfloat::soft_quad { return ::math::softfloat::soft_quad::my_value_max(); }
+    static constexpr auto lowest       () noexcept -> ::math::softfloat::soft_quad { return ::math::softfloat::soft_quad::my_value_lowest(); }
+    static constexpr auto epsilon      () noexcept -> ::math::softfloat::soft_quad { return ::math::softfloat::soft_quad::my_value_epsilon(); }
+    static constexpr auto round_error  () noexcept -> ::math::softfloat::soft_quad { return ::math::softfloat::soft_quad::my_value_round_error(); }
+    static constexpr auto denorm_min   () noexcept -> ::math::softfloat::soft_quad { return ::math::softfloat::soft_quad::my_value_denorm_min(); }
+    static constexpr auto infinity     () noexcept -> ::math::softfloat::soft_quad { return ::math::softfloat::soft_quad::my_value_infinity(); }
+    static constexpr auto quiet_NaN    () noexcept -> ::math::softfloat::soft_quad { return ::math::softfloat::soft_quad::my_value_quiet_NaN(); }
+    static constexpr auto signaling_NaN() noexcept -> ::math::softfloat::soft_quad { return ::math::softfloat::soft_quad::my_value_quiet_NaN(); }
+  };
+
+  } // namespace std
+
+#endif // SOFT_QUAD_2025_07_12_H
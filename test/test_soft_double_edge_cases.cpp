@@ -5,13 +5,34 @@
 //  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
 ///////////////////////////////////////////////////////////////////
 
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <ctime>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <random>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if (defined(__unix__) || defined(__APPLE__))
+#include <sys/stat.h>
+#endif
 
 #include <math/softfloat/soft_double.h>
+#include <math/softfloat/soft_double_batch.h>
+#include <math/softfloat/soft_double_binary.h>
+#include <math/softfloat/soft_double_double.h>
+#include <math/softfloat/soft_double_rounding.h>
+#include <math/softfloat/soft_double_simd.h>
+#include <math/softfloat/soft_double_text_reader.h>
+#include <math/softfloat/soft_float.h>
+#include <math/softfloat/soft_interval.h>
+#include <math/softfloat/soft_quad.h>
 #include <util/utility/util_pseudorandom_time_point_seed.h>
 
 namespace test_soft_double_edge {
@@ -280,6 +301,2526 @@ auto test_various_64_bit_cast() -> bool
   return result_is_ok;
 }
 
+auto test_various_mul64To128() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify that the selected 64x64->128-bit product backend agrees
+  // with the portable schoolbook product for extreme and random values.
+
+  using ::math::softfloat::detail::softfloat_mul64To128;
+  using ::math::softfloat::detail::softfloat_mul64To128_portable;
+
+  {
+    const auto p_max = softfloat_mul64To128((std::numeric_limits<std::uint64_t>::max)(), (std::numeric_limits<std::uint64_t>::max)());
+
+    const auto result_p_max_is_ok =
+    (
+         (p_max.v0 == static_cast<std::uint64_t>(UINT64_C(0x0000000000000001)))
+      && (p_max.v1 == static_cast<std::uint64_t>(UINT64_C(0xFFFFFFFFFFFFFFFE)))
+    );
+
+    result_is_ok = (result_p_max_is_ok && result_is_ok);
+  }
+
+  {
+    eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+    distribution64_type dist_u64;
+
+    for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+               i < static_cast<std::uint32_t>(UINT32_C(100000));
+             ++i)
+    {
+      const auto a = dist_u64(eng_d15);
+      const auto b = dist_u64(eng_d15);
+
+      const auto p_sel = softfloat_mul64To128         (a, b);
+      const auto p_ref = softfloat_mul64To128_portable(a, b);
+
+      const auto result_mul64To128_is_ok = ((p_sel.v0 == p_ref.v0) && (p_sel.v1 == p_ref.v1));
+
+      result_is_ok = (result_mul64To128_is_ok && result_is_ok);
+    }
+  }
+
+  return result_is_ok;
+}
+
+auto test_various_div_kernel() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify that the selected division kernel rounds correctly
+  // for random significands spanning the full 52-bit fraction,
+  // including quotients that are exact.
+
+  using ::math::softfloat::float64_t;
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  distribution64_type dist_frc(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT64_C(0x000FFFFFFFFFFFFF)));
+  distribution64_type dist_exp(static_cast<std::uint64_t>(UINT16_C(0x3F0)), static_cast<std::uint64_t>(UINT16_C(0x40F)));
+  distribution64_type dist_mul(static_cast<std::uint64_t>(UINT8_C(1)), static_cast<std::uint64_t>(UINT16_C(1023)));
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(100000));
+           ++i)
+  {
+    const auto u_a = static_cast<std::uint64_t>(dist_frc(eng_d15) | static_cast<std::uint64_t>(dist_exp(eng_d15) << static_cast<unsigned>(UINT8_C(52))));
+    const auto u_b = static_cast<std::uint64_t>(dist_frc(eng_d15) | static_cast<std::uint64_t>(dist_exp(eng_d15) << static_cast<unsigned>(UINT8_C(52))));
+
+    const auto d_a = ::math::softfloat::detail::uz_type<double>(u_a).get_f(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    const auto d_b = ::math::softfloat::detail::uz_type<double>(u_b).get_f(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+    const auto d_e = static_cast<double>(d_b * static_cast<double>(dist_mul(eng_d15)));
+
+    const auto x_a = float64_t(u_a, ::math::softfloat::detail::nothing());
+    const auto x_b = float64_t(u_b, ::math::softfloat::detail::nothing());
+    const auto x_e = float64_t(::math::softfloat::detail::uz_type<double>(d_e).get_u(), ::math::softfloat::detail::nothing()); // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+    const auto result_div_is_ok =
+    (
+         ((x_a / x_b).crepresentation() == ::math::softfloat::detail::uz_type<double>(d_a / d_b).get_u()) // NOLINT(cppcoreguidelines-pro-type-union-access)
+      && ((x_e / x_b).crepresentation() == ::math::softfloat::detail::uz_type<double>(d_e / d_b).get_u()) // NOLINT(cppcoreguidelines-pro-type-union-access)
+    );
+
+    result_is_ok = (result_div_is_ok && result_is_ok);
+  }
+
+  #if ((SOFT_DOUBLE_HAS_NATIVE_UINT128 == 1) || (SOFT_DOUBLE_HAS_UMUL128 == 1))
+  {
+    // Verify the 64-bit reciprocal division kernel directly (whether or not
+    // it is selected in f64_div). The jammed quotient q must be odd unless
+    // exact, and the remainder d = (sigA * 2^63) - (q - 1) * sigB must then
+    // satisfy 0 < d < 2 * sigB with d != sigB.
+
+    using ::math::softfloat::detail::softfloat_divSigF64_wide;
+    using ::math::softfloat::detail::softfloat_mul64To128;
+    using ::math::softfloat::detail::softfloat_sub128;
+    using ::math::softfloat::detail::uint128_compound;
+
+    for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+               i < static_cast<std::uint32_t>(UINT32_C(100000));
+             ++i)
+    {
+      const auto sig_a = static_cast<std::uint64_t>(dist_frc(eng_d15) | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)));
+      const auto sig_b = static_cast<std::uint64_t>(dist_frc(eng_d15) | static_cast<std::uint64_t>(UINT64_C(0x0010000000000000)));
+
+      const auto a = static_cast<std::uint64_t>(sig_a << static_cast<unsigned>((sig_a < sig_b) ? UINT8_C(11) : UINT8_C(10)));
+      const auto b = static_cast<std::uint64_t>(sig_b << static_cast<unsigned>(UINT8_C(11)));
+
+      const auto q = softfloat_divSigF64_wide(a, b);
+
+      const auto a_times_two_pow_63 =
+        uint128_compound
+        {
+          static_cast<std::uint64_t>(a << static_cast<unsigned>(UINT8_C(63))),
+          static_cast<std::uint64_t>(a >> static_cast<unsigned>(UINT8_C(1)))
+        };
+
+      const auto p = softfloat_mul64To128(q, b);
+
+      const auto result_is_exact = ((p.v0 == a_times_two_pow_63.v0) && (p.v1 == a_times_two_pow_63.v1));
+
+      auto result_div_wide_is_ok = result_is_exact;
+
+      if((!result_is_exact) && (static_cast<std::uint64_t>(q & static_cast<std::uint64_t>(UINT8_C(1))) != static_cast<std::uint64_t>(UINT8_C(0))))
+      {
+        const auto d = softfloat_sub128(a_times_two_pow_63, softfloat_mul64To128(static_cast<std::uint64_t>(q - static_cast<std::uint64_t>(UINT8_C(1))), b));
+
+        const auto d_hi_limit = static_cast<std::uint64_t>(b >> static_cast<unsigned>(UINT8_C(63)));
+        const auto d_lo_limit = static_cast<std::uint64_t>(b << static_cast<unsigned>(UINT8_C(1)));
+
+        const auto d_is_below_two_b = ((d.v1 < d_hi_limit) || ((d.v1 == d_hi_limit) && (d.v0 < d_lo_limit)));
+        const auto d_is_positive    = ((d.v1 != static_cast<std::uint64_t>(UINT8_C(0))) || (d.v0 != static_cast<std::uint64_t>(UINT8_C(0))));
+        const auto d_is_not_b       = ((d.v1 != static_cast<std::uint64_t>(UINT8_C(0))) || (d.v0 != b));
+
+        result_div_wide_is_ok = (d_is_below_two_b && d_is_positive && d_is_not_b);
+      }
+
+      result_is_ok = (result_div_wide_is_ok && result_is_ok);
+    }
+  }
+  #endif
+
+  return result_is_ok;
+}
+
+auto test_various_clz() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify the selected count-leading-zeros backend against
+  // a simple bit-by-bit count, including the value zero.
+
+  using ::math::softfloat::detail::softfloat_countLeadingZeros32;
+  using ::math::softfloat::detail::softfloat_countLeadingZeros64;
+
+  const auto clz64_ref =
+    [](std::uint64_t u) -> std::uint_fast8_t
+    {
+      auto n = static_cast<std::uint_fast8_t>(UINT8_C(64));
+
+      while(u != static_cast<std::uint64_t>(UINT8_C(0)))
+      {
+        u >>= static_cast<unsigned>(UINT8_C(1));
+
+        --n;
+      }
+
+      return n;
+    };
+
+  result_is_ok = ((softfloat_countLeadingZeros32(static_cast<std::uint32_t>(UINT8_C(0))) == static_cast<std::uint_fast8_t>(UINT8_C(32))) && result_is_ok);
+  result_is_ok = ((softfloat_countLeadingZeros64(static_cast<std::uint64_t>(UINT8_C(0))) == static_cast<std::uint_fast8_t>(UINT8_C(64))) && result_is_ok);
+
+  for(auto   shift = static_cast<unsigned>(UINT8_C(0));
+             shift < static_cast<unsigned>(UINT8_C(64));
+           ++shift)
+  {
+    const auto u = static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << shift);
+
+    result_is_ok = ((softfloat_countLeadingZeros64(u) == static_cast<std::uint_fast8_t>(UINT8_C(63) - shift)) && result_is_ok);
+  }
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  distribution64_type dist_u64;
+  distribution32_type dist_shr(static_cast<std::uint32_t>(UINT8_C(0)), static_cast<std::uint32_t>(UINT8_C(63)));
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(100000));
+           ++i)
+  {
+    const auto u = static_cast<std::uint64_t>(dist_u64(eng_d15) >> static_cast<unsigned>(dist_shr(eng_d15)));
+
+    const auto result_clz64_is_ok = (softfloat_countLeadingZeros64(u) == clz64_ref(u));
+
+    const auto result_clz32_is_ok =
+      (softfloat_countLeadingZeros32(static_cast<std::uint32_t>(u)) == static_cast<std::uint_fast8_t>(clz64_ref(static_cast<std::uint32_t>(u)) - static_cast<std::uint_fast8_t>(UINT8_C(32))));
+
+    result_is_ok = (result_clz64_is_ok && result_clz32_is_ok && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+auto test_various_fma() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify that fma rounds only once by comparing it bit-for-bit
+  // with std::fma, also for sums that cancel (nearly) completely.
+
+  using ::math::softfloat::float64_t;
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  distribution64_type dist_frc(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT64_C(0x000FFFFFFFFFFFFF)));
+  distribution64_type dist_exp(static_cast<std::uint64_t>(UINT16_C(0x3C0)), static_cast<std::uint64_t>(UINT16_C(0x440)));
+  distribution64_type dist_bit(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT8_C(1)));
+
+  const auto make_random_u64 =
+    [&dist_frc, &dist_exp, &dist_bit]() -> std::uint64_t
+    {
+      return
+        static_cast<std::uint64_t>
+        (
+            dist_frc(eng_d15)
+          | static_cast<std::uint64_t>(dist_exp(eng_d15) << static_cast<unsigned>(UINT8_C(52)))
+          | static_cast<std::uint64_t>(dist_bit(eng_d15) << static_cast<unsigned>(UINT8_C(63)))
+        );
+    };
+
+  const auto fma_is_ok =
+    [](double a, double b, double c) -> bool
+    {
+      const auto x_a = float64_t(::math::softfloat::detail::uz_type<double>(a).get_u(), ::math::softfloat::detail::nothing()); // NOLINT(cppcoreguidelines-pro-type-union-access)
+      const auto x_b = float64_t(::math::softfloat::detail::uz_type<double>(b).get_u(), ::math::softfloat::detail::nothing()); // NOLINT(cppcoreguidelines-pro-type-union-access)
+      const auto x_c = float64_t(::math::softfloat::detail::uz_type<double>(c).get_u(), ::math::softfloat::detail::nothing()); // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+      return (fma(x_a, x_b, x_c).crepresentation() == ::math::softfloat::detail::uz_type<double>(std::fma(a, b, c)).get_u()); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    };
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(100000));
+           ++i)
+  {
+    const auto a = ::math::softfloat::detail::uz_type<double>(make_random_u64()).get_f(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    const auto b = ::math::softfloat::detail::uz_type<double>(make_random_u64()).get_f(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    const auto c = ::math::softfloat::detail::uz_type<double>(make_random_u64()).get_f(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+    const auto p = a * b;
+
+    const auto result_fma_is_ok =
+    (
+         fma_is_ok(a, b, c)
+      && fma_is_ok(a, b, -p)
+      && fma_is_ok(a, b, -std::nextafter(p, 0.0))
+      && fma_is_ok(a, b, 0.0)
+      && fma_is_ok(0.0, b, c)
+    );
+
+    result_is_ok = (result_fma_is_ok && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+auto test_various_batch() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify that the batch operations agree bit-for-bit with the scalar
+  // operators, including lanes that fall back to the scalar kernels
+  // (zero, subnormal, infinite and cancelling operands, underflow
+  // and overflow) and a count that is not a multiple of the block size.
+
+  using ::math::softfloat::float64_t;
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  distribution64_type dist_frc(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT64_C(0x000FFFFFFFFFFFFF)));
+  distribution64_type dist_exp(static_cast<std::uint64_t>(UINT8_C(0)),  static_cast<std::uint64_t>(UINT16_C(0x7FF)));
+  distribution64_type dist_mid(static_cast<std::uint64_t>(UINT16_C(0x3C0)), static_cast<std::uint64_t>(UINT16_C(0x440)));
+  distribution64_type dist_sel(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT8_C(7)));
+
+  const auto make_random_u64 =
+    [&dist_frc, &dist_exp, &dist_mid, &dist_sel]() -> std::uint64_t
+    {
+      const auto sel = dist_sel(eng_d15);
+
+      const auto exp = ((sel < static_cast<std::uint64_t>(UINT8_C(2))) ? dist_exp(eng_d15) : dist_mid(eng_d15));
+
+      return
+        static_cast<std::uint64_t>
+        (
+            dist_frc(eng_d15)
+          | static_cast<std::uint64_t>(exp << static_cast<unsigned>(UINT8_C(52)))
+          | static_cast<std::uint64_t>(static_cast<std::uint64_t>(sel & static_cast<std::uint64_t>(UINT8_C(1))) << static_cast<unsigned>(UINT8_C(63)))
+        );
+    };
+
+  const auto count = static_cast<std::size_t>(UINT16_C(1001));
+
+  std::vector<float64_t> a(count);
+  std::vector<float64_t> b(count);
+  std::vector<float64_t> c(count);
+  std::vector<float64_t> r(count);
+
+  for(auto   j = static_cast<std::uint32_t>(UINT8_C(0));
+             j < static_cast<std::uint32_t>(UINT8_C(64));
+           ++j)
+  {
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      a[i] = float64_t(make_random_u64(), ::math::softfloat::detail::nothing());
+      c[i] = float64_t(make_random_u64(), ::math::softfloat::detail::nothing());
+
+      const auto sel = static_cast<std::size_t>(i % static_cast<std::size_t>(UINT8_C(5)));
+
+      // Mix in operands which cancel exactly or (very) nearly.
+      b[i] = ((sel == static_cast<std::size_t>(UINT8_C(0))) ? -a[i]
+           : ((sel == static_cast<std::size_t>(UINT8_C(1))) ? float64_t(static_cast<std::uint64_t>(a[i].crepresentation() ^ static_cast<std::uint64_t>(UINT64_C(0x8000000000000001))), ::math::softfloat::detail::nothing())
+           :                                                 float64_t(make_random_u64(), ::math::softfloat::detail::nothing())));
+    }
+
+    ::math::softfloat::batch::add(a.data(), b.data(), r.data(), count);
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i) { result_is_ok = ((r[i].crepresentation() == (a[i] + b[i]).crepresentation()) && result_is_ok); }
+
+    ::math::softfloat::batch::sub(a.data(), b.data(), r.data(), count);
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i) { result_is_ok = ((r[i].crepresentation() == (a[i] - b[i]).crepresentation()) && result_is_ok); }
+
+    ::math::softfloat::batch::mul(a.data(), b.data(), r.data(), count);
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i) { result_is_ok = ((r[i].crepresentation() == (a[i] * b[i]).crepresentation()) && result_is_ok); }
+
+    ::math::softfloat::batch::mul(a.data(), c.data(), r.data(), count);
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i) { result_is_ok = ((r[i].crepresentation() == (a[i] * c[i]).crepresentation()) && result_is_ok); }
+
+    ::math::softfloat::batch::div(a.data(), c.data(), r.data(), count);
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i) { result_is_ok = ((r[i].crepresentation() == (a[i] / c[i]).crepresentation()) && result_is_ok); }
+
+    ::math::softfloat::batch::fma(a.data(), b.data(), c.data(), r.data(), count);
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i) { result_is_ok = ((r[i].crepresentation() == fma(a[i], b[i], c[i]).crepresentation()) && result_is_ok); }
+
+    ::math::softfloat::batch::sqrt(c.data(), r.data(), count);
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i) { result_is_ok = ((r[i].crepresentation() == sqrt(c[i]).crepresentation()) && result_is_ok); }
+
+    // The result may alias an operand.
+    r = a;
+    ::math::softfloat::batch::add(r.data(), c.data(), r.data(), count);
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i) { result_is_ok = ((r[i].crepresentation() == (a[i] + c[i]).crepresentation()) && result_is_ok); }
+  }
+
+  return result_is_ok;
+}
+
+
+template<typename PackedType>
+auto test_various_packed_lanes() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify that each lane of the packed arithmetic and comparisons
+  // agrees bit-for-bit with the scalar soft_double operations.
+
+  using ::math::softfloat::float64_t;
+
+  using packed_type = PackedType;
+
+  constexpr auto lane_count = packed_type::lane_count();
+
+  distribution64_type dist_frc(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT64_C(0x000FFFFFFFFFFFFF)));
+  distribution64_type dist_exp(static_cast<std::uint64_t>(UINT8_C(0)),  static_cast<std::uint64_t>(UINT16_C(0x7FF)));
+  distribution64_type dist_mid(static_cast<std::uint64_t>(UINT16_C(0x3F0)), static_cast<std::uint64_t>(UINT16_C(0x410)));
+  distribution64_type dist_sel(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT8_C(15)));
+
+  const auto make_random_u64 =
+    [&dist_frc, &dist_exp, &dist_mid, &dist_sel]() -> std::uint64_t
+    {
+      const auto sel = dist_sel(eng_d15);
+
+      // Mostly values of moderate size, and some with small fractions
+      // (so that comparisons of equal values arise), zeros, subnormals,
+      // infinities and values of arbitrary magnitude.
+      const auto exp = ((sel < static_cast<std::uint64_t>(UINT8_C(3))) ? dist_exp(eng_d15) : dist_mid(eng_d15));
+      const auto frc = ((sel == static_cast<std::uint64_t>(UINT8_C(4))) ? static_cast<std::uint64_t>(dist_frc(eng_d15) & static_cast<std::uint64_t>(UINT8_C(3))) : dist_frc(eng_d15));
+
+      return
+        static_cast<std::uint64_t>
+        (
+            ((sel == static_cast<std::uint64_t>(UINT8_C(5))) ? static_cast<std::uint64_t>(UINT8_C(0)) : frc)
+          | static_cast<std::uint64_t>(((sel == static_cast<std::uint64_t>(UINT8_C(5))) ? static_cast<std::uint64_t>(UINT8_C(0)) : exp) << static_cast<unsigned>(UINT8_C(52)))
+          | static_cast<std::uint64_t>(static_cast<std::uint64_t>(sel & static_cast<std::uint64_t>(UINT8_C(1))) << static_cast<unsigned>(UINT8_C(63)))
+        );
+    };
+
+  std::array<float64_t, lane_count> a { };
+  std::array<float64_t, lane_count> b { };
+
+  for(auto   j = static_cast<std::uint32_t>(UINT8_C(0));
+             j < static_cast<std::uint32_t>(UINT32_C(20000));
+           ++j)
+  {
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < lane_count; ++i)
+    {
+      a[i] = float64_t(make_random_u64(), ::math::softfloat::detail::nothing());
+      b[i] = ((dist_sel(eng_d15) == static_cast<std::uint64_t>(UINT8_C(0))) ? a[i] : float64_t(make_random_u64(), ::math::softfloat::detail::nothing()));
+    }
+
+    const auto x_a = packed_type::load(a.data());
+    const auto x_b = packed_type::load(b.data());
+
+    const auto x_add = x_a + x_b;
+    const auto x_sub = x_a - x_b;
+    const auto x_mul = x_a * x_b;
+    const auto x_div = x_a / x_b;
+    const auto x_sqr = sqrt(x_a);
+    const auto x_neg = -x_a;
+
+    const auto m_lt = (x_a <  x_b);
+    const auto m_le = (x_a <= x_b);
+    const auto m_gt = (x_a >  x_b);
+    const auto m_ge = (x_a >= x_b);
+    const auto m_eq = (x_a == x_b);
+    const auto m_ne = (x_a != x_b);
+
+    const auto x_max = select(m_gt, x_a, x_b);
+
+    const auto mask_is = [](std::uint64_t m, bool expected) { return (m == static_cast<std::uint64_t>(expected ? UINT64_C(0xFFFFFFFFFFFFFFFF) : UINT64_C(0))); };
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < lane_count; ++i)
+    {
+      const auto result_lane_is_ok =
+      (
+           (x_add[i].crepresentation() == (a[i] + b[i]).crepresentation())
+        && (x_sub[i].crepresentation() == (a[i] - b[i]).crepresentation())
+        && (x_mul[i].crepresentation() == (a[i] * b[i]).crepresentation())
+        && (x_div[i].crepresentation() == (a[i] / b[i]).crepresentation())
+        && (x_sqr[i].crepresentation() == sqrt(a[i]).crepresentation())
+        && (x_neg[i].crepresentation() == (-a[i]).crepresentation())
+        && mask_is(m_lt[i], (a[i] <  b[i]))
+        && mask_is(m_le[i], (a[i] <= b[i]))
+        && mask_is(m_gt[i], (a[i] >  b[i]))
+        && mask_is(m_ge[i], (a[i] >= b[i]))
+        && mask_is(m_eq[i], (a[i] == b[i]))
+        && mask_is(m_ne[i], (a[i] != b[i]))
+        && (x_max[i].crepresentation() == ((a[i] > b[i]) ? a[i] : b[i]).crepresentation())
+      );
+
+      result_is_ok = (result_lane_is_ok && result_is_ok);
+    }
+  }
+
+  return result_is_ok;
+}
+
+auto test_various_packed() -> bool
+{
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  const auto result_x4_is_ok = test_various_packed_lanes<::math::softfloat::soft_double_x4>();
+  const auto result_x8_is_ok = test_various_packed_lanes<::math::softfloat::soft_double_x8>();
+
+  return (result_x4_is_ok && result_x8_is_ok);
+}
+
+auto test_various_exp() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify the selected exponential function against the built-in one.
+  // The table-driven kernel rounds only once. It is checked to within
+  // one unit in the last place over the whole range, including results
+  // that are subnormal. The Pade approximation is checked with a relative
+  // tolerance for moderate arguments.
+
+  using ::math::softfloat::float64_t;
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  #if (SOFT_DOUBLE_HAS_TABLE_EXP == 1)
+  std::uniform_real_distribution<double> dist_x(-745.0, 709.7); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  #else
+  std::uniform_real_distribution<double> dist_x(-20.0, 20.0); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  #endif
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(100000));
+           ++i)
+  {
+    const auto d_x = dist_x(eng_d15);
+
+    const auto e_x = exp(float64_t(d_x));
+    const auto e_d = std::exp(d_x);
+
+    #if (SOFT_DOUBLE_HAS_TABLE_EXP == 1)
+    const auto u_x = e_x.crepresentation();
+    const auto u_d = ::math::softfloat::detail::uz_type<double>(e_d).get_u(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+    const auto ulps = static_cast<std::uint64_t>((u_x > u_d) ? (u_x - u_d) : (u_d - u_x));
+
+    result_is_ok = ((ulps <= static_cast<std::uint64_t>(UINT8_C(1))) && result_is_ok);
+    #else
+    const auto closeness = std::fabs(1.0 - std::fabs(static_cast<double>(e_x) / e_d));
+
+    result_is_ok = ((closeness < std::numeric_limits<double>::epsilon() * 40.0) && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    #endif
+  }
+
+  #if (SOFT_DOUBLE_HAS_TABLE_EXP == 1)
+  {
+    constexpr auto e_one = exp(float64_t::my_value_one());
+
+    static_assert(e_one.crepresentation() == static_cast<std::uint64_t>(UINT64_C(0x4005BF0A8B145769)), "Error: Table-driven exponential is not correct");
+
+    const auto inf = std::numeric_limits<float64_t>::infinity();
+
+    result_is_ok = ((exp(float64_t::my_value_zero()) == float64_t::my_value_one()) && result_is_ok);
+    result_is_ok = ((exp( inf) == inf)                                           && result_is_ok);
+    result_is_ok = ((exp(-inf) == float64_t::my_value_zero())                    && result_is_ok);
+    result_is_ok = ((exp(float64_t( 710)) == inf)                                && result_is_ok);
+    result_is_ok = ((exp(float64_t(-746)) == float64_t::my_value_zero())         && result_is_ok);
+    result_is_ok = ((::math::softfloat::isnan)(exp(std::numeric_limits<float64_t>::quiet_NaN())) && result_is_ok);
+  }
+  #endif
+
+  return result_is_ok;
+}
+
+auto test_various_log() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify the selected logarithm function against the built-in one.
+  // The table-driven kernel is checked to within one unit in the last
+  // place for arguments spread over the whole range and close to 1.
+  // The rational approximation is checked with a relative tolerance
+  // for arguments away from 1.
+
+  using ::math::softfloat::float64_t;
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  #if (SOFT_DOUBLE_HAS_TABLE_LOG == 1)
+  std::uniform_real_distribution<double> dist_u(-708.0, 709.0); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  std::uniform_real_distribution<double> dist_v(-0.0625, 0.0625); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  #else
+  std::uniform_real_distribution<double> dist_u(-19.0, 19.0); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  #endif
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(100000));
+           ++i)
+  {
+    const auto d_u = dist_u(eng_d15);
+
+    #if (SOFT_DOUBLE_HAS_TABLE_LOG == 1)
+    const auto d_x = (((i % 2U) == 0U) ? std::exp(d_u) : 1.0 + dist_v(eng_d15));
+    #else
+    const auto d_x = std::exp((d_u < 0.0) ? (d_u - 1.0) : (d_u + 1.0));
+    #endif
+
+    const auto l_x = log(float64_t(d_x));
+    const auto l_d = std::log(d_x);
+
+    #if (SOFT_DOUBLE_HAS_TABLE_LOG == 1)
+    const auto u_x = l_x.crepresentation();
+    const auto u_d = ::math::softfloat::detail::uz_type<double>(l_d).get_u(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+    const auto ulps = static_cast<std::uint64_t>((u_x > u_d) ? (u_x - u_d) : (u_d - u_x));
+
+    result_is_ok = ((ulps <= static_cast<std::uint64_t>(UINT8_C(1))) && result_is_ok);
+    #else
+    const auto closeness = std::fabs(1.0 - std::fabs(static_cast<double>(l_x) / l_d));
+
+    result_is_ok = ((closeness < std::numeric_limits<double>::epsilon() * 40.0) && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    #endif
+  }
+
+  #if (SOFT_DOUBLE_HAS_TABLE_LOG == 1)
+  {
+    constexpr auto l_one = log(float64_t::my_value_one());
+    constexpr auto l_two = log(float64_t(2));
+
+    static_assert(l_one.crepresentation() == static_cast<std::uint64_t>(UINT8_C(0)), "Error: Table-driven logarithm is not correct");
+    static_assert(l_two == float64_t::my_value_ln2(), "Error: Table-driven logarithm is not correct");
+
+    const auto inf = std::numeric_limits<float64_t>::infinity();
+
+    result_is_ok = ((log(float64_t::my_value_zero()) == -inf)                                         && result_is_ok);
+    result_is_ok = ((log(inf) == inf)                                                                  && result_is_ok);
+    result_is_ok = ((::math::softfloat::isnan)(log(-inf))                                             && result_is_ok);
+    result_is_ok = ((::math::softfloat::isnan)(log(float64_t(-1)))                                    && result_is_ok);
+    result_is_ok = ((::math::softfloat::isnan)(log(std::numeric_limits<float64_t>::quiet_NaN()))      && result_is_ok);
+    result_is_ok = ((log(std::numeric_limits<float64_t>::denorm_min()) < float64_t(-744))             && result_is_ok);
+  }
+  #endif
+
+  return result_is_ok;
+}
+
+auto test_various_trig() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify sin and cos against the built-in functions to within one unit
+  // in the last place, and sincos and tan along with them. The arguments
+  // range from tiny up to huge values, which need Payne-Hanek reduction.
+
+  using ::math::softfloat::float64_t;
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  std::uniform_real_distribution<double> dist_m(1.0, 2.0);
+  std::uniform_int_distribution<int>     dist_e(-40, 1022); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(100000));
+           ++i)
+  {
+    // Use moderate arguments for half of the trials.
+    const auto e_x = (((i % 2U) == 0U) ? dist_e(eng_d15) : (dist_e(eng_d15) % 32)); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    const auto d_x = (((i % 4U) < 2U) ? 1.0 : -1.0) * std::ldexp(dist_m(eng_d15), e_x);
+
+    const auto u_s = sin(float64_t(d_x)).crepresentation();
+    const auto u_c = cos(float64_t(d_x)).crepresentation();
+
+    const auto u_s_ref = ::math::softfloat::detail::uz_type<double>(std::sin(d_x)).get_u(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    const auto u_c_ref = ::math::softfloat::detail::uz_type<double>(std::cos(d_x)).get_u(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+    const auto ulps_s = static_cast<std::uint64_t>((u_s > u_s_ref) ? (u_s - u_s_ref) : (u_s_ref - u_s));
+    const auto ulps_c = static_cast<std::uint64_t>((u_c > u_c_ref) ? (u_c - u_c_ref) : (u_c_ref - u_c));
+
+    result_is_ok = ((ulps_s <= static_cast<std::uint64_t>(UINT8_C(1))) && result_is_ok);
+    result_is_ok = ((ulps_c <= static_cast<std::uint64_t>(UINT8_C(1))) && result_is_ok);
+
+    // The combined sincos must agree exactly with sin and cos,
+    // and tan (built on the same reduction) is also within one unit.
+    auto s_x = float64_t { };
+    auto c_x = float64_t { };
+
+    sincos(float64_t(d_x), &s_x, &c_x);
+
+    result_is_ok = ((s_x.crepresentation() == u_s) && (c_x.crepresentation() == u_c) && result_is_ok);
+
+    const auto u_t     = tan(float64_t(d_x)).crepresentation();
+    const auto u_t_ref = ::math::softfloat::detail::uz_type<double>(std::tan(d_x)).get_u(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+    const auto ulps_t = static_cast<std::uint64_t>((u_t > u_t_ref) ? (u_t - u_t_ref) : (u_t_ref - u_t));
+
+    result_is_ok = ((ulps_t <= static_cast<std::uint64_t>(UINT8_C(1))) && result_is_ok);
+  }
+
+  {
+    constexpr auto s_zero = sin(float64_t::my_value_zero());
+    constexpr auto c_zero = cos(float64_t::my_value_zero());
+    constexpr auto s_pi_2 = sin(float64_t::my_value_pi_half());
+
+    static_assert(s_zero.crepresentation() == static_cast<std::uint64_t>(UINT8_C(0)), "Error: Sine is not correct");
+    static_assert(c_zero == float64_t::my_value_one(), "Error: Cosine is not correct");
+    static_assert(s_pi_2 == float64_t::my_value_one(), "Error: Sine is not correct");
+
+    // A notoriously hard case for argument reduction, and sin(-x) = -sin(x).
+    const auto x_hard = float64_t(6.381956970095103E293); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    result_is_ok = ((sin(x_hard) == float64_t(std::sin(6.381956970095103E293)))                     && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    result_is_ok = ((sin(-x_hard) == -sin(x_hard))                                                 && result_is_ok);
+    result_is_ok = ((cos(-x_hard) ==  cos(x_hard))                                                 && result_is_ok);
+
+    const auto inf = std::numeric_limits<float64_t>::infinity();
+
+    result_is_ok = ((::math::softfloat::isnan)(sin(inf))                                           && result_is_ok);
+    result_is_ok = ((::math::softfloat::isnan)(cos(-inf))                                          && result_is_ok);
+    result_is_ok = ((::math::softfloat::isnan)(sin(std::numeric_limits<float64_t>::quiet_NaN()))   && result_is_ok);
+    result_is_ok = ((::math::softfloat::isnan)(tan(inf))                                           && result_is_ok);
+    result_is_ok = ((sin(std::numeric_limits<float64_t>::denorm_min()) == std::numeric_limits<float64_t>::denorm_min()) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+auto test_various_pow() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify the special cases of pow, together with random arguments
+  // checked against the built-in function to within one unit in the last
+  // place. The fixed-point core of pow does not depend on the kernels
+  // selected for exp and log.
+
+  using ::math::softfloat::float64_t;
+
+  const auto inf  = std::numeric_limits<float64_t>::infinity();
+  const auto qnan = std::numeric_limits<float64_t>::quiet_NaN();
+
+  const auto one  = float64_t::my_value_one();
+  const auto zero = float64_t::my_value_zero();
+
+  result_is_ok = ((pow(qnan, zero) == one)                                                  && result_is_ok);
+  result_is_ok = ((pow(one, qnan) == one)                                                   && result_is_ok);
+  result_is_ok = ((::math::softfloat::isnan)(pow(qnan, one))                                && result_is_ok);
+  result_is_ok = ((::math::softfloat::isnan)(pow(float64_t(-8), float64_t(0.5)))            && result_is_ok);
+  result_is_ok = ((pow(float64_t(-1), inf) == one)                                          && result_is_ok);
+  result_is_ok = ((pow(float64_t(0.5), inf) == zero)                                        && result_is_ok);
+  result_is_ok = ((pow(float64_t(0.5), -inf) == inf)                                        && result_is_ok);
+  result_is_ok = ((pow(float64_t(2), -inf) == zero)                                         && result_is_ok);
+  result_is_ok = ((pow(zero, float64_t(-1)) == inf)                                         && result_is_ok);
+  result_is_ok = ((pow(-zero, float64_t(-3)) == -inf)                                       && result_is_ok);
+  result_is_ok = ((pow(-zero, float64_t(3)).crepresentation() == (-zero).crepresentation()) && result_is_ok);
+  result_is_ok = ((pow(-zero, float64_t(2)).crepresentation() == zero.crepresentation())    && result_is_ok);
+  result_is_ok = ((pow(-inf, float64_t(3)) == -inf)                                         && result_is_ok);
+  result_is_ok = ((pow(-inf, float64_t(-3)).crepresentation() == (-zero).crepresentation()) && result_is_ok);
+  result_is_ok = ((pow(-inf, float64_t(2)) == inf)                                          && result_is_ok);
+  result_is_ok = ((pow(float64_t(-1), float64_t(1.0E300)) == one)                           && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((pow(float64_t(-1), float64_t(3)) == -one)                                && result_is_ok);
+  result_is_ok = ((pow(float64_t(-2), float64_t(3)) == float64_t(-8))                       && result_is_ok);
+  result_is_ok = ((pow(float64_t(-2), float64_t(-3)) == float64_t(-0.125))                  && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((pow(float64_t(2), float64_t(10)) == float64_t(1024))                     && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((pow(float64_t(10), float64_t(22)) == float64_t(1.0E22))                  && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+  result_is_ok = ((pow(float64_t(2), float64_t(1024)) == inf)                               && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((pow(float64_t(2), float64_t(-1074)) == std::numeric_limits<float64_t>::denorm_min()) && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((pow(float64_t(2), float64_t(-1076)) == zero)                             && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  std::uniform_real_distribution<double> dist_u(-700.0, 700.0); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  std::uniform_real_distribution<double> dist_v(-1.0, 1.0);
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(100000));
+           ++i)
+  {
+    // Choose x over the whole range and y such that x^y stays finite.
+    // Every eighth trial uses a negative x with an integer y.
+    const auto d_x0 = std::exp(dist_u(eng_d15));
+    const auto d_y0 = (dist_v(eng_d15) * 700.0) / std::fabs(std::log(d_x0)); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    const auto neg = ((i % 8U) == 0U);
+
+    const auto d_x = (neg ? -d_x0 : d_x0);
+    const auto d_y = (neg ? std::round(d_y0) : d_y0);
+
+    const auto u_p     = pow(float64_t(d_x), float64_t(d_y)).crepresentation();
+    const auto u_p_ref = ::math::softfloat::detail::uz_type<double>(std::pow(d_x, d_y)).get_u(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+    const auto ulps = static_cast<std::uint64_t>((u_p > u_p_ref) ? (u_p - u_p_ref) : (u_p_ref - u_p));
+
+    result_is_ok = ((ulps <= static_cast<std::uint64_t>(UINT8_C(1))) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+auto test_various_expm1_log1p() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify expm1, log1p and the hyperbolic functions rebuilt on them.
+  // The fixed-point series for small |x|, the arguments just beyond
+  // them and the whole range are checked.
+
+  using ::math::softfloat::float64_t;
+
+  const auto inf  = std::numeric_limits<float64_t>::infinity();
+  const auto qnan = std::numeric_limits<float64_t>::quiet_NaN();
+
+  const auto one  = float64_t::my_value_one();
+  const auto zero = float64_t::my_value_zero();
+
+  result_is_ok = ((expm1(-zero).crepresentation() == (-zero).crepresentation()) && result_is_ok);
+  result_is_ok = ((log1p(-zero).crepresentation() == (-zero).crepresentation()) && result_is_ok);
+  result_is_ok = ((sinh (-zero).crepresentation() == (-zero).crepresentation()) && result_is_ok);
+  result_is_ok = ((tanh (-zero).crepresentation() == (-zero).crepresentation()) && result_is_ok);
+  result_is_ok = ((cosh (-zero) == one)                                         && result_is_ok);
+  result_is_ok = ((expm1(inf) == inf)                                           && result_is_ok);
+  result_is_ok = ((expm1(-inf) == -one)                                         && result_is_ok);
+  result_is_ok = ((expm1(float64_t(-50)) == -one)                               && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((expm1(float64_t(710)) == inf)                                && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((log1p(-one) == -inf)                                         && result_is_ok);
+  result_is_ok = ((log1p(inf) == inf)                                           && result_is_ok);
+  result_is_ok = ((::math::softfloat::isnan)(log1p(float64_t(-2)))              && result_is_ok);
+  result_is_ok = ((::math::softfloat::isnan)(log1p(-inf))                       && result_is_ok);
+  result_is_ok = ((::math::softfloat::isnan)(expm1(qnan))                       && result_is_ok);
+  result_is_ok = ((::math::softfloat::isnan)(sinh(qnan))                        && result_is_ok);
+  result_is_ok = ((::math::softfloat::isnan)(cosh(qnan))                        && result_is_ok);
+  result_is_ok = ((::math::softfloat::isnan)(tanh(qnan))                        && result_is_ok);
+
+  {
+    // A NaN with a clear sign bit is also propagated by the hyperbolic functions.
+    const auto pos_nan = float64_t { static_cast<std::uint64_t>(UINT64_C(0x7FF8000000000000)), ::math::softfloat::detail::nothing() };
+
+    result_is_ok = ((sinh(pos_nan).crepresentation() == pos_nan.crepresentation()) && result_is_ok);
+    result_is_ok = ((cosh(pos_nan).crepresentation() == pos_nan.crepresentation()) && result_is_ok);
+    result_is_ok = ((tanh(pos_nan).crepresentation() == pos_nan.crepresentation()) && result_is_ok);
+  }
+
+  result_is_ok = ((sinh(-inf) == -inf)                                          && result_is_ok);
+  result_is_ok = ((cosh(-inf) == inf)                                           && result_is_ok);
+  result_is_ok = ((sinh(float64_t(711)) == inf)                                 && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((tanh(inf) == one)                                            && result_is_ok);
+  result_is_ok = ((tanh(-inf) == -one)                                          && result_is_ok);
+  result_is_ok = ((expm1(float64_t(1.0E-300)) == float64_t(1.0E-300))           && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((log1p(float64_t(1.0E-300)) == float64_t(1.0E-300))           && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  std::uniform_real_distribution<double> dist_small(-1.0, 1.0);
+  std::uniform_real_distribution<double> dist_exp2 (-60.0, 0.0); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+  const auto ulps_of =
+    [](float64_t x, double d_ref) -> std::uint64_t
+    {
+      const auto u_x   = x.crepresentation();
+      const auto u_ref = ::math::softfloat::detail::uz_type<double>(d_ref).get_u(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+      return static_cast<std::uint64_t>((u_x > u_ref) ? (u_x - u_ref) : (u_ref - u_x));
+    };
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(100000));
+           ++i)
+  {
+    // Choose |x| < 1 with a widely spread exponent, and a smaller
+    // argument for log1p to exercise its series.
+    const auto d_x = dist_small(eng_d15) * std::exp2(dist_exp2(eng_d15) / 4.0); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    const auto d_y = d_x / 32.0; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    const auto x = float64_t(d_x);
+    const auto y = float64_t(d_y);
+
+    result_is_ok = ((ulps_of(expm1(x), std::expm1(d_x)) <= static_cast<std::uint64_t>(UINT8_C(1))) && result_is_ok);
+    result_is_ok = ((ulps_of(log1p(y), std::log1p(d_y)) <= static_cast<std::uint64_t>(UINT8_C(1))) && result_is_ok);
+    result_is_ok = ((ulps_of(sinh (x), std::sinh (d_x)) <= static_cast<std::uint64_t>(UINT8_C(2))) && result_is_ok);
+    result_is_ok = ((ulps_of(tanh (y), std::tanh (d_y)) <= static_cast<std::uint64_t>(UINT8_C(3))) && result_is_ok);
+  }
+
+  {
+    // Arguments just above the limits of the series, |x| = 2^-5 for log1p
+    // and |x| = 1 for expm1, where the fixed-point log and exp take over.
+    const std::uint64_t u_limits[static_cast<std::size_t>(UINT8_C(2))] =
+    {
+      static_cast<std::uint64_t>(UINT64_C(0x3FA0000000000000)),
+      static_cast<std::uint64_t>(UINT64_C(0x3FF0000000000000))
+    };
+
+    for(const auto u_limit : u_limits)
+    {
+      for(auto   n = static_cast<std::uint64_t>(UINT8_C(0));
+                 n < static_cast<std::uint64_t>(UINT8_C(64));
+               ++n)
+      {
+        // Step away from the limit first ulp by ulp, then further out.
+        const auto u_pos = static_cast<std::uint64_t>(u_limit + ((n < 32U) ? n : (n * n * n * UINT64_C(0x10000000))));
+        const auto u_neg = static_cast<std::uint64_t>(u_pos | static_cast<std::uint64_t>(UINT64_C(0x8000000000000000)));
+
+        for(const auto u : { u_pos, u_neg })
+        {
+          const auto x   = float64_t { u, ::math::softfloat::detail::nothing() };
+          const auto d_x = static_cast<double>(x);
+
+          result_is_ok = ((ulps_of(expm1(x), std::expm1(d_x)) <= static_cast<std::uint64_t>(UINT8_C(1))) && result_is_ok);
+          result_is_ok = (((d_x <= -1.0) || (ulps_of(log1p(x), std::log1p(d_x)) <= static_cast<std::uint64_t>(UINT8_C(1)))) && result_is_ok);
+          result_is_ok = ((ulps_of(sinh (x), std::sinh (d_x)) <= static_cast<std::uint64_t>(UINT8_C(2))) && result_is_ok);
+          result_is_ok = ((ulps_of(cosh (x), std::cosh (d_x)) <= static_cast<std::uint64_t>(UINT8_C(2))) && result_is_ok);
+          result_is_ok = ((ulps_of(tanh (x), std::tanh (d_x)) <= static_cast<std::uint64_t>(UINT8_C(3))) && result_is_ok);
+        }
+      }
+    }
+  }
+
+  std::uniform_real_distribution<double> dist_wide(-700.0, 700.0); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(100000));
+           ++i)
+  {
+    const auto d_x = ((i % 2U) == 0U) ? dist_wide(eng_d15) : (dist_wide(eng_d15) / 32.0); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    const auto d_y = std::fabs(d_x) - 0.5; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    const auto x = float64_t(d_x);
+    const auto y = float64_t(d_y);
+
+    result_is_ok = ((ulps_of(expm1(x), std::expm1(d_x)) <= static_cast<std::uint64_t>(UINT8_C(1))) && result_is_ok);
+    result_is_ok = ((ulps_of(log1p(y), std::log1p(d_y)) <= static_cast<std::uint64_t>(UINT8_C(1))) && result_is_ok);
+    result_is_ok = ((ulps_of(sinh (x), std::sinh (d_x)) <= static_cast<std::uint64_t>(UINT8_C(2))) && result_is_ok);
+    result_is_ok = ((ulps_of(cosh (x), std::cosh (d_x)) <= static_cast<std::uint64_t>(UINT8_C(2))) && result_is_ok);
+    result_is_ok = ((ulps_of(tanh (x), std::tanh (d_x)) <= static_cast<std::uint64_t>(UINT8_C(3))) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+auto test_various_atan2_cbrt() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify atan2, hypot and cbrt, together with exp2, log2 and log10.
+  // The references are computed in long double. The base-2 and base-10
+  // functions are checked at special and exact points and over their
+  // whole range, independent of the kernels selected for exp and log.
+
+  using ::math::softfloat::float64_t;
+
+  const auto inf  = std::numeric_limits<float64_t>::infinity();
+  const auto qnan = std::numeric_limits<float64_t>::quiet_NaN();
+
+  const auto one  = float64_t::my_value_one();
+  const auto zero = float64_t::my_value_zero();
+  const auto pi   = float64_t::my_value_pi();
+
+  result_is_ok = ((atan2( zero,  zero).crepresentation() == zero.crepresentation())    && result_is_ok);
+  result_is_ok = ((atan2(-zero,  zero).crepresentation() == (-zero).crepresentation()) && result_is_ok);
+  result_is_ok = ((atan2( zero, -zero) ==  pi)                                         && result_is_ok);
+  result_is_ok = ((atan2(-zero, -one)  == -pi)                                         && result_is_ok);
+  result_is_ok = ((atan2( one,   zero) ==  float64_t::my_value_pi_half())              && result_is_ok);
+  result_is_ok = ((atan2( one,  -inf)  ==  pi)                                         && result_is_ok);
+  result_is_ok = ((atan2(-one,   inf).crepresentation() == (-zero).crepresentation())  && result_is_ok);
+  result_is_ok = ((::math::softfloat::isnan)(atan2(qnan, one))                         && result_is_ok);
+  result_is_ok = ((::math::softfloat::isnan)(atan2(one, qnan))                         && result_is_ok);
+  result_is_ok = ((hypot(qnan, -inf) == inf)                                           && result_is_ok);
+  result_is_ok = ((hypot(float64_t(3), float64_t(-4)) == float64_t(5))                 && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((hypot(float64_t(1.0E300), float64_t(1.0E300)) < inf)                && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((hypot(float64_t(1.5E308), float64_t(1.5E308)) == inf)               && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((::math::softfloat::isnan)(hypot(qnan, one))                         && result_is_ok);
+  result_is_ok = ((cbrt(-zero).crepresentation() == (-zero).crepresentation())         && result_is_ok);
+  result_is_ok = ((cbrt(float64_t(-27)) == float64_t(-3))                              && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((cbrt(-inf) == -inf)                                                 && result_is_ok);
+  result_is_ok = ((::math::softfloat::isnan)(cbrt(qnan))                               && result_is_ok);
+
+  result_is_ok = ((exp2(float64_t(10)) == float64_t(1024))                             && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((exp2(float64_t(-1074)).crepresentation() == static_cast<std::uint64_t>(UINT8_C(1))) && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((exp2(float64_t(1024)) == inf)                                       && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((exp2(-inf) == zero)                                                 && result_is_ok);
+  result_is_ok = ((log2(float64_t(1024)) == float64_t(10))                             && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((log2(one) == zero)                                                  && result_is_ok);
+  result_is_ok = ((log2(-zero) == -inf)                                                && result_is_ok);
+  result_is_ok = ((log10(zero) == -inf)                                                && result_is_ok);
+  result_is_ok = ((log10(inf) == inf)                                                  && result_is_ok);
+  result_is_ok = ((::math::softfloat::isnan)(log2 (-one))                              && result_is_ok);
+  result_is_ok = ((::math::softfloat::isnan)(log10(-one))                              && result_is_ok);
+  result_is_ok = ((::math::softfloat::isnan)(exp2 (qnan))                              && result_is_ok);
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  std::uniform_real_distribution<double> dist_mant(-1.0, 1.0);
+  std::uniform_real_distribution<double> dist_expo(-40.0, 40.0); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+  const auto ulps_of =
+    [](float64_t x, long double ld_ref) -> std::uint64_t
+    {
+      const auto u_x   = x.crepresentation();
+      const auto u_ref = ::math::softfloat::detail::uz_type<double>(static_cast<double>(ld_ref)).get_u(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+      return static_cast<std::uint64_t>((u_x > u_ref) ? (u_x - u_ref) : (u_ref - u_x));
+    };
+
+  // Allow one more ulp when long double offers no extra precision.
+  const auto tol =
+    static_cast<std::uint64_t>
+    (
+      (std::numeric_limits<long double>::digits > std::numeric_limits<double>::digits)
+        ? static_cast<std::uint64_t>(UINT8_C(1))
+        : static_cast<std::uint64_t>(UINT8_C(2))
+    );
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(100000));
+           ++i)
+  {
+    const auto d_x = dist_mant(eng_d15) * std::exp2(dist_expo(eng_d15));
+    const auto d_y = dist_mant(eng_d15) * std::exp2(dist_expo(eng_d15));
+
+    const auto x = float64_t(d_x);
+    const auto y = float64_t(d_y);
+
+    const auto ld_x = static_cast<long double>(d_x);
+    const auto ld_y = static_cast<long double>(d_y);
+
+    result_is_ok = ((ulps_of(atan2(y, x), std::atan2(ld_y, ld_x)) <= tol) && result_is_ok);
+    result_is_ok = ((ulps_of(hypot(x, y), std::hypot(ld_x, ld_y)) <= tol) && result_is_ok);
+    result_is_ok = ((ulps_of(cbrt (x),    std::cbrt (ld_x))       <= tol) && result_is_ok);
+
+    const auto d_e = d_x * 16.0; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    const auto d_a = std::fabs(d_x);
+
+    result_is_ok = ((ulps_of(exp2 (float64_t(d_e)), std::exp2 (static_cast<long double>(d_e))) <= tol) && result_is_ok);
+    result_is_ok = ((ulps_of(log2 (float64_t(d_a)), std::log2 (static_cast<long double>(d_a))) <= tol) && result_is_ok);
+    result_is_ok = ((ulps_of(log10(float64_t(d_a)), std::log10(static_cast<long double>(d_a))) <= tol) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+auto test_various_round_to_int() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify the bit-level rounding functions against the built-in double
+  // functions bit for bit, including signed zeros, ties, huge arguments
+  // and non-finite values.
+
+  using ::math::softfloat::float64_t;
+
+  const auto bits_of =
+    [](double d) -> std::uint64_t
+    {
+      return ::math::softfloat::detail::uz_type<double>(d).get_u(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    };
+
+  const auto check_one =
+    [&bits_of](double d) -> bool
+    {
+      const auto x = float64_t { bits_of(d), ::math::softfloat::detail::nothing() };
+
+      auto i_x = float64_t { };
+      auto i_d = double    { };
+
+      const auto f_x = modf(x, &i_x);
+      const auto f_d = std::modf(d, &i_d);
+
+      const auto result_round_is_ok =
+      (
+           (floor    (x).crepresentation() == bits_of(std::floor    (d)))
+        && (ceil     (x).crepresentation() == bits_of(std::ceil     (d)))
+        && (trunc    (x).crepresentation() == bits_of(std::trunc    (d)))
+        && (round    (x).crepresentation() == bits_of(std::round    (d)))
+        && (nearbyint(x).crepresentation() == bits_of(std::nearbyint(d)))
+        && (f_x.crepresentation()          == bits_of(f_d))
+        && (i_x.crepresentation()          == bits_of(i_d))
+        && ((std::fabs(d) > 1.0E9) || (lround(x) == std::lround(d))) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      );
+
+      return result_round_is_ok;
+    };
+
+  const std::vector<double> special_values =
+  {
+     0.0, -0.0, 0.5, -0.5, 1.5, -1.5, 2.5, -2.5, 0.75, -0.75,
+     0.49999999999999994, -0.49999999999999994,
+     4503599627370495.5, -4503599627370495.5, 9007199254740993.0,
+     1.0E19, -1.0E19, 1.0E300, -1.0E300,
+     std::numeric_limits<double>::denorm_min(), -std::numeric_limits<double>::denorm_min(),
+     std::numeric_limits<double>::min(),
+     std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()
+  };
+
+  for(const auto& d : special_values)
+  {
+    result_is_ok = (check_one(d) && result_is_ok);
+  }
+
+  {
+    // The quiet NaN propagates through all of the rounding functions.
+    const auto qnan = std::numeric_limits<float64_t>::quiet_NaN();
+
+    auto i_x = float64_t { };
+
+    const auto f_x = modf(qnan, &i_x);
+
+    result_is_ok = ((::math::softfloat::isnan)(floor    (qnan)) && result_is_ok);
+    result_is_ok = ((::math::softfloat::isnan)(ceil     (qnan)) && result_is_ok);
+    result_is_ok = ((::math::softfloat::isnan)(trunc    (qnan)) && result_is_ok);
+    result_is_ok = ((::math::softfloat::isnan)(round    (qnan)) && result_is_ok);
+    result_is_ok = ((::math::softfloat::isnan)(nearbyint(qnan)) && result_is_ok);
+    result_is_ok = ((::math::softfloat::isnan)(f_x)             && result_is_ok);
+    result_is_ok = ((::math::softfloat::isnan)(i_x)             && result_is_ok);
+  }
+
+  {
+    // Conversions to 64-bit integers are exact beyond 2^53.
+    const auto x_big = float64_t { bits_of(-4.0E18), ::math::softfloat::detail::nothing() }; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    result_is_ok = ((static_cast<std::int64_t> (x_big)  == static_cast<std::int64_t> (INT64_C(-4000000000000000000))) && result_is_ok);
+    result_is_ok = ((static_cast<std::uint64_t>(-x_big) == static_cast<std::uint64_t>(UINT64_C(4000000000000000000))) && result_is_ok);
+  }
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(200000));
+           ++i)
+  {
+    // Spread the exponent over [-8, 60) to cover both sides of 2^52,
+    // and alternate with exact ties.
+    const auto u_rnd  = eng_d15();
+    const auto u_expo = static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT16_C(1015)) + static_cast<std::uint64_t>(eng_d15() % static_cast<std::uint64_t>(UINT8_C(68))));
+
+    const auto u_x =
+      static_cast<std::uint64_t>
+      (
+          static_cast<std::uint64_t>(u_rnd & static_cast<std::uint64_t>(UINT64_C(0x800FFFFFFFFFFFFF)))
+        | static_cast<std::uint64_t>(u_expo << static_cast<unsigned>(UINT8_C(52)))
+      );
+
+    const auto d_x = ::math::softfloat::detail::uz_type<double>(u_x).get_f(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+    const auto d_tie = ((std::fabs(d_x) < 1.0E15) ? (std::floor(d_x) + 0.5) : d_x); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    result_is_ok = (check_one(d_x)   && result_is_ok);
+    result_is_ok = (check_one(d_tie) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+auto test_various_fmod_rem() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify fmod, remainder and remquo against the built-in double functions
+  // bit for bit. These are exact, also for huge quotients and subnormals.
+
+  using ::math::softfloat::float64_t;
+
+  const auto bits_of =
+    [](double d) -> std::uint64_t
+    {
+      return ::math::softfloat::detail::uz_type<double>(d).get_u(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    };
+
+  const auto is_same_value =
+    [&bits_of](float64_t x, double d) -> bool
+    {
+      return ((std::isnan(d)) ? (!(::math::softfloat::isfinite)(x)) : (x.crepresentation() == bits_of(d)));
+    };
+
+  const auto check_one =
+    [&bits_of, &is_same_value](double d_a, double d_b) -> bool
+    {
+      const auto a = float64_t { bits_of(d_a), ::math::softfloat::detail::nothing() };
+      const auto b = float64_t { bits_of(d_b), ::math::softfloat::detail::nothing() };
+
+      auto quo_x = int { };
+      auto quo_d = int { };
+
+      const auto r_x = remquo(a, b, &quo_x);
+      const auto r_d = std::remquo(d_a, d_b, &quo_d);
+
+      const auto result_rem_is_ok =
+      (
+           is_same_value(fmod     (a, b), std::fmod     (d_a, d_b))
+        && is_same_value(remainder(a, b), std::remainder(d_a, d_b))
+        && is_same_value(r_x, r_d)
+        && (std::isnan(r_d) || ((quo_x % 8) == (quo_d % 8))) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      );
+
+      return result_rem_is_ok;
+    };
+
+  const std::vector<double> special_values =
+  {
+     0.0, -0.0, 0.5, 1.0, -1.0, 1.5, 2.5, 3.0, -3.0, 7.0, 0.1,
+     6.283185307179586, 1.0E300, -1.0E300, 1.0E-300,
+     std::numeric_limits<double>::denorm_min(), -std::numeric_limits<double>::denorm_min(),
+     std::numeric_limits<double>::min(),
+     std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()
+  };
+
+  for(const auto& d_a : special_values)
+  {
+    for(const auto& d_b : special_values)
+    {
+      result_is_ok = (check_one(d_a, d_b) && result_is_ok);
+    }
+  }
+
+  {
+    const auto qnan = std::numeric_limits<float64_t>::quiet_NaN();
+
+    result_is_ok = ((::math::softfloat::isnan)(fmod     (qnan, float64_t(2)))  && result_is_ok);
+    result_is_ok = ((::math::softfloat::isnan)(remainder(float64_t(2), qnan))  && result_is_ok);
+  }
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(100000));
+           ++i)
+  {
+    // Mix wide exponent ranges with nearby operands, where the
+    // rounding of the quotient in remainder matters the most.
+    const auto u_expo_a = static_cast<std::uint64_t>(eng_d15() % static_cast<std::uint64_t>(UINT16_C(2047)));
+    const auto u_expo_b = static_cast<std::uint64_t>(eng_d15() % static_cast<std::uint64_t>(UINT16_C(2047)));
+
+    const auto u_a = static_cast<std::uint64_t>(static_cast<std::uint64_t>(eng_d15() & static_cast<std::uint64_t>(UINT64_C(0x800FFFFFFFFFFFFF))) | static_cast<std::uint64_t>(u_expo_a << static_cast<unsigned>(UINT8_C(52))));
+    const auto u_b = static_cast<std::uint64_t>(static_cast<std::uint64_t>(eng_d15() & static_cast<std::uint64_t>(UINT64_C(0x800FFFFFFFFFFFFF))) | static_cast<std::uint64_t>(u_expo_b << static_cast<unsigned>(UINT8_C(52))));
+
+    const auto d_a = ::math::softfloat::detail::uz_type<double>(u_a).get_f(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    const auto d_b = ::math::softfloat::detail::uz_type<double>(u_b).get_f(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+    const auto d_n = static_cast<double>(static_cast<std::uint32_t>(UINT8_C(1)) + static_cast<std::uint32_t>(eng_d15() % static_cast<std::uint64_t>(UINT8_C(9))));
+
+    result_is_ok = (check_one(d_a, d_b)       && result_is_ok);
+    result_is_ok = (check_one(d_a, d_a / d_n) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+auto test_various_soft_float() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify the generic soft_float formats. The binary32 results are compared
+  // bit for bit with built-in float. For binary16 and bfloat16, the operations
+  // are carried out in double (which is wide enough in both precision and
+  // range for a single correct rounding to the narrower format) and then
+  // rounded.
+
+  using ::math::softfloat::soft_float16;
+  using ::math::softfloat::soft_bfloat16;
+  using ::math::softfloat::soft_float32;
+
+  static_assert(std::numeric_limits<soft_float16>::digits        == 11, "Error: Wrong digits for soft_float16");
+  static_assert(std::numeric_limits<soft_bfloat16>::digits       ==  8, "Error: Wrong digits for soft_bfloat16");
+  static_assert(std::numeric_limits<soft_float32>::max_digits10  ==  9, "Error: Wrong max_digits10 for soft_float32");
+  static_assert(std::numeric_limits<soft_float32>::max_exponent10 == std::numeric_limits<float>::max_exponent10, "Error: Wrong max_exponent10 for soft_float32");
+
+  static_assert(sizeof(soft_float16::representation_type) == static_cast<std::size_t>(UINT8_C(2)), "Error: soft_float16 should be stored in 16 bits");
+  static_assert(sizeof(soft_float16::significand_type)    == static_cast<std::size_t>(UINT8_C(2)), "Error: soft_float16 should calculate in 16 bits");
+
+  result_is_ok = ((static_cast<double>(std::numeric_limits<soft_float16>::max())        == 65504.0)                                        && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((static_cast<float> (std::numeric_limits<soft_float32>::denorm_min()) == std::numeric_limits<float>::denorm_min())       && result_is_ok);
+  result_is_ok = ((static_cast<float> (std::numeric_limits<soft_float32>::epsilon())    == std::numeric_limits<float>::epsilon())          && result_is_ok);
+  result_is_ok = ((static_cast<float> (soft_float32(std::numeric_limits<float>::denorm_min() * 3.0F)) == (std::numeric_limits<float>::denorm_min() * 3.0F)) && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((soft_float16(65520) == std::numeric_limits<soft_float16>::infinity())                                                   && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  result_is_ok = ((soft_float32(-0.0) == soft_float32(0))                                                                                  && result_is_ok);
+  result_is_ok = (isnan(std::numeric_limits<soft_bfloat16>::infinity() - std::numeric_limits<soft_bfloat16>::infinity()) && result_is_ok);
+  result_is_ok = ((!(std::numeric_limits<soft_float16>::quiet_NaN() == std::numeric_limits<soft_float16>::quiet_NaN()))                    && result_is_ok);
+
+  const auto bits_of_float =
+    [](float f) -> std::uint32_t
+    {
+      return ::math::softfloat::detail::uz_type<float>(f).get_u(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    };
+
+  const auto float_of_bits =
+    [](std::uint32_t u) -> float
+    {
+      return ::math::softfloat::detail::uz_type<float>(u).get_f(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    };
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(200000));
+           ++i)
+  {
+    const auto u_rnd = eng_d15();
+
+    const auto u_a = static_cast<std::uint32_t>(u_rnd);
+    const auto u_b = static_cast<std::uint32_t>(u_rnd >> static_cast<unsigned>(UINT8_C(32)));
+
+    const auto f_a = float_of_bits(u_a);
+    const auto f_b = float_of_bits(u_b);
+
+    if(std::isnan(f_a) || std::isnan(f_b))
+    {
+      continue;
+    }
+
+    {
+      const auto x = soft_float32 { u_a, ::math::softfloat::detail::nothing() };
+      const auto y = soft_float32 { u_b, ::math::softfloat::detail::nothing() };
+
+      const auto f_s = std::sqrt(std::fabs(f_a));
+
+      result_is_ok = (((x + y).crepresentation()            == bits_of_float(f_a + f_b)) && result_is_ok);
+      result_is_ok = (((x - y).crepresentation()            == bits_of_float(f_a - f_b)) && result_is_ok);
+      result_is_ok = (((x * y).crepresentation()            == bits_of_float(f_a * f_b)) && result_is_ok);
+      result_is_ok = ((std::isnan(f_a / f_b) || ((x / y).crepresentation() == bits_of_float(f_a / f_b))) && result_is_ok);
+      result_is_ok = ((sqrt(fabs(x)).crepresentation()      == bits_of_float(f_s))       && result_is_ok);
+      result_is_ok = (((x < y) == (f_a < f_b))                                           && result_is_ok);
+      result_is_ok = ((static_cast<float>(x) == f_a)                                     && result_is_ok);
+    }
+
+    {
+      // Narrow the random operands to binary16 and bfloat16 first.
+      const auto h_a = soft_float16(f_a / 65536.0F); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      const auto h_b = soft_float16(f_b * 65536.0F); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+      const auto b_a = soft_bfloat16(f_a);
+      const auto b_b = soft_bfloat16(f_b);
+
+      const auto fh_a = static_cast<double>(h_a);
+      const auto fh_b = static_cast<double>(h_b);
+      const auto fb_a = static_cast<double>(b_a);
+      const auto fb_b = static_cast<double>(b_b);
+
+      const auto is_same_h = [](soft_float16  x, double f) { return (std::isnan(f) ? isnan(x) : (x.crepresentation() == soft_float16 (f).crepresentation())); };
+      const auto is_same_b = [](soft_bfloat16 x, double f) { return (std::isnan(f) ? isnan(x) : (x.crepresentation() == soft_bfloat16(f).crepresentation())); };
+
+      result_is_ok = (is_same_h(h_a + h_b, fh_a + fh_b)                         && result_is_ok);
+      result_is_ok = (is_same_h(h_a * h_b, fh_a * fh_b)                         && result_is_ok);
+      result_is_ok = (is_same_h(h_a / h_b, fh_a / fh_b)                         && result_is_ok);
+      result_is_ok = (is_same_h(sqrt(fabs(h_a)), std::sqrt(std::fabs(fh_a)))    && result_is_ok);
+      result_is_ok = (is_same_b(b_a - b_b, fb_a - fb_b)                         && result_is_ok);
+      result_is_ok = (is_same_b(b_a * b_b, fb_a * fb_b)                         && result_is_ok);
+      result_is_ok = (is_same_b(b_a / b_b, fb_a / fb_b)                         && result_is_ok);
+      result_is_ok = (is_same_b(sqrt(fabs(b_a)), std::sqrt(std::fabs(fb_a)))    && result_is_ok);
+    }
+  }
+
+  return result_is_ok;
+}
+
+auto test_various_soft_quad() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify the binary128 type soft_quad. Known bit patterns are checked
+  // for a few correctly rounded results. For random doubles, each operation
+  // carried out in soft_quad and rounded to double must agree with the
+  // native operation (since 113 >= 2 * 53 + 2, double rounding is harmless
+  // here). Exact products are compared with the error term from fma.
+
+  using ::math::softfloat::soft_quad;
+
+  const auto is_same_rep =
+    [](const soft_quad& x, std::uint64_t hi, std::uint64_t lo)
+    {
+      return ((x.crepresentation().v1 == hi) && (x.crepresentation().v0 == lo));
+    };
+
+  result_is_ok = (is_same_rep(soft_quad(1) / soft_quad(3),  static_cast<std::uint64_t>(UINT64_C(0x3FFD555555555555)), static_cast<std::uint64_t>(UINT64_C(0x5555555555555555))) && result_is_ok);
+  result_is_ok = (is_same_rep(soft_quad(1) / soft_quad(10), static_cast<std::uint64_t>(UINT64_C(0x3FFB999999999999)), static_cast<std::uint64_t>(UINT64_C(0x999999999999999A))) && result_is_ok);
+  result_is_ok = (is_same_rep(sqrt(soft_quad(2)),           static_cast<std::uint64_t>(UINT64_C(0x3FFF6A09E667F3BC)), static_cast<std::uint64_t>(UINT64_C(0xC908B2FB1366EA95))) && result_is_ok);
+
+  static_assert(std::numeric_limits<soft_quad>::digits == 113, "Error: Wrong digits for soft_quad");
+
+  constexpr auto q_third = soft_quad(1) / soft_quad(3);
+
+  static_assert((q_third * soft_quad(3)) == soft_quad(1), "Error: soft_quad is not constexpr-friendly");
+
+  {
+    const auto one = soft_quad(1);
+    const auto eps = std::numeric_limits<soft_quad>::epsilon();
+    const auto inf = std::numeric_limits<soft_quad>::infinity();
+    const auto zer = soft_quad(0);
+
+    result_is_ok = (((one + eps) > one)                                                            && result_is_ok);
+    result_is_ok = (((one + (eps / soft_quad(2))) == one)                                          && result_is_ok);
+    result_is_ok = (isinf(std::numeric_limits<soft_quad>::max() * soft_quad(2))                    && result_is_ok);
+    result_is_ok = (((std::numeric_limits<soft_quad>::denorm_min() / soft_quad(2)) == zer)         && result_is_ok);
+    result_is_ok = (((std::numeric_limits<soft_quad>::min() / soft_quad(4)) > zer)                 && result_is_ok);
+    result_is_ok = (isnan(inf - inf)                                                               && result_is_ok);
+    result_is_ok = (isnan(zer / zer)                                                               && result_is_ok);
+    result_is_ok = (isnan(sqrt(-one))                                                              && result_is_ok);
+    result_is_ok = ((!(std::numeric_limits<soft_quad>::quiet_NaN() == std::numeric_limits<soft_quad>::quiet_NaN())) && result_is_ok);
+    result_is_ok = ((signbit(-one / zer) && isinf(-one / zer))                                     && result_is_ok);
+    result_is_ok = ((soft_quad(-0.0) == zer)                                                       && result_is_ok);
+
+    // Integers up to 64 bits are exact.
+    const auto u_max = static_cast<std::uint64_t>(UINT64_C(0xFFFFFFFFFFFFFFFF));
+    const auto n_min = static_cast<std::int64_t>(INT64_MIN);
+    const auto n_odd = static_cast<std::int64_t>(INT64_C(-9007199254740993));
+
+    result_is_ok = ((static_cast<std::uint64_t>(soft_quad(u_max)) == u_max)                       && result_is_ok);
+    result_is_ok = ((static_cast<std::int64_t> (soft_quad(n_min)) == n_min)                       && result_is_ok);
+    result_is_ok = ((static_cast<std::int64_t> (soft_quad(n_odd)) == n_odd)                       && result_is_ok);
+    result_is_ok = ((static_cast<std::int64_t> (soft_quad(n_odd) / soft_quad(2)) == (n_odd / 2))  && result_is_ok);
+    result_is_ok = ((static_cast<std::int32_t> (inf) == static_cast<std::int32_t>(INT32_MAX))     && result_is_ok);
+  }
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  distribution64_type dist_frc(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT64_C(0x000FFFFFFFFFFFFF)));
+  distribution64_type dist_exp(static_cast<std::uint64_t>(UINT16_C(0x300)), static_cast<std::uint64_t>(UINT16_C(0x4FF)));
+  distribution64_type dist_neg(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT8_C(1)));
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(100000));
+           ++i)
+  {
+    const auto u_a = static_cast<std::uint64_t>(dist_frc(eng_d15) | static_cast<std::uint64_t>(dist_exp(eng_d15) << static_cast<unsigned>(UINT8_C(52))) | static_cast<std::uint64_t>(dist_neg(eng_d15) << static_cast<unsigned>(UINT8_C(63))));
+    const auto u_b = static_cast<std::uint64_t>(dist_frc(eng_d15) | static_cast<std::uint64_t>(dist_exp(eng_d15) << static_cast<unsigned>(UINT8_C(52))));
+
+    const auto d_a = ::math::softfloat::detail::uz_type<double>(u_a).get_f(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    const auto d_b = ::math::softfloat::detail::uz_type<double>(u_b).get_f(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+    const auto q_a = soft_quad(d_a);
+    const auto q_b = soft_quad(d_b);
+
+    const auto is_same_double =
+      [](const soft_quad& x, double d)
+      {
+        return (static_cast<::math::softfloat::soft_double>(x).crepresentation() == ::math::softfloat::detail::uz_type<double>(d).get_u()); // NOLINT(cppcoreguidelines-pro-type-union-access)
+      };
+
+    result_is_ok = (is_same_double(q_a,         d_a)            && result_is_ok);
+    result_is_ok = (is_same_double(q_a + q_b,   d_a + d_b)      && result_is_ok);
+    result_is_ok = (is_same_double(q_a - q_b,   d_a - d_b)      && result_is_ok);
+    result_is_ok = (is_same_double(q_a * q_b,   d_a * d_b)      && result_is_ok);
+    result_is_ok = (is_same_double(q_a / q_b,   d_a / d_b)      && result_is_ok);
+    result_is_ok = (is_same_double(sqrt(q_b),   std::sqrt(d_b)) && result_is_ok);
+    result_is_ok = (((q_a < q_b) == (d_a < d_b))                && result_is_ok);
+
+    // The product of two doubles is exact in soft_quad, and
+    // its low part is the error term of the rounded product.
+    const auto d_p = d_a * d_b;
+
+    result_is_ok = (is_same_double((q_a * q_b) - soft_quad(d_p), std::fma(d_a, d_b, -d_p)) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+auto test_various_double_double() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify the error-free transformations two_sum and two_prod bit-for-bit
+  // with the native ones, and the double-double type built on them. Its
+  // operands are exact products of random doubles, for which soft_quad
+  // provides references with more than 106 bits. The exponents are
+  // limited such that products of the operands stay in range.
+
+  using ::math::softfloat::soft_double;
+  using ::math::softfloat::soft_double_double;
+  using ::math::softfloat::soft_quad;
+
+  static_assert(std::numeric_limits<soft_double_double>::digits == 106, "Error: Wrong digits for soft_double_double");
+
+  static_assert((soft_double_double(2) * soft_double_double(3)) == soft_double_double(6), "Error: soft_double_double is not constexpr-friendly");
+  static_assert(sqrt(soft_double_double(16)) == soft_double_double(4), "Error: soft_double_double is not constexpr-friendly");
+
+  {
+    // Zeros and subnormals add exactly in soft_double.
+    const auto zer = soft_double(0);
+    const auto den = std::numeric_limits<soft_double>::denorm_min();
+
+    result_is_ok = (((zer + zer).crepresentation() == static_cast<std::uint64_t>(UINT8_C(0)))   && result_is_ok);
+    result_is_ok = (((den + den).crepresentation() == static_cast<std::uint64_t>(UINT8_C(2)))   && result_is_ok);
+
+    const auto one   = soft_double_double(1);
+    const auto third = one / soft_double_double(3);
+    const auto u_max = static_cast<std::uint64_t>(UINT64_C(0xFFFFFFFFFFFFFFFF));
+    const auto n_min = static_cast<std::int64_t>(INT64_MIN);
+
+    result_is_ok = ((abs((third * soft_double_double(3)) - one) <= std::numeric_limits<soft_double_double>::epsilon()) && result_is_ok);
+    result_is_ok = (((soft_quad(soft_double_double(u_max).hi()) + soft_quad(soft_double_double(u_max).lo())) == soft_quad(u_max)) && result_is_ok);
+    result_is_ok = (((soft_quad(soft_double_double(n_min).hi()) + soft_quad(soft_double_double(n_min).lo())) == soft_quad(n_min)) && result_is_ok);
+    result_is_ok = ((isinf(one / soft_double_double(0)) && (!signbit(one / soft_double_double(0))))                   && result_is_ok);
+    result_is_ok = (isnan(soft_double_double(0) / soft_double_double(0))                                             && result_is_ok);
+    result_is_ok = (isnan(sqrt(-one))                                                                                && result_is_ok);
+    result_is_ok = ((sqrt(soft_double_double(0)) == soft_double_double(0))                                           && result_is_ok);
+  }
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  distribution64_type dist_frc(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT64_C(0x000FFFFFFFFFFFFF)));
+  distribution64_type dist_exp(static_cast<std::uint64_t>(UINT16_C(0x380)), static_cast<std::uint64_t>(UINT16_C(0x47F)));
+  distribution64_type dist_neg(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT8_C(1)));
+  distribution64_type dist_dif(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT8_C(60)));
+
+  const auto make_random_double =
+    [&dist_frc, &dist_exp, &dist_neg]() -> double
+    {
+      const auto u =
+        static_cast<std::uint64_t>
+        (
+            dist_frc(eng_d15)
+          | static_cast<std::uint64_t>(dist_exp(eng_d15) << static_cast<unsigned>(UINT8_C(52)))
+          | static_cast<std::uint64_t>(dist_neg(eng_d15) << static_cast<unsigned>(UINT8_C(63)))
+        );
+
+      return ::math::softfloat::detail::uz_type<double>(u).get_f(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    };
+
+  const auto is_same_double =
+    [](const soft_double& x, double d)
+    {
+      return (x.crepresentation() == ::math::softfloat::detail::uz_type<double>(d).get_u()); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    };
+
+  const auto to_quad = [](const soft_double_double& x) { return soft_quad(x.hi()) + soft_quad(x.lo()); };
+
+  // The relative error bound is 2^-103, in other words 8 units of 2^-106.
+  const auto tol = std::numeric_limits<soft_quad>::epsilon() * soft_quad(512);
+
+  const auto is_close =
+    [&tol](const soft_quad& x, const soft_quad& ref)
+    {
+      return (fabs(x - ref) <= (fabs(ref) * tol));
+    };
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(50000));
+           ++i)
+  {
+    const auto d_a = make_random_double();
+    const auto d_b = make_random_double();
+
+    // Also sum operands that are close in magnitude and may cancel.
+    const auto d_c =
+      std::ldexp(d_a, -static_cast<int>(dist_dif(eng_d15))) * (((i % static_cast<std::uint32_t>(UINT8_C(2))) == static_cast<std::uint32_t>(UINT8_C(0))) ? -1.0 : 1.0);
+
+    {
+      const auto d_s  = d_a + d_c;
+      const auto d_bb = d_s - d_a;
+      const auto d_e  = (d_a - (d_s - d_bb)) + (d_c - d_bb);
+
+      auto e = soft_double { };
+
+      const auto s = two_sum(soft_double(d_a), soft_double(d_c), &e);
+
+      result_is_ok = ((is_same_double(s, d_s) && is_same_double(e, d_e)) && result_is_ok);
+    }
+
+    auto e_ab = soft_double { };
+    auto e_cb = soft_double { };
+
+    const auto p_ab = two_prod(soft_double(d_a), soft_double(d_b), &e_ab);
+    const auto p_cb = two_prod(soft_double(d_c), soft_double(d_b), &e_cb);
+
+    result_is_ok = ((is_same_double(p_ab, d_a * d_b) && is_same_double(e_ab, std::fma(d_a, d_b, -(d_a * d_b)))) && result_is_ok);
+
+    const auto x = soft_double_double(p_ab, e_ab);
+    const auto y = soft_double_double(p_cb, e_cb);
+
+    const auto q_x = soft_quad(d_a) * soft_quad(d_b);
+    const auto q_y = soft_quad(d_c) * soft_quad(d_b);
+
+    result_is_ok = ((to_quad(x) == q_x)                            && result_is_ok);
+    result_is_ok = (is_close(to_quad(x + y),     q_x + q_y)        && result_is_ok);
+    result_is_ok = (is_close(to_quad(x - y),     q_x - q_y)        && result_is_ok);
+    result_is_ok = (is_close(to_quad(x * y),     q_x * q_y)        && result_is_ok);
+    result_is_ok = (is_close(to_quad(x / y),     q_x / q_y)        && result_is_ok);
+    result_is_ok = (is_close(to_quad(sqrt(abs(x))), sqrt(fabs(q_x))) && result_is_ok);
+    result_is_ok = (((x < y) == (q_x < q_y))                       && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+auto test_various_rounding() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify the directed roundings of basic_soft_double. For each operation,
+  // the native result rounded to nearest and the sign of its exact error
+  // (from two_sum or a residual formed with the native fma) determine the
+  // results of the other rounding directions.
+
+  using ::math::softfloat::soft_double;
+  using ::math::softfloat::soft_double_downward;
+  using ::math::softfloat::soft_double_toward_zero;
+  using ::math::softfloat::soft_double_upward;
+
+  static_assert(std::numeric_limits<soft_double_upward>::round_style == std::round_toward_infinity, "Error: Wrong round_style for soft_double_upward");
+  static_assert(std::numeric_limits<soft_double_downward>::round_style == std::round_toward_neg_infinity, "Error: Wrong round_style for soft_double_downward");
+
+  static_assert(static_cast<soft_double>(soft_double_upward(1) / soft_double_upward(3)) > static_cast<soft_double>(soft_double_downward(1) / soft_double_downward(3)), "Error: basic_soft_double is not constexpr-friendly");
+
+  const auto is_same_double =
+    [](const soft_double& x, double d)
+    {
+      return (x.crepresentation() == ::math::softfloat::detail::uz_type<double>(d).get_u()); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    };
+
+  {
+    const auto d_max = (std::numeric_limits<double>::max)();
+    const auto d_inf = std::numeric_limits<double>::infinity();
+
+    // Overflow gives infinity or the largest finite value.
+    result_is_ok = (is_same_double(static_cast<soft_double>(soft_double_upward     ( d_max) * soft_double_upward     (2)),  d_inf) && result_is_ok);
+    result_is_ok = (is_same_double(static_cast<soft_double>(soft_double_upward     (-d_max) * soft_double_upward     (2)), -d_max) && result_is_ok);
+    result_is_ok = (is_same_double(static_cast<soft_double>(soft_double_downward   ( d_max) * soft_double_downward   (2)),  d_max) && result_is_ok);
+    result_is_ok = (is_same_double(static_cast<soft_double>(soft_double_downward   (-d_max) * soft_double_downward   (2)), -d_inf) && result_is_ok);
+    result_is_ok = (is_same_double(static_cast<soft_double>(soft_double_toward_zero(-d_max) * soft_double_toward_zero(2)), -d_max) && result_is_ok);
+
+    // An exact zero sum is negative only when rounding downward.
+    result_is_ok = (is_same_double(static_cast<soft_double>(soft_double_downward   (1) - soft_double_downward   (1)), -0.0) && result_is_ok);
+    result_is_ok = (is_same_double(static_cast<soft_double>(soft_double_upward     (1) - soft_double_upward     (1)),  0.0) && result_is_ok);
+    result_is_ok = (is_same_double(static_cast<soft_double>(soft_double_toward_zero(1) - soft_double_toward_zero(1)),  0.0) && result_is_ok);
+
+    // The smallest subnormal does not underflow to zero in its direction.
+    const auto tiny = soft_double_upward(std::numeric_limits<double>::denorm_min());
+
+    result_is_ok = (is_same_double(static_cast<soft_double>(tiny * tiny), std::numeric_limits<double>::denorm_min()) && result_is_ok);
+    result_is_ok = (is_same_double(static_cast<soft_double>(soft_double_downward(std::numeric_limits<double>::denorm_min()) / soft_double_downward(3)), 0.0) && result_is_ok);
+
+    // Special values.
+    result_is_ok = (isinf(soft_double_toward_zero(d_inf) * soft_double_toward_zero(2))                       && result_is_ok);
+    result_is_ok = (isinf(soft_double_downward(1) / soft_double_downward(0))                                 && result_is_ok);
+    result_is_ok = (isnan(soft_double_upward(d_inf) - soft_double_upward(d_inf))                             && result_is_ok);
+    result_is_ok = (isnan(sqrt(soft_double_upward(-1)))                                                      && result_is_ok);
+    result_is_ok = (isnan(fma(soft_double_upward(d_inf), soft_double_upward(0), soft_double_upward(1)))      && result_is_ok);
+
+    // Integers convert in both directions with the rounding of the policy.
+    const auto n_big = static_cast<std::int64_t>(INT64_C(9007199254740993));
+
+    result_is_ok = ((static_cast<std::int64_t>(soft_double_upward     (n_big)) == static_cast<std::int64_t>(INT64_C(9007199254740994))) && result_is_ok);
+    result_is_ok = ((static_cast<std::int64_t>(soft_double_downward   (n_big)) == static_cast<std::int64_t>(INT64_C(9007199254740992))) && result_is_ok);
+    result_is_ok = ((static_cast<std::int64_t>(soft_double_toward_zero(n_big)) == static_cast<std::int64_t>(INT64_C(9007199254740992))) && result_is_ok);
+
+    result_is_ok = ((static_cast<int>(soft_double_upward     (-2.5)) == static_cast<int>(INT8_C(-2))) && result_is_ok);
+    result_is_ok = ((static_cast<int>(soft_double_downward   (-2.5)) == static_cast<int>(INT8_C(-3))) && result_is_ok);
+    result_is_ok = ((static_cast<int>(soft_double_toward_zero(-2.5)) == static_cast<int>(INT8_C(-2))) && result_is_ok);
+    result_is_ok = ((static_cast<unsigned>(soft_double_upward(2.25)) == static_cast<unsigned>(UINT8_C(3))) && result_is_ok);
+  }
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  distribution64_type dist_frc(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT64_C(0x000FFFFFFFFFFFFF)));
+  distribution64_type dist_exp(static_cast<std::uint64_t>(UINT16_C(0x380)), static_cast<std::uint64_t>(UINT16_C(0x47F)));
+  distribution64_type dist_neg(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT8_C(1)));
+
+  const auto make_random_double =
+    [&dist_frc, &dist_exp, &dist_neg]() -> double
+    {
+      const auto u =
+        static_cast<std::uint64_t>
+        (
+            dist_frc(eng_d15)
+          | static_cast<std::uint64_t>(dist_exp(eng_d15) << static_cast<unsigned>(UINT8_C(52)))
+          | static_cast<std::uint64_t>(dist_neg(eng_d15) << static_cast<unsigned>(UINT8_C(63)))
+        );
+
+      return ::math::softfloat::detail::uz_type<double>(u).get_f(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    };
+
+  // Check the results of the three directed roundings, given the result z
+  // rounded to nearest and the sign of the exact value minus z.
+  const auto is_directed_ok =
+    [&is_same_double](const soft_double_upward& r_up, const soft_double_downward& r_dn, const soft_double_toward_zero& r_tz, double z, double err)
+    {
+      const auto z_up = ((err > 0.0) ? std::nextafter(z,  std::numeric_limits<double>::infinity()) : z);
+      const auto z_dn = ((err < 0.0) ? std::nextafter(z, -std::numeric_limits<double>::infinity()) : z);
+
+      return
+        (
+             is_same_double(static_cast<soft_double>(r_up), z_up)
+          && is_same_double(static_cast<soft_double>(r_dn), z_dn)
+          && is_same_double(static_cast<soft_double>(r_tz), ((z > 0.0) ? z_dn : z_up))
+        );
+    };
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(50000));
+           ++i)
+  {
+    const auto d_a = make_random_double();
+    const auto d_b = make_random_double();
+
+    const auto up_a = soft_double_upward     (d_a);
+    const auto dn_a = soft_double_downward   (d_a);
+    const auto tz_a = soft_double_toward_zero(d_a);
+    const auto up_b = soft_double_upward     (d_b);
+    const auto dn_b = soft_double_downward   (d_b);
+    const auto tz_b = soft_double_toward_zero(d_b);
+
+    // Also add operands that are close in magnitude, which may cancel.
+    const auto d_c  = std::ldexp(d_b, std::ilogb(d_a) - std::ilogb(d_b));
+    const auto d_s  = d_a + d_c;
+    const auto d_bb = d_s - d_a;
+    const auto d_e  = (d_a - (d_s - d_bb)) + (d_c - d_bb);
+
+    const auto d_p = d_a * d_b;
+    const auto d_q = d_a / d_b;
+    const auto d_r = std::sqrt(std::fabs(d_a));
+
+    result_is_ok = (is_directed_ok(up_a + soft_double_upward(d_c), dn_a + soft_double_downward(d_c), tz_a + soft_double_toward_zero(d_c), d_s, d_e) && result_is_ok);
+    result_is_ok = (is_directed_ok(up_a * up_b, dn_a * dn_b, tz_a * tz_b, d_p, std::fma(d_a, d_b, -d_p)) && result_is_ok);
+    result_is_ok = (is_directed_ok(up_a / up_b, dn_a / dn_b, tz_a / tz_b, d_q, std::fma(-d_q, d_b, d_a) * d_b) && result_is_ok);
+    result_is_ok = (is_directed_ok(sqrt(abs(up_a)), sqrt(abs(dn_a)), sqrt(abs(tz_a)), d_r, std::fma(-d_r, d_r, std::fabs(d_a))) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+auto test_various_interval() -> bool
+{
+  auto result_is_ok = true;
+
+  // Verify that the intervals enclose their exact results. The bounds
+  // of operations on points must be those of the directed roundings.
+  // The enclosures of exp and log are compared with the long double
+  // functions, and their widths are checked to be a few ulps.
+
+  using ::math::softfloat::soft_double;
+  using ::math::softfloat::soft_double_downward;
+  using ::math::softfloat::soft_double_upward;
+  using ::math::softfloat::soft_interval;
+
+  static_assert((soft_interval(1) / soft_interval(3)).lower() < (soft_interval(1) / soft_interval(3)).upper(), "Error: soft_interval is not constexpr-friendly");
+  static_assert(sqrt(soft_interval(16)) == soft_interval(4), "Error: soft_interval is not constexpr-friendly");
+
+  {
+    const auto d_inf = std::numeric_limits<double>::infinity();
+
+    const auto n_big = static_cast<std::int64_t>(INT64_C(9007199254740993));
+
+    result_is_ok = ((static_cast<std::int64_t>(soft_interval(n_big).lower()) == static_cast<std::int64_t>(INT64_C(9007199254740992))) && result_is_ok);
+    result_is_ok = ((static_cast<std::int64_t>(soft_interval(n_big).upper()) == static_cast<std::int64_t>(INT64_C(9007199254740994))) && result_is_ok);
+
+    result_is_ok = ((exp(soft_interval(0)) == soft_interval(1))                                                          && result_is_ok);
+    result_is_ok = ((log(soft_interval(1)) == soft_interval(0))                                                          && result_is_ok);
+    result_is_ok = ((exp(soft_interval(-d_inf)) == soft_interval(0))                                                     && result_is_ok);
+    result_is_ok = (isinf(log(soft_interval(0)).upper())                                                                 && result_is_ok);
+    result_is_ok = (isinf(exp(soft_interval(1000)).upper())                                                              && result_is_ok);
+    result_is_ok = ((exp(soft_interval(-1000)).upper() == std::numeric_limits<soft_double>::denorm_min())                && result_is_ok);
+    result_is_ok = ((sqrt(soft_interval(soft_double(-1), soft_double(4))) == soft_interval(soft_double(0), soft_double(2))) && result_is_ok);
+    result_is_ok = (isinf((soft_interval(1) / soft_interval(soft_double(-1), soft_double(1))).upper())                   && result_is_ok);
+    result_is_ok = (isinf(log(soft_interval(soft_double(0), soft_double(1))).lower())                                    && result_is_ok);
+    result_is_ok = (isnan(sqrt(soft_interval(soft_double(-2), soft_double(-1))))                                         && result_is_ok);
+    result_is_ok = (isnan(soft_interval(0) / soft_interval(0))                                                           && result_is_ok);
+    result_is_ok = ((width(soft_interval(1) / soft_interval(3)) == std::numeric_limits<soft_double>::epsilon() / 4)      && result_is_ok);
+  }
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  distribution64_type dist_frc(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT64_C(0x000FFFFFFFFFFFFF)));
+  distribution64_type dist_exp(static_cast<std::uint64_t>(UINT16_C(0x380)), static_cast<std::uint64_t>(UINT16_C(0x47F)));
+  distribution64_type dist_neg(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT8_C(1)));
+
+  const auto make_random_double =
+    [&dist_frc, &dist_exp, &dist_neg]() -> double
+    {
+      const auto u =
+        static_cast<std::uint64_t>
+        (
+            dist_frc(eng_d15)
+          | static_cast<std::uint64_t>(dist_exp(eng_d15) << static_cast<unsigned>(UINT8_C(52)))
+          | static_cast<std::uint64_t>(dist_neg(eng_d15) << static_cast<unsigned>(UINT8_C(63)))
+        );
+
+      return ::math::softfloat::detail::uz_type<double>(u).get_f(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    };
+
+  const auto is_directed_pair =
+    [](const soft_interval& x, const soft_double_downward& r_dn, const soft_double_upward& r_up)
+    {
+      return
+        (
+             (x.lower() == static_cast<soft_double>(r_dn))
+          && (x.upper() == static_cast<soft_double>(r_up))
+        );
+    };
+
+  // The number of ulps between the bounds of an interval whose bounds have the same sign.
+  const auto ulps_of =
+    [](const soft_interval& x)
+    {
+      return
+        ((x.lower() < soft_double(0))
+          ? static_cast<std::uint64_t>(x.lower().crepresentation() - x.upper().crepresentation())
+          : static_cast<std::uint64_t>(x.upper().crepresentation() - x.lower().crepresentation()));
+    };
+
+  // Check that the interval encloses the long double value v.
+  const auto encloses =
+    [](const soft_interval& x, long double v)
+    {
+      const auto tol = static_cast<long double>(std::fabs(v) * (std::numeric_limits<long double>::epsilon() * 4));
+
+      return
+        (
+             (static_cast<long double>(x.lower()) <= (v + tol))
+          && (static_cast<long double>(x.upper()) >= (v - tol))
+        );
+    };
+
+  std::uniform_real_distribution<double> dist_x(-745.0, 709.0);
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(20000));
+           ++i)
+  {
+    const auto d_a = make_random_double();
+    const auto d_b = make_random_double();
+
+    const auto x_a = soft_interval(d_a);
+    const auto x_b = soft_interval(d_b);
+
+    // Also add operands that are close in magnitude, which may cancel.
+    const auto d_c = std::ldexp(d_b, std::ilogb(d_a) - std::ilogb(d_b));
+
+    result_is_ok = (is_directed_pair(x_a + soft_interval(d_c), soft_double_downward(d_a) + soft_double_downward(d_c), soft_double_upward(d_a) + soft_double_upward(d_c)) && result_is_ok);
+    result_is_ok = (is_directed_pair(x_a - x_b, soft_double_downward(d_a) - soft_double_downward(d_b), soft_double_upward(d_a) - soft_double_upward(d_b)) && result_is_ok);
+    result_is_ok = (is_directed_pair(x_a * x_b, soft_double_downward(d_a) * soft_double_downward(d_b), soft_double_upward(d_a) * soft_double_upward(d_b)) && result_is_ok);
+    result_is_ok = (is_directed_pair(x_a / x_b, soft_double_downward(d_a) / soft_double_downward(d_b), soft_double_upward(d_a) / soft_double_upward(d_b)) && result_is_ok);
+    result_is_ok = (is_directed_pair(sqrt(soft_interval(std::fabs(d_a))), sqrt(soft_double_downward(std::fabs(d_a))), sqrt(soft_double_upward(std::fabs(d_a)))) && result_is_ok);
+
+    // Intervals having these bounds contain the rounded results on their points.
+    const auto d_a2 = d_a + std::fabs(d_c);
+    const auto d_b2 = d_b + std::fabs(d_a);
+
+    const auto x_ab = soft_interval(soft_double(d_a), soft_double(d_a2));
+    const auto x_bb = soft_interval(soft_double(d_b), soft_double(d_b2));
+
+    const auto x_p = x_ab * x_bb;
+    const auto x_q = x_ab / x_bb;
+
+    for(const auto& d_u : { d_a, d_a2 })
+    {
+      for(const auto& d_v : { d_b, d_b2 })
+      {
+        result_is_ok = (contains(x_p, soft_double(d_u) * soft_double(d_v)) && result_is_ok);
+        result_is_ok = ((contains(x_bb, soft_double(0)) || contains(x_q, soft_double(d_u) / soft_double(d_v))) && result_is_ok);
+      }
+    }
+
+    // The functions exp and log.
+    const auto d_x = dist_x(eng_d15);
+    const auto d_y = std::fabs(d_a);
+
+    const auto x_exp = exp(soft_interval(d_x));
+    const auto x_log = log(soft_interval(d_y));
+
+    result_is_ok = (encloses(x_exp, std::exp(static_cast<long double>(d_x))) && result_is_ok);
+    result_is_ok = (encloses(x_log, std::log(static_cast<long double>(d_y))) && result_is_ok);
+
+    result_is_ok = (((x_exp.lower() < (std::numeric_limits<soft_double>::min)()) || (ulps_of(x_exp) <= static_cast<std::uint64_t>(UINT8_C(16)))) && result_is_ok);
+    result_is_ok = ((contains(x_log, soft_double(0)) || (ulps_of(x_log) <= static_cast<std::uint64_t>(UINT8_C(16)))) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+constexpr auto to_chars_char_at(::math::softfloat::soft_double x, ::math::softfloat::chars_format fmt, int precision, std::size_t index) -> char
+{
+  char buf[static_cast<std::size_t>(UINT8_C(64))] { }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+  const auto res = to_chars(buf, buf + sizeof(buf), x, fmt, precision);
+
+  return ((res.ec == ::math::softfloat::chars_errc { }) ? buf[index] : '?'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+}
+
+auto test_various_to_chars() -> bool
+{
+  auto result_is_ok = true;
+
+  // The shortest representation must convert back to the same value and
+  // no representation having one digit less may do so. The formats with
+  // precision must agree with those of printf, which are exact.
+
+  using ::math::softfloat::chars_errc;
+  using ::math::softfloat::chars_format;
+  using ::math::softfloat::soft_double;
+
+  static_assert(to_chars_char_at(soft_double(1) / soft_double(3), chars_format::fixed,      30, static_cast<std::size_t>(UINT8_C(19))) == '4', "Error: to_chars is not constexpr-friendly");
+  static_assert(to_chars_char_at(soft_double(1) / soft_double(3), chars_format::scientific,  2, static_cast<std::size_t>(UINT8_C( 5))) == '-', "Error: to_chars is not constexpr-friendly");
+
+  const auto to_string =
+    [](soft_double x, chars_format fmt, int precision) -> std::string
+    {
+      std::vector<char> buf(static_cast<std::size_t>(static_cast<std::size_t>(precision) + static_cast<std::size_t>(UINT16_C(400))));
+
+      const auto res =
+        ((precision < 0) ? to_chars(buf.data(), buf.data() + buf.size(), x, fmt)
+                         : to_chars(buf.data(), buf.data() + buf.size(), x, fmt, precision));
+
+      return ((res.ec == chars_errc { }) ? std::string(buf.data(), res.ptr) : std::string("?"));
+    };
+
+  const auto to_string_plain =
+    [](soft_double x) -> std::string
+    {
+      std::array<char, static_cast<std::size_t>(UINT8_C(32))> buf { };
+
+      const auto res = to_chars(buf.data(), buf.data() + buf.size(), x);
+
+      return ((res.ec == chars_errc { }) ? std::string(buf.data(), res.ptr) : std::string("?"));
+    };
+
+  const auto to_string_printf =
+    [](double d, char conversion, int precision) -> std::string
+    {
+      std::vector<char> buf(static_cast<std::size_t>(static_cast<std::size_t>(precision) + static_cast<std::size_t>(UINT16_C(400))));
+
+      const char fmt[] = { '%', '.', '*', conversion, '\0' }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+      const auto len = std::snprintf(buf.data(), buf.size(), fmt, precision, d); // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+
+      return std::string(buf.data(), static_cast<std::size_t>(len));
+    };
+
+  {
+    const auto d_inf = std::numeric_limits<soft_double>::infinity();
+
+    result_is_ok = ((to_string_plain(soft_double(100000))                           == "1e+05")                   && result_is_ok);
+    result_is_ok = ((to_string_plain(soft_double(-123456))                          == "-123456")                 && result_is_ok);
+    result_is_ok = ((to_string_plain(soft_double(1) / soft_double(8))               == "0.125")                   && result_is_ok);
+    result_is_ok = ((to_string_plain(-soft_double(0))                               == "-0")                      && result_is_ok);
+    result_is_ok = ((to_string_plain(-d_inf)                                        == "-inf")                    && result_is_ok);
+    result_is_ok = ((to_string_plain(std::numeric_limits<soft_double>::denorm_min()) == "5e-324")                  && result_is_ok);
+    result_is_ok = ((to_string_plain((std::numeric_limits<soft_double>::max)())      == "1.7976931348623157e+308") && result_is_ok);
+    result_is_ok = ((to_string(soft_double(1234567), chars_format::general, -1)     == "1.234567e+06")            && result_is_ok);
+    result_is_ok = ((to_string(soft_double(123456), chars_format::general, -1)      == "123456")                  && result_is_ok);
+    result_is_ok = ((to_string(soft_double(1.0E23), chars_format::fixed, -1)        == "99999999999999991611392") && result_is_ok);
+    result_is_ok = ((to_string(soft_double(1.0E23), chars_format::scientific, -1)   == "1e+23")                   && result_is_ok);
+    result_is_ok = ((to_string(soft_double(100), chars_format::hex, -1)             == "1.9p+6")                  && result_is_ok);
+    result_is_ok = ((to_string(soft_double(100), chars_format::hex, 3)              == "1.900p+6")                && result_is_ok);
+    result_is_ok = ((to_string(soft_double(3) / soft_double(2), chars_format::hex, 0) == "2p+0")                  && result_is_ok);
+    result_is_ok = ((to_string(std::numeric_limits<soft_double>::denorm_min(), chars_format::hex, -1) == "0.0000000000001p-1022") && result_is_ok);
+    result_is_ok = ((to_string(soft_double(5) / soft_double(2), chars_format::fixed, 0) == "2")                   && result_is_ok);
+    result_is_ok = ((to_string(soft_double(0), chars_format::general, 3)            == "0")                       && result_is_ok);
+
+    std::array<char, static_cast<std::size_t>(UINT8_C(6))> buf { };
+
+    result_is_ok = ((to_chars(buf.data(), buf.data() + buf.size(), soft_double(123456)).ec  == chars_errc { })                 && result_is_ok);
+    result_is_ok = ((to_chars(buf.data(), buf.data() + buf.size(), soft_double(1000000)).ec == chars_errc { })                 && result_is_ok);
+    result_is_ok = ((to_chars(buf.data(), buf.data() + buf.size(), soft_double(1) / 3).ec   == chars_errc::value_too_large)    && result_is_ok);
+    result_is_ok = ((to_chars(buf.data(), buf.data() + buf.size(), soft_double(1), static_cast<chars_format>(UINT8_C(0))).ec == chars_errc::invalid_argument) && result_is_ok);
+  }
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  distribution64_type dist_bits(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT64_C(0x7FEFFFFFFFFFFFFF)));
+  distribution64_type dist_prec(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT8_C(24)));
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(20000));
+           ++i)
+  {
+    const auto u = dist_bits(eng_d15);
+    const auto d = ::math::softfloat::detail::uz_type<double>(u).get_f(); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    const auto x = soft_double(d);
+
+    // Shortest round trip.
+    const auto str_sci = to_string(x, chars_format::scientific, -1);
+
+    const auto digits = static_cast<int>(str_sci.find('e') - ((str_sci.find('.') == std::string::npos) ? 0U : 1U));
+
+    result_is_ok = ((std::strtod(str_sci.c_str(), nullptr) == d) && result_is_ok);
+    result_is_ok = ((std::strtod(to_string_plain(x).c_str(), nullptr) == d) && result_is_ok);
+    result_is_ok = (((digits == 1) || (std::strtod(to_string_printf(d, 'e', digits - 2).c_str(), nullptr) != d)) && result_is_ok);
+
+    // Exact digits with precision, for values of moderate size in fixed format.
+    const auto p = static_cast<int>(dist_prec(eng_d15));
+
+    const auto d_mod = std::ldexp(d, -std::ilogb(d) + static_cast<int>(std::ilogb(d) % 64));
+
+    result_is_ok = ((to_string(x, chars_format::scientific, p)          == to_string_printf(d,     'e', p)) && result_is_ok);
+    result_is_ok = ((to_string(x, chars_format::general,    p)          == to_string_printf(d,     'g', p)) && result_is_ok);
+    result_is_ok = ((to_string(soft_double(d_mod), chars_format::fixed, p) == to_string_printf(d_mod, 'f', p)) && result_is_ok);
+  }
+
+  {
+    // Stream output with various flags.
+    const auto x = soft_double(-1) / soft_double(3);
+
+    std::stringstream strm;
+
+    strm << std::showpos << std::uppercase << std::scientific << std::setprecision(3) << -x;
+
+    result_is_ok = ((strm.str() == "+3.333E-01") && result_is_ok);
+
+    strm.str(std::string());
+
+    strm << std::noshowpos << std::hexfloat << x;
+
+    result_is_ok = ((strm.str() == "-0X1.5555555555555P-2") && result_is_ok);
+
+    strm.str(std::string());
+
+    strm << std::defaultfloat << std::showpoint << std::setprecision(4) << std::setw(8) << std::setfill('*') << soft_double(2);
+
+    result_is_ok = ((strm.str() == "***2.000") && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+constexpr auto from_chars_bits(const char* str, std::size_t count, ::math::softfloat::chars_format fmt) -> std::uint64_t
+{
+  auto x = ::math::softfloat::soft_double(-1);
+
+  const auto res = from_chars(str, str + count, x, fmt);
+
+  return ((res.ec == ::math::softfloat::chars_errc { }) ? x.crepresentation() : static_cast<std::uint64_t>(UINT8_C(0xAA)));
+}
+
+auto test_various_from_chars() -> bool
+{
+  auto result_is_ok = true;
+
+  // The parsed values must be rounded to nearest, as are those of strtod.
+  // The shortest representations of to_chars must be read back exactly.
+
+  using ::math::softfloat::chars_errc;
+  using ::math::softfloat::chars_format;
+  using ::math::softfloat::soft_double;
+
+  static_assert(from_chars_bits("0.1",                     static_cast<std::size_t>(UINT8_C( 3)), chars_format::general) == static_cast<std::uint64_t>(UINT64_C(0x3FB999999999999A)), "Error: from_chars is not constexpr-friendly");
+  static_assert(from_chars_bits("9007199254740993",        static_cast<std::size_t>(UINT8_C(16)), chars_format::general) == static_cast<std::uint64_t>(UINT64_C(0x4340000000000000)), "Error: from_chars is not constexpr-friendly");
+  static_assert(from_chars_bits("2.4703282292062328e-324", static_cast<std::size_t>(UINT8_C(23)), chars_format::general) == static_cast<std::uint64_t>(UINT8_C(1)),                    "Error: from_chars is not constexpr-friendly");
+  static_assert(from_chars_bits("1.8p3",                   static_cast<std::size_t>(UINT8_C( 5)), chars_format::hex)     == static_cast<std::uint64_t>(UINT64_C(0x4028000000000000)), "Error: from_chars is not constexpr-friendly");
+
+  const auto parse =
+    [](const std::string& str, chars_format fmt, soft_double& x) -> std::ptrdiff_t
+    {
+      const auto res = from_chars(str.data(), str.data() + str.size(), x, fmt);
+
+      return ((res.ec == chars_errc { }) ? static_cast<std::ptrdiff_t>(res.ptr - str.data()) : static_cast<std::ptrdiff_t>(-1));
+    };
+
+  {
+    auto x = soft_double(0);
+
+    result_is_ok = ((parse("-12.5e-1x",    chars_format::general,    x) == 8) && (x == soft_double(-1.25)) && result_is_ok);
+    result_is_ok = ((parse("1e+",          chars_format::general,    x) == 1) && (x == soft_double(1))     && result_is_ok);
+    result_is_ok = ((parse("25e3",         chars_format::fixed,      x) == 2) && (x == soft_double(25))    && result_is_ok);
+    result_is_ok = ((parse("a.8p-2",       chars_format::hex,        x) == 6) && (x == soft_double(2.625)) && result_is_ok);
+    result_is_ok = ((parse("-Infinity",    chars_format::general,    x) == 9) && (::math::softfloat::isinf)(x) && (x < soft_double(0)) && result_is_ok);
+    result_is_ok = ((parse("nan(1_a)",     chars_format::general,    x) == 8) && (::math::softfloat::isnan)(x) && result_is_ok);
+    result_is_ok = ((parse("2.2250738585072011e-308", chars_format::general, x) > 0) && (x.crepresentation() == static_cast<std::uint64_t>(UINT64_C(0x000FFFFFFFFFFFFF))) && result_is_ok);
+    result_is_ok = ((parse("1.7976931348623158e308",  chars_format::general, x) > 0) && (x == (std::numeric_limits<soft_double>::max)()) && result_is_ok);
+    result_is_ok = ((parse("25",           chars_format::scientific, x) == -1) && result_is_ok);
+    result_is_ok = ((parse("+1",           chars_format::general,    x) == -1) && result_is_ok);
+    result_is_ok = ((parse(" 1",           chars_format::general,    x) == -1) && result_is_ok);
+    result_is_ok = ((parse(".e1",          chars_format::general,    x) == -1) && result_is_ok);
+
+    // Out of range, the value is not modified.
+    x = soft_double(25);
+
+    const auto str_big = std::string("-1.8e308");
+    const auto res_big = from_chars(str_big.data(), str_big.data() + str_big.size(), x);
+
+    result_is_ok = ((res_big.ec == chars_errc::result_out_of_range) && (res_big.ptr == str_big.data() + str_big.size()) && (x == soft_double(25)) && result_is_ok);
+
+    const auto str_tiny = std::string("1e-400");
+    const auto res_tiny = from_chars(str_tiny.data(), str_tiny.data() + str_tiny.size(), x);
+
+    result_is_ok = ((res_tiny.ec == chars_errc::result_out_of_range) && (x == soft_double(25)) && result_is_ok);
+
+    // The halfway point between 1 and its successor, with many digits.
+    const auto str_half = std::string("1.00000000000000011102230246251565404236316680908203125");
+
+    result_is_ok = ((parse(str_half,                 chars_format::general, x) > 0) && (x == soft_double(1))                                                     && result_is_ok);
+    result_is_ok = ((parse(str_half + "00000000001", chars_format::general, x) > 0) && (x.crepresentation() == static_cast<std::uint64_t>(UINT64_C(0x3FF0000000000001))) && result_is_ok);
+  }
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  distribution64_type dist_bits(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT64_C(0x7FEFFFFFFFFFFFFF)));
+  distribution64_type dist_digit(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT8_C(9)));
+  distribution64_type dist_count(static_cast<std::uint64_t>(UINT8_C(1)), static_cast<std::uint64_t>(UINT16_C(800)));
+  distribution64_type dist_exp  (static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT16_C(1200)));
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(20000));
+           ++i)
+  {
+    const auto u = dist_bits(eng_d15);
+
+    // The shortest and the general representation with a random precision.
+    std::array<char, static_cast<std::size_t>(UINT8_C(64))> buf { };
+
+    const auto res_short = to_chars(buf.data(), buf.data() + buf.size(), soft_double(::math::softfloat::detail::uz_type<double>(u).get_f())); // NOLINT(cppcoreguidelines-pro-type-union-access)
+
+    auto x = soft_double(0);
+
+    result_is_ok = ((from_chars(buf.data(), res_short.ptr, x).ptr == res_short.ptr) && (x.crepresentation() == u) && result_is_ok);
+
+    // Random digit strings, which may be close to the halfway points.
+    auto str = std::string(static_cast<std::size_t>(dist_count(eng_d15)), '0');
+
+    for(auto& c : str)
+    {
+      c = static_cast<char>('0' + static_cast<char>(dist_digit(eng_d15)));
+    }
+
+    str += 'e';
+    str += std::to_string(static_cast<int>(dist_exp(eng_d15)) - static_cast<int>(INT16_C(900)));
+
+    const auto d = std::strtod(str.c_str(), nullptr);
+
+    if((d != 0.0) && (d < (std::numeric_limits<double>::max)()))
+    {
+      result_is_ok = ((parse(str, chars_format::scientific, x) == static_cast<std::ptrdiff_t>(str.size())) && (x.crepresentation() == ::math::softfloat::detail::uz_type<double>(d).get_u()) && result_is_ok); // NOLINT(cppcoreguidelines-pro-type-union-access)
+    }
+  }
+
+  {
+    // Stream input, as done by std::num_get.
+    std::stringstream strm(" +12.5E-1 -.5x 1e999 abc");
+
+    auto x = soft_double(0);
+    auto y = soft_double(0);
+
+    strm >> x >> y;
+
+    result_is_ok = ((x == soft_double(1.25)) && (y == soft_double(-0.5)) && (!strm.fail()) && result_is_ok);
+
+    strm.ignore(1);
+
+    strm >> x;
+
+    result_is_ok = (strm.fail() && (x == (std::numeric_limits<soft_double>::max)()) && result_is_ok);
+
+    strm.clear();
+
+    strm >> x;
+
+    result_is_ok = (strm.fail() && (x == soft_double(0)) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+auto test_various_text_reader() -> bool
+{
+  auto result_is_ok = true;
+
+  // Text read in one piece, in chunks of a stream, from a file and
+  // with several threads must give the same values and errors.
+
+  using ::math::softfloat::chars_errc;
+  using ::math::softfloat::soft_double;
+
+  namespace text = ::math::softfloat::text;
+
+  const auto parse =
+    [](const std::string& str, std::vector<soft_double>& values, const text::read_options& options) -> text::read_result
+    {
+      return text::parse(str.data(), str.data() + str.size(), values, options);
+    };
+
+  {
+    std::vector<soft_double> values;
+
+    const auto res = parse("1.5, -2\r\n+3e2 4\n\n  1e-1\t,7", values, text::read_options { });
+
+    result_is_ok = ((res.ec == chars_errc { }) && (res.count == static_cast<std::size_t>(UINT8_C(6))) && (values.size() == static_cast<std::size_t>(UINT8_C(6))) && result_is_ok);
+
+    result_is_ok = ((values[0U] == soft_double(1.5)) && (values[1U] == soft_double(-2)) && (values[2U] == soft_double(300)) && (values[3U] == soft_double(4)) && (values[4U] == soft_double(0.1)) && (values[5U] == soft_double(7)) && result_is_ok);
+
+    // The hexadecimal prefix is not part of the format, so reading stops at 0x1p3.
+    const auto res_hex = parse("0x1p3", values, text::read_options { });
+
+    result_is_ok = ((res_hex.ec == chars_errc::invalid_argument) && (res_hex.line == static_cast<std::size_t>(UINT8_C(1))) && result_is_ok);
+  }
+
+  {
+    // The first error is reported with its line, and the values before it are kept.
+    struct bad_text_type { const char* str; std::size_t count; std::size_t line; chars_errc ec; };
+
+    const std::array<bad_text_type, static_cast<std::size_t>(UINT8_C(6))> bad_texts =
+    {{
+      { "1,2\n3,,4\n",    static_cast<std::size_t>(UINT8_C(3)), static_cast<std::size_t>(UINT8_C(2)), chars_errc::invalid_argument },
+      { "1,2\n3,4,\n5\n", static_cast<std::size_t>(UINT8_C(4)), static_cast<std::size_t>(UINT8_C(2)), chars_errc::invalid_argument },
+      { "1\n2\n3x\n",     static_cast<std::size_t>(UINT8_C(2)), static_cast<std::size_t>(UINT8_C(3)), chars_errc::invalid_argument },
+      { ",1\n",           static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(UINT8_C(1)), chars_errc::invalid_argument },
+      { "1 ; 2",           static_cast<std::size_t>(UINT8_C(1)), static_cast<std::size_t>(UINT8_C(1)), chars_errc::invalid_argument },
+      { "1\n2e999\n",     static_cast<std::size_t>(UINT8_C(1)), static_cast<std::size_t>(UINT8_C(2)), chars_errc::result_out_of_range }
+    }};
+
+    for(const auto& bad : bad_texts)
+    {
+      std::vector<soft_double> values;
+
+      const auto res = parse(bad.str, values, text::read_options { });
+
+      result_is_ok = ((res.ec == bad.ec) && (res.count == bad.count) && (values.size() == bad.count) && (res.line == bad.line) && result_is_ok);
+    }
+
+    std::vector<soft_double> values;
+
+    text::read_options options { };
+
+    options.delimiter = ';';
+
+    result_is_ok = ((parse("1 ; 2;3", values, options).count == static_cast<std::size_t>(UINT8_C(3))) && result_is_ok);
+  }
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  distribution64_type dist_bits(static_cast<std::uint64_t>(UINT8_C(0)), static_cast<std::uint64_t>(UINT64_C(0x7FEFFFFFFFFFFFFF)));
+
+  // Several columns of random values, enough to be split for several threads.
+  std::string str;
+
+  std::vector<std::uint64_t> bits;
+
+  for(auto   row = static_cast<std::uint32_t>(UINT8_C(0));
+             row < static_cast<std::uint32_t>(UINT32_C(20000));
+           ++row)
+  {
+    for(auto   col = static_cast<std::uint32_t>(UINT8_C(0));
+               col < static_cast<std::uint32_t>(UINT8_C(4));
+             ++col)
+    {
+      const auto u = static_cast<std::uint64_t>(dist_bits(eng_d15) | static_cast<std::uint64_t>(static_cast<std::uint64_t>(col & 1U) << 63U));
+
+      std::array<char, static_cast<std::size_t>(UINT8_C(64))> buf { };
+
+      const auto res = to_chars(buf.data(), buf.data() + buf.size(), soft_double(u, ::math::softfloat::detail::nothing()));
+
+      str += ((col == static_cast<std::uint32_t>(UINT8_C(0))) ? "" : ((row % 2U) == 0U) ? ", " : "\t");
+      str.append(buf.data(), res.ptr);
+
+      bits.push_back(u);
+    }
+
+    str += "\n";
+  }
+
+  const auto is_equal =
+    [&bits](const std::vector<soft_double>& values) -> bool
+    {
+      auto equal = (values.size() == bits.size());
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); (equal && (i < values.size())); ++i)
+      {
+        equal = (values[i].crepresentation() == bits[i]);
+      }
+
+      return equal;
+    };
+
+  {
+    for(auto   thread_count = static_cast<unsigned>(UINT8_C(0));
+               thread_count < static_cast<unsigned>(UINT8_C(5));
+             ++thread_count)
+    {
+      std::vector<soft_double> values;
+
+      text::read_options options { };
+
+      options.thread_count = thread_count;
+
+      const auto res = parse(str, values, options);
+
+      result_is_ok = ((res.ec == chars_errc { }) && (res.count == bits.size()) && is_equal(values) && result_is_ok);
+    }
+
+    // An error near the end is found on its line with several threads.
+    std::vector<soft_double> values;
+
+    text::read_options options { };
+
+    options.thread_count = static_cast<unsigned>(UINT8_C(4));
+
+    const auto res = parse(str + "1,2\n3 x\n", values, options);
+
+    result_is_ok = ((res.ec == chars_errc::invalid_argument) && (res.line == static_cast<std::size_t>(UINT32_C(20002))) && (res.count == static_cast<std::size_t>(bits.size() + 3U)) && result_is_ok);
+  }
+
+  {
+    // Small chunks of a stream, some of which are shorter than a line.
+    for(auto chunk_size : { static_cast<std::size_t>(UINT8_C(16)), static_cast<std::size_t>(UINT16_C(1000)), static_cast<std::size_t>(UINT32_C(0x400000)) })
+    {
+      std::stringstream strm(str + "5,x\n");
+
+      std::vector<soft_double> values;
+
+      text::read_options options { };
+
+      options.chunk_size = chunk_size;
+
+      const auto res = text::read(strm, values, options);
+
+      values.pop_back();
+
+      result_is_ok = ((res.ec == chars_errc::invalid_argument) && (res.line == static_cast<std::size_t>(UINT32_C(20001))) && is_equal(values) && result_is_ok);
+    }
+  }
+
+  {
+    const auto file_name = std::string("test_soft_double_text_reader.csv");
+
+    {
+      std::ofstream out(file_name, std::ios::out | std::ios::binary);
+
+      out << str;
+    }
+
+    std::vector<soft_double> values;
+
+    const auto res = text::read_file(file_name.c_str(), values);
+
+    static_cast<void>(std::remove(file_name.c_str()));
+
+    result_is_ok = ((res.ec == chars_errc { }) && is_equal(values) && result_is_ok);
+
+    const auto res_none = text::read_file(file_name.c_str(), values);
+
+    result_is_ok = ((res_none.ec == chars_errc::invalid_argument) && (res_none.line == static_cast<std::size_t>(UINT8_C(0))) && result_is_ok);
+
+    // A directory can be opened as a stream on some systems, but not read.
+    const auto res_dir = text::read_file(".", values);
+
+    result_is_ok = ((res_dir.ec == chars_errc::invalid_argument) && (res_dir.count == static_cast<std::size_t>(UINT8_C(0))) && result_is_ok);
+  }
+
+  #if (defined(__unix__) || defined(__APPLE__))
+  {
+    // A FIFO reports a size of zero. It is not mapped, but read as a stream.
+    const auto fifo_name = std::string("test_soft_double_text_reader.fifo");
+
+    if(::mkfifo(fifo_name.c_str(), static_cast<mode_t>(UINT16_C(0600))) == 0) // NOLINT(hicpp-signed-bitwise)
+    {
+      std::thread writer
+      (
+        [&fifo_name, &str]()
+        {
+          std::ofstream out(fifo_name, std::ios::out | std::ios::binary);
+
+          out << str;
+        }
+      );
+
+      std::vector<soft_double> values;
+
+      const auto res = text::read_file(fifo_name.c_str(), values);
+
+      writer.join();
+
+      static_cast<void>(std::remove(fifo_name.c_str()));
+
+      result_is_ok = ((res.ec == chars_errc { }) && is_equal(values) && result_is_ok);
+    }
+    else
+    {
+      result_is_ok = false;
+    }
+  }
+  #endif
+
+  return result_is_ok;
+}
+
+auto test_various_binary() -> bool
+{
+  auto result_is_ok = true;
+
+  // Values written to the binary container must be read back bit for
+  // bit, from a stream, a file or in place from the mapped file.
+
+  using ::math::softfloat::soft_double;
+
+  namespace binary = ::math::softfloat::binary;
+
+  static_assert(std::is_trivially_copyable<soft_double>::value, "Error: soft_double must be trivially copyable");
+  static_assert(std::is_standard_layout   <soft_double>::value, "Error: soft_double must be standard-layout");
+
+  eng_d15.seed(::util::util_pseudorandom_time_point_seed::value<typename eng_d15_type::result_type>());
+
+  std::vector<soft_double> values;
+
+  for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
+             i < static_cast<std::uint32_t>(UINT32_C(10000));
+           ++i)
+  {
+    values.emplace_back(static_cast<std::uint64_t>(eng_d15()), ::math::softfloat::detail::nothing());
+  }
+
+  values.push_back((std::numeric_limits<soft_double>::quiet_NaN)());
+  values.push_back(-(std::numeric_limits<soft_double>::infinity)());
+  values.push_back(-soft_double(0));
+
+  const auto is_equal =
+    [&values](const soft_double* p, std::size_t count) -> bool
+    {
+      auto equal = (count == values.size());
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); (equal && (i < count)); ++i)
+      {
+        equal = (p[i].crepresentation() == values[i].crepresentation()); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      return equal;
+    };
+
+  {
+    // Two containers in one stream, with and without a checksum.
+    std::stringstream strm;
+
+    result_is_ok = ((binary::write(strm, values)        == binary::errc::ok) && result_is_ok);
+    result_is_ok = ((binary::write(strm, values, false) == binary::errc::ok) && result_is_ok);
+
+    const auto str = strm.str();
+
+    result_is_ok = ((str.size() == static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(2)) * static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(24)) + static_cast<std::size_t>(values.size() * 8U)))) && result_is_ok);
+
+    // The header and the values are little-endian on every host.
+    result_is_ok = ((str.compare(0U, 4U, "SDBL") == 0) && (str[8U] == static_cast<char>(values.size() & 0xFFU)) && (str[9U] == static_cast<char>(values.size() >> 8U)) && result_is_ok);
+    result_is_ok = ((str[24U] == static_cast<char>(values.front().crepresentation() & 0xFFU)) && (str[31U] == static_cast<char>(values.front().crepresentation() >> 56U)) && result_is_ok);
+
+    std::vector<soft_double> first;
+    std::vector<soft_double> second;
+
+    result_is_ok = ((binary::read(strm, first)  == binary::errc::ok) && is_equal(first.data(),  first.size())  && result_is_ok);
+    result_is_ok = ((binary::read(strm, second) == binary::errc::ok) && is_equal(second.data(), second.size()) && result_is_ok);
+    result_is_ok = ((binary::read(strm, second) == binary::errc::truncated) && result_is_ok);
+
+    // A flipped bit is found by the checksum, and a short container is truncated.
+    auto str_flip = str;
+
+    str_flip[1000U] = static_cast<char>(str_flip[1000U] ^ static_cast<char>(INT8_C(0x10)));
+
+    std::stringstream strm_flip(str_flip);
+    std::stringstream strm_short(str.substr(0U, 1000U));
+    std::stringstream strm_magic("SDBX" + str.substr(4U));
+
+    std::vector<soft_double> dummy;
+
+    result_is_ok = ((binary::read(strm_flip,  dummy) == binary::errc::checksum_mismatch) && result_is_ok);
+    result_is_ok = ((binary::read(strm_short, dummy) == binary::errc::truncated)         && result_is_ok);
+    result_is_ok = ((binary::read(strm_magic, dummy) == binary::errc::invalid_header)    && result_is_ok);
+  }
+
+  {
+    const auto file_name = std::string("test_soft_double_binary.sdbl");
+
+    result_is_ok = ((binary::write_file(file_name.c_str(), values) == binary::errc::ok) && result_is_ok);
+
+    std::vector<soft_double> copied;
+
+    result_is_ok = ((binary::read_file(file_name.c_str(), copied) == binary::errc::ok) && is_equal(copied.data(), copied.size()) && result_is_ok);
+
+    {
+      const binary::mapped_array mapped(file_name.c_str());
+
+      #if (UTIL_MEMORY_MAPPED_FILE_IS_AVAILABLE == 1)
+      const auto little_endian = (binary::detail::host_is_little_endian());
+
+      result_is_ok = ((little_endian ? mapped.is_open() : (mapped.error() == binary::errc::byte_order)) && result_is_ok);
+      #endif
+
+      if(mapped.is_open())
+      {
+        const auto view = mapped.values();
+
+        result_is_ok = (is_equal(view.data(), view.size()) && (mapped[1U] == values[1U]) && result_is_ok);
+      }
+    }
+
+    // A file cut short is neither mapped nor read.
+    {
+      std::stringstream strm;
+
+      static_cast<void>(binary::write(strm, values));
+
+      const auto str = strm.str();
+
+      std::ofstream out(file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+
+      static_cast<void>(out.write(str.data(), static_cast<std::streamsize>(INT16_C(1000))));
+    }
+
+    {
+      const binary::mapped_array mapped_short(file_name.c_str());
+
+      #if (UTIL_MEMORY_MAPPED_FILE_IS_AVAILABLE == 1)
+      result_is_ok = ((mapped_short.error() == binary::errc::truncated) && (mapped_short.size() == static_cast<std::size_t>(UINT8_C(0))) && result_is_ok);
+      #endif
+
+      result_is_ok = ((binary::read_file(file_name.c_str(), copied) == binary::errc::truncated) && result_is_ok);
+    }
+
+    static_cast<void>(std::remove(file_name.c_str()));
+
+    const binary::mapped_array mapped_none(file_name.c_str());
+
+    result_is_ok = ((mapped_none.error() == binary::errc::io_error) && (mapped_none.size() == static_cast<std::size_t>(UINT8_C(0))) && result_is_ok);
+
+    result_is_ok = ((binary::read_file(file_name.c_str(), copied) == binary::errc::io_error) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+auto test_various_literals() -> bool
+{
+  auto result_is_ok = true;
+
+  // The literals are parsed at compile time in every language standard,
+  // and their results are those of from_chars and the native literals.
+
+  using ::math::softfloat::soft_double;
+
+  using namespace ::math::softfloat::literals; // NOLINT(google-build-using-namespace)
+
+  static_assert((1.5_sd).crepresentation()          == static_cast<std::uint64_t>(UINT64_C(0x3FF8000000000000)), "Error: The literal is not constexpr-friendly");
+  static_assert((0.1_sd).crepresentation()          == static_cast<std::uint64_t>(UINT64_C(0x3FB999999999999A)), "Error: The literal is not constexpr-friendly");
+  static_assert((6.674e-11_sd).crepresentation()    == static_cast<std::uint64_t>(UINT64_C(0x3DD25868F4DEAE16)), "Error: The literal is not constexpr-friendly");
+  static_assert((-2.5_sd).crepresentation()         == static_cast<std::uint64_t>(UINT64_C(0xC004000000000000)), "Error: The literal is not constexpr-friendly");
+  static_assert((1'000.25_sd).crepresentation()     == static_cast<std::uint64_t>(UINT64_C(0x408F420000000000)), "Error: The literal is not constexpr-friendly");
+  static_assert((25_sd).crepresentation()           == static_cast<std::uint64_t>(UINT64_C(0x4039000000000000)), "Error: The literal is not constexpr-friendly");
+  static_assert((031_sd).crepresentation()          == static_cast<std::uint64_t>(UINT64_C(0x4039000000000000)), "Error: The literal is not constexpr-friendly");
+  static_assert((0x19_sd).crepresentation()         == static_cast<std::uint64_t>(UINT64_C(0x4039000000000000)), "Error: The literal is not constexpr-friendly");
+  static_assert((0b11001_sd).crepresentation()      == static_cast<std::uint64_t>(UINT64_C(0x4039000000000000)), "Error: The literal is not constexpr-friendly");
+  static_assert((09.5_sd).crepresentation()         == static_cast<std::uint64_t>(UINT64_C(0x4023000000000000)), "Error: The literal is not constexpr-friendly");
+  static_assert((0_sd).crepresentation()            == static_cast<std::uint64_t>(UINT8_C(0)),                    "Error: The literal is not constexpr-friendly");
+  static_assert((4.9e-324_sd).crepresentation()     == static_cast<std::uint64_t>(UINT8_C(1)),                    "Error: The literal is not constexpr-friendly");
+  static_assert((1e999_sd).crepresentation()        == static_cast<std::uint64_t>(UINT64_C(0x7FF0000000000000)), "Error: The literal is not constexpr-friendly");
+  static_assert((1e-999_sd).crepresentation()       == static_cast<std::uint64_t>(UINT8_C(0)),                    "Error: The literal is not constexpr-friendly");
+
+  // Integers beyond 2^53 are rounded to nearest, with ties to even.
+  static_assert((9007199254740993_sd).crepresentation() == static_cast<std::uint64_t>(UINT64_C(0x4340000000000000)), "Error: The literal is not correctly rounded");
+  static_assert((9007199254740995_sd).crepresentation() == static_cast<std::uint64_t>(UINT64_C(0x4340000000000002)), "Error: The literal is not correctly rounded");
+  static_assert((0b10000000000000000000000000000000000000000000000000000100000000001_sd).crepresentation() == static_cast<std::uint64_t>(UINT64_C(0x43F0000000000001)), "Error: The literal is not correctly rounded");
+
+  #if (__cplusplus >= 201703L)
+  static_assert((0x1.8p3_sd).crepresentation()      == static_cast<std::uint64_t>(UINT64_C(0x4028000000000000)), "Error: The literal is not constexpr-friendly");
+  #endif
+
+  // A table of constants, which needs no initialization at run time.
+  constexpr std::array<soft_double, static_cast<std::size_t>(UINT8_C(4))> table =
+  {{
+    1.0_sd, 0.5_sd, 0.16666666666666666_sd, 0.041666666666666664_sd
+  }};
+
+  static_assert(table[2U] < table[1U], "Error: The literal is not constexpr-friendly");
+
+  result_is_ok = ((table[3U] == soft_double(1.0 / 24.0)) && result_is_ok);
+
+  result_is_ok = ((1.2345e-6_sd == soft_double(1.2345e-6)) && result_is_ok);
+  result_is_ok = ((2.2250738585072014e-308_sd == (std::numeric_limits<soft_double>::min)()) && result_is_ok);
+  result_is_ok = ((1.7976931348623157e308_sd == (std::numeric_limits<soft_double>::max)()) && result_is_ok);
+  result_is_ok = ((1.00000000000000011102230246251565404236316680908203125_sd == soft_double(1)) && result_is_ok);
+  result_is_ok = ((1.00000000000000011102230246251565404236316680908203126_sd > soft_double(1)) && result_is_ok);
+
+  return result_is_ok;
+}
+
 } // namespace test_soft_double_edge
 
 auto test_soft_double_edge_cases() -> bool
@@ -290,6 +2831,30 @@ auto test_soft_double_edge_cases() -> bool
   result_edge_cases_is_ok = (test_soft_double_edge::test_various_ostream_ops() && result_edge_cases_is_ok);
   result_edge_cases_is_ok = (test_soft_double_edge::test_various_pos_powers () && result_edge_cases_is_ok);
   result_edge_cases_is_ok = (test_soft_double_edge::test_various_64_bit_cast() && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_mul64To128 () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_div_kernel  () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_clz         () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_fma         () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_batch       () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_packed      () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_exp         () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_log         () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_trig        () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_pow         () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_expm1_log1p() && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_atan2_cbrt () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_round_to_int() && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_fmod_rem   () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_soft_float () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_soft_quad  () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_double_double() && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_rounding   () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_interval   () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_to_chars   () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_from_chars () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_text_reader() && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_binary     () && result_edge_cases_is_ok);
+  result_edge_cases_is_ok = (test_soft_double_edge::test_various_literals   () && result_edge_cases_is_ok);
 
   return result_edge_cases_is_ok;
 }
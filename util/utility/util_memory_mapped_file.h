@@ -0,0 +1,164 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2025.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UTIL_MEMORY_MAPPED_FILE_2025_08_03_H // NOLINT(llvm-header-guard)
+  #define UTIL_MEMORY_MAPPED_FILE_2025_08_03_H
+
+  #include <cstddef>
+  #include <cstdint>
+
+  #include <util/utility/util_noncopyable.h>
+
+  // A read-only view of a whole file mapped into memory, with POSIX
+  // mmap or the file mappings of Windows. On other systems, or if the
+  // file can not be mapped, is_open() is false and the caller is
+  // expected to read the file in the usual way.
+
+  #if defined(_WIN32)
+    #if !defined(WIN32_LEAN_AND_MEAN)
+    #define WIN32_LEAN_AND_MEAN
+    #endif
+    #if !defined(NOMINMAX)
+    #define NOMINMAX
+    #endif
+    #include <windows.h>
+    #define UTIL_MEMORY_MAPPED_FILE_IS_AVAILABLE 1 // NOLINT(cppcoreguidelines-macro-usage)
+  #elif (defined(__unix__) || defined(__APPLE__))
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define UTIL_MEMORY_MAPPED_FILE_IS_AVAILABLE 1 // NOLINT(cppcoreguidelines-macro-usage)
+  #else
+    #define UTIL_MEMORY_MAPPED_FILE_IS_AVAILABLE 0 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  namespace util {
+
+  class memory_mapped_file : private noncopyable
+  {
+  public:
+    explicit memory_mapped_file(const char* path)
+    {
+      #if defined(_WIN32)
+      my_file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+      auto file_size = LARGE_INTEGER { };
+
+      // Only disk files are mapped, whereas pipes and devices are left
+      // to be read in the usual way.
+      if(   (my_file != INVALID_HANDLE_VALUE)
+         && (::GetFileType(my_file) == FILE_TYPE_DISK)
+         && (::GetFileSizeEx(my_file, &file_size) != FALSE))
+      {
+        my_size = static_cast<std::size_t>(file_size.QuadPart);
+
+        // An empty file can not be mapped, but is open all the same.
+        my_is_open = (my_size == static_cast<std::size_t>(UINT8_C(0)));
+
+        if(!my_is_open)
+        {
+          my_mapping = ::CreateFileMappingA(my_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+          if(my_mapping != nullptr)
+          {
+            my_data = static_cast<const char*>(::MapViewOfFile(my_mapping, FILE_MAP_READ, 0, 0, 0));
+
+            my_is_open = (my_data != nullptr);
+          }
+        }
+      }
+      #elif (UTIL_MEMORY_MAPPED_FILE_IS_AVAILABLE == 1)
+      struct stat file_status { };
+
+      // Only regular files are mapped. Pipes, FIFOs and files such as those
+      // in /proc report a size of zero, and are left to be read in the usual
+      // way. They are not even opened here, since opening a FIFO waits for
+      // its writer.
+      if((::stat(path, &file_status) == 0) && S_ISREG(file_status.st_mode)) // NOLINT(hicpp-signed-bitwise)
+      {
+        my_file = ::open(path, O_RDONLY); // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+      }
+
+      if((my_file != -1) && (::fstat(my_file, &file_status) == 0) && S_ISREG(file_status.st_mode)) // NOLINT(hicpp-signed-bitwise)
+      {
+        my_size = static_cast<std::size_t>(file_status.st_size);
+
+        // An empty file can not be mapped, but is open all the same.
+        my_is_open = (my_size == static_cast<std::size_t>(UINT8_C(0)));
+
+        if(!my_is_open)
+        {
+          void* p = ::mmap(nullptr, my_size, PROT_READ, MAP_PRIVATE, my_file, 0);
+
+          if(p != MAP_FAILED) // NOLINT(cppcoreguidelines-pro-type-cstyle-cast,performance-no-int-to-ptr)
+          {
+            // The pages are read once from the beginning to the end.
+            static_cast<void>(::madvise(p, my_size, MADV_SEQUENTIAL));
+
+            my_data    = static_cast<const char*>(p);
+            my_is_open = true;
+          }
+        }
+      }
+      #else
+      static_cast<void>(path);
+      #endif
+
+      if(!my_is_open)
+      {
+        close();
+      }
+    }
+
+    ~memory_mapped_file() { close(); }
+
+    auto is_open() const noexcept -> bool { return my_is_open; }
+
+    auto data() const noexcept -> const char* { return my_data; }
+    auto size() const noexcept -> std::size_t { return my_size; }
+
+    auto begin() const noexcept -> const char* { return my_data; }
+    auto end  () const noexcept -> const char* { return my_data + my_size; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  private:
+    const char* my_data    { nullptr };
+    std::size_t my_size    { };
+    bool        my_is_open { false };
+
+    #if defined(_WIN32)
+    HANDLE      my_file    { INVALID_HANDLE_VALUE };
+    HANDLE      my_mapping { nullptr };
+    #elif (UTIL_MEMORY_MAPPED_FILE_IS_AVAILABLE == 1)
+    int         my_file    { -1 };
+    #endif
+
+    auto close() noexcept -> void
+    {
+      #if defined(_WIN32)
+      if(my_data    != nullptr)              { static_cast<void>(::UnmapViewOfFile(my_data)); }
+      if(my_mapping != nullptr)              { static_cast<void>(::CloseHandle(my_mapping)); }
+      if(my_file    != INVALID_HANDLE_VALUE) { static_cast<void>(::CloseHandle(my_file)); }
+
+      my_mapping = nullptr;
+      my_file    = INVALID_HANDLE_VALUE;
+      #elif (UTIL_MEMORY_MAPPED_FILE_IS_AVAILABLE == 1)
+      if(my_data != nullptr) { static_cast<void>(::munmap(const_cast<char*>(my_data), my_size)); } // NOLINT(cppcoreguidelines-pro-type-const-cast)
+      if(my_file != -1)      { static_cast<void>(::close(my_file)); }
+
+      my_file = -1;
+      #endif
+
+      my_data    = nullptr;
+      my_size    = static_cast<std::size_t>(UINT8_C(0));
+      my_is_open = false;
+    }
+  };
+
+  } // namespace util
+
+#endif // UTIL_MEMORY_MAPPED_FILE_2025_08_03_H